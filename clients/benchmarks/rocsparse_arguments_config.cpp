@@ -48,6 +48,7 @@ rocsparse_arguments_config::rocsparse_arguments_config()
         this->uu             = static_cast<rocsparse_int>(0);
         this->index_type_I   = static_cast<rocsparse_indextype>(0);
         this->index_type_J   = static_cast<rocsparse_indextype>(0);
+        this->a_type         = static_cast<rocsparse_datatype>(0);
         this->compute_type   = static_cast<rocsparse_datatype>(0);
         this->alpha          = static_cast<double>(0);
         this->alphai         = static_cast<double>(0);
@@ -131,7 +132,7 @@ void rocsparse_arguments_config::set_description(options_description& desc)
 
     ("sizek,k",
      value<rocsparse_int>(&this->K)->default_value(128),
-     "Specific matrix/vector size testing: SPARSE-3: the number of columns")
+     "Specific matrix/vector size testing: SPARSE-3: the number of columns. csriluk: the level of fill. csrmc: the number of Gauss-Seidel sweeps")
 
     ("sizennz,z",
      value<rocsparse_int>(&this->nnz)->default_value(32),
@@ -256,7 +257,7 @@ void rocsparse_arguments_config::set_description(options_description& desc)
     ("hybpart",
      value<int>(&this->b_part)->default_value(0),
      "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
-     "2 = rocsparse_hyb_partition_max, (default: 0)")
+     "2 = rocsparse_hyb_partition_max, 3 = rocsparse_hyb_partition_cost, (default: 0)")
 
     ("hybellwidth",
      value<uint32_t>(&this->algo)->default_value(0),
@@ -287,16 +288,16 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      value<std::string>(&this->function_name)->default_value("axpyi"),
      "SPARSE function to test. Options:\n"
      "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-     "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, csritsv, coosv, ellmv, hybmv, gebsrmv, gemvi\n"
-     "  Level3: bsrmm, bsrsm, gebsrmm, csrmm, csrmm_batched, coomm, coomm_batched, cscmm, cscmm_batched, csrsm, coosm, gemmi, sddmm\n"
+     "  Level2: bellmv, bsrmv, bsrxmv, bsrsv, spsv_bsr, coomv, coomv_aos, coomv_batched, csrmv, csrmv_batched, csrmv_managed, csrmv_rowblocks, csrsv, csritsv, coosv, ellmv, hybmv, gebsrmv, gemvi\n"
+     "  Level3: bsrmm, spmm_bsr, bsrsm, spsm_bsr, gebsrmm, csrmm, csrmm_batched, coomm, coomm_batched, cscmm, cscmm_batched, ellmm, ellmm_batched, csrsm, coosm, gemmi, sddmm\n"
      "  Extra: bsrgeam, bsrgemm, csrgeam, csrgemm, csrgemm_reuse\n"
-     "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, csritilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
+     "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, csriluk, csrmc, csritilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
      "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
      "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
      "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
      "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
      "  Sorting: cscsort, csrsort, coosort\n"
-     "  Misc: identity, inverse_permutation, nnz\n"
+     "  Misc: analysis_cache, identity, import_matrixmarket, inverse_permutation, mat_info_export, memory_pool, nnz\n"
      "  Util: check_matrix_csr, check_matrix_csc, check_matrix_coo, check_matrix_gebsr, check_matrix_gebsc, check_matrix_ell, check_matrix_hyb")
 
     ("indextype",
@@ -304,7 +305,8 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      "Specify index types to be int32_t (s), int64_t (d) or mixed (m). Options: s,d,m")
 
     ("precision,r",
-     value<char>(&this->precision)->default_value('s'), "Options: s,d,c,z")
+     value<char>(&this->precision)->default_value('s'),
+     "Options: s,d,c,z,h,b. h (resp. b) runs SpMV/SpMM with a half (resp. bfloat16) sparse matrix and single precision vectors")
 
     ("verify,v",
      value<rocsparse_int>(&this->unit_check)->default_value(0),
@@ -362,7 +364,11 @@ void rocsparse_arguments_config::set_description(options_description& desc)
 
     ("spmv_alg",
       value<rocsparse_int>(&this->b_spmv_alg)->default_value(rocsparse_spmv_alg_default),
-      "Indicates what algorithm to use when running SpMV. Possibly choices are default: 0, COO: 1, CSR adaptive: 2, CSR stream: 3, ELL: 4, COO atomic: 5 (default:0)")
+      "Indicates what algorithm to use when running SpMV. Possibly choices are default: 0, COO: 1, CSR adaptive: 2, CSR stream: 3, ELL: 4, COO atomic: 5, auto: 7, CSR binned: 8, CSR merge: 9 (default:0)")
+
+    ("spsv_alg",
+      value<rocsparse_int>(&this->b_spsv_alg)->default_value(rocsparse_spsv_alg_default),
+      "Indicates what algorithm to use when running SpSV. Possibly choices are default: 0, level set: 1 (default:0)")
 
     ("itilu0_alg",
       value<rocsparse_int>(&this->b_itilu0_alg)->default_value(rocsparse_itilu0_alg_default),
@@ -370,7 +376,7 @@ void rocsparse_arguments_config::set_description(options_description& desc)
 
     ("spmm_alg",
       value<rocsparse_int>(&this->b_spmm_alg)->default_value(rocsparse_spmm_alg_default),
-      "Indicates what algorithm to use when running SpMM. Possibly choices are default: 0, CSR: 1, COO segmented: 2, COO atomic: 3, CSR row split: 4, CSR merge: 5, COO segmented atomic: 6, BELL: 7 (default:0)")
+      "Indicates what algorithm to use when running SpMM. Possibly choices are default: 0, CSR: 1, COO segmented: 2, COO atomic: 3, CSR row split: 4, CSR merge: 5, COO segmented atomic: 6, BELL: 7, BSR: 8 (default:0)")
 
     ("gtsv_interleaved_alg",
       value<rocsparse_int>(&this->b_gtsv_interleaved_alg)->default_value(rocsparse_gtsv_interleaved_alg_default),
@@ -438,12 +444,22 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_adaptive
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_stream
        && this->b_spmv_alg != rocsparse_spmv_alg_ell
-       && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic)
+       && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic
+       && this->b_spmv_alg != rocsparse_spmv_alg_auto
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_binned
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_merge)
   {
       std::cerr << "Invalid value for --spmv_alg" << std::endl;
       return -1;
   }
 
+  if(this->b_spsv_alg != rocsparse_spsv_alg_default
+       && this->b_spsv_alg != rocsparse_spsv_alg_level_set)
+  {
+      std::cerr << "Invalid value for --spsv_alg" << std::endl;
+      return -1;
+  }
+
   if(this->b_spmm_alg != rocsparse_spmm_alg_default
        && this->b_spmm_alg != rocsparse_spmm_alg_csr
        && this->b_spmm_alg != rocsparse_spmm_alg_coo_segmented
@@ -451,7 +467,8 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
        && this->b_spmm_alg != rocsparse_spmm_alg_csr_row_split
        && this->b_spmm_alg != rocsparse_spmm_alg_csr_merge
        && this->b_spmm_alg != rocsparse_spmm_alg_coo_segmented_atomic
-       && this->b_spmm_alg != rocsparse_spmm_alg_bell)
+       && this->b_spmm_alg != rocsparse_spmm_alg_bell
+       && this->b_spmm_alg != rocsparse_spmm_alg_bsr)
   {
       std::cerr << "Invalid value for --spmm_alg" << std::endl;
       return -1;
@@ -500,7 +517,8 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   this->action      = (this->b_action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
   this->part        = (this->b_part == 0)   ? rocsparse_hyb_partition_auto
     : (this->b_part == 1) ? rocsparse_hyb_partition_user
-    : rocsparse_hyb_partition_max;
+    : (this->b_part == 2) ? rocsparse_hyb_partition_max
+    : rocsparse_hyb_partition_cost;
   this->matrix_type = (this->b_matrix_type == 0)   ? rocsparse_matrix_type_general
     : (this->b_matrix_type == 1) ? rocsparse_matrix_type_symmetric
     : (this->b_matrix_type == 2) ? rocsparse_matrix_type_hermitian
@@ -515,6 +533,7 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   this->order  = (this->b_order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
   this->format = (rocsparse_format)this->b_format;
   this->spmv_alg = (rocsparse_spmv_alg)this->b_spmv_alg;
+  this->spsv_alg = (rocsparse_spsv_alg)this->b_spsv_alg;
   this->itilu0_alg = (rocsparse_itilu0_alg)this->b_itilu0_alg;
   this->spmm_alg = (rocsparse_spmm_alg)this->b_spmm_alg;
   this->gtsv_interleaved_alg = (rocsparse_gtsv_interleaved_alg)this->b_gtsv_interleaved_alg;
@@ -670,6 +689,18 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
 	this->compute_type = rocsparse_datatype_f64_c;
 	break;
       }
+    case 'h':
+      {
+	this->a_type       = rocsparse_datatype_f16_r;
+	this->compute_type = rocsparse_datatype_f32_r;
+	break;
+      }
+    case 'b':
+      {
+	this->a_type       = rocsparse_datatype_bf16_r;
+	this->compute_type = rocsparse_datatype_f32_r;
+	break;
+      }
     default:
       {
 	std::cerr << "Invalid value for --precision" << std::endl;
@@ -731,12 +762,22 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_adaptive
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_stream
        && this->b_spmv_alg != rocsparse_spmv_alg_ell
-       && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic)
+       && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic
+       && this->b_spmv_alg != rocsparse_spmv_alg_auto
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_binned
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_merge)
   {
       std::cerr << "Invalid value for --spmv_alg" << std::endl;
       return -1;
   }
 
+  if(this->b_spsv_alg != rocsparse_spsv_alg_default
+       && this->b_spsv_alg != rocsparse_spsv_alg_level_set)
+  {
+      std::cerr << "Invalid value for --spsv_alg" << std::endl;
+      return -1;
+  }
+
   if(this->b_spmm_alg != rocsparse_spmm_alg_default
        && this->b_spmm_alg != rocsparse_spmm_alg_csr
        && this->b_spmm_alg != rocsparse_spmm_alg_coo_segmented
@@ -744,7 +785,8 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
        && this->b_spmm_alg != rocsparse_spmm_alg_csr_row_split
        && this->b_spmm_alg != rocsparse_spmm_alg_csr_merge
        && this->b_spmm_alg != rocsparse_spmm_alg_coo_segmented_atomic
-       && this->b_spmm_alg != rocsparse_spmm_alg_bell)
+       && this->b_spmm_alg != rocsparse_spmm_alg_bell
+       && this->b_spmm_alg != rocsparse_spmm_alg_bsr)
   {
       std::cerr << "Invalid value for --spmm_alg" << std::endl;
       return -1;
@@ -794,7 +836,8 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
   this->action = (b_action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
   this->part   = (b_part == 0)   ? rocsparse_hyb_partition_auto
     : (b_part == 1) ? rocsparse_hyb_partition_user
-    : rocsparse_hyb_partition_max;
+    : (b_part == 2) ? rocsparse_hyb_partition_max
+    : rocsparse_hyb_partition_cost;
   this->diag   = (b_diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
   this->uplo   = (b_uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
   this->storage= (b_storage == 0) ? rocsparse_storage_mode_sorted : rocsparse_storage_mode_unsorted;
@@ -805,6 +848,7 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
   this->order  = (b_order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
   this->format = (rocsparse_format)b_format;
   this->spmv_alg = (rocsparse_spmv_alg)this->b_spmv_alg;
+  this->spsv_alg = (rocsparse_spsv_alg)this->b_spsv_alg;
   this->spmm_alg = (rocsparse_spmm_alg)this->b_spmm_alg;
   this->gtsv_interleaved_alg = (rocsparse_gtsv_interleaved_alg)this->b_gtsv_interleaved_alg;
 
@@ -963,6 +1007,18 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
 	this->compute_type = rocsparse_datatype_f64_c;
 	break;
       }
+    case 'h':
+      {
+	this->a_type       = rocsparse_datatype_f16_r;
+	this->compute_type = rocsparse_datatype_f32_r;
+	break;
+      }
+    case 'b':
+      {
+	this->a_type       = rocsparse_datatype_bf16_r;
+	this->compute_type = rocsparse_datatype_f32_r;
+	break;
+      }
     default:
       {
 	std::cerr << "Invalid value for --precision" << std::endl;
@@ -63,6 +63,7 @@ private:
     rocsparse_int b_format{};
     rocsparse_int b_itilu0_alg{};
     rocsparse_int b_spmv_alg{};
+    rocsparse_int b_spsv_alg{};
     rocsparse_int b_spmm_alg{};
     rocsparse_int b_gtsv_interleaved_alg{};
 #ifdef ROCSPARSE_WITH_MEMSTAT
@@ -123,15 +123,31 @@ rocsparse_status rocsparse_routine::dispatch_indextype(const char cindextype, co
 //
 //
 //
+static constexpr bool is_half_matrix_routine(rocsparse_routine::value_type fname)
+{
+    return fname == rocsparse_routine::bsrmv || fname == rocsparse_routine::csrmv
+           || fname == rocsparse_routine::cscmv || fname == rocsparse_routine::coomv
+           || fname == rocsparse_routine::coomv_aos || fname == rocsparse_routine::ellmv
+           || fname == rocsparse_routine::bellmv || fname == rocsparse_routine::csrmm;
+}
+
 template <rocsparse_routine::value_type FNAME>
 rocsparse_status rocsparse_routine::dispatch_precision(const char       precision,
                                                        const char       indextype,
                                                        const Arguments& arg)
 {
+    // Half precision matrices (h, b) are computed with single precision vectors
+    if((precision == 'h' || precision == 'b') && !is_half_matrix_routine(FNAME))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     const rocsparse_datatype datatype = (precision == 's')   ? rocsparse_datatype_f32_r
                                         : (precision == 'd') ? rocsparse_datatype_f64_r
                                         : (precision == 'c') ? rocsparse_datatype_f32_c
                                         : (precision == 'z') ? rocsparse_datatype_f64_c
+                                        : (precision == 'h') ? rocsparse_datatype_f32_r
+                                        : (precision == 'b') ? rocsparse_datatype_f32_r
                                                              : ((rocsparse_datatype)-1);
     switch(datatype)
     {
@@ -147,6 +163,8 @@ rocsparse_status rocsparse_routine::dispatch_precision(const char       precisio
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
         return rocsparse_status_invalid_value;
     }
     return rocsparse_status_invalid_value;
@@ -210,17 +228,20 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_bsrxmv.hpp"
 #include "testing_csritsv.hpp"
 #include "testing_csrmv_managed.hpp"
+#include "testing_csrmv_rowblocks.hpp"
 #include "testing_csrsv.hpp"
 #include "testing_gebsrmv.hpp"
 #include "testing_gemvi.hpp"
 #include "testing_hybmv.hpp"
 #include "testing_spitsv_csr.hpp"
+#include "testing_spmv_bell.hpp"
 #include "testing_spmv_bsr.hpp"
 #include "testing_spmv_coo.hpp"
 #include "testing_spmv_coo_aos.hpp"
 #include "testing_spmv_csc.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spmv_ell.hpp"
+#include "testing_spsv_bsr.hpp"
 #include "testing_spsv_coo.hpp"
 #include "testing_spsv_csr.hpp"
 
@@ -235,11 +256,17 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_spmm_batched_bell.hpp"
 #include "testing_spmm_batched_coo.hpp"
 #include "testing_spmm_batched_csc.hpp"
+#include "testing_spmm_batched_ell.hpp"
 #include "testing_spmm_batched_csr.hpp"
+#include "testing_spmv_batched_coo.hpp"
+#include "testing_spmv_batched_csr.hpp"
 #include "testing_spmm_bell.hpp"
+#include "testing_spmm_bsr.hpp"
 #include "testing_spmm_coo.hpp"
 #include "testing_spmm_csc.hpp"
 #include "testing_spmm_csr.hpp"
+#include "testing_spmm_ell.hpp"
+#include "testing_spsm_bsr.hpp"
 #include "testing_spsm_coo.hpp"
 #include "testing_spsm_csr.hpp"
 
@@ -257,6 +284,8 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_bsrilu0.hpp"
 #include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csriluk.hpp"
+#include "testing_csrmc.hpp"
 #include "testing_csritilu0.hpp"
 #include "testing_gpsv_interleaved_batch.hpp"
 #include "testing_gtsv.hpp"
@@ -291,8 +320,12 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_gebsr2gebsc.hpp"
 #include "testing_gebsr2gebsr.hpp"
 #include "testing_hyb2csr.hpp"
+#include "testing_analysis_cache.hpp"
 #include "testing_identity.hpp"
+#include "testing_import_matrixmarket.hpp"
 #include "testing_inverse_permutation.hpp"
+#include "testing_mat_info_export.hpp"
+#include "testing_memory_pool.hpp"
 #include "testing_nnz.hpp"
 #include "testing_prune_csr2csr.hpp"
 #include "testing_prune_csr2csr_by_percentage.hpp"
@@ -359,32 +392,59 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         }                                     \
     }
 
-#define DEFINE_CASE_IAXYT_X(value, testingf)  \
-    case value:                               \
-    {                                         \
-        try                                   \
-        {                                     \
-            testingf<I, T, T, T, T>(arg);     \
-            return rocsparse_status_success;  \
-        }                                     \
-        catch(const rocsparse_status& status) \
-        {                                     \
-            return status;                    \
-        }                                     \
+// Sparse matrix types used with single precision vectors, i.e. precision h and b
+#define IS_T_FLOAT (std::is_same<T, float>())
+#define HALF_T std::conditional_t<std::is_same<T, float>{}, _Float16, T>
+#define BFLOAT16_T std::conditional_t<std::is_same<T, float>{}, hip_bfloat16, T>
+
+#define DEFINE_CASE_IAXYT_X(value, testingf)                               \
+    case value:                                                            \
+    {                                                                      \
+        try                                                                \
+        {                                                                  \
+            if(IS_T_FLOAT && arg.a_type == rocsparse_datatype_f16_r)       \
+            {                                                              \
+                testingf<I, HALF_T, T, T, T>(arg);                         \
+            }                                                              \
+            else if(IS_T_FLOAT && arg.a_type == rocsparse_datatype_bf16_r) \
+            {                                                              \
+                testingf<I, BFLOAT16_T, T, T, T>(arg);                     \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                testingf<I, T, T, T, T>(arg);                              \
+            }                                                              \
+            return rocsparse_status_success;                               \
+        }                                                                  \
+        catch(const rocsparse_status& status)                              \
+        {                                                                  \
+            return status;                                                 \
+        }                                                                  \
     }
 
-#define DEFINE_CASE_IJAXYT_X(value, testingf) \
-    case value:                               \
-    {                                         \
-        try                                   \
-        {                                     \
-            testingf<I, J, T, T, T, T>(arg);  \
-            return rocsparse_status_success;  \
-        }                                     \
-        catch(const rocsparse_status& status) \
-        {                                     \
-            return status;                    \
-        }                                     \
+#define DEFINE_CASE_IJAXYT_X(value, testingf)                              \
+    case value:                                                            \
+    {                                                                      \
+        try                                                                \
+        {                                                                  \
+            if(IS_T_FLOAT && arg.a_type == rocsparse_datatype_f16_r)       \
+            {                                                              \
+                testingf<I, J, HALF_T, T, T, T>(arg);                      \
+            }                                                              \
+            else if(IS_T_FLOAT && arg.a_type == rocsparse_datatype_bf16_r) \
+            {                                                              \
+                testingf<I, J, BFLOAT16_T, T, T, T>(arg);                  \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                testingf<I, J, T, T, T, T>(arg);                           \
+            }                                                              \
+            return rocsparse_status_success;                               \
+        }                                                                  \
+        catch(const rocsparse_status& status)                              \
+        {                                                                  \
+            return status;                                                 \
+        }                                                                  \
     }
 
 #define DEFINE_CASE_IT(value) DEFINE_CASE_IT_X(value, testing_##value)
@@ -483,12 +543,16 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(axpyi);
         DEFINE_CASE_IT_X(bellmm, testing_spmm_bell);
         DEFINE_CASE_IT_X(bellmm_batched, testing_spmm_batched_bell);
+        DEFINE_CASE_IAXYT_X(bellmv, testing_spmv_bell);
         DEFINE_CASE_T(bsrgeam);
         DEFINE_CASE_T(bsric0);
         DEFINE_CASE_T(bsrilu0);
         DEFINE_CASE_T(bsrmm);
+        DEFINE_CASE_T_X(spmm_bsr, testing_spmm_bsr);
         DEFINE_CASE_T(bsrsm);
+        DEFINE_CASE_T_X(spsm_bsr, testing_spsm_bsr);
         DEFINE_CASE_T(bsrsv);
+        DEFINE_CASE_T_X(spsv_bsr, testing_spsv_bsr);
         DEFINE_CASE_T(bsrxmv);
         DEFINE_CASE_T(bsr2csr);
         DEFINE_CASE_T(check_matrix_csr);
@@ -501,6 +565,7 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_IT_X(coomm, testing_spmm_coo);
         DEFINE_CASE_IT_X(coomm_batched, testing_spmm_batched_coo);
         DEFINE_CASE_IAXYT_X(coomv, testing_spmv_coo);
+        DEFINE_CASE_IT_X(coomv_batched, testing_spmv_batched_coo);
         DEFINE_CASE_T_FLOAT_ONLY(coosort);
         DEFINE_CASE_IT_X(coosv, testing_spsv_coo);
         DEFINE_CASE_IAXYT_X(coomv_aos, testing_spmv_coo_aos);
@@ -512,6 +577,8 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(csrcolor);
         DEFINE_CASE_T(csric0);
         DEFINE_CASE_T(csrilu0);
+        DEFINE_CASE_T(csriluk);
+        DEFINE_CASE_T(csrmc);
         DEFINE_CASE_T(csritilu0);
         DEFINE_CASE_T(csrgeam);
         DEFINE_CASE_IJT_X(bsrgemm, testing_spgemm_bsr);
@@ -519,7 +586,9 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(csrgemm_reuse);
         DEFINE_CASE_IJAXYT_X(bsrmv, testing_spmv_bsr);
         DEFINE_CASE_IJAXYT_X(csrmv, testing_spmv_csr);
+        DEFINE_CASE_IJT_X(csrmv_batched, testing_spmv_batched_csr);
         DEFINE_CASE_T(csrmv_managed);
+        DEFINE_CASE_T_FLOAT_ONLY(csrmv_rowblocks);
         DEFINE_CASE_IJAXYT_X(cscmv, testing_spmv_csc);
         DEFINE_CASE_IJT_X(csrmm, testing_spmm_csr);
         DEFINE_CASE_IJT_X(csrmm_batched, testing_spmm_batched_csr);
@@ -546,6 +615,8 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_IJT(dense_to_sparse_csr);
         DEFINE_CASE_T(doti);
         DEFINE_CASE_T_REAL_VS_COMPLEX(dotci, testing_doti, testing_dotci);
+        DEFINE_CASE_IT_X(ellmm, testing_spmm_ell);
+        DEFINE_CASE_IT_X(ellmm_batched, testing_spmm_batched_ell);
         DEFINE_CASE_IAXYT_X(ellmv, testing_spmv_ell);
         DEFINE_CASE_T(ell2csr);
         DEFINE_CASE_T(gebsr2csr);
@@ -564,8 +635,12 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(gpsv_interleaved_batch);
         DEFINE_CASE_T(hybmv);
         DEFINE_CASE_T(hyb2csr);
+        DEFINE_CASE_T(analysis_cache);
         DEFINE_CASE_T_FLOAT_ONLY(identity);
+        DEFINE_CASE_T(import_matrixmarket);
         DEFINE_CASE_T_FLOAT_ONLY(inverse_permutation);
+        DEFINE_CASE_T(mat_info_export);
+        DEFINE_CASE_T(memory_pool);
         DEFINE_CASE_T(nnz);
         DEFINE_CASE_T_REAL_ONLY(prune_csr2csr);
         DEFINE_CASE_T_REAL_ONLY(prune_csr2csr_by_percentage);
@@ -26,17 +26,22 @@
 
 // clang-format off
 #define ROCSPARSE_FOREACH_ROUTINE			\
+ROCSPARSE_DO_ROUTINE(analysis_cache)					\
 ROCSPARSE_DO_ROUTINE(axpyi)						\
 ROCSPARSE_DO_ROUTINE(bellmm)						\
 ROCSPARSE_DO_ROUTINE(bellmm_batched)					\
+ROCSPARSE_DO_ROUTINE(bellmv)						\
 ROCSPARSE_DO_ROUTINE(bsrgeam)					\
 ROCSPARSE_DO_ROUTINE(bsric0)					\
 ROCSPARSE_DO_ROUTINE(bsrilu0)					\
 ROCSPARSE_DO_ROUTINE(bsrgemm)					\
 ROCSPARSE_DO_ROUTINE(bsrmm)					\
+ROCSPARSE_DO_ROUTINE(spmm_bsr)					\
 ROCSPARSE_DO_ROUTINE(bsrmv)					\
 ROCSPARSE_DO_ROUTINE(bsrsm)					\
+ROCSPARSE_DO_ROUTINE(spsm_bsr)					\
 ROCSPARSE_DO_ROUTINE(bsrsv)					\
+ROCSPARSE_DO_ROUTINE(spsv_bsr)					\
 ROCSPARSE_DO_ROUTINE(bsrxmv)					\
 ROCSPARSE_DO_ROUTINE(bsr2csr)					\
 ROCSPARSE_DO_ROUTINE(check_matrix_csr)					\
@@ -49,6 +54,7 @@ ROCSPARSE_DO_ROUTINE(check_matrix_hyb)					\
 ROCSPARSE_DO_ROUTINE(coomm)					\
 ROCSPARSE_DO_ROUTINE(coomm_batched)					\
 ROCSPARSE_DO_ROUTINE(coomv)					\
+ROCSPARSE_DO_ROUTINE(coomv_batched)				\
 ROCSPARSE_DO_ROUTINE(coosort)					\
 ROCSPARSE_DO_ROUTINE(coosv)					\
 ROCSPARSE_DO_ROUTINE(coomv_aos)					\
@@ -60,12 +66,16 @@ ROCSPARSE_DO_ROUTINE(csc2dense)					\
 ROCSPARSE_DO_ROUTINE(csrcolor)					\
 ROCSPARSE_DO_ROUTINE(csric0)					\
 ROCSPARSE_DO_ROUTINE(csrilu0)					\
+ROCSPARSE_DO_ROUTINE(csriluk)					\
+ROCSPARSE_DO_ROUTINE(csrmc)					\
 ROCSPARSE_DO_ROUTINE(csritilu0)					\
 ROCSPARSE_DO_ROUTINE(csrgeam)					\
 ROCSPARSE_DO_ROUTINE(csrgemm)					\
 ROCSPARSE_DO_ROUTINE(csrgemm_reuse)				\
 ROCSPARSE_DO_ROUTINE(csrmv)					\
+ROCSPARSE_DO_ROUTINE(csrmv_batched)				\
 ROCSPARSE_DO_ROUTINE(csrmv_managed)				\
+ROCSPARSE_DO_ROUTINE(csrmv_rowblocks)				\
 ROCSPARSE_DO_ROUTINE(cscmv)					\
 ROCSPARSE_DO_ROUTINE(csrmm)					\
 ROCSPARSE_DO_ROUTINE(csrmm_batched)					\
@@ -92,6 +102,8 @@ ROCSPARSE_DO_ROUTINE(dense_to_sparse_csc)			\
 ROCSPARSE_DO_ROUTINE(dense_to_sparse_csr)			\
 ROCSPARSE_DO_ROUTINE(doti)					\
 ROCSPARSE_DO_ROUTINE(dotci)					\
+ROCSPARSE_DO_ROUTINE(ellmm)					\
+ROCSPARSE_DO_ROUTINE(ellmm_batched)				\
 ROCSPARSE_DO_ROUTINE(ellmv)					\
 ROCSPARSE_DO_ROUTINE(ell2csr)					\
 ROCSPARSE_DO_ROUTINE(gebsr2csr)					\
@@ -111,7 +123,10 @@ ROCSPARSE_DO_ROUTINE(gtsv_interleaved_batch)		\
 ROCSPARSE_DO_ROUTINE(hybmv)					\
 ROCSPARSE_DO_ROUTINE(hyb2csr)					\
 ROCSPARSE_DO_ROUTINE(identity)					\
+ROCSPARSE_DO_ROUTINE(import_matrixmarket)			\
 ROCSPARSE_DO_ROUTINE(inverse_permutation)			\
+ROCSPARSE_DO_ROUTINE(mat_info_export)			\
+ROCSPARSE_DO_ROUTINE(memory_pool)				\
 ROCSPARSE_DO_ROUTINE(nnz)					\
 ROCSPARSE_DO_ROUTINE(prune_csr2csr)				\
 ROCSPARSE_DO_ROUTINE(prune_csr2csr_by_percentage)		\
@@ -0,0 +1,630 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+//
+// rocsparse-tune sweeps the run time kernel selection parameters of rocSPARSE (see
+// library/src/include/tuning.h) on the current device and writes the best values as a
+// tuning file, to be used through ROCSPARSE_TUNING_FILE, or as an entry of the built-in
+// tuning table.
+//
+// The parameters are optimized one after the other (coordinate descent). Each candidate
+// value is written to a temporary tuning file, which is picked up by a newly created
+// handle, and scored by the geometric mean of the execution times of the routines it
+// affects over a set of synthetic matrices with different row length distributions.
+//
+
+#include "tuning.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#define HIP_CHECK(stat)                                                                 \
+    {                                                                                   \
+        if((stat) != hipSuccess)                                                        \
+        {                                                                               \
+            std::cerr << "rocsparse-tune: hip error in line " << __LINE__ << std::endl; \
+            exit(1);                                                                    \
+        }                                                                               \
+    }
+
+#define ROCSPARSE_CHECK(stat)                                                                 \
+    {                                                                                         \
+        if((stat) != rocsparse_status_success)                                                \
+        {                                                                                     \
+            std::cerr << "rocsparse-tune: rocsparse error in line " << __LINE__ << std::endl; \
+            exit(1);                                                                          \
+        }                                                                                     \
+    }
+
+// Sparse matrix in CSR format, on the host and on the device
+struct tune_matrix
+{
+    std::string                name;
+    rocsparse_int              m{};
+    rocsparse_int              n{};
+    rocsparse_int              nnz{};
+    std::vector<rocsparse_int> ptr;
+    std::vector<rocsparse_int> col;
+
+    rocsparse_int* d_ptr{};
+    rocsparse_int* d_col{};
+    double*        d_val{};
+};
+
+// Square matrix whose row lengths are drawn from length(rng). The columns of a row are
+// evenly spread with a random offset, such that they are unique and sorted.
+template <typename F>
+static tune_matrix make_matrix(const std::string& name, rocsparse_int m, F length)
+{
+    std::mt19937 rng(12345);
+
+    tune_matrix A;
+    A.name = name;
+    A.m    = m;
+    A.n    = m;
+    A.ptr.resize(m + 1, 0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int len = std::min(std::max(length(rng), 1), m);
+        rocsparse_int gap = m / len;
+        rocsparse_int off = std::uniform_int_distribution<rocsparse_int>(0, gap - 1)(rng);
+
+        for(rocsparse_int j = 0; j < len; ++j)
+        {
+            A.col.push_back(off + j * gap);
+        }
+
+        A.ptr[i + 1] = A.ptr[i] + len;
+    }
+
+    A.nnz = A.ptr[m];
+
+    std::vector<double> val(A.nnz, 1.0);
+
+    HIP_CHECK(hipMalloc((void**)&A.d_ptr, sizeof(rocsparse_int) * (m + 1)));
+    HIP_CHECK(hipMalloc((void**)&A.d_col, sizeof(rocsparse_int) * A.nnz));
+    HIP_CHECK(hipMalloc((void**)&A.d_val, sizeof(double) * A.nnz));
+    HIP_CHECK(hipMemcpy(
+        A.d_ptr, A.ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    HIP_CHECK(
+        hipMemcpy(A.d_col, A.col.data(), sizeof(rocsparse_int) * A.nnz, hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(A.d_val, val.data(), sizeof(double) * A.nnz, hipMemcpyHostToDevice));
+
+    return A;
+}
+
+static void free_matrix(tune_matrix& A)
+{
+    HIP_CHECK(hipFree(A.d_ptr));
+    HIP_CHECK(hipFree(A.d_col));
+    HIP_CHECK(hipFree(A.d_val));
+}
+
+// Uniform, power law and bimodal row length distributions
+static std::vector<tune_matrix> make_matrices(rocsparse_int m)
+{
+    std::vector<tune_matrix> matrices;
+
+    for(int len : {8, 24, 48, 96, 256})
+    {
+        matrices.push_back(make_matrix(
+            "uniform" + std::to_string(len), m, [len](std::mt19937&) { return len; }));
+    }
+
+    matrices.push_back(make_matrix("powerlaw", m, [](std::mt19937& rng) {
+        double u = std::uniform_real_distribution<double>(1e-6, 1.0)(rng);
+        return static_cast<int>(std::min(2.0 * std::pow(u, -0.8), 1e5));
+    }));
+
+    matrices.push_back(make_matrix("bimodal", m, [](std::mt19937& rng) {
+        return std::uniform_int_distribution<int>(0, 9)(rng) == 0 ? 300 : 4;
+    }));
+
+    return matrices;
+}
+
+// Average time of a call of f in milliseconds, after two warm up calls
+template <typename F>
+static double time_calls(F f, int iters)
+{
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    f();
+    f();
+
+    HIP_CHECK(hipEventRecord(start, 0));
+    for(int i = 0; i < iters; ++i)
+    {
+        f();
+    }
+    HIP_CHECK(hipEventRecord(stop, 0));
+    HIP_CHECK(hipEventSynchronize(stop));
+
+    float msec;
+    HIP_CHECK(hipEventElapsedTime(&msec, start, stop));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+
+    return msec / iters;
+}
+
+static double time_csrmv(rocsparse_handle handle, const tune_matrix& A, int iters)
+{
+    rocsparse_mat_descr descr;
+    rocsparse_mat_info  info;
+    ROCSPARSE_CHECK(rocsparse_create_mat_descr(&descr));
+    ROCSPARSE_CHECK(rocsparse_create_mat_info(&info));
+
+    double *x, *y;
+    HIP_CHECK(hipMalloc((void**)&x, sizeof(double) * A.n));
+    HIP_CHECK(hipMalloc((void**)&y, sizeof(double) * A.m));
+    HIP_CHECK(hipMemset(x, 0, sizeof(double) * A.n));
+
+    double alpha = 1.0;
+    double beta  = 0.0;
+
+    ROCSPARSE_CHECK(rocsparse_dcsrmv_analysis(handle,
+                                              rocsparse_operation_none,
+                                              A.m,
+                                              A.n,
+                                              A.nnz,
+                                              descr,
+                                              A.d_val,
+                                              A.d_ptr,
+                                              A.d_col,
+                                              info));
+
+    double t = time_calls(
+        [&]() {
+            ROCSPARSE_CHECK(rocsparse_dcsrmv(handle,
+                                             rocsparse_operation_none,
+                                             A.m,
+                                             A.n,
+                                             A.nnz,
+                                             &alpha,
+                                             descr,
+                                             A.d_val,
+                                             A.d_ptr,
+                                             A.d_col,
+                                             info,
+                                             x,
+                                             &beta,
+                                             y));
+        },
+        iters);
+
+    HIP_CHECK(hipFree(x));
+    HIP_CHECK(hipFree(y));
+    ROCSPARSE_CHECK(rocsparse_destroy_mat_info(info));
+    ROCSPARSE_CHECK(rocsparse_destroy_mat_descr(descr));
+
+    return t;
+}
+
+// Both kernel families of csrmm, with a non-transposed and a transposed B
+static double time_csrmm(rocsparse_handle handle, const tune_matrix& A, int iters)
+{
+    static constexpr rocsparse_int n = 32;
+
+    rocsparse_mat_descr descr;
+    ROCSPARSE_CHECK(rocsparse_create_mat_descr(&descr));
+
+    double *B, *C;
+    HIP_CHECK(hipMalloc((void**)&B, sizeof(double) * A.n * n));
+    HIP_CHECK(hipMalloc((void**)&C, sizeof(double) * A.m * n));
+    HIP_CHECK(hipMemset(B, 0, sizeof(double) * A.n * n));
+
+    double alpha = 1.0;
+    double beta  = 0.0;
+    double t     = 1.0;
+
+    for(rocsparse_operation trans_B : {rocsparse_operation_none, rocsparse_operation_transpose})
+    {
+        rocsparse_int ldb = (trans_B == rocsparse_operation_none) ? A.n : n;
+
+        t *= time_calls(
+            [&]() {
+                ROCSPARSE_CHECK(rocsparse_dcsrmm(handle,
+                                                 rocsparse_operation_none,
+                                                 trans_B,
+                                                 A.m,
+                                                 n,
+                                                 A.n,
+                                                 A.nnz,
+                                                 &alpha,
+                                                 descr,
+                                                 A.d_val,
+                                                 A.d_ptr,
+                                                 A.d_col,
+                                                 B,
+                                                 ldb,
+                                                 &beta,
+                                                 C,
+                                                 A.m));
+            },
+            iters);
+    }
+
+    HIP_CHECK(hipFree(B));
+    HIP_CHECK(hipFree(C));
+    ROCSPARSE_CHECK(rocsparse_destroy_mat_descr(descr));
+
+    return std::sqrt(t);
+}
+
+// C = A * A, including the non-zero pattern of C
+static double time_csrgemm(rocsparse_handle handle, const tune_matrix& A, int iters)
+{
+    rocsparse_mat_descr descr;
+    rocsparse_mat_info  info;
+    ROCSPARSE_CHECK(rocsparse_create_mat_descr(&descr));
+    ROCSPARSE_CHECK(rocsparse_create_mat_info(&info));
+
+    rocsparse_operation op    = rocsparse_operation_none;
+    double              alpha = 1.0;
+
+    size_t buffer_size;
+    ROCSPARSE_CHECK(rocsparse_dcsrgemm_buffer_size(handle,
+                                                   op,
+                                                   op,
+                                                   A.m,
+                                                   A.n,
+                                                   A.n,
+                                                   &alpha,
+                                                   descr,
+                                                   A.nnz,
+                                                   A.d_ptr,
+                                                   A.d_col,
+                                                   descr,
+                                                   A.nnz,
+                                                   A.d_ptr,
+                                                   A.d_col,
+                                                   nullptr,
+                                                   nullptr,
+                                                   0,
+                                                   nullptr,
+                                                   nullptr,
+                                                   info,
+                                                   &buffer_size));
+
+    void*          buffer;
+    rocsparse_int* ptr_C;
+    HIP_CHECK(hipMalloc(&buffer, buffer_size));
+    HIP_CHECK(hipMalloc((void**)&ptr_C, sizeof(rocsparse_int) * (A.m + 1)));
+
+    rocsparse_int nnz_C;
+    auto          nnz = [&]() {
+        ROCSPARSE_CHECK(rocsparse_csrgemm_nnz(handle,
+                                              op,
+                                              op,
+                                              A.m,
+                                              A.n,
+                                              A.n,
+                                              descr,
+                                              A.nnz,
+                                              A.d_ptr,
+                                              A.d_col,
+                                              descr,
+                                              A.nnz,
+                                              A.d_ptr,
+                                              A.d_col,
+                                              nullptr,
+                                              0,
+                                              nullptr,
+                                              nullptr,
+                                              descr,
+                                              ptr_C,
+                                              &nnz_C,
+                                              info,
+                                              buffer));
+    };
+
+    double t_nnz = time_calls(nnz, iters);
+
+    rocsparse_int* col_C;
+    double*        val_C;
+    HIP_CHECK(hipMalloc((void**)&col_C, sizeof(rocsparse_int) * nnz_C));
+    HIP_CHECK(hipMalloc((void**)&val_C, sizeof(double) * nnz_C));
+
+    double t_calc = time_calls(
+        [&]() {
+            ROCSPARSE_CHECK(rocsparse_dcsrgemm(handle,
+                                               op,
+                                               op,
+                                               A.m,
+                                               A.n,
+                                               A.n,
+                                               &alpha,
+                                               descr,
+                                               A.nnz,
+                                               A.d_val,
+                                               A.d_ptr,
+                                               A.d_col,
+                                               descr,
+                                               A.nnz,
+                                               A.d_val,
+                                               A.d_ptr,
+                                               A.d_col,
+                                               nullptr,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               descr,
+                                               val_C,
+                                               ptr_C,
+                                               col_C,
+                                               info,
+                                               buffer));
+        },
+        iters);
+
+    HIP_CHECK(hipFree(buffer));
+    HIP_CHECK(hipFree(ptr_C));
+    HIP_CHECK(hipFree(col_C));
+    HIP_CHECK(hipFree(val_C));
+    ROCSPARSE_CHECK(rocsparse_destroy_mat_info(info));
+    ROCSPARSE_CHECK(rocsparse_destroy_mat_descr(descr));
+
+    return t_nnz + t_calc;
+}
+
+typedef double (*tune_routine)(rocsparse_handle, const tune_matrix&, int);
+
+// A tunable parameter, the routine it affects and its candidate values
+struct tune_param
+{
+    const char*          name;
+    int32_t*             value;
+    tune_routine         routine;
+    std::vector<int32_t> candidates;
+};
+
+static void write_params(std::ostream& os, const std::vector<tune_param>& params)
+{
+    for(const tune_param& p : params)
+    {
+        os << p.name << " = " << *p.value << std::endl;
+    }
+}
+
+// Geometric mean of the execution times of routine, with a new handle that reads the
+// current parameters from the tuning file
+static double score(const std::vector<tune_param>&  params,
+                    tune_routine                    routine,
+                    const std::vector<tune_matrix>& matrices,
+                    const std::string&              path,
+                    int                             iters)
+{
+    {
+        std::ofstream file(path);
+        file << "[*]" << std::endl;
+        write_params(file, params);
+    }
+
+    rocsparse_handle handle;
+    ROCSPARSE_CHECK(rocsparse_create_handle(&handle));
+
+    double log_sum = 0.0;
+    for(const tune_matrix& A : matrices)
+    {
+        log_sum += std::log(routine(handle, A, iters));
+    }
+
+    ROCSPARSE_CHECK(rocsparse_destroy_handle(handle));
+
+    return std::exp(log_sum / matrices.size());
+}
+
+static void usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]" << std::endl
+              << "  --device <id>         device to tune (default: 0)" << std::endl
+              << "  --rows <m>            rows of the SpMV and SpMM matrices, SpGEMM uses m / 8 "
+                 "(default: 262144)"
+              << std::endl
+              << "  --iters <n>           timed calls per routine and matrix (default: 20)"
+              << std::endl
+              << "  --format file|table   write a tuning file section or an entry of the "
+                 "built-in table (default: file)"
+              << std::endl
+              << "  --output <path>       output file (default: stdout)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int           device = 0;
+    rocsparse_int rows   = 262144;
+    int           iters  = 20;
+    std::string   format = "file";
+    std::string   output;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if(i + 1 < argc && arg == "--device")
+            device = atoi(argv[++i]);
+        else if(i + 1 < argc && arg == "--rows")
+            rows = atoi(argv[++i]);
+        else if(i + 1 < argc && arg == "--iters")
+            iters = atoi(argv[++i]);
+        else if(i + 1 < argc && arg == "--format")
+            format = argv[++i];
+        else if(i + 1 < argc && arg == "--output")
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return (arg == "--help" || arg == "-h") ? 0 : 1;
+        }
+    }
+
+    if(rows < 64 || iters < 1 || (format != "file" && format != "table"))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    HIP_CHECK(hipSetDevice(device));
+
+    hipDeviceProp_t prop;
+    HIP_CHECK(hipGetDeviceProperties(&prop, device));
+
+    std::string arch = prop.gcnArchName;
+    arch             = arch.substr(0, arch.find(':'));
+
+    // Start from the defaults, a tuning file of the environment is ignored
+    rocsparse_tuning_params best;
+
+    std::string path = "rocsparse-tune-" + std::to_string(device) + ".tmp";
+    setenv("ROCSPARSE_TUNING_FILE", path.c_str(), 1);
+
+    std::vector<tune_param> params
+        = {{"csrmv_long_row", &best.csrmv_long_row, time_csrmv, {32, 64, 96, 128, 192, 256, 384}},
+           {"csrmv_short_row", &best.csrmv_short_row, time_csrmv, {8, 16, 24, 32, 48, 64}},
+           {"csrmv_row_window",
+            &best.csrmv_row_window,
+            time_csrmv,
+            {256, 512, 1024, 2048, 4096}},
+           {"csrmm_nnz_per_row_0",
+            &best.csrmm_nnz_per_row[0],
+            time_csrmm,
+            {8, 12, 16, 24, 32}},
+           {"csrmm_nnz_per_row_1",
+            &best.csrmm_nnz_per_row[1],
+            time_csrmm,
+            {16, 24, 32, 48, 64}},
+           {"csrmm_nnz_per_row_2",
+            &best.csrmm_nnz_per_row[2],
+            time_csrmm,
+            {32, 48, 64, 96, 128}},
+           {"csrgemm_group_nnz", &best.csrgemm_group_nnz, time_csrgemm, {1, 4, 8, 12, 16}},
+           {"csrgemm_group_products",
+            &best.csrgemm_group_products,
+            time_csrgemm,
+            {1, 8, 16, 24, 32}}};
+
+    // Sub-wavefronts of 64 threads are not available on wave32 devices
+    if(prop.warpSize == 32)
+    {
+        best.csrmm_nnz_per_row[2] = INT_MAX;
+        params.erase(std::remove_if(params.begin(),
+                                    params.end(),
+                                    [](const tune_param& p) {
+                                        return strcmp(p.name, "csrmm_nnz_per_row_2") == 0;
+                                    }),
+                     params.end());
+    }
+
+    std::vector<tune_matrix> matrices      = make_matrices(rows);
+    std::vector<tune_matrix> gemm_matrices = make_matrices(std::max(rows / 8, 64));
+
+    std::cerr << "rocsparse-tune: " << prop.name << " (" << arch << ", wave" << prop.warpSize
+              << ")" << std::endl;
+
+    for(tune_param& p : params)
+    {
+        const std::vector<tune_matrix>& set
+            = (p.routine == time_csrgemm) ? gemm_matrices : matrices;
+
+        int32_t current    = *p.value;
+        double  best_score = score(params, p.routine, set, path, iters);
+
+        for(int32_t v : p.candidates)
+        {
+            *p.value = v;
+
+            // Keep the thresholds of a parameter family ordered
+            if(v == current || best.csrmv_short_row > best.csrmv_long_row
+               || best.csrmm_nnz_per_row[0] > best.csrmm_nnz_per_row[1]
+               || best.csrmm_nnz_per_row[1] > best.csrmm_nnz_per_row[2])
+            {
+                continue;
+            }
+
+            double s = score(params, p.routine, set, path, iters);
+
+            std::cerr << "  " << p.name << " = " << v << ": " << s << " ms" << std::endl;
+
+            // Require a gain of 1% to move away from the current value
+            if(s < 0.99 * best_score)
+            {
+                best_score = s;
+                current    = v;
+            }
+        }
+
+        *p.value = current;
+
+        std::cerr << p.name << " = " << current << std::endl;
+    }
+
+    std::remove(path.c_str());
+
+    for(tune_matrix& A : matrices)
+        free_matrix(A);
+    for(tune_matrix& A : gemm_matrices)
+        free_matrix(A);
+
+    std::ofstream ofs;
+    if(!output.empty())
+    {
+        ofs.open(output);
+    }
+    std::ostream& os = output.empty() ? std::cout : ofs;
+
+    if(format == "table")
+    {
+        os << "    {\"" << arch << "\", " << prop.warpSize << ", {" << best.csrmv_long_row << ", "
+           << best.csrmv_short_row << ", " << best.csrmv_row_window << ", {"
+           << best.csrmm_nnz_per_row[0] << ", " << best.csrmm_nnz_per_row[1] << ", "
+           << (best.csrmm_nnz_per_row[2] == INT_MAX ? std::string("INT_MAX")
+                                                    : std::to_string(best.csrmm_nnz_per_row[2]))
+           << "}, " << best.csrgemm_group_nnz << ", " << best.csrgemm_group_products << "}},"
+           << std::endl;
+    }
+    else
+    {
+        os << "# rocsparse-tune, " << prop.name << std::endl << "[" << arch << "]" << std::endl;
+        write_params(os, params);
+    }
+
+    return 0;
+}
@@ -39,12 +39,16 @@ static constexpr size_t s_var_bool_size = countof(rocsparse_clients_envariables:
 static constexpr size_t s_var_string_size
     = countof(rocsparse_clients_envariables::s_var_string_all);
 
-static constexpr const char* s_var_bool_names[s_var_bool_size] = {"ROCSPARSE_CLIENTS_VERBOSE"};
+static constexpr const char* s_var_bool_names[s_var_bool_size]
+    = {"ROCSPARSE_CLIENTS_VERBOSE", "ROCSPARSE_CLIENTS_NO_MATRICES_CACHE"};
 static constexpr const char* s_var_string_names[s_var_string_size]
-    = {"ROCSPARSE_CLIENTS_MATRICES_DIR"};
-static constexpr const char* s_var_bool_descriptions[s_var_bool_size] = {"0: disabled, 1: enabled"};
+    = {"ROCSPARSE_CLIENTS_MATRICES_DIR", "ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR"};
+static constexpr const char* s_var_bool_descriptions[s_var_bool_size]
+    = {"0: disabled, 1: enabled",
+       "0: cache imported matrices, 1: do not cache imported matrices"};
 static constexpr const char* s_var_string_descriptions[s_var_string_size]
-    = {"Full path of the matrices directory"};
+    = {"Full path of the matrices directory",
+       "Full path of the imported matrices cache directory, default is next to the matrix file"};
 
 ///
 /// @brief Grab an environment variable value.
@@ -153,6 +157,7 @@ private:
             switch(tag)
             {
             case rocsparse_clients_envariables::VERBOSE:
+            case rocsparse_clients_envariables::NO_MATRICES_CACHE:
             {
                 const bool success = rocsparse_getenv(
                     s_var_bool_names[tag], this->m_var_bool_defined[tag], this->m_var_bool[tag]);
@@ -172,6 +177,7 @@ private:
             switch(tag)
             {
             case rocsparse_clients_envariables::MATRICES_DIR:
+            case rocsparse_clients_envariables::MATRICES_CACHE_DIR:
             {
                 const bool success = rocsparse_getenv(s_var_string_names[tag],
                                                       this->m_var_string_defined[tag],
@@ -194,6 +200,7 @@ private:
                 switch(tag)
                 {
                 case rocsparse_clients_envariables::VERBOSE:
+                case rocsparse_clients_envariables::NO_MATRICES_CACHE:
                 {
                     const bool v = this->m_var_bool[tag];
                     std::cout << ""
@@ -211,6 +218,7 @@ private:
                 switch(tag)
                 {
                 case rocsparse_clients_envariables::MATRICES_DIR:
+                case rocsparse_clients_envariables::MATRICES_CACHE_DIR:
                 {
                     const std::string v = this->m_var_string[tag];
                     std::cout << ""
@@ -24,6 +24,7 @@
 #include "utility.hpp"
 
 #include <limits>
+#include <map>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -1344,6 +1345,42 @@ void host_coomv(rocsparse_operation  trans,
     }
 }
 
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_coomv_batched(rocsparse_operation  trans,
+                        I                    M,
+                        I                    N,
+                        int64_t              nnz,
+                        int64_t              batch_count,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        int64_t              indices_batch_stride,
+                        const A*             coo_val,
+                        int64_t              values_batch_stride,
+                        const X*             x,
+                        int64_t              x_batch_stride,
+                        T                    beta,
+                        Y*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_index_base base)
+{
+    for(int64_t b = 0; b < batch_count; ++b)
+    {
+        host_coomv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   coo_row_ind + indices_batch_stride * b,
+                   coo_col_ind + indices_batch_stride * b,
+                   coo_val + values_batch_stride * b,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base);
+    }
+}
+
 template <typename T, typename I, typename A, typename X, typename Y>
 void host_coomv_aos(rocsparse_operation  trans,
                     I                    M,
@@ -1765,6 +1802,47 @@ void host_csrmv(rocsparse_operation   trans,
     }
 }
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_csrmv_batched(rocsparse_operation   trans,
+                        J                     M,
+                        J                     N,
+                        I                     nnz,
+                        int64_t               batch_count,
+                        T                     alpha,
+                        const I*              csr_row_ptr,
+                        int64_t               offsets_batch_stride,
+                        const J*              csr_col_ind,
+                        int64_t               columns_batch_stride,
+                        const A*              csr_val,
+                        int64_t               values_batch_stride,
+                        const X*              x,
+                        int64_t               x_batch_stride,
+                        T                     beta,
+                        Y*                    y,
+                        int64_t               y_batch_stride,
+                        rocsparse_index_base  base,
+                        rocsparse_matrix_type matrix_type)
+{
+    for(int64_t b = 0; b < batch_count; ++b)
+    {
+        host_csrmv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   csr_row_ptr + offsets_batch_stride * b,
+                   csr_col_ind + columns_batch_stride * b,
+                   csr_val + values_batch_stride * b,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base,
+                   matrix_type,
+                   rocsparse_spmv_alg_csr_stream,
+                   false);
+    }
+}
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_cscmv(rocsparse_operation trans,
                 J                   M,
@@ -2309,6 +2387,107 @@ void host_ellmv(rocsparse_operation  trans,
     }
 }
 
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_bellmv(rocsparse_operation  trans,
+                 rocsparse_direction  dir,
+                 I                    Mb,
+                 I                    Nb,
+                 I                    bell_cols,
+                 I                    block_dim,
+                 T                    alpha,
+                 const I*             bell_col_ind,
+                 const A*             bell_val,
+                 const X*             x,
+                 T                    beta,
+                 Y*                   y,
+                 rocsparse_index_base base)
+{
+    const I       bell_width = bell_cols / block_dim;
+    const int64_t block_size = static_cast<int64_t>(block_dim) * block_dim;
+
+    // Index of the entry (r, c) of the block p
+    auto val_ind = [&](int64_t p, I r, I c) {
+        return (dir == rocsparse_direction_row) ? p * block_size + block_dim * r + c
+                                                : p * block_size + block_dim * c + r;
+    };
+
+    if(trans == rocsparse_operation_none)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int64_t i = 0; i < static_cast<int64_t>(Mb) * block_dim; ++i)
+        {
+            const I bi = i / block_dim;
+            const I r  = i % block_dim;
+
+            T sum = static_cast<T>(0);
+            for(I l = 0; l < bell_width; ++l)
+            {
+                int64_t p  = (int64_t)l * Mb + bi;
+                I       bj = bell_col_ind[p] - base;
+
+                if(bj >= 0 && bj < Nb)
+                {
+                    for(I c = 0; c < block_dim; ++c)
+                    {
+                        sum = std::fma(static_cast<T>(bell_val[val_ind(p, r, c)]),
+                                       static_cast<T>(x[(int64_t)block_dim * bj + c]),
+                                       static_cast<T>(sum));
+                    }
+                }
+            }
+
+            if(beta != static_cast<T>(0))
+            {
+                y[i] = std::fma(
+                    static_cast<T>(beta), static_cast<T>(y[i]), static_cast<T>(alpha * sum));
+            }
+            else
+            {
+                y[i] = alpha * sum;
+            }
+        }
+    }
+    else
+    {
+        // Scale y with beta
+        for(int64_t i = 0; i < static_cast<int64_t>(Nb) * block_dim; ++i)
+        {
+            y[i] *= beta;
+        }
+
+        // Transposed SpMV
+        for(int64_t i = 0; i < static_cast<int64_t>(Mb) * block_dim; ++i)
+        {
+            const I bi = i / block_dim;
+            const I r  = i % block_dim;
+
+            T row_val = alpha * x[i];
+
+            for(I l = 0; l < bell_width; ++l)
+            {
+                int64_t p  = (int64_t)l * Mb + bi;
+                I       bj = bell_col_ind[p] - base;
+
+                if(bj >= 0 && bj < Nb)
+                {
+                    for(I c = 0; c < block_dim; ++c)
+                    {
+                        T val = (trans == rocsparse_operation_conjugate_transpose)
+                                    ? rocsparse_conj(bell_val[val_ind(p, r, c)])
+                                    : bell_val[val_ind(p, r, c)];
+
+                        int64_t col = (int64_t)block_dim * bj + c;
+                        y[col]      = std::fma(
+                            static_cast<T>(val), static_cast<T>(row_val), static_cast<T>(y[col]));
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename T>
 void host_hybmv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -4694,24 +4873,24 @@ void host_csrgemm_nnz(J                    M,
     *nnz_C = csr_row_ptr_C[M] - base_C;
 }
 
-template <typename T, typename I, typename J>
+template <typename T, typename I, typename J, typename A>
 void host_csrgemm(J                    M,
                   J                    N,
                   J                    L,
                   const T*             alpha,
                   const I*             csr_row_ptr_A,
                   const J*             csr_col_ind_A,
-                  const T*             csr_val_A,
+                  const A*             csr_val_A,
                   const I*             csr_row_ptr_B,
                   const J*             csr_col_ind_B,
-                  const T*             csr_val_B,
+                  const A*             csr_val_B,
                   const T*             beta,
                   const I*             csr_row_ptr_D,
                   const J*             csr_col_ind_D,
-                  const T*             csr_val_D,
+                  const A*             csr_val_D,
                   const I*             csr_row_ptr_C,
                   J*                   csr_col_ind_C,
-                  T*                   csr_val_C,
+                  A*                   csr_val_C,
                   rocsparse_index_base base_A,
                   rocsparse_index_base base_B,
                   rocsparse_index_base base_C,
@@ -4729,6 +4908,12 @@ void host_csrgemm(J                    M,
     {
         return;
     }
+
+    I nnz_C = csr_row_ptr_C[M] - base_C;
+
+    // Accumulate the entries of C in the precision of the computation
+    std::vector<T> val(nnz_C);
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -4782,12 +4967,12 @@ void host_csrgemm(J                    M,
                         {
                             nnz[col_B]               = row_end_C;
                             csr_col_ind_C[row_end_C] = col_B + base_C;
-                            csr_val_C[row_end_C]     = val_A * val_B;
+                            val[row_end_C]           = val_A * val_B;
                             ++row_end_C;
                         }
                         else
                         {
-                            csr_val_C[nnz[col_B]] += val_A * val_B;
+                            val[nnz[col_B]] += val_A * val_B;
                         }
                     }
                 }
@@ -4813,25 +4998,21 @@ void host_csrgemm(J                    M,
                         nnz[col_D] = row_end_C;
 
                         csr_col_ind_C[row_end_C] = col_D + base_C;
-                        csr_val_C[row_end_C]     = val_D;
+                        val[row_end_C]           = val_D;
                         ++row_end_C;
                     }
                     else
                     {
-                        csr_val_C[nnz[col_D]] += val_D;
+                        val[nnz[col_D]] += val_D;
                     }
                 }
             }
         }
     }
 
-    I nnz = csr_row_ptr_C[M] - base_C;
+    std::vector<J> col(nnz_C);
 
-    std::vector<J> col(nnz);
-    std::vector<T> val(nnz);
-
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz);
+    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz_C);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -4858,7 +5039,7 @@ void host_csrgemm(J                    M,
         for(J j = 0; j < row_nnz; ++j)
         {
             csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+            csr_val_C[row_begin + j]     = static_cast<A>(val_entry[perm[j]]);
         }
     }
 }
@@ -5817,6 +5998,303 @@ void host_csrilu0(rocsparse_int                     M,
     }
 }
 
+template <typename T>
+void host_csriluk(rocsparse_int                     level,
+                  rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  std::vector<rocsparse_int>&       lu_row_ptr,
+                  std::vector<rocsparse_int>&       lu_col_ind,
+                  std::vector<T>&                   lu_val,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot)
+{
+    // Level of fill of each entry of the factors
+    std::vector<rocsparse_int> lu_lev;
+
+    lu_row_ptr.resize(M + 1);
+    lu_col_ind.clear();
+    lu_val.clear();
+
+    lu_row_ptr[0] = base;
+
+    // Symbolic factorization, row by row
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        // Levels of the i-th row, sorted by column
+        std::map<rocsparse_int, rocsparse_int> row;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            row[csr_col_ind[j] - base] = 0;
+        }
+
+        // Eliminate the lower part of the row in ascending column order, fill-in is
+        // always inserted to the right of the current column
+        for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
+        {
+            rocsparse_int k     = it->first;
+            rocsparse_int lev_k = it->second;
+
+            for(rocsparse_int j = lu_row_ptr[k] - base; j < lu_row_ptr[k + 1] - base; ++j)
+            {
+                rocsparse_int col = lu_col_ind[j] - base;
+
+                if(col <= k)
+                {
+                    continue;
+                }
+
+                rocsparse_int lev = lev_k + lu_lev[j] + 1;
+
+                if(lev > level)
+                {
+                    continue;
+                }
+
+                auto entry = row.find(col);
+
+                if(entry == row.end())
+                {
+                    row[col] = lev;
+                }
+                else
+                {
+                    entry->second = std::min(entry->second, lev);
+                }
+            }
+        }
+
+        for(auto it = row.begin(); it != row.end(); ++it)
+        {
+            lu_col_ind.push_back(it->first + base);
+            lu_lev.push_back(it->second);
+        }
+
+        lu_row_ptr[i + 1] = static_cast<rocsparse_int>(lu_col_ind.size()) + base;
+    }
+
+    // Copy the entries of A into the factors, fill-in is initialized with zero
+    lu_val.resize(lu_col_ind.size(), static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int k = lu_row_ptr[i] - base;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            while(lu_col_ind[k] != csr_col_ind[j])
+            {
+                ++k;
+            }
+
+            lu_val[k] = csr_val[j];
+        }
+    }
+
+    // Numeric factorization on the pattern of the factors
+    host_csrilu0(M,
+                 lu_row_ptr,
+                 lu_col_ind,
+                 lu_val,
+                 base,
+                 struct_pivot,
+                 numeric_pivot,
+                 false,
+                 static_cast<floating_data_t<T>>(0),
+                 static_cast<T>(0));
+}
+
+template <typename T>
+void host_csritilu0_apply(rocsparse_int        nsweeps,
+                          rocsparse_int        M,
+                          const rocsparse_int* csr_row_ptr,
+                          const rocsparse_int* csr_col_ind,
+                          const T*             ilu0,
+                          rocsparse_index_base base,
+                          const T*             x,
+                          T*                   y)
+{
+    // Jacobi sweeps on L z = x from z = x, then on U y = z from y = inv(D) z
+    std::vector<T> diag(M);
+    std::vector<T> z(x, x + M);
+    std::vector<T> w(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            if(csr_col_ind[k] - base == i)
+            {
+                diag[i] = ilu0[k];
+            }
+        }
+    }
+
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            T sum = static_cast<T>(0);
+            for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+            {
+                const rocsparse_int j = csr_col_ind[k] - base;
+                if(j < i)
+                {
+                    sum += ilu0[k] * z[j];
+                }
+            }
+            w[i] = x[i] - sum;
+        }
+        z.swap(w);
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        y[i] = z[i] / diag[i];
+    }
+
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            T sum = static_cast<T>(0);
+            for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+            {
+                const rocsparse_int j = csr_col_ind[k] - base;
+                if(j > i)
+                {
+                    sum += ilu0[k] * y[j];
+                }
+            }
+            w[i] = (z[i] - sum) / diag[i];
+        }
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            y[i] = w[i];
+        }
+    }
+}
+
+template <typename T>
+void host_csrmc_reorder(rocsparse_int                     M,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        const std::vector<rocsparse_int>& coloring,
+                        rocsparse_index_base              base,
+                        std::vector<rocsparse_int>&       perm,
+                        std::vector<rocsparse_int>&       mc_row_ptr,
+                        std::vector<rocsparse_int>&       mc_col_ind,
+                        std::vector<T>&                   mc_val)
+{
+    // Stable sort of the rows by color
+    perm.resize(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        perm[i] = i;
+    }
+
+    std::stable_sort(perm.begin(), perm.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return coloring[a] < coloring[b];
+    });
+
+    std::vector<rocsparse_int> iperm(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        iperm[perm[i]] = i;
+    }
+
+    // Permute rows and columns, and sort the column indices of each row
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    mc_row_ptr.resize(M + 1);
+    mc_col_ind.resize(nnz);
+    mc_val.resize(nnz);
+
+    mc_row_ptr[0] = base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row = perm[i];
+
+        std::vector<std::pair<rocsparse_int, T>> entries;
+        for(rocsparse_int k = csr_row_ptr[row] - base; k < csr_row_ptr[row + 1] - base; ++k)
+        {
+            entries.push_back(std::make_pair(iperm[csr_col_ind[k] - base], csr_val[k]));
+        }
+
+        std::stable_sort(entries.begin(),
+                         entries.end(),
+                         [](const std::pair<rocsparse_int, T>& a,
+                            const std::pair<rocsparse_int, T>& b) { return a.first < b.first; });
+
+        rocsparse_int idx = mc_row_ptr[i] - base;
+        for(size_t k = 0; k < entries.size(); ++k)
+        {
+            mc_col_ind[idx + k] = entries[k].first + base;
+            mc_val[idx + k]     = entries[k].second;
+        }
+
+        mc_row_ptr[i + 1] = mc_row_ptr[i] + static_cast<rocsparse_int>(entries.size());
+    }
+}
+
+template <typename T>
+void host_csrmcgs(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& mc_row_ptr,
+                  const std::vector<rocsparse_int>& mc_col_ind,
+                  const std::vector<T>&             mc_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int                     nsweeps,
+                  bool                              symmetric,
+                  const std::vector<T>&             b,
+                  std::vector<T>&                   x)
+{
+    // Rows of the same color are not coupled, such that relaxing the color ordered matrix
+    // row by row is equivalent to relaxing it color by color
+    auto relax = [&](rocsparse_int i) {
+        T    sum      = static_cast<T>(0);
+        T    diag     = static_cast<T>(0);
+        bool has_diag = false;
+        for(rocsparse_int k = mc_row_ptr[i] - base; k < mc_row_ptr[i + 1] - base; ++k)
+        {
+            rocsparse_int j = mc_col_ind[k] - base;
+            if(j == i)
+            {
+                diag     = mc_val[k];
+                has_diag = true;
+            }
+            else
+            {
+                sum = std::fma(mc_val[k], x[j], sum);
+            }
+        }
+
+        // Rows without diagonal entry are left untouched
+        if(has_diag)
+        {
+            x[i] = (b[i] - sum) / diag;
+        }
+    };
+
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            relax(i);
+        }
+
+        if(symmetric)
+        {
+            for(rocsparse_int i = M - 1; i >= 0; --i)
+            {
+                relax(i);
+            }
+        }
+    }
+}
+
 // Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
@@ -7587,11 +8065,47 @@ void host_csr_to_hyb(rocsparse_int                     M,
     ell_nnz = 0;
     coo_nnz = 0;
 
-    // Auto and user width
-    if(part == rocsparse_hyb_partition_auto || part == rocsparse_hyb_partition_user)
+    // Cost based width
+    if(part == rocsparse_hyb_partition_cost)
+    {
+        // Bytes moved by hybmv per ELL slot and additional bytes per COO entry
+        int64_t ell_bytes = sizeof(rocsparse_int) + sizeof(T);
+        int64_t coo_bytes = 2 * sizeof(rocsparse_int) + 3 * sizeof(T);
+
+        // Row length histogram, clamped to the ELL width limit
+        rocsparse_int              width_limit = 2 * (nnz - 1) / M + 1;
+        std::vector<rocsparse_int> hist(width_limit + 1, 0);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            ++hist[std::min(csr_row_ptr[i + 1] - csr_row_ptr[i], width_limit)];
+        }
+
+        // Largest width for which extending the ELL part still pays off
+        ell_width         = 0;
+        rocsparse_int cnt = 0;
+
+        for(rocsparse_int k = width_limit; k > 0; --k)
+        {
+            cnt += hist[k];
+
+            if(cnt * coo_bytes > M * ell_bytes)
+            {
+                ell_width = k;
+                break;
+            }
+        }
+    }
+
+    // Auto, user and cost based width
+    if(part == rocsparse_hyb_partition_auto || part == rocsparse_hyb_partition_user
+       || part == rocsparse_hyb_partition_cost)
     {
         // Determine ELL width
-        ell_width = (part == rocsparse_hyb_partition_auto) ? (nnz - 1) / M + 1 : ell_width;
+        if(part == rocsparse_hyb_partition_auto)
+        {
+            ell_width = (nnz - 1) / M + 1;
+        }
 
         // Determine COO nnz
         for(rocsparse_int i = 0; i < M; ++i)
@@ -8304,6 +8818,44 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      bool                              boost,                     \
                                      floating_data_t<TYPE>             boost_tol,                 \
                                      TYPE                              boost_val);                                             \
+    template void             host_csriluk<TYPE>(rocsparse_int                     level,                     \
+                                     rocsparse_int                     M,                         \
+                                     const std::vector<rocsparse_int>& csr_row_ptr,               \
+                                     const std::vector<rocsparse_int>& csr_col_ind,               \
+                                     const std::vector<TYPE>&          csr_val,                   \
+                                     rocsparse_index_base              base,                      \
+                                     std::vector<rocsparse_int>&       lu_row_ptr,                \
+                                     std::vector<rocsparse_int>&       lu_col_ind,                \
+                                     std::vector<TYPE>&                lu_val,                    \
+                                     rocsparse_int*                    struct_pivot,              \
+                                     rocsparse_int*                    numeric_pivot);            \
+    template void             host_csritilu0_apply<TYPE>(rocsparse_int        nsweeps,        \
+                                             rocsparse_int        M,              \
+                                             const rocsparse_int* csr_row_ptr,    \
+                                             const rocsparse_int* csr_col_ind,    \
+                                             const TYPE*          ilu0,           \
+                                             rocsparse_index_base base,           \
+                                             const TYPE*          x,              \
+                                             TYPE*                y);             \
+    template void             host_csrmc_reorder<TYPE>(rocsparse_int                     M,                  \
+                                           const std::vector<rocsparse_int>& csr_row_ptr,        \
+                                           const std::vector<rocsparse_int>& csr_col_ind,        \
+                                           const std::vector<TYPE>&          csr_val,            \
+                                           const std::vector<rocsparse_int>& coloring,           \
+                                           rocsparse_index_base              base,               \
+                                           std::vector<rocsparse_int>&       perm,               \
+                                           std::vector<rocsparse_int>&       mc_row_ptr,         \
+                                           std::vector<rocsparse_int>&       mc_col_ind,         \
+                                           std::vector<TYPE>&                mc_val);            \
+    template void             host_csrmcgs<TYPE>(rocsparse_int                     M,                        \
+                                     const std::vector<rocsparse_int>& mc_row_ptr,               \
+                                     const std::vector<rocsparse_int>& mc_col_ind,               \
+                                     const std::vector<TYPE>&          mc_val,                   \
+                                     rocsparse_index_base              base,                     \
+                                     rocsparse_int                     nsweeps,                  \
+                                     bool                              symmetric,                \
+                                     const std::vector<TYPE>&          b,                        \
+                                     std::vector<TYPE>&                x);                       \
     template void             host_gtsv_no_pivot<TYPE>(rocsparse_int            m,                            \
                                            rocsparse_int            n,                            \
                                            const std::vector<TYPE>& dl,                           \
@@ -8829,27 +9381,50 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                         rocsparse_index_base base_B,           \
                                                         rocsparse_index_base base_C,           \
                                                         rocsparse_index_base base_D);          \
-    template void host_csrgemm<TTYPE, ITYPE, JTYPE>(JTYPE                M,                    \
-                                                    JTYPE                N,                    \
-                                                    JTYPE                L,                    \
-                                                    const TTYPE*         alpha,                \
-                                                    const ITYPE*         csr_row_ptr_A,        \
-                                                    const JTYPE*         csr_col_ind_A,        \
-                                                    const TTYPE*         csr_val_A,            \
-                                                    const ITYPE*         csr_row_ptr_B,        \
-                                                    const JTYPE*         csr_col_ind_B,        \
-                                                    const TTYPE*         csr_val_B,            \
-                                                    const TTYPE*         beta,                 \
-                                                    const ITYPE*         csr_row_ptr_D,        \
-                                                    const JTYPE*         csr_col_ind_D,        \
-                                                    const TTYPE*         csr_val_D,            \
-                                                    const ITYPE*         csr_row_ptr_C,        \
-                                                    JTYPE*               csr_col_ind_C,        \
-                                                    TTYPE*               csr_val_C,            \
-                                                    rocsparse_index_base base_A,               \
-                                                    rocsparse_index_base base_B,               \
-                                                    rocsparse_index_base base_C,               \
-                                                    rocsparse_index_base base_D);
+    template void host_csrgemm<TTYPE, ITYPE, JTYPE, TTYPE>(JTYPE                M,             \
+                                                           JTYPE                N,             \
+                                                           JTYPE                L,             \
+                                                           const TTYPE*         alpha,         \
+                                                           const ITYPE*         csr_row_ptr_A, \
+                                                           const JTYPE*         csr_col_ind_A, \
+                                                           const TTYPE*         csr_val_A,     \
+                                                           const ITYPE*         csr_row_ptr_B, \
+                                                           const JTYPE*         csr_col_ind_B, \
+                                                           const TTYPE*         csr_val_B,     \
+                                                           const TTYPE*         beta,          \
+                                                           const ITYPE*         csr_row_ptr_D, \
+                                                           const JTYPE*         csr_col_ind_D, \
+                                                           const TTYPE*         csr_val_D,     \
+                                                           const ITYPE*         csr_row_ptr_C, \
+                                                           JTYPE*               csr_col_ind_C, \
+                                                           TTYPE*               csr_val_C,     \
+                                                           rocsparse_index_base base_A,        \
+                                                           rocsparse_index_base base_B,        \
+                                                           rocsparse_index_base base_C,        \
+                                                           rocsparse_index_base base_D);
+
+#define INSTANTIATE_IJAT(ITYPE, JTYPE, ATYPE, TTYPE)                                           \
+    template void host_csrgemm<TTYPE, ITYPE, JTYPE, ATYPE>(JTYPE                M,             \
+                                                           JTYPE                N,             \
+                                                           JTYPE                L,             \
+                                                           const TTYPE*         alpha,         \
+                                                           const ITYPE*         csr_row_ptr_A, \
+                                                           const JTYPE*         csr_col_ind_A, \
+                                                           const ATYPE*         csr_val_A,     \
+                                                           const ITYPE*         csr_row_ptr_B, \
+                                                           const JTYPE*         csr_col_ind_B, \
+                                                           const ATYPE*         csr_val_B,     \
+                                                           const TTYPE*         beta,          \
+                                                           const ITYPE*         csr_row_ptr_D, \
+                                                           const JTYPE*         csr_col_ind_D, \
+                                                           const ATYPE*         csr_val_D,     \
+                                                           const ITYPE*         csr_row_ptr_C, \
+                                                           JTYPE*               csr_col_ind_C, \
+                                                           ATYPE*               csr_val_C,     \
+                                                           rocsparse_index_base base_A,        \
+                                                           rocsparse_index_base base_B,        \
+                                                           rocsparse_index_base base_C,        \
+                                                           rocsparse_index_base base_D)
 
 #define INSTANTIATE_IXYT(ITYPE, XTYPE, YTYPE, TTYPE)                                  \
     template void host_doti<ITYPE, XTYPE, YTYPE, TTYPE>(ITYPE                nnz,     \
@@ -8886,86 +9461,135 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                            TTYPE*               A,                   \
                                                            ITYPE                ld);
 
-#define INSTANTIATE_IJAXYT(ITYPE, JTYPE, ATYPE, XTYPE, YTYPE, TTYPE) \
-    template void host_bsrmv(rocsparse_direction  dir,               \
-                             rocsparse_operation  trans,             \
-                             JTYPE                mb,                \
-                             JTYPE                nb,                \
-                             ITYPE                nnzb,              \
-                             TTYPE                alpha,             \
-                             const ITYPE*         bsr_row_ptr,       \
-                             const JTYPE*         bsr_col_ind,       \
-                             const ATYPE*         bsr_val,           \
-                             JTYPE                bsr_dim,           \
-                             const XTYPE*         x,                 \
-                             TTYPE                beta,              \
-                             YTYPE*               y,                 \
-                             rocsparse_index_base base);             \
-    template void host_cscmv(rocsparse_operation   trans,            \
-                             JTYPE                 M,                \
-                             JTYPE                 N,                \
-                             ITYPE                 nnz,              \
-                             TTYPE                 alpha,            \
-                             const ITYPE*          csc_col_ptr,      \
-                             const JTYPE*          csc_row_ind,      \
-                             const ATYPE*          csc_val,          \
-                             const XTYPE*          x,                \
-                             TTYPE                 beta,             \
-                             YTYPE*                y,                \
-                             rocsparse_index_base  base,             \
-                             rocsparse_matrix_type matrix_type,      \
-                             rocsparse_spmv_alg    algo);               \
-    template void host_csrmv(rocsparse_operation   trans,            \
-                             JTYPE                 M,                \
-                             JTYPE                 N,                \
-                             ITYPE                 nnz,              \
-                             TTYPE                 alpha,            \
-                             const ITYPE*          csr_row_ptr,      \
-                             const JTYPE*          csr_col_ind,      \
-                             const ATYPE*          csr_val,          \
-                             const XTYPE*          x,                \
-                             TTYPE                 beta,             \
-                             YTYPE*                y,                \
-                             rocsparse_index_base  base,             \
-                             rocsparse_matrix_type matrix_type,      \
-                             rocsparse_spmv_alg    algo,             \
-                             bool                  force_conj)
-
-#define INSTANTIATE_IAXYT(ITYPE, ATYPE, XTYPE, YTYPE, TTYPE)   \
-    template void host_coomv(rocsparse_operation  trans,       \
-                             ITYPE                M,           \
-                             ITYPE                N,           \
-                             int64_t              nnz,         \
-                             TTYPE                alpha,       \
-                             const ITYPE*         coo_row_ind, \
-                             const ITYPE*         coo_col_ind, \
-                             const ATYPE*         coo_val,     \
-                             const XTYPE*         x,           \
-                             TTYPE                beta,        \
-                             YTYPE*               y,           \
-                             rocsparse_index_base base);       \
-    template void host_coomv_aos(rocsparse_operation  trans,   \
-                                 ITYPE                M,       \
-                                 ITYPE                N,       \
-                                 int64_t              nnz,     \
-                                 TTYPE                alpha,   \
-                                 const ITYPE*         coo_ind, \
-                                 const ATYPE*         coo_val, \
-                                 const XTYPE*         x,       \
-                                 TTYPE                beta,    \
-                                 YTYPE*               y,       \
-                                 rocsparse_index_base base);   \
-    template void host_ellmv(rocsparse_operation  trans,       \
-                             ITYPE                M,           \
-                             ITYPE                N,           \
-                             TTYPE                alpha,       \
-                             const ITYPE*         ell_col_ind, \
-                             const ATYPE*         ell_val,     \
-                             ITYPE                ell_width,   \
-                             const XTYPE*         x,           \
-                             TTYPE                beta,        \
-                             YTYPE*               y,           \
-                             rocsparse_index_base base);
+#define INSTANTIATE_IJAXYT(ITYPE, JTYPE, ATYPE, XTYPE, YTYPE, TTYPE)             \
+    template void host_bsrmv(rocsparse_direction  dir,                           \
+                             rocsparse_operation  trans,                         \
+                             JTYPE                mb,                            \
+                             JTYPE                nb,                            \
+                             ITYPE                nnzb,                          \
+                             TTYPE                alpha,                         \
+                             const ITYPE*         bsr_row_ptr,                   \
+                             const JTYPE*         bsr_col_ind,                   \
+                             const ATYPE*         bsr_val,                       \
+                             JTYPE                bsr_dim,                       \
+                             const XTYPE*         x,                             \
+                             TTYPE                beta,                          \
+                             YTYPE*               y,                             \
+                             rocsparse_index_base base);                         \
+    template void host_cscmv(rocsparse_operation   trans,                        \
+                             JTYPE                 M,                            \
+                             JTYPE                 N,                            \
+                             ITYPE                 nnz,                          \
+                             TTYPE                 alpha,                        \
+                             const ITYPE*          csc_col_ptr,                  \
+                             const JTYPE*          csc_row_ind,                  \
+                             const ATYPE*          csc_val,                      \
+                             const XTYPE*          x,                            \
+                             TTYPE                 beta,                         \
+                             YTYPE*                y,                            \
+                             rocsparse_index_base  base,                         \
+                             rocsparse_matrix_type matrix_type,                  \
+                             rocsparse_spmv_alg    algo);                        \
+    template void host_csrmv(rocsparse_operation   trans,                        \
+                             JTYPE                 M,                            \
+                             JTYPE                 N,                            \
+                             ITYPE                 nnz,                          \
+                             TTYPE                 alpha,                        \
+                             const ITYPE*          csr_row_ptr,                  \
+                             const JTYPE*          csr_col_ind,                  \
+                             const ATYPE*          csr_val,                      \
+                             const XTYPE*          x,                            \
+                             TTYPE                 beta,                         \
+                             YTYPE*                y,                            \
+                             rocsparse_index_base  base,                         \
+                             rocsparse_matrix_type matrix_type,                  \
+                             rocsparse_spmv_alg    algo,                         \
+                             bool                  force_conj);                  \
+    template void host_csrmv_batched(rocsparse_operation   trans,                \
+                                     JTYPE                 M,                    \
+                                     JTYPE                 N,                    \
+                                     ITYPE                 nnz,                  \
+                                     int64_t               batch_count,          \
+                                     TTYPE                 alpha,                \
+                                     const ITYPE*          csr_row_ptr,          \
+                                     int64_t               offsets_batch_stride, \
+                                     const JTYPE*          csr_col_ind,          \
+                                     int64_t               columns_batch_stride, \
+                                     const ATYPE*          csr_val,              \
+                                     int64_t               values_batch_stride,  \
+                                     const XTYPE*          x,                    \
+                                     int64_t               x_batch_stride,       \
+                                     TTYPE                 beta,                 \
+                                     YTYPE*                y,                    \
+                                     int64_t               y_batch_stride,       \
+                                     rocsparse_index_base  base,                 \
+                                     rocsparse_matrix_type matrix_type)
+
+#define INSTANTIATE_IAXYT(ITYPE, ATYPE, XTYPE, YTYPE, TTYPE)                    \
+    template void host_coomv(rocsparse_operation  trans,                        \
+                             ITYPE                M,                            \
+                             ITYPE                N,                            \
+                             int64_t              nnz,                          \
+                             TTYPE                alpha,                        \
+                             const ITYPE*         coo_row_ind,                  \
+                             const ITYPE*         coo_col_ind,                  \
+                             const ATYPE*         coo_val,                      \
+                             const XTYPE*         x,                            \
+                             TTYPE                beta,                         \
+                             YTYPE*               y,                            \
+                             rocsparse_index_base base);                        \
+    template void host_coomv_batched(rocsparse_operation  trans,                \
+                                     ITYPE                M,                    \
+                                     ITYPE                N,                    \
+                                     int64_t              nnz,                  \
+                                     int64_t              batch_count,          \
+                                     TTYPE                alpha,                \
+                                     const ITYPE*         coo_row_ind,          \
+                                     const ITYPE*         coo_col_ind,          \
+                                     int64_t              indices_batch_stride, \
+                                     const ATYPE*         coo_val,              \
+                                     int64_t              values_batch_stride,  \
+                                     const XTYPE*         x,                    \
+                                     int64_t              x_batch_stride,       \
+                                     TTYPE                beta,                 \
+                                     YTYPE*               y,                    \
+                                     int64_t              y_batch_stride,       \
+                                     rocsparse_index_base base);                \
+    template void host_coomv_aos(rocsparse_operation  trans,                    \
+                                 ITYPE                M,                        \
+                                 ITYPE                N,                        \
+                                 int64_t              nnz,                      \
+                                 TTYPE                alpha,                    \
+                                 const ITYPE*         coo_ind,                  \
+                                 const ATYPE*         coo_val,                  \
+                                 const XTYPE*         x,                        \
+                                 TTYPE                beta,                     \
+                                 YTYPE*               y,                        \
+                                 rocsparse_index_base base);                    \
+    template void host_ellmv(rocsparse_operation  trans,                        \
+                             ITYPE                M,                            \
+                             ITYPE                N,                            \
+                             TTYPE                alpha,                        \
+                             const ITYPE*         ell_col_ind,                  \
+                             const ATYPE*         ell_val,                      \
+                             ITYPE                ell_width,                    \
+                             const XTYPE*         x,                            \
+                             TTYPE                beta,                         \
+                             YTYPE*               y,                            \
+                             rocsparse_index_base base);                        \
+    template void host_bellmv(rocsparse_operation  trans,                       \
+                              rocsparse_direction  dir,                         \
+                              ITYPE                Mb,                          \
+                              ITYPE                Nb,                          \
+                              ITYPE                bell_cols,                   \
+                              ITYPE                block_dim,                   \
+                              TTYPE                alpha,                       \
+                              const ITYPE*         bell_col_ind,                \
+                              const ATYPE*         bell_val,                    \
+                              const XTYPE*         x,                           \
+                              TTYPE                beta,                        \
+                              YTYPE*               y,                           \
+                              rocsparse_index_base base);
 
 INSTANTIATE_GATHER_SCATTER(int32_t, int8_t);
 INSTANTIATE_GATHER_SCATTER(int32_t, float);
@@ -9008,6 +9632,10 @@ INSTANTIATE_IJT(int64_t, int64_t, double);
 INSTANTIATE_IJT(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE_IJT(int64_t, int64_t, rocsparse_double_complex);
 
+INSTANTIATE_IJAT(int32_t, int32_t, float, double);
+INSTANTIATE_IJAT(int64_t, int32_t, float, double);
+INSTANTIATE_IJAT(int64_t, int64_t, float, double);
+
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, float);
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, double);
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, rocsparse_float_complex);
@@ -9065,6 +9693,14 @@ INSTANTIATE_IJAXYT(int32_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE_IJAXYT(int64_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE_IJAXYT(int64_t, int64_t, int8_t, int8_t, float, float);
 
+INSTANTIATE_IJAXYT(int32_t, int32_t, _Float16, float, float, float);
+INSTANTIATE_IJAXYT(int64_t, int32_t, _Float16, float, float, float);
+INSTANTIATE_IJAXYT(int64_t, int64_t, _Float16, float, float, float);
+
+INSTANTIATE_IJAXYT(int32_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_IJAXYT(int64_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_IJAXYT(int64_t, int64_t, hip_bfloat16, float, float, float);
+
 INSTANTIATE_IJAXYT(int32_t, int32_t, float, double, double, double);
 INSTANTIATE_IJAXYT(int64_t, int32_t, float, double, double, double);
 INSTANTIATE_IJAXYT(int64_t, int64_t, float, double, double, double);
@@ -9172,6 +9808,10 @@ INSTANTIATE_IAXYT(int32_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE_IAXYT(int64_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE_IAXYT(int32_t, int8_t, int8_t, float, float);
 INSTANTIATE_IAXYT(int64_t, int8_t, int8_t, float, float);
+INSTANTIATE_IAXYT(int32_t, _Float16, float, float, float);
+INSTANTIATE_IAXYT(int64_t, _Float16, float, float, float);
+INSTANTIATE_IAXYT(int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_IAXYT(int64_t, hip_bfloat16, float, float, float);
 INSTANTIATE_IAXYT(
     int32_t, float, rocsparse_float_complex, rocsparse_float_complex, rocsparse_float_complex);
 INSTANTIATE_IAXYT(
@@ -23,50 +23,286 @@
  * ************************************************************************ */
 #include "rocsparse_importer_matrixmarket.hpp"
 #include <stdio.h>
+
+#ifdef WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 rocsparse_importer_matrixmarket::rocsparse_importer_matrixmarket(const std::string& filename_)
     : m_filename(filename_)
 {
 }
 
+rocsparse_importer_matrixmarket::~rocsparse_importer_matrixmarket()
+{
+    this->unmap_file();
+}
+
+rocsparse_status rocsparse_importer_matrixmarket::map_file()
+{
+    if(this->m_buffer != nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+#ifdef WIN32
+    std::ifstream in(this->m_filename, std::ios::binary | std::ios::ate);
+    if(!in)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::map_file: cannot open file '"
+                  << this->m_filename << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    this->m_buffer_size = static_cast<size_t>(in.tellg());
+    this->m_buffer_storage.resize(this->m_buffer_size + 1);
+    in.seekg(0);
+    if(!in.read(this->m_buffer_storage.data(), this->m_buffer_size))
+    {
+        return rocsparse_status_internal_error;
+    }
+    this->m_buffer = this->m_buffer_storage.data();
+#else
+    const int fd = open(this->m_filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::map_file: cannot open file '"
+                  << this->m_filename << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return rocsparse_status_internal_error;
+    }
+
+    this->m_buffer_size = static_cast<size_t>(st.st_size);
+    if(this->m_buffer_size == 0)
+    {
+        close(fd);
+        this->m_buffer_storage.resize(1);
+        this->m_buffer = this->m_buffer_storage.data();
+        return rocsparse_status_success;
+    }
+
+    void* p = mmap(nullptr, this->m_buffer_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(p == MAP_FAILED)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::map_file: cannot map file '"
+                  << this->m_filename << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    // The chunks are read concurrently, ask for the whole file.
+    madvise(p, this->m_buffer_size, MADV_WILLNEED);
+    this->m_buffer = static_cast<const char*>(p);
+#endif
+    return rocsparse_status_success;
+}
+
+void rocsparse_importer_matrixmarket::unmap_file()
+{
+#ifndef WIN32
+    if(this->m_buffer != nullptr && this->m_buffer_storage.empty())
+    {
+        munmap(const_cast<char*>(this->m_buffer), this->m_buffer_size);
+    }
+#endif
+    this->m_buffer      = nullptr;
+    this->m_buffer_size = 0;
+    this->m_buffer_storage.clear();
+}
+
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, int8_t& val)
+/*! \brief  Hand-rolled parsing of the mtx file content, the content is not null-terminated. */
+static inline const char* mtx_skip_blanks(const char* p, const char* end)
 {
-    is >> row >> col >> val;
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+    return p;
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, float& val)
+static inline const char* mtx_next_line(const char* p, const char* end)
 {
-    is >> row >> col >> val;
+    const char* q = static_cast<const char*>(memchr(p, '\n', end - p));
+    return (q != nullptr) ? q + 1 : end;
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, double& val)
+static inline bool mtx_is_entry_line(const char* p, const char* end)
 {
-    is >> row >> col >> val;
+    p = mtx_skip_blanks(p, end);
+    return (p < end && *p != '\n' && *p != '%');
 }
 
-static inline void
-    read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, rocsparse_float_complex& val)
+static inline bool mtx_parse_int(const char*& p, const char* end, int64_t& x)
 {
-    float real{};
-    float imag{};
+    p = mtx_skip_blanks(p, end);
 
-    is >> row >> col >> real >> imag;
+    bool neg = false;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-');
+        ++p;
+    }
 
-    val = {real, imag};
+    if(p == end || *p < '0' || *p > '9')
+    {
+        return false;
+    }
+
+    static constexpr uint64_t int64max = std::numeric_limits<int64_t>::max();
+
+    uint64_t v = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        const uint64_t d = *p - '0';
+        if(v > (int64max - d) / 10)
+        {
+            return false;
+        }
+        v = v * 10 + d;
+        ++p;
+    }
+
+    x = neg ? -static_cast<int64_t>(v) : static_cast<int64_t>(v);
+    return true;
+}
+
+static inline bool mtx_parse_real(const char*& p, const char* end, double& x)
+{
+    p = mtx_skip_blanks(p, end);
+
+    // Copy the token so that strtod sees a null-terminated string and cannot read past the
+    // mapping.
+    char   token[64];
+    size_t len = 0;
+    while(p + len < end && len < sizeof(token) - 1 && p[len] != ' ' && p[len] != '\t'
+          && p[len] != '\r' && p[len] != '\n')
+    {
+        ++len;
+    }
+
+    if(len == 0 || len == sizeof(token) - 1)
+    {
+        return false;
+    }
+
+    memcpy(token, p, len);
+    token[len] = '\0';
+
+    char* last;
+    x = strtod(token, &last);
+    if(last != token + len)
+    {
+        return false;
+    }
+
+    p += len;
+    return true;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix value from mtx file */
+static inline bool read_mtx_value(const char*& p, const char* end, int8_t& val)
+{
+    int64_t tmp{};
+    if(!mtx_parse_int(p, end, tmp))
+    {
+        return false;
+    }
+
+    val = static_cast<int8_t>(tmp);
+    return true;
 }
 
-static inline void read_mtx_value(std::istringstream&       is,
-                                  int64_t&                  row,
-                                  int64_t&                  col,
-                                  rocsparse_double_complex& val)
+static inline bool read_mtx_value(const char*& p, const char* end, _Float16& val)
+{
+    double tmp{};
+    if(!mtx_parse_real(p, end, tmp))
+    {
+        return false;
+    }
+
+    val = static_cast<_Float16>(static_cast<float>(tmp));
+    return true;
+}
+
+static inline bool read_mtx_value(const char*& p, const char* end, hip_bfloat16& val)
+{
+    double tmp{};
+    if(!mtx_parse_real(p, end, tmp))
+    {
+        return false;
+    }
+
+    val = static_cast<hip_bfloat16>(static_cast<float>(tmp));
+    return true;
+}
+
+static inline bool read_mtx_value(const char*& p, const char* end, float& val)
+{
+    double tmp{};
+    if(!mtx_parse_real(p, end, tmp))
+    {
+        return false;
+    }
+
+    val = static_cast<float>(tmp);
+    return true;
+}
+
+static inline bool read_mtx_value(const char*& p, const char* end, double& val)
+{
+    return mtx_parse_real(p, end, val);
+}
+
+static inline bool read_mtx_value(const char*& p, const char* end, rocsparse_float_complex& val)
 {
     double real{};
     double imag{};
+    if(!mtx_parse_real(p, end, real) || !mtx_parse_real(p, end, imag))
+    {
+        return false;
+    }
 
-    is >> row >> col >> real >> imag;
+    val = {static_cast<float>(real), static_cast<float>(imag)};
+    return true;
+}
+
+static inline bool read_mtx_value(const char*& p, const char* end, rocsparse_double_complex& val)
+{
+    double real{};
+    double imag{};
+    if(!mtx_parse_real(p, end, real) || !mtx_parse_real(p, end, imag))
+    {
+        return false;
+    }
 
     val = {real, imag};
+    return true;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read the row and column indices of a coefficient line */
+static inline bool read_mtx_indices(
+    const char*& p, const char* end, int64_t m, int64_t n, int64_t& row, int64_t& col)
+{
+    return mtx_parse_int(p, end, row) && mtx_parse_int(p, end, col) && row >= 1 && row <= m
+           && col >= 1 && col <= n;
 }
 
 template <typename I, typename J>
@@ -109,20 +345,29 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
                                                                     int64_t*              nnz,
                                                                     rocsparse_index_base* base)
 {
-    char line[1024];
-    f = fopen(this->m_filename.c_str(), "r");
-    if(!f)
+    rocsparse_status status = this->map_file();
+    if(status != rocsparse_status_success)
     {
-        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: cannot open file '"
-                  << this->m_filename << "' " << std::endl;
-        return rocsparse_status_internal_error;
+        return status;
     }
+
+    const char* const buffer_end = this->m_buffer + this->m_buffer_size;
+
     // Check for banner
-    if(!fgets(line, 1024, f))
+    const char* p = this->m_buffer;
+    if(p == buffer_end)
     {
         throw rocsparse_status_internal_error;
     }
 
+    char line[1024];
+    {
+        const size_t len = std::min(static_cast<size_t>(mtx_next_line(p, buffer_end) - p),
+                                    sizeof(line) - 1);
+        memcpy(line, p, len);
+        line[len] = '\0';
+    }
+
     char banner[16];
     char array[16];
     char coord[16];
@@ -179,178 +424,267 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
     this->m_symm = !strcmp(type, "symmetric");
 
     // Skip comments
-    while(fgets(line, 1024, f))
+    p = mtx_next_line(p, buffer_end);
+    while(p < buffer_end && !mtx_is_entry_line(p, buffer_end))
     {
-        if(line[0] != '%')
-        {
-            break;
-        }
+        p = mtx_next_line(p, buffer_end);
     }
 
-    // Read dimensions
-    I snnz;
-
-    int inrow;
-    int incol;
-    int innz;
-
-    sscanf(line, "%d %d %d", &inrow, &incol, &innz);
-
-    rocsparse_status status;
-    status = rocsparse_type_conversion(inrow, m[0]);
-    if(status != rocsparse_status_success)
-        return status;
-
-    status = rocsparse_type_conversion(incol, n[0]);
-    if(status != rocsparse_status_success)
-        return status;
-
-    status = rocsparse_type_conversion(innz, snnz);
-    if(status != rocsparse_status_success)
-        return status;
-
-    if(this->m_symm)
+    // Read dimensions, with 64-bit integers
+    int64_t inrow;
+    int64_t incol;
+    int64_t innz;
+    if(!mtx_parse_int(p, buffer_end, inrow) || !mtx_parse_int(p, buffer_end, incol)
+       || !mtx_parse_int(p, buffer_end, innz) || inrow < 0 || incol < 0 || innz < 0)
     {
-        //
-        //
-        // We need to count how many diagonal elements are in the file.
-        //
-        //
+        throw rocsparse_status_internal_error;
+    }
 
-        //
-        // Record position.
-        //
-        fpos_t pos;
-        if(0 != fgetpos(this->f, &pos))
+    this->m_m             = inrow;
+    this->m_n             = incol;
+    this->m_entries_begin = mtx_next_line(p, buffer_end) - this->m_buffer;
+
+    //
+    // Split the coefficient lines into chunks aligned on line boundaries.
+    //
+    static constexpr size_t chunk_min_size = 1 << 20;
+
+    const size_t entries_size = this->m_buffer_size - this->m_entries_begin;
+    int64_t      nthreads     = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+    const int64_t nchunks = std::max(
+        static_cast<int64_t>(1),
+        std::min(static_cast<int64_t>(entries_size / chunk_min_size), 8 * nthreads));
+
+    this->m_chunk_ptr.resize(nchunks + 1);
+    this->m_chunk_ptr[0]       = this->m_entries_begin;
+    this->m_chunk_ptr[nchunks] = this->m_buffer_size;
+    for(int64_t c = 1; c < nchunks; ++c)
+    {
+        size_t pos = this->m_entries_begin + (entries_size / nchunks) * c;
+        if(pos > this->m_chunk_ptr[c - 1])
         {
-            throw rocsparse_status_internal_error;
+            pos = mtx_next_line(this->m_buffer + pos - 1, buffer_end) - this->m_buffer;
         }
+        this->m_chunk_ptr[c] = std::max(pos, this->m_chunk_ptr[c - 1]);
+    }
+
+    //
+    // Count the coefficient lines of each chunk, and the number of coefficients once the
+    // symmetric part is expanded; this replaces a second pass over the file for counting
+    // the diagonal coefficients.
+    //
+    std::vector<int64_t> chunk_nlines(nchunks, 0);
+    this->m_chunk_nnz.resize(nchunks + 1);
+    this->m_chunk_nnz[0] = 0;
+
+    int64_t num_invalid_chunks = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : num_invalid_chunks)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        const char* q     = this->m_buffer + this->m_chunk_ptr[c];
+        const char* q_end = this->m_buffer + this->m_chunk_ptr[c + 1];
 
-        //
-        // Count diagonal coefficients.
-        //
-        I num_diagonal_coefficients = 0;
-        while(fgets(line, 1024, f))
+        int64_t nlines   = 0;
+        int64_t nentries = 0;
+        while(q < q_end)
         {
-            int32_t irow{};
-            int32_t icol{};
-            sscanf(line, "%d %d", &irow, &icol);
-            if(irow == icol)
+            if(mtx_is_entry_line(q, q_end))
             {
-                ++num_diagonal_coefficients;
+                int64_t irow;
+                int64_t icol;
+                if(!read_mtx_indices(q, q_end, this->m_m, this->m_n, irow, icol))
+                {
+                    ++num_invalid_chunks;
+                    break;
+                }
+
+                ++nlines;
+                nentries += (this->m_symm && irow != icol) ? 2 : 1;
             }
+            q = mtx_next_line(q, q_end);
         }
 
-        //
-        // Set position.
-        //
-        if(0 != fsetpos(this->f, &pos))
-        {
-            throw rocsparse_status_internal_error;
-        }
+        chunk_nlines[c]          = nlines;
+        this->m_chunk_nnz[c + 1] = nentries;
+    }
 
-        //
-        // Now calculate the right number of coefficients.
-        //
-        snnz = (snnz - num_diagonal_coefficients) * 2 + num_diagonal_coefficients;
+    if(num_invalid_chunks > 0)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: invalid coefficient in '"
+                  << this->m_filename << "' " << std::endl;
+        throw rocsparse_status_internal_error;
+    }
+
+    int64_t nlines = 0;
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        nlines += chunk_nlines[c];
+        this->m_chunk_nnz[c + 1] += this->m_chunk_nnz[c];
     }
 
-    status = rocsparse_type_conversion(snnz, nnz[0]);
+    if(nlines != innz)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: found " << nlines
+                  << " coefficients instead of " << innz << " in '" << this->m_filename << "' "
+                  << std::endl;
+        throw rocsparse_status_internal_error;
+    }
+
+    status = rocsparse_type_conversion(inrow, m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(incol, n[0]);
     if(status != rocsparse_status_success)
         return status;
 
+    nnz[0]      = this->m_chunk_nnz[nchunks];
     base[0]     = rocsparse_index_base_one;
-    this->m_nnz = snnz;
+    this->m_nnz = this->m_chunk_nnz[nchunks];
     return rocsparse_status_success;
 }
 
 template <typename T, typename I>
 rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind, I* col_ind, T* val)
 {
-    char           line[1024];
-    const size_t   nnz = this->m_nnz;
+    if(this->m_buffer == nullptr)
+    {
+        throw rocsparse_status_internal_error;
+    }
+
+    const int64_t  nchunks = static_cast<int64_t>(this->m_chunk_ptr.size()) - 1;
+    const int64_t  nnz     = this->m_nnz;
+    const int64_t  m       = this->m_m;
+    const bool     pattern = !strcmp(this->m_data, "pattern");
     std::vector<I> unsorted_row(nnz);
     std::vector<I> unsorted_col(nnz);
     std::vector<T> unsorted_val(nnz);
 
-    // Read entries
-    I idx = 0;
-    while(fgets(line, 1024, f))
+    //
+    // Read entries, each chunk writes its own range.
+    //
+    int64_t num_invalid_chunks = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : num_invalid_chunks)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
     {
-        if(idx >= nnz)
-        {
-            throw rocsparse_status_internal_error;
-        }
+        const char* q     = this->m_buffer + this->m_chunk_ptr[c];
+        const char* q_end = this->m_buffer + this->m_chunk_ptr[c + 1];
 
-        int64_t irow{};
-        int64_t icol{};
-        T       ival;
-
-        std::istringstream ss(line);
-
-        if(!strcmp(this->m_data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = static_cast<T>(1);
-        }
-        else
+        int64_t idx = this->m_chunk_nnz[c];
+        while(q < q_end)
         {
-            read_mtx_value(ss, irow, icol, ival);
-        }
-
-        unsorted_row[idx] = (I)irow;
-        unsorted_col[idx] = (I)icol;
-        unsorted_val[idx] = ival;
-
-        ++idx;
-        if(this->m_symm && irow != icol)
-        {
-            if(idx >= nnz)
+            if(mtx_is_entry_line(q, q_end))
             {
-                throw rocsparse_status_internal_error;
+                int64_t irow{};
+                int64_t icol{};
+                T       ival;
+
+                if(!read_mtx_indices(q, q_end, m, this->m_n, irow, icol))
+                {
+                    ++num_invalid_chunks;
+                    break;
+                }
+
+                if(pattern)
+                {
+                    ival = static_cast<T>(1);
+                }
+                else if(!read_mtx_value(q, q_end, ival))
+                {
+                    ++num_invalid_chunks;
+                    break;
+                }
+
+                unsorted_row[idx] = static_cast<I>(irow);
+                unsorted_col[idx] = static_cast<I>(icol);
+                unsorted_val[idx] = ival;
+                ++idx;
+
+                if(this->m_symm && irow != icol)
+                {
+                    unsorted_row[idx] = static_cast<I>(icol);
+                    unsorted_col[idx] = static_cast<I>(irow);
+                    unsorted_val[idx] = ival;
+                    ++idx;
+                }
             }
-
-            unsorted_row[idx] = (I)icol;
-            unsorted_col[idx] = (I)irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            q = mtx_next_line(q, q_end);
         }
     }
-    fclose(f);
 
-    // Sort by row and column index
-    std::vector<I> perm(nnz);
-    for(I i = 0; i < nnz; ++i)
+    this->unmap_file();
+
+    if(num_invalid_chunks > 0)
     {
-        perm[i] = i;
+        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: invalid coefficient in '"
+                  << this->m_filename << "' " << std::endl;
+        throw rocsparse_status_internal_error;
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
+    //
+    // Sort by row and column index: bucket the coefficients by row, then sort each row by
+    // column index. Ties are broken by the position in the file to keep the result deterministic.
+    //
+    std::vector<int64_t> row_ptr(m + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        ++row_ptr[unsorted_row[k]];
+    }
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
 
-    for(I i = 0; i < nnz; ++i)
+    std::vector<int64_t> row_fill(row_ptr.begin(), row_ptr.end() - 1);
+    std::vector<int64_t> perm(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t k = 0; k < nnz; ++k)
     {
-        row_ind[i] = unsorted_row[perm[i]];
+        int64_t pos;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        pos = row_fill[unsorted_row[k] - 1]++;
+        perm[pos] = k;
     }
-    for(I i = 0; i < nnz; ++i)
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t i = 0; i < m; ++i)
     {
-        col_ind[i] = unsorted_col[perm[i]];
+        std::sort(perm.begin() + row_ptr[i],
+                  perm.begin() + row_ptr[i + 1],
+                  [&](const int64_t& a, const int64_t& b) {
+                      return (unsorted_col[a] < unsorted_col[b])
+                             || (unsorted_col[a] == unsorted_col[b] && a < b);
+                  });
     }
-    for(I i = 0; i < nnz; ++i)
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t k = 0; k < nnz; ++k)
     {
-        val[i] = unsorted_val[perm[i]];
+        row_ind[k] = unsorted_row[perm[k]];
+        col_ind[k] = unsorted_col[perm[k]];
+        val[k]     = unsorted_val[perm[k]];
     }
 
     return rocsparse_status_success;
@@ -385,6 +719,14 @@ INSTANTIATE_TIJ(int8_t, int32_t, int32_t);
 INSTANTIATE_TIJ(int8_t, int64_t, int32_t);
 INSTANTIATE_TIJ(int8_t, int64_t, int64_t);
 
+INSTANTIATE_TIJ(_Float16, int32_t, int32_t);
+INSTANTIATE_TIJ(_Float16, int64_t, int32_t);
+INSTANTIATE_TIJ(_Float16, int64_t, int64_t);
+
+INSTANTIATE_TIJ(hip_bfloat16, int32_t, int32_t);
+INSTANTIATE_TIJ(hip_bfloat16, int64_t, int32_t);
+INSTANTIATE_TIJ(hip_bfloat16, int64_t, int64_t);
+
 INSTANTIATE_TIJ(float, int32_t, int32_t);
 INSTANTIATE_TIJ(float, int64_t, int32_t);
 INSTANTIATE_TIJ(float, int64_t, int64_t);
@@ -404,6 +746,12 @@ INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
 INSTANTIATE_TI(int8_t, int32_t);
 INSTANTIATE_TI(int8_t, int64_t);
 
+INSTANTIATE_TI(_Float16, int32_t);
+INSTANTIATE_TI(_Float16, int64_t);
+
+INSTANTIATE_TI(hip_bfloat16, int32_t);
+INSTANTIATE_TI(hip_bfloat16, int64_t);
+
 INSTANTIATE_TI(float, int32_t);
 INSTANTIATE_TI(float, int64_t);
 
@@ -34,12 +34,40 @@ protected:
 
 public:
     rocsparse_importer_matrixmarket(const std::string& filename_);
+    ~rocsparse_importer_matrixmarket();
+
+    rocsparse_importer_matrixmarket(const rocsparse_importer_matrixmarket&) = delete;
+    rocsparse_importer_matrixmarket& operator=(const rocsparse_importer_matrixmarket&) = delete;
 
 private:
-    FILE*  f;
-    size_t m_nnz;
-    char   m_data[16];
-    int    m_symm;
+    //
+    // Content of the file, memory mapped (or read at once if mapping is not available).
+    //
+    const char*       m_buffer{};
+    size_t            m_buffer_size{};
+    std::vector<char> m_buffer_storage;
+
+    //
+    // Offset of the first coefficient line.
+    //
+    size_t m_entries_begin{};
+
+    //
+    // The coefficient lines are split into chunks aligned on line boundaries,
+    // m_chunk_ptr[c] is the offset of the chunk c and m_chunk_nnz[c] the offset of its
+    // first coefficient once symmetric coefficients are expanded.
+    //
+    std::vector<size_t>  m_chunk_ptr;
+    std::vector<int64_t> m_chunk_nnz;
+
+    int64_t m_m{};
+    int64_t m_n{};
+    size_t  m_nnz{};
+    char    m_data[16]{};
+    int     m_symm{};
+
+    rocsparse_status map_file();
+    void             unmap_file();
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
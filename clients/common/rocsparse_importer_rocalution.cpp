@@ -41,6 +41,40 @@ static inline void read_csr_values(std::ifstream& in, int64_t nnz, int8_t* csr_v
     }
 }
 
+static inline void read_csr_values(std::ifstream& in, int64_t nnz, _Float16* csr_val)
+{
+    // Temporary array to convert from double to half
+    std::vector<double> tmp(nnz);
+
+    // Read in double values
+    in.read((char*)tmp.data(), sizeof(double) * nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        csr_val[i] = static_cast<_Float16>(static_cast<float>(tmp[i]));
+    }
+}
+
+static inline void read_csr_values(std::ifstream& in, int64_t nnz, hip_bfloat16* csr_val)
+{
+    // Temporary array to convert from double to bfloat16
+    std::vector<double> tmp(nnz);
+
+    // Read in double values
+    in.read((char*)tmp.data(), sizeof(double) * nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        csr_val[i] = static_cast<hip_bfloat16>(static_cast<float>(tmp[i]));
+    }
+}
+
 static inline void read_csr_values(std::ifstream& in, int64_t nnz, float* csr_val)
 {
     // Temporary array to convert from double to float
@@ -309,6 +343,14 @@ INSTANTIATE_TIJ(int8_t, int32_t, int32_t);
 INSTANTIATE_TIJ(int8_t, int64_t, int32_t);
 INSTANTIATE_TIJ(int8_t, int64_t, int64_t);
 
+INSTANTIATE_TIJ(_Float16, int32_t, int32_t);
+INSTANTIATE_TIJ(_Float16, int64_t, int32_t);
+INSTANTIATE_TIJ(_Float16, int64_t, int64_t);
+
+INSTANTIATE_TIJ(hip_bfloat16, int32_t, int32_t);
+INSTANTIATE_TIJ(hip_bfloat16, int64_t, int32_t);
+INSTANTIATE_TIJ(hip_bfloat16, int64_t, int64_t);
+
 INSTANTIATE_TIJ(float, int32_t, int32_t);
 INSTANTIATE_TIJ(float, int64_t, int32_t);
 INSTANTIATE_TIJ(float, int64_t, int64_t);
@@ -328,6 +370,12 @@ INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
 INSTANTIATE_TI(int8_t, int32_t);
 INSTANTIATE_TI(int8_t, int64_t);
 
+INSTANTIATE_TI(_Float16, int32_t);
+INSTANTIATE_TI(_Float16, int64_t);
+
+INSTANTIATE_TI(hip_bfloat16, int32_t);
+INSTANTIATE_TI(hip_bfloat16, int64_t);
+
 INSTANTIATE_TI(float, int32_t);
 INSTANTIATE_TI(float, int64_t);
 
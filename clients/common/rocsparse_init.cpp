@@ -25,6 +25,7 @@
 #include "rocsparse_import.hpp"
 #include "rocsparse_importer_impls.hpp"
 #include "rocsparse_matrix.hpp"
+#include "rocsparse_matrix_cache.hpp"
 
 template <typename I, typename J>
 void host_coo_to_csr(
@@ -786,6 +787,83 @@ void rocsparse_init_gebsr_laplace3d(std::vector<I>&      row_ptr,
     }
 }
 
+/* ==================================================================================== */
+/*! \brief  Import a CSR matrix from file, through the binary cache of the file */
+template <typename IMPORTER, typename I, typename J, typename T>
+static rocsparse_status rocsparse_import_sparse_csr_cached(const char*          filename,
+                                                           std::vector<I>&      row_ptr,
+                                                           std::vector<J>&      col_ind,
+                                                           std::vector<T>&      val,
+                                                           J&                   M,
+                                                           J&                   N,
+                                                           I&                   nnz,
+                                                           rocsparse_index_base base)
+{
+    rocsparse_direction dirb;
+    J                   row_block_dim;
+    J                   col_block_dim;
+    if(rocsparse_matrix_cache_load(
+           filename, dirb, M, N, nnz, row_block_dim, col_block_dim, row_ptr, col_ind, val, base))
+    {
+        return rocsparse_status_success;
+    }
+
+    IMPORTER         importer(filename);
+    rocsparse_status status
+        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    rocsparse_matrix_cache_save(
+        filename, rocsparse_direction_row, M, N, nnz, J(1), J(1), row_ptr, col_ind, val, base);
+    return rocsparse_status_success;
+}
+
+/* ==================================================================================== */
+/*! \brief  Import a GEBSR matrix from file, through the binary cache of the file */
+template <typename IMPORTER, typename I, typename J, typename T>
+static rocsparse_status rocsparse_import_sparse_gebsr_cached(const char*          filename,
+                                                             std::vector<I>&      row_ptr,
+                                                             std::vector<J>&      col_ind,
+                                                             std::vector<T>&      val,
+                                                             rocsparse_direction& dirb,
+                                                             J&                   Mb,
+                                                             J&                   Nb,
+                                                             I&                   nnzb,
+                                                             J&                   row_block_dim,
+                                                             J&                   col_block_dim,
+                                                             rocsparse_index_base base)
+{
+    if(rocsparse_matrix_cache_load(
+           filename, dirb, Mb, Nb, nnzb, row_block_dim, col_block_dim, row_ptr, col_ind, val, base))
+    {
+        return rocsparse_status_success;
+    }
+
+    IMPORTER         importer(filename);
+    rocsparse_status status = rocsparse_import_sparse_gebsr(importer,
+                                                            row_ptr,
+                                                            col_ind,
+                                                            val,
+                                                            dirb,
+                                                            Mb,
+                                                            Nb,
+                                                            nnzb,
+                                                            row_block_dim,
+                                                            col_block_dim,
+                                                            base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    rocsparse_matrix_cache_save(
+        filename, dirb, Mb, Nb, nnzb, row_block_dim, col_block_dim, row_ptr, col_ind, val, base);
+    return rocsparse_status_success;
+}
+
 /* ==================================================================================== */
 /*! \brief  Read matrix from mtx file in CSR format */
 template <typename I, typename J, typename T>
@@ -836,10 +914,53 @@ void rocsparse_init_coo_mtx(const char*          filename,
                             int64_t&             nnz,
                             rocsparse_index_base base)
 {
+    //
+    // The cache holds the CSR matrix.
+    //
+    std::vector<I>      csr_row_ptr;
+    I                   csr_nnz;
+    rocsparse_direction dirb;
+    I                   row_block_dim;
+    I                   col_block_dim;
+    if(rocsparse_matrix_cache_load(filename,
+                                   dirb,
+                                   M,
+                                   N,
+                                   csr_nnz,
+                                   row_block_dim,
+                                   col_block_dim,
+                                   csr_row_ptr,
+                                   coo_col_ind,
+                                   coo_val,
+                                   base))
+    {
+        nnz = csr_nnz;
+        coo_row_ind.resize(nnz);
+        host_csr_to_coo(M, csr_nnz, csr_row_ptr, coo_row_ind, base);
+        return;
+    }
+
     rocsparse_importer_matrixmarket importer(filename);
     rocsparse_status                status
         = rocsparse_import_sparse_coo(importer, coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base);
     CHECK_ROCSPARSE_THROW_ERROR(status);
+
+    if(nnz <= std::numeric_limits<I>::max())
+    {
+        csr_nnz = static_cast<I>(nnz);
+        host_coo_to_csr(M, csr_nnz, coo_row_ind.data(), csr_row_ptr, base);
+        rocsparse_matrix_cache_save(filename,
+                                    rocsparse_direction_row,
+                                    M,
+                                    N,
+                                    csr_nnz,
+                                    I(1),
+                                    I(1),
+                                    csr_row_ptr,
+                                    coo_col_ind,
+                                    coo_val,
+                                    base);
+    }
 }
 
 /* ============================================================================================ */
@@ -880,9 +1001,8 @@ void rocsparse_init_csr_smtx(const char*          filename,
                              rocsparse_index_base base)
 {
 
-    rocsparse_importer_mlcsr importer(filename);
-    const rocsparse_status   status
-        = rocsparse_import_sparse_csr(importer, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    const rocsparse_status status = rocsparse_import_sparse_csr_cached<rocsparse_importer_mlcsr>(
+        filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
 
     for(size_t i = 0; i < nnz; ++i)
     {
@@ -926,9 +1046,8 @@ void rocsparse_init_gebsr_smtx(const char*          filename,
                                rocsparse_index_base base)
 {
 
-    rocsparse_importer_mlcsr importer(filename);
-    const rocsparse_status   status = rocsparse_import_sparse_csr(
-        importer, bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+    const rocsparse_status status = rocsparse_import_sparse_csr_cached<rocsparse_importer_mlcsr>(
+        filename, bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
 
     CHECK_ROCSPARSE_THROW_ERROR(status);
 
@@ -963,19 +1082,19 @@ void rocsparse_init_csr_bsmtx(const char*          filename,
     J row_block_dim;
     J col_block_dim;
 
-    rocsparse_importer_mlbsr importer(filename);
-    rocsparse_direction      import_dir = {};
-    const rocsparse_status   status     = rocsparse_import_sparse_gebsr(importer,
-                                                                  bsr_row_ptr,
-                                                                  bsr_col_ind,
-                                                                  bsr_val,
-                                                                  import_dir,
-                                                                  Mb,
-                                                                  Nb,
-                                                                  nnzb,
-                                                                  row_block_dim,
-                                                                  col_block_dim,
-                                                                  base);
+    rocsparse_direction    import_dir = {};
+    const rocsparse_status status
+        = rocsparse_import_sparse_gebsr_cached<rocsparse_importer_mlbsr>(filename,
+                                                                         bsr_row_ptr,
+                                                                         bsr_col_ind,
+                                                                         bsr_val,
+                                                                         import_dir,
+                                                                         Mb,
+                                                                         Nb,
+                                                                         nnzb,
+                                                                         row_block_dim,
+                                                                         col_block_dim,
+                                                                         base);
 
     CHECK_ROCSPARSE_THROW_ERROR(status);
     nnz = nnzb * row_block_dim * col_block_dim;
@@ -1058,19 +1177,19 @@ void rocsparse_init_gebsr_bsmtx(const char*          filename,
                                 rocsparse_index_base base)
 {
 
-    rocsparse_importer_mlbsr importer(filename);
-    rocsparse_direction      import_dir = {};
-    const rocsparse_status   status     = rocsparse_import_sparse_gebsr(importer,
-                                                                  bsr_row_ptr,
-                                                                  bsr_col_ind,
-                                                                  bsr_val,
-                                                                  import_dir,
-                                                                  Mb,
-                                                                  Nb,
-                                                                  nnzb,
-                                                                  row_block_dim,
-                                                                  col_block_dim,
-                                                                  base);
+    rocsparse_direction    import_dir = {};
+    const rocsparse_status status
+        = rocsparse_import_sparse_gebsr_cached<rocsparse_importer_mlbsr>(filename,
+                                                                         bsr_row_ptr,
+                                                                         bsr_col_ind,
+                                                                         bsr_val,
+                                                                         import_dir,
+                                                                         Mb,
+                                                                         Nb,
+                                                                         nnzb,
+                                                                         row_block_dim,
+                                                                         col_block_dim,
+                                                                         base);
 
     CHECK_ROCSPARSE_THROW_ERROR(status);
     const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
@@ -1091,9 +1210,8 @@ void rocsparse_init_csr_rocalution(const char*          filename,
                                    I&                   nnz,
                                    rocsparse_index_base base)
 {
-    rocsparse_importer_rocalution importer(filename);
-    rocsparse_status              status
-        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
+    rocsparse_status status = rocsparse_import_sparse_csr_cached<rocsparse_importer_rocalution>(
+        filename, row_ptr, col_ind, val, M, N, nnz, base);
     CHECK_ROCSPARSE_THROW_ERROR(status);
 }
 
@@ -2080,6 +2198,8 @@ INSTANTIATEI(int32_t);
 INSTANTIATEI(int64_t);
 
 INSTANTIATE(int8_t);
+INSTANTIATE(_Float16);
+INSTANTIATE(hip_bfloat16);
 INSTANTIATE(int32_t);
 INSTANTIATE(int64_t);
 INSTANTIATE(size_t);
@@ -2094,6 +2214,10 @@ INSTANTIATE1(int64_t, int64_t);
 
 INSTANTIATE2(int32_t, int8_t);
 INSTANTIATE2(int64_t, int8_t);
+INSTANTIATE2(int32_t, _Float16);
+INSTANTIATE2(int64_t, _Float16);
+INSTANTIATE2(int32_t, hip_bfloat16);
+INSTANTIATE2(int64_t, hip_bfloat16);
 INSTANTIATE2(int32_t, float);
 INSTANTIATE2(int64_t, float);
 INSTANTIATE2(int32_t, double);
@@ -2106,6 +2230,12 @@ INSTANTIATE2(int64_t, rocsparse_double_complex);
 INSTANTIATE3(int32_t, int32_t, int8_t);
 INSTANTIATE3(int64_t, int32_t, int8_t);
 INSTANTIATE3(int64_t, int64_t, int8_t);
+INSTANTIATE3(int32_t, int32_t, _Float16);
+INSTANTIATE3(int64_t, int32_t, _Float16);
+INSTANTIATE3(int64_t, int64_t, _Float16);
+INSTANTIATE3(int32_t, int32_t, hip_bfloat16);
+INSTANTIATE3(int64_t, int32_t, hip_bfloat16);
+INSTANTIATE3(int64_t, int64_t, hip_bfloat16);
 INSTANTIATE3(int32_t, int32_t, float);
 INSTANTIATE3(int64_t, int32_t, float);
 INSTANTIATE3(int64_t, int64_t, float);
@@ -0,0 +1,446 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_matrix_cache.hpp"
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_datatype2string.hpp"
+#include "utility.hpp"
+#include <algorithm>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static constexpr char     s_cache_magic[8] = {'R', 'S', 'P', 'C', 'A', 'C', 'H', 'E'};
+static constexpr uint64_t s_cache_version  = 3;
+
+//
+// The arrays of the cache are aligned to this many bytes, such that they can be read in place
+// from the mapped file.
+//
+static constexpr size_t s_cache_alignment = 16;
+
+//
+// The arrays are checksummed and copied by chunks of this many bytes, such that each chunk
+// is still in cache when it is copied and the mapped file is only read once.
+//
+static constexpr size_t s_cache_chunk_bytes = 65536;
+
+struct rocsparse_matrix_cache_header
+{
+    char     magic[8];
+    uint64_t version;
+    uint64_t source_size;
+    int64_t  source_mtime;
+    int64_t  datatype;
+    int64_t  indextype_I;
+    int64_t  indextype_J;
+    int64_t  dirb;
+    int64_t  base;
+    int64_t  m;
+    int64_t  n;
+    int64_t  nnz;
+    int64_t  row_block_dim;
+    int64_t  col_block_dim;
+    uint64_t ptr_size;
+    uint64_t ind_size;
+    uint64_t val_size;
+    uint64_t payload_checksum;
+    uint64_t checksum;
+};
+
+static size_t rocsparse_matrix_cache_align(size_t bytes)
+{
+    return (bytes + s_cache_alignment - 1) / s_cache_alignment * s_cache_alignment;
+}
+
+//
+// The arrays of the cache follow the padded header.
+//
+static constexpr size_t s_cache_header_bytes
+    = (sizeof(rocsparse_matrix_cache_header) + s_cache_alignment - 1) / s_cache_alignment
+      * s_cache_alignment;
+
+//
+// FNV-1a on 64-bit words.
+//
+static uint64_t rocsparse_matrix_cache_checksum(const void* data, size_t size, uint64_t hash)
+{
+    static constexpr uint64_t prime = 0x100000001b3ULL;
+
+    const char* p = static_cast<const char*>(data);
+    size_t      i = 0;
+    for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t w;
+        memcpy(&w, p + i, sizeof(uint64_t));
+        hash = (hash ^ w) * prime;
+        hash ^= hash >> 32;
+    }
+
+    for(; i < size; ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(p[i])) * prime;
+    }
+
+    return hash;
+}
+
+//
+// Checksum of the header, except its checksum field.
+//
+static uint64_t rocsparse_matrix_cache_header_checksum(const rocsparse_matrix_cache_header& header)
+{
+    return rocsparse_matrix_cache_checksum(
+        &header, offsetof(rocsparse_matrix_cache_header, checksum), 0);
+}
+
+//
+// Update the payload checksum with an array, chunk by chunk, and call copy_chunk(i, n) after
+// each chunk of n entries starting at entry i has been checksummed. The chunks are a multiple
+// of 8 bytes, the checksum is then the same as the one of the whole array.
+//
+template <typename S, typename F>
+static uint64_t
+    rocsparse_matrix_cache_read(const char* src, size_t size, uint64_t hash, F copy_chunk)
+{
+    static constexpr size_t chunk = s_cache_chunk_bytes / sizeof(S);
+
+    const S* begin = reinterpret_cast<const S*>(src);
+    for(size_t i = 0; i < size; i += chunk)
+    {
+        const size_t n = std::min(chunk, size - i);
+        hash           = rocsparse_matrix_cache_checksum(begin + i, sizeof(S) * n, hash);
+        copy_chunk(i, n);
+    }
+
+    return hash;
+}
+
+//
+// Copy an index array of the mapped file, switch its index base on the fly and update the
+// payload checksum.
+//
+template <typename S>
+static uint64_t rocsparse_matrix_cache_copy(
+    std::vector<S>& dest, const char* src, size_t size, S shift, uint64_t hash)
+{
+    const S* begin = reinterpret_cast<const S*>(src);
+    dest.resize(size);
+    return rocsparse_matrix_cache_read<S>(src, size, hash, [&](size_t i, size_t n) {
+        for(size_t j = i; j < i + n; ++j)
+        {
+            dest[j] = begin[j] + shift;
+        }
+    });
+}
+
+//
+// Copy the value array of the mapped file and update the payload checksum.
+//
+template <typename T>
+static uint64_t
+    rocsparse_matrix_cache_copy(std::vector<T>& dest, const char* src, size_t size, uint64_t hash)
+{
+    dest.resize(size);
+    return rocsparse_matrix_cache_read<T>(src, size, hash, [&](size_t i, size_t n) {
+        memcpy(dest.data() + i, src + sizeof(T) * i, sizeof(T) * n);
+    });
+}
+
+template <typename T, typename I, typename J>
+static bool rocsparse_matrix_cache_filename(const char* filename, std::string& cache_filename)
+{
+    if(rocsparse_clients_envariables::get(rocsparse_clients_envariables::NO_MATRICES_CACHE))
+    {
+        return false;
+    }
+
+    const std::string suffix = std::string(".") + rocsparse_datatype2string(get_datatype<T>())
+                               + "_" + rocsparse_indextype2string(get_indextype<I>()) + "_"
+                               + rocsparse_indextype2string(get_indextype<J>()) + ".cache";
+
+    const std::string path(filename);
+    if(rocsparse_clients_envariables::is_defined(rocsparse_clients_envariables::MATRICES_CACHE_DIR))
+    {
+        const char* dir
+            = rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_CACHE_DIR);
+        const size_t      pos = path.find_last_of("/\\");
+        const std::string basename
+            = (pos == std::string::npos) ? path : path.substr(pos + 1, std::string::npos);
+        cache_filename = std::string(dir) + "/" + basename + suffix;
+    }
+    else
+    {
+        cache_filename = path + suffix;
+    }
+
+    return true;
+}
+
+template <typename T, typename I, typename J>
+bool rocsparse_matrix_cache_load(const char*          filename,
+                                 rocsparse_direction& dirb,
+                                 J&                   M,
+                                 J&                   N,
+                                 I&                   nnz,
+                                 J&                   row_block_dim,
+                                 J&                   col_block_dim,
+                                 std::vector<I>&      ptr,
+                                 std::vector<J>&      ind,
+                                 std::vector<T>&      val,
+                                 rocsparse_index_base base)
+{
+#ifdef WIN32
+    // Not supported.
+    return false;
+#else
+    std::string cache_filename;
+    if(!rocsparse_matrix_cache_filename<T, I, J>(filename, cache_filename))
+    {
+        return false;
+    }
+
+    struct stat source_st;
+    if(stat(filename, &source_st) != 0)
+    {
+        return false;
+    }
+
+    const int fd = open(cache_filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0
+       || static_cast<size_t>(st.st_size) < s_cache_header_bytes)
+    {
+        close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void*        p    = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(p == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const char*                   data = static_cast<const char*>(p);
+    rocsparse_matrix_cache_header header;
+    memcpy(&header, data, sizeof(header));
+
+    const size_t ptr_bytes = rocsparse_matrix_cache_align(header.ptr_size * sizeof(I));
+    const size_t ind_bytes = rocsparse_matrix_cache_align(header.ind_size * sizeof(J));
+    const size_t val_bytes = rocsparse_matrix_cache_align(header.val_size * sizeof(T));
+
+    //
+    // Check the cache is up to date and consistent.
+    //
+    bool valid = (memcmp(header.magic, s_cache_magic, sizeof(s_cache_magic)) == 0)
+                       && header.version == s_cache_version
+                       && header.checksum == rocsparse_matrix_cache_header_checksum(header)
+                       && header.source_size == static_cast<uint64_t>(source_st.st_size)
+                       && header.source_mtime == static_cast<int64_t>(source_st.st_mtime)
+                       && header.datatype == get_datatype<T>()
+                       && header.indextype_I == get_indextype<I>()
+                       && header.indextype_J == get_indextype<J>()
+                       && size == s_cache_header_bytes + ptr_bytes + ind_bytes + val_bytes;
+
+    if(valid)
+    {
+        const char* ptr_data = data + s_cache_header_bytes;
+        const char* ind_data = ptr_data + ptr_bytes;
+        const char* val_data = ind_data + ind_bytes;
+
+        madvise(p, size, MADV_SEQUENTIAL);
+
+        //
+        // Read the arrays in place, switch base and verify the payload checksum. A corrupted
+        // payload is re-imported from the source file.
+        //
+        const I  ptr_shift = static_cast<I>(base) - static_cast<I>(header.base);
+        const J  ind_shift = static_cast<J>(base) - static_cast<J>(header.base);
+        uint64_t hash      = 0;
+        hash = rocsparse_matrix_cache_copy(ptr, ptr_data, header.ptr_size, ptr_shift, hash);
+        hash = rocsparse_matrix_cache_copy(ind, ind_data, header.ind_size, ind_shift, hash);
+        hash = rocsparse_matrix_cache_copy(val, val_data, header.val_size, hash);
+
+        valid = (hash == header.payload_checksum);
+    }
+
+    if(valid)
+    {
+        dirb          = static_cast<rocsparse_direction>(header.dirb);
+        M             = static_cast<J>(header.m);
+        N             = static_cast<J>(header.n);
+        nnz           = static_cast<I>(header.nnz);
+        row_block_dim = static_cast<J>(header.row_block_dim);
+        col_block_dim = static_cast<J>(header.col_block_dim);
+    }
+
+    munmap(p, size);
+
+    if(!valid && rocsparse_clients_envariables::get(rocsparse_clients_envariables::VERBOSE))
+    {
+        std::cout << "rocsparse_matrix_cache: ignore outdated or invalid cache '" << cache_filename
+                  << "'" << std::endl;
+    }
+
+    return valid;
+#endif
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_cache_save(const char*           filename,
+                                 rocsparse_direction   dirb,
+                                 J                     M,
+                                 J                     N,
+                                 I                     nnz,
+                                 J                     row_block_dim,
+                                 J                     col_block_dim,
+                                 const std::vector<I>& ptr,
+                                 const std::vector<J>& ind,
+                                 const std::vector<T>& val,
+                                 rocsparse_index_base  base)
+{
+#ifndef WIN32
+    std::string cache_filename;
+    if(!rocsparse_matrix_cache_filename<T, I, J>(filename, cache_filename))
+    {
+        return;
+    }
+
+    struct stat source_st;
+    if(stat(filename, &source_st) != 0)
+    {
+        return;
+    }
+
+    rocsparse_matrix_cache_header header;
+    memcpy(header.magic, s_cache_magic, sizeof(s_cache_magic));
+    header.version       = s_cache_version;
+    header.source_size   = static_cast<uint64_t>(source_st.st_size);
+    header.source_mtime  = static_cast<int64_t>(source_st.st_mtime);
+    header.datatype      = get_datatype<T>();
+    header.indextype_I   = get_indextype<I>();
+    header.indextype_J   = get_indextype<J>();
+    header.dirb          = dirb;
+    header.base          = base;
+    header.m             = M;
+    header.n             = N;
+    header.nnz           = nnz;
+    header.row_block_dim = row_block_dim;
+    header.col_block_dim = col_block_dim;
+    header.ptr_size      = ptr.size();
+    header.ind_size      = ind.size();
+    header.val_size      = val.size();
+
+    uint64_t hash = 0;
+    hash = rocsparse_matrix_cache_checksum(ptr.data(), sizeof(I) * ptr.size(), hash);
+    hash = rocsparse_matrix_cache_checksum(ind.data(), sizeof(J) * ind.size(), hash);
+    hash = rocsparse_matrix_cache_checksum(val.data(), sizeof(T) * val.size(), hash);
+
+    header.payload_checksum = hash;
+    header.checksum         = rocsparse_matrix_cache_header_checksum(header);
+
+    //
+    // Write a temporary file and rename it, concurrent processes never see a partial cache.
+    //
+    const std::string tmp_filename = cache_filename + "." + std::to_string(getpid()) + ".tmp";
+    FILE*             f            = fopen(tmp_filename.c_str(), "wb");
+    if(f == nullptr)
+    {
+        return;
+    }
+
+    //
+    // Pad each array to the alignment of the cache.
+    //
+    static constexpr char padding[s_cache_alignment] = {};
+    const auto            write_array = [f](const void* data, size_t size, size_t bytes) {
+        const size_t pad = rocsparse_matrix_cache_align(size * bytes) - size * bytes;
+        return fwrite(data, bytes, size, f) == size && fwrite(padding, 1, pad, f) == pad;
+    };
+
+    const bool success = write_array(&header, 1, sizeof(header))
+                         && write_array(ptr.data(), ptr.size(), sizeof(I))
+                         && write_array(ind.data(), ind.size(), sizeof(J))
+                         && write_array(val.data(), val.size(), sizeof(T));
+
+    if(fclose(f) != 0 || !success || rename(tmp_filename.c_str(), cache_filename.c_str()) != 0)
+    {
+        remove(tmp_filename.c_str());
+        return;
+    }
+
+    if(rocsparse_clients_envariables::get(rocsparse_clients_envariables::VERBOSE))
+    {
+        std::cout << "rocsparse_matrix_cache: write '" << cache_filename << "'" << std::endl;
+    }
+#endif
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                              \
+    template bool rocsparse_matrix_cache_load<T, I, J>(const char*,           \
+                                                       rocsparse_direction&,  \
+                                                       J&,                    \
+                                                       J&,                    \
+                                                       I&,                    \
+                                                       J&,                    \
+                                                       J&,                    \
+                                                       std::vector<I>&,       \
+                                                       std::vector<J>&,       \
+                                                       std::vector<T>&,       \
+                                                       rocsparse_index_base); \
+    template void rocsparse_matrix_cache_save<T, I, J>(const char*,           \
+                                                       rocsparse_direction,   \
+                                                       J,                     \
+                                                       J,                     \
+                                                       I,                     \
+                                                       J,                     \
+                                                       J,                     \
+                                                       const std::vector<I>&, \
+                                                       const std::vector<J>&, \
+                                                       const std::vector<T>&, \
+                                                       rocsparse_index_base)
+
+#define INSTANTIATE_T(T)                  \
+    INSTANTIATE_TIJ(T, int32_t, int32_t); \
+    INSTANTIATE_TIJ(T, int64_t, int32_t); \
+    INSTANTIATE_TIJ(T, int64_t, int64_t)
+
+INSTANTIATE_T(int8_t);
+INSTANTIATE_T(_Float16);
+INSTANTIATE_T(hip_bfloat16);
+INSTANTIATE_T(float);
+INSTANTIATE_T(double);
+INSTANTIATE_T(rocsparse_float_complex);
+INSTANTIATE_T(rocsparse_double_complex);
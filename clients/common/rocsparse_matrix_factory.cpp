@@ -916,6 +916,14 @@ template struct rocsparse_matrix_factory<int8_t, int32_t, int32_t>;
 template struct rocsparse_matrix_factory<int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory<int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory<_Float16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory<_Float16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory<_Float16, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory<hip_bfloat16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory<hip_bfloat16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory<hip_bfloat16, int64_t, int64_t>;
+
 template struct rocsparse_matrix_factory<float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory<float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory<float, int64_t, int64_t>;
@@ -562,6 +562,32 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, int8_t,
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              _Float16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              _Float16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              _Float16,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              hip_bfloat16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int64_t>;
+
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_mtx, float, int64_t, int64_t>;
@@ -609,6 +635,32 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
                                               int64_t,
                                               int64_t>;
 
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              _Float16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              _Float16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              _Float16,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              hip_bfloat16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int64_t>;
+
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocalution,
                                               float,
                                               int32_t,
@@ -674,6 +726,32 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
                                               int64_t,
                                               int64_t>;
 
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              _Float16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              _Float16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              _Float16,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              hip_bfloat16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int64_t>;
+
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
                                               float,
                                               int32_t,
@@ -730,6 +808,32 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, int8_t
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              _Float16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              _Float16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              _Float16,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              hip_bfloat16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int64_t>;
+
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_smtx, float, int64_t, int64_t>;
@@ -777,6 +881,32 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
                                               int64_t,
                                               int64_t>;
 
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              _Float16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              _Float16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              _Float16,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              hip_bfloat16,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx,
+                                              hip_bfloat16,
+                                              int64_t,
+                                              int64_t>;
+
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx, float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx, float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_bsmtx, float, int64_t, int64_t>;
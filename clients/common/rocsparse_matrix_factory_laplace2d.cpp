@@ -198,6 +198,14 @@ template struct rocsparse_matrix_factory_laplace2d<int8_t, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace2d<int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace2d<int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_laplace2d<_Float16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace2d<_Float16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace2d<_Float16, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_laplace2d<hip_bfloat16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace2d<hip_bfloat16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace2d<hip_bfloat16, int64_t, int64_t>;
+
 template struct rocsparse_matrix_factory_laplace2d<float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace2d<float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace2d<float, int64_t, int64_t>;
@@ -220,6 +220,14 @@ template struct rocsparse_matrix_factory_laplace3d<int8_t, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace3d<int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace3d<int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_laplace3d<_Float16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace3d<_Float16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace3d<_Float16, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_laplace3d<hip_bfloat16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace3d<hip_bfloat16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_laplace3d<hip_bfloat16, int64_t, int64_t>;
+
 template struct rocsparse_matrix_factory_laplace3d<float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace3d<float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_laplace3d<float, int64_t, int64_t>;
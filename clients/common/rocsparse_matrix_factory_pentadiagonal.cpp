@@ -233,6 +233,14 @@ template struct rocsparse_matrix_factory_pentadiagonal<int8_t, int32_t, int32_t>
 template struct rocsparse_matrix_factory_pentadiagonal<int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_pentadiagonal<int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_pentadiagonal<_Float16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_pentadiagonal<_Float16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_pentadiagonal<_Float16, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_pentadiagonal<hip_bfloat16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_pentadiagonal<hip_bfloat16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_pentadiagonal<hip_bfloat16, int64_t, int64_t>;
+
 template struct rocsparse_matrix_factory_pentadiagonal<float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_pentadiagonal<float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_pentadiagonal<float, int64_t, int64_t>;
@@ -92,6 +92,14 @@ template struct rocsparse_matrix_factory_zero<int8_t, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_zero<int8_t, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_zero<int8_t, int64_t, int64_t>;
 
+template struct rocsparse_matrix_factory_zero<_Float16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_zero<_Float16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_zero<_Float16, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_zero<hip_bfloat16, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_zero<hip_bfloat16, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_zero<hip_bfloat16, int64_t, int64_t>;
+
 template struct rocsparse_matrix_factory_zero<float, int32_t, int32_t>;
 template struct rocsparse_matrix_factory_zero<float, int64_t, int32_t>;
 template struct rocsparse_matrix_factory_zero<float, int64_t, int64_t>;
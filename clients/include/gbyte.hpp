@@ -108,6 +108,27 @@ constexpr double coomv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
     return coomv_gbyte_count<T, T, T>(M, N, nnz, beta);
 }
 
+template <typename T, typename I>
+constexpr double coomv_batched_gbyte_count(I       M,
+                                           I       N,
+                                           int64_t nnz,
+                                           int     batch_count_A,
+                                           int     batch_count_x,
+                                           int     batch_count_y,
+                                           bool    beta = false)
+{
+    // read A matrix, the sparsity pattern is shared by all batches
+    size_t readA = sizeof(I) * 2 * nnz + batch_count_A * nnz * sizeof(T);
+
+    // read x vector
+    size_t readx = batch_count_x * N * sizeof(T);
+
+    // read and write y vector
+    size_t ready = batch_count_y * (M + (beta ? M : 0)) * sizeof(T);
+
+    return (readA + readx + ready) / 1e9;
+}
+
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 {
@@ -122,6 +143,27 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
     return csrmv_gbyte_count<T, T, T>(M, N, nnz, beta);
 }
 
+template <typename T, typename I, typename J>
+constexpr double csrmv_batched_gbyte_count(J    M,
+                                           J    N,
+                                           I    nnz,
+                                           int  batch_count_A,
+                                           int  batch_count_x,
+                                           int  batch_count_y,
+                                           bool beta = false)
+{
+    // read A matrix, the sparsity pattern is shared by all batches
+    size_t readA = sizeof(I) * (M + 1) + sizeof(J) * nnz + batch_count_A * nnz * sizeof(T);
+
+    // read x vector
+    size_t readx = batch_count_x * N * sizeof(T);
+
+    // read and write y vector
+    size_t ready = batch_count_y * (M + (beta ? M : 0)) * sizeof(T);
+
+    return (readA + readx + ready) / 1e9;
+}
+
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double cscmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 {
@@ -149,6 +191,15 @@ constexpr double ellmv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
     return ellmv_gbyte_count<T, T, T>(M, N, nnz, beta);
 }
 
+template <typename A, typename X, typename Y, typename I>
+constexpr double bellmv_gbyte_count(I Mb, I Nb, I bell_width, I block_dim, bool beta = false)
+{
+    return (sizeof(I) * Mb * bell_width + sizeof(A) * Mb * bell_width * block_dim * block_dim
+            + sizeof(Y) * (Mb * block_dim + (beta ? Mb * block_dim : 0))
+            + sizeof(X) * Nb * block_dim)
+           / 1e9;
+}
+
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double
     gebsrmv_gbyte_count(J mb, J nb, I nnzb, J row_block_dim, J col_block_dim, bool beta = false)
@@ -332,6 +383,36 @@ constexpr double coomm_batched_gbyte_count(I       M,
     return (readA + readB + readC + writeC) / 1e9;
 }
 
+template <typename T, typename I>
+constexpr double ellmm_gbyte_count(int64_t nnz_A, int64_t nnz_B, int64_t nnz_C, bool beta = false)
+{
+    return (nnz_A * sizeof(I) + (nnz_A + nnz_B + nnz_C + (beta ? nnz_C : 0)) * sizeof(T)) / 1e9;
+}
+
+template <typename T, typename I>
+constexpr double ellmm_batched_gbyte_count(int64_t nnz_A,
+                                           int64_t nnz_B,
+                                           int64_t nnz_C,
+                                           I       batch_count_A,
+                                           I       batch_count_B,
+                                           I       batch_count_C,
+                                           bool    beta = false)
+{
+    // read A matrix
+    size_t readA = batch_count_A * (nnz_A * sizeof(I) + nnz_A * sizeof(T));
+
+    // read B matrix
+    size_t readB = batch_count_B * nnz_B * sizeof(T);
+
+    // read C matrix
+    size_t readC = batch_count_C * (beta ? nnz_C : 0) * sizeof(T);
+
+    // write C matrix
+    size_t writeC = batch_count_C * nnz_C * sizeof(T);
+
+    return (readA + readB + readC + writeC) / 1e9;
+}
+
 template <rocsparse_format FORMAT>
 struct rocsparse_gbyte_count
 {
@@ -1182,6 +1182,19 @@ REAL_COMPLEX_TEMPLATE(csritilu0_history,
                       size_t               buffer_size_,
                       void*                buffer);
 
+// csritilu0_apply
+REAL_COMPLEX_TEMPLATE(csritilu0_apply,
+                      rocsparse_handle     handle,
+                      rocsparse_int        nsweeps,
+                      rocsparse_int        m,
+                      rocsparse_int        nnz,
+                      const rocsparse_int* ptr,
+                      const rocsparse_int* ind,
+                      const T*             ilu0,
+                      rocsparse_index_base base,
+                      const T*             x,
+                      T*                   y);
+
 // csrilu0
 REAL_COMPLEX_TEMPLATE(csrilu0_buffer_size,
                       rocsparse_handle          handle,
@@ -1226,6 +1239,89 @@ REAL_COMPLEX_TEMPLATE(csrilu0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// csriluk
+REAL_COMPLEX_TEMPLATE(csriluk_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csriluk_analysis,
+                      rocsparse_handle          handle,
+                      rocsparse_int             level,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_analysis_policy analysis,
+                      rocsparse_solve_policy    solve,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csriluk,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      T*                        lu_val,
+                      rocsparse_int*            lu_row_ptr,
+                      rocsparse_int*            lu_col_ind,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csrmc
+REAL_COMPLEX_TEMPLATE(csrmc_reorder,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             ncolors,
+                      const rocsparse_int*      coloring,
+                      rocsparse_mat_info        info,
+                      rocsparse_int*            perm,
+                      T*                        mc_val,
+                      rocsparse_int*            mc_row_ptr,
+                      rocsparse_int*            mc_col_ind,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrmcilu0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        mc_val,
+                      const rocsparse_int*      mc_row_ptr,
+                      const rocsparse_int*      mc_col_ind,
+                      rocsparse_mat_info        info);
+
+REAL_COMPLEX_TEMPLATE(csrmcgs,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  mc_val,
+                      const rocsparse_int*      mc_row_ptr,
+                      const rocsparse_int*      mc_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             nsweeps,
+                      int                       symmetric,
+                      const T*                  b,
+                      T*                        x);
+
 REAL_COMPLEX_TEMPLATE(gtsv_buffer_size,
                       rocsparse_handle handle,
                       rocsparse_int    m,
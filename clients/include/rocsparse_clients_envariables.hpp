@@ -42,10 +42,11 @@ struct rocsparse_clients_envariables
     ///
     typedef enum var_bool_ : int32_t
     {
-        VERBOSE
+        VERBOSE,
+        NO_MATRICES_CACHE
     } var_bool;
 
-    static constexpr var_bool s_var_bool_all[] = {VERBOSE};
+    static constexpr var_bool s_var_bool_all[] = {VERBOSE, NO_MATRICES_CACHE};
 
     ///
     /// @brief Return value of a Boolean variable.
@@ -72,10 +73,11 @@ struct rocsparse_clients_envariables
     ///
     typedef enum var_string_ : int32_t
     {
-        MATRICES_DIR
+        MATRICES_DIR,
+        MATRICES_CACHE_DIR
     } var_string;
 
-    static constexpr var_string s_var_string_all[] = {MATRICES_DIR};
+    static constexpr var_string s_var_string_all[] = {MATRICES_DIR, MATRICES_CACHE_DIR};
 
     ///
     /// @brief Return value of a string variable.
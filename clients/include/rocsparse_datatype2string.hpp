@@ -128,6 +128,10 @@ constexpr auto rocsparse_datatype2string(rocsparse_datatype type)
         return "i32_r";
     case rocsparse_datatype_u32_r:
         return "u32_r";
+    case rocsparse_datatype_f16_r:
+        return "f16_r";
+    case rocsparse_datatype_bf16_r:
+        return "bf16_r";
     }
     return "invalid";
 }
@@ -232,6 +236,8 @@ constexpr auto rocsparse_partition2string(rocsparse_hyb_partition part)
         return "user";
     case rocsparse_hyb_partition_max:
         return "max";
+    case rocsparse_hyb_partition_cost:
+        return "cost";
     }
     return "invalid";
 }
@@ -357,6 +363,12 @@ constexpr auto rocsparse_spmvalg2string(rocsparse_spmv_alg alg)
         return "ell";
     case rocsparse_spmv_alg_coo_atomic:
         return "cooatomic";
+    case rocsparse_spmv_alg_auto:
+        return "auto";
+    case rocsparse_spmv_alg_csr_binned:
+        return "csrbinned";
+    case rocsparse_spmv_alg_csr_merge:
+        return "csrmerge";
     }
     return "invalid";
 }
@@ -367,6 +379,8 @@ constexpr auto rocsparse_spsvalg2string(rocsparse_spsv_alg alg)
     {
     case rocsparse_spsv_alg_default:
         return "default";
+    case rocsparse_spsv_alg_level_set:
+        return "levelset";
     }
     return "invalid";
 }
@@ -211,6 +211,8 @@ namespace testing
     TESTING_COMPUTE_TEMPLATE(csrilu0_analysis)
     TESTING_TEMPLATE(csrilu0_clear)
     TESTING_COMPUTE_TEMPLATE(csrilu0)
+    TESTING_COMPUTE_TEMPLATE(csriluk_buffer_size)
+    TESTING_COMPUTE_TEMPLATE(csriluk)
     TESTING_COMPUTE_TEMPLATE(gtsv_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gtsv)
     TESTING_COMPUTE_TEMPLATE(gtsv_no_pivot_buffer_size)
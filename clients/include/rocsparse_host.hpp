@@ -246,6 +246,25 @@ void host_coomv(rocsparse_operation  trans,
                 Y*                   y,
                 rocsparse_index_base base);
 
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_coomv_batched(rocsparse_operation  trans,
+                        I                    M,
+                        I                    N,
+                        int64_t              nnz,
+                        int64_t              batch_count,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        int64_t              indices_batch_stride,
+                        const A*             coo_val,
+                        int64_t              values_batch_stride,
+                        const X*             x,
+                        int64_t              x_batch_stride,
+                        T                    beta,
+                        Y*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_index_base base);
+
 template <typename T, typename I, typename A, typename X, typename Y>
 void host_coomv_aos(rocsparse_operation  trans,
                     I                    M,
@@ -276,6 +295,27 @@ void host_csrmv(rocsparse_operation   trans,
                 rocsparse_spmv_alg    algo,
                 bool                  force_conj);
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_csrmv_batched(rocsparse_operation   trans,
+                        J                     M,
+                        J                     N,
+                        I                     nnz,
+                        int64_t               batch_count,
+                        T                     alpha,
+                        const I*              csr_row_ptr,
+                        int64_t               offsets_batch_stride,
+                        const J*              csr_col_ind,
+                        int64_t               columns_batch_stride,
+                        const A*              csr_val,
+                        int64_t               values_batch_stride,
+                        const X*              x,
+                        int64_t               x_batch_stride,
+                        T                     beta,
+                        Y*                    y,
+                        int64_t               y_batch_stride,
+                        rocsparse_index_base  base,
+                        rocsparse_matrix_type matrix_type);
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_cscmv(rocsparse_operation trans,
                 J                   M,
@@ -337,6 +377,21 @@ void host_ellmv(rocsparse_operation  trans,
                 Y*                   y,
                 rocsparse_index_base base);
 
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_bellmv(rocsparse_operation  trans,
+                 rocsparse_direction  dir,
+                 I                    Mb,
+                 I                    Nb,
+                 I                    bell_cols,
+                 I                    block_dim,
+                 T                    alpha,
+                 const I*             bell_col_ind,
+                 const A*             bell_val,
+                 const X*             x,
+                 T                    beta,
+                 Y*                   y,
+                 rocsparse_index_base base);
+
 template <typename T>
 void host_hybmv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -777,24 +832,24 @@ void host_csrgemm_nnz(J                    M,
                       rocsparse_index_base base_C,
                       rocsparse_index_base base_D);
 
-template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int, typename A = T>
 void host_csrgemm(J                    M,
                   J                    N,
                   J                    L,
                   const T*             alpha,
                   const I*             csr_row_ptr_A,
                   const J*             csr_col_ind_A,
-                  const T*             csr_val_A,
+                  const A*             csr_val_A,
                   const I*             csr_row_ptr_B,
                   const J*             csr_col_ind_B,
-                  const T*             csr_val_B,
+                  const A*             csr_val_B,
                   const T*             beta,
                   const I*             csr_row_ptr_D,
                   const J*             csr_col_ind_D,
-                  const T*             csr_val_D,
+                  const A*             csr_val_D,
                   const I*             csr_row_ptr_C,
                   J*                   csr_col_ind_C,
-                  T*                   csr_val_C,
+                  A*                   csr_val_C,
                   rocsparse_index_base base_A,
                   rocsparse_index_base base_B,
                   rocsparse_index_base base_C,
@@ -851,6 +906,52 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T>
+void host_csriluk(rocsparse_int                     level,
+                  rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  std::vector<rocsparse_int>&       lu_row_ptr,
+                  std::vector<rocsparse_int>&       lu_col_ind,
+                  std::vector<T>&                   lu_val,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot);
+
+template <typename T>
+void host_csritilu0_apply(rocsparse_int        nsweeps,
+                          rocsparse_int        M,
+                          const rocsparse_int* csr_row_ptr,
+                          const rocsparse_int* csr_col_ind,
+                          const T*             ilu0,
+                          rocsparse_index_base base,
+                          const T*             x,
+                          T*                   y);
+
+template <typename T>
+void host_csrmc_reorder(rocsparse_int                     M,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        const std::vector<rocsparse_int>& coloring,
+                        rocsparse_index_base              base,
+                        std::vector<rocsparse_int>&       perm,
+                        std::vector<rocsparse_int>&       mc_row_ptr,
+                        std::vector<rocsparse_int>&       mc_col_ind,
+                        std::vector<T>&                   mc_val);
+
+template <typename T>
+void host_csrmcgs(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& mc_row_ptr,
+                  const std::vector<rocsparse_int>& mc_col_ind,
+                  const std::vector<T>&             mc_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int                     nsweeps,
+                  bool                              symmetric,
+                  const std::vector<T>&             b,
+                  std::vector<T>&                   x);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -27,6 +27,7 @@
 #define ROCSPARSE_MATH_HPP
 
 #include <cmath>
+#include <hip/hip_bfloat16.h>
 #include <rocsparse.h>
 
 /* =================================================================================== */
@@ -63,6 +64,18 @@ inline bool rocsparse_isnan(double arg)
 {
     return std::isnan(arg);
 }
+
+template <>
+inline bool rocsparse_isnan(_Float16 arg)
+{
+    return std::isnan(static_cast<float>(arg));
+}
+
+template <>
+inline bool rocsparse_isnan(hip_bfloat16 arg)
+{
+    return std::isnan(static_cast<float>(arg));
+}
 template <>
 inline bool rocsparse_isnan(float arg)
 {
@@ -122,6 +135,18 @@ inline bool rocsparse_isinf(double arg)
     return std::isinf(arg);
 }
 
+template <>
+inline bool rocsparse_isinf(_Float16 arg)
+{
+    return std::isinf(static_cast<float>(arg));
+}
+
+template <>
+inline bool rocsparse_isinf(hip_bfloat16 arg)
+{
+    return std::isinf(static_cast<float>(arg));
+}
+
 template <>
 inline bool rocsparse_isinf(rocsparse_float_complex arg)
 {
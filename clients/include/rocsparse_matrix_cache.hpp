@@ -0,0 +1,77 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_CACHE_HPP
+#define ROCSPARSE_MATRIX_CACHE_HPP
+
+#include <rocsparse.h>
+#include <vector>
+
+//
+// Binary cache of the matrices imported from files.
+//
+// The imported matrix is stored in '<filename>.<T>_<I>_<J>.cache', next to the file or in the
+// directory ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR if defined. The cache is reused as long as the
+// size and the modification time of the file are unchanged, it can be disabled with
+// ROCSPARSE_CLIENTS_NO_MATRICES_CACHE=1.
+//
+// CSR matrices are stored with row_block_dim = col_block_dim = 1.
+//
+
+///
+/// @brief Load a matrix from the cache of the file \p filename.
+/// @return true if the cache exists and is valid, false otherwise.
+///
+template <typename T, typename I, typename J>
+bool rocsparse_matrix_cache_load(const char*          filename,
+                                 rocsparse_direction& dirb,
+                                 J&                   M,
+                                 J&                   N,
+                                 I&                   nnz,
+                                 J&                   row_block_dim,
+                                 J&                   col_block_dim,
+                                 std::vector<I>&      ptr,
+                                 std::vector<J>&      ind,
+                                 std::vector<T>&      val,
+                                 rocsparse_index_base base);
+
+///
+/// @brief Save a matrix imported from the file \p filename to its cache.
+/// @note Failing to write the cache is not an error.
+///
+template <typename T, typename I, typename J>
+void rocsparse_matrix_cache_save(const char*           filename,
+                                 rocsparse_direction   dirb,
+                                 J                     M,
+                                 J                     N,
+                                 I                     nnz,
+                                 J                     row_block_dim,
+                                 J                     col_block_dim,
+                                 const std::vector<I>& ptr,
+                                 const std::vector<J>& ind,
+                                 const std::vector<T>& val,
+                                 rocsparse_index_base  base);
+
+#endif
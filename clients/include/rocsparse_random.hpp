@@ -128,6 +128,18 @@ public:
         return random_nan_data<float, uint32_t, 23, 8>();
     }
 
+    // Random NaN half
+    explicit operator _Float16()
+    {
+        return random_nan_data<_Float16, uint16_t, 10, 5>();
+    }
+
+    // Random NaN bfloat16
+    explicit operator hip_bfloat16()
+    {
+        return random_nan_data<hip_bfloat16, uint16_t, 7, 8>();
+    }
+
     explicit operator rocsparse_float_complex()
     {
         return {float(*this), float(*this)};
@@ -149,6 +161,19 @@ inline T random_generator_exact(int a = 1, int b = 10)
     return std::uniform_int_distribution<int>(a, b)(rocsparse_rng_get());
 }
 
+template <>
+inline _Float16 random_generator_exact<_Float16>(int a, int b)
+{
+    return static_cast<_Float16>(std::uniform_int_distribution<int>(a, b)(rocsparse_rng_get()));
+}
+
+template <>
+inline hip_bfloat16 random_generator_exact<hip_bfloat16>(int a, int b)
+{
+    return static_cast<hip_bfloat16>(
+        static_cast<float>(std::uniform_int_distribution<int>(a, b)(rocsparse_rng_get())));
+}
+
 template <>
 inline rocsparse_float_complex random_generator_exact<rocsparse_float_complex>(int a, int b)
 {
@@ -176,6 +201,18 @@ inline T random_generator(T a = static_cast<T>(0), T b = static_cast<T>(1))
     return std::uniform_real_distribution<T>(a, b)(rocsparse_rng_get());
 }
 
+template <>
+inline _Float16 random_generator<_Float16>(_Float16 a, _Float16 b)
+{
+    return static_cast<_Float16>(random_generator<float>(a, b));
+}
+
+template <>
+inline hip_bfloat16 random_generator<hip_bfloat16>(hip_bfloat16 a, hip_bfloat16 b)
+{
+    return static_cast<hip_bfloat16>(random_generator<float>(a, b));
+}
+
 template <>
 inline rocsparse_float_complex random_generator<rocsparse_float_complex>(rocsparse_float_complex a,
                                                                          rocsparse_float_complex b)
@@ -210,6 +247,18 @@ inline float random_cached_generator_exact(int a, int b)
     return static_cast<float>(rocsparse_uniform_int(a, b));
 }
 
+template <>
+inline _Float16 random_cached_generator_exact(int a, int b)
+{
+    return static_cast<_Float16>(rocsparse_uniform_int(a, b));
+}
+
+template <>
+inline hip_bfloat16 random_cached_generator_exact(int a, int b)
+{
+    return static_cast<hip_bfloat16>(static_cast<float>(rocsparse_uniform_int(a, b)));
+}
+
 template <>
 inline double random_cached_generator_exact(int a, int b)
 {
@@ -100,6 +100,49 @@ struct testing_matrix_type_traits<rocsparse_format_ell, I, I, T>
     using device_sparse_matrix = device_ell_matrix<U, I>;
 };
 
+//
+// Reset the data pointers of a sparse matrix descriptor.
+//
+template <typename T, typename I, typename J>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr descr,
+                                           device_csr_matrix<T, I, J>& m)
+{
+    return rocsparse_csr_set_pointers(descr, m.ptr, m.ind, m.val);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr descr,
+                                           device_csc_matrix<T, I, J>& m)
+{
+    return rocsparse_csc_set_pointers(descr, m.ptr, m.ind, m.val);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr         descr,
+                                           device_gebsr_matrix<T, I, J>& m)
+{
+    return rocsparse_bsr_set_pointers(descr, m.ptr, m.ind, m.val);
+}
+
+template <typename T, typename I>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr descr, device_coo_matrix<T, I>& m)
+{
+    return rocsparse_coo_set_pointers(descr, m.row_ind, m.col_ind, m.val);
+}
+
+template <typename T, typename I>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr       descr,
+                                           device_coo_aos_matrix<T, I>& m)
+{
+    return rocsparse_coo_aos_set_pointers(descr, m.ind, m.val);
+}
+
+template <typename T, typename I>
+rocsparse_status testing_spmv_set_pointers(rocsparse_spmat_descr descr, device_ell_matrix<T, I>& m)
+{
+    return rocsparse_ell_set_pointers(descr, m.ind, m.val);
+}
+
 template <rocsparse_format FORMAT,
           typename I,
           typename J,
@@ -752,6 +795,28 @@ public:
         CHECK_ROCSPARSE_ERROR(
             rocsparse_spmv(PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_preprocess)));
 
+        // The preprocess stage selects the algorithm in automatic mode
+        if(arg.unit_check && alg == rocsparse_spmv_alg_auto)
+        {
+            rocsparse_spmv_alg selected_alg;
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+                matA, rocsparse_spmat_spmv_alg, &selected_alg, sizeof(selected_alg)));
+
+            const int selected = (selected_alg != rocsparse_spmv_alg_default
+                                  && selected_alg != rocsparse_spmv_alg_auto);
+            unit_check_scalar<int>(1, selected);
+
+            // Setting the pointers discards the selected algorithm
+            CHECK_ROCSPARSE_ERROR(testing_spmv_set_pointers(matA, dA));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+                matA, rocsparse_spmat_spmv_alg, &selected_alg, sizeof(selected_alg)));
+            unit_check_scalar<int>(rocsparse_spmv_alg_default, selected_alg);
+
+            // Select it again
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_preprocess)));
+        }
+
         // Pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -786,6 +851,82 @@ public:
             }
 
             hy.near_check(dy);
+
+            //
+            // A transposed preprocess stage must not leave row bins or a selected algorithm
+            // behind that a non-transposed compute stage would then launch from
+            //
+            if((alg == rocsparse_spmv_alg_csr_binned || alg == rocsparse_spmv_alg_auto)
+               && trans != rocsparse_operation_none
+               && matrix_type == rocsparse_matrix_type_general && M == N)
+            {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+                rocsparse_local_spmat matB(dA);
+
+                size_t buffer_size_trans = 0;
+                size_t buffer_size_none  = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                     trans,
+                                                     h_alpha,
+                                                     matB,
+                                                     x,
+                                                     h_beta,
+                                                     y,
+                                                     ttype,
+                                                     alg,
+                                                     rocsparse_spmv_stage_buffer_size,
+                                                     &buffer_size_trans,
+                                                     nullptr));
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                     rocsparse_operation_none,
+                                                     h_alpha,
+                                                     matB,
+                                                     x,
+                                                     h_beta,
+                                                     y,
+                                                     ttype,
+                                                     alg,
+                                                     rocsparse_spmv_stage_buffer_size,
+                                                     &buffer_size_none,
+                                                     nullptr));
+
+                size_t buffer_size_B = std::max(buffer_size_trans, buffer_size_none);
+                void*  dbuffer_B     = nullptr;
+                CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer_B, buffer_size_B));
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                     trans,
+                                                     h_alpha,
+                                                     matB,
+                                                     x,
+                                                     h_beta,
+                                                     y,
+                                                     ttype,
+                                                     alg,
+                                                     rocsparse_spmv_stage_preprocess,
+                                                     &buffer_size_B,
+                                                     dbuffer_B));
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                     rocsparse_operation_none,
+                                                     h_alpha,
+                                                     matB,
+                                                     x,
+                                                     h_beta,
+                                                     y,
+                                                     ttype,
+                                                     alg,
+                                                     rocsparse_spmv_stage_compute,
+                                                     &buffer_size_B,
+                                                     dbuffer_B));
+
+                traits::host_calculation(
+                    rocsparse_operation_none, h_alpha, hA, hx, h_beta, hy, alg, matrix_type);
+                hy.near_check(dy);
+
+                CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer_B));
+            }
         }
 
         if(arg.timing)
@@ -297,6 +297,14 @@ auto rocsparse_iaxyt_dispatch(const Arguments& arg)
         = (A == rocsparse_datatype_i8_r && X == rocsparse_datatype_i8_r
            && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
 
+    bool f16r_f32r_f32r_f32r_case
+        = (A == rocsparse_datatype_f16_r && X == rocsparse_datatype_f32_r
+           && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
+
+    bool bf16r_f32r_f32r_f32r_case
+        = (A == rocsparse_datatype_bf16_r && X == rocsparse_datatype_f32_r
+           && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
+
     bool f32r_f32c_f32c_f32c_case
         = (A == rocsparse_datatype_f32_r && X == rocsparse_datatype_f32_c
            && Y == rocsparse_datatype_f32_c && T == rocsparse_datatype_f32_c);
@@ -305,54 +313,62 @@ auto rocsparse_iaxyt_dispatch(const Arguments& arg)
         = (A == rocsparse_datatype_f64_r && X == rocsparse_datatype_f64_c
            && Y == rocsparse_datatype_f64_c && T == rocsparse_datatype_f64_c);
 
-#define INSTANTIATE_TEST(ITYPE)                                      \
-    if(f32r_case)                                                    \
-    {                                                                \
-        return TEST<ITYPE, float, float, float, float>{}(arg);       \
-    }                                                                \
-    else if(f64r_case)                                               \
-    {                                                                \
-        return TEST<ITYPE, double, double, double, double>{}(arg);   \
-    }                                                                \
-    else if(f32c_case)                                               \
-    {                                                                \
-        return TEST<ITYPE,                                           \
-                    rocsparse_float_complex,                         \
-                    rocsparse_float_complex,                         \
-                    rocsparse_float_complex,                         \
-                    rocsparse_float_complex>{}(arg);                 \
-    }                                                                \
-    else if(f64c_case)                                               \
-    {                                                                \
-        return TEST<ITYPE,                                           \
-                    rocsparse_double_complex,                        \
-                    rocsparse_double_complex,                        \
-                    rocsparse_double_complex,                        \
-                    rocsparse_double_complex>{}(arg);                \
-    }                                                                \
-    else if(i8r_i8r_i32r_i32r_case)                                  \
-    {                                                                \
-        return TEST<ITYPE, int8_t, int8_t, int32_t, int32_t>{}(arg); \
-    }                                                                \
-    else if(i8r_i8r_f32r_f32r_case)                                  \
-    {                                                                \
-        return TEST<ITYPE, int8_t, int8_t, float, float>{}(arg);     \
-    }                                                                \
-    else if(f32r_f32c_f32c_f32c_case)                                \
-    {                                                                \
-        return TEST<ITYPE,                                           \
-                    float,                                           \
-                    rocsparse_float_complex,                         \
-                    rocsparse_float_complex,                         \
-                    rocsparse_float_complex>{}(arg);                 \
-    }                                                                \
-    else if(f64r_f64c_f64c_f64c_case)                                \
-    {                                                                \
-        return TEST<ITYPE,                                           \
-                    double,                                          \
-                    rocsparse_double_complex,                        \
-                    rocsparse_double_complex,                        \
-                    rocsparse_double_complex>{}(arg);                \
+#define INSTANTIATE_TEST(ITYPE)                                       \
+    if(f32r_case)                                                     \
+    {                                                                 \
+        return TEST<ITYPE, float, float, float, float>{}(arg);        \
+    }                                                                 \
+    else if(f64r_case)                                                \
+    {                                                                 \
+        return TEST<ITYPE, double, double, double, double>{}(arg);    \
+    }                                                                 \
+    else if(f32c_case)                                                \
+    {                                                                 \
+        return TEST<ITYPE,                                            \
+                    rocsparse_float_complex,                          \
+                    rocsparse_float_complex,                          \
+                    rocsparse_float_complex,                          \
+                    rocsparse_float_complex>{}(arg);                  \
+    }                                                                 \
+    else if(f64c_case)                                                \
+    {                                                                 \
+        return TEST<ITYPE,                                            \
+                    rocsparse_double_complex,                         \
+                    rocsparse_double_complex,                         \
+                    rocsparse_double_complex,                         \
+                    rocsparse_double_complex>{}(arg);                 \
+    }                                                                 \
+    else if(i8r_i8r_i32r_i32r_case)                                   \
+    {                                                                 \
+        return TEST<ITYPE, int8_t, int8_t, int32_t, int32_t>{}(arg);  \
+    }                                                                 \
+    else if(i8r_i8r_f32r_f32r_case)                                   \
+    {                                                                 \
+        return TEST<ITYPE, int8_t, int8_t, float, float>{}(arg);      \
+    }                                                                 \
+    else if(f16r_f32r_f32r_f32r_case)                                 \
+    {                                                                 \
+        return TEST<ITYPE, _Float16, float, float, float>{}(arg);     \
+    }                                                                 \
+    else if(bf16r_f32r_f32r_f32r_case)                                \
+    {                                                                 \
+        return TEST<ITYPE, hip_bfloat16, float, float, float>{}(arg); \
+    }                                                                 \
+    else if(f32r_f32c_f32c_f32c_case)                                 \
+    {                                                                 \
+        return TEST<ITYPE,                                            \
+                    float,                                            \
+                    rocsparse_float_complex,                          \
+                    rocsparse_float_complex,                          \
+                    rocsparse_float_complex>{}(arg);                  \
+    }                                                                 \
+    else if(f64r_f64c_f64c_f64c_case)                                 \
+    {                                                                 \
+        return TEST<ITYPE,                                            \
+                    double,                                           \
+                    rocsparse_double_complex,                         \
+                    rocsparse_double_complex,                         \
+                    rocsparse_double_complex>{}(arg);                 \
     }
 
     switch(I)
@@ -400,6 +416,14 @@ auto rocsparse_ijaxyt_dispatch(const Arguments& arg)
         = (A == rocsparse_datatype_i8_r && X == rocsparse_datatype_i8_r
            && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
 
+    bool f16r_f32r_f32r_f32r_case
+        = (A == rocsparse_datatype_f16_r && X == rocsparse_datatype_f32_r
+           && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
+
+    bool bf16r_f32r_f32r_f32r_case
+        = (A == rocsparse_datatype_bf16_r && X == rocsparse_datatype_f32_r
+           && Y == rocsparse_datatype_f32_r && T == rocsparse_datatype_f32_r);
+
     bool f32r_f32c_f32c_f32c_case
         = (A == rocsparse_datatype_f32_r && X == rocsparse_datatype_f32_c
            && Y == rocsparse_datatype_f32_c && T == rocsparse_datatype_f32_c);
@@ -408,58 +432,66 @@ auto rocsparse_ijaxyt_dispatch(const Arguments& arg)
         = (A == rocsparse_datatype_f64_r && X == rocsparse_datatype_f64_c
            && Y == rocsparse_datatype_f64_c && T == rocsparse_datatype_f64_c);
 
-#define INSTANTIATE_TEST(ITYPE, JTYPE)                                      \
-    if(f32r_case)                                                           \
-    {                                                                       \
-        return TEST<ITYPE, JTYPE, float, float, float, float>{}(arg);       \
-    }                                                                       \
-    else if(f64r_case)                                                      \
-    {                                                                       \
-        return TEST<ITYPE, JTYPE, double, double, double, double>{}(arg);   \
-    }                                                                       \
-    else if(f32c_case)                                                      \
-    {                                                                       \
-        return TEST<ITYPE,                                                  \
-                    JTYPE,                                                  \
-                    rocsparse_float_complex,                                \
-                    rocsparse_float_complex,                                \
-                    rocsparse_float_complex,                                \
-                    rocsparse_float_complex>{}(arg);                        \
-    }                                                                       \
-    else if(f64c_case)                                                      \
-    {                                                                       \
-        return TEST<ITYPE,                                                  \
-                    JTYPE,                                                  \
-                    rocsparse_double_complex,                               \
-                    rocsparse_double_complex,                               \
-                    rocsparse_double_complex,                               \
-                    rocsparse_double_complex>{}(arg);                       \
-    }                                                                       \
-    else if(i8r_i8r_i32r_i32r_case)                                         \
-    {                                                                       \
-        return TEST<ITYPE, JTYPE, int8_t, int8_t, int32_t, int32_t>{}(arg); \
-    }                                                                       \
-    else if(i8r_i8r_f32r_f32r_case)                                         \
-    {                                                                       \
-        return TEST<ITYPE, JTYPE, int8_t, int8_t, float, float>{}(arg);     \
-    }                                                                       \
-    else if(f32r_f32c_f32c_f32c_case)                                       \
-    {                                                                       \
-        return TEST<ITYPE,                                                  \
-                    JTYPE,                                                  \
-                    float,                                                  \
-                    rocsparse_float_complex,                                \
-                    rocsparse_float_complex,                                \
-                    rocsparse_float_complex>{}(arg);                        \
-    }                                                                       \
-    else if(f64r_f64c_f64c_f64c_case)                                       \
-    {                                                                       \
-        return TEST<ITYPE,                                                  \
-                    JTYPE,                                                  \
-                    double,                                                 \
-                    rocsparse_double_complex,                               \
-                    rocsparse_double_complex,                               \
-                    rocsparse_double_complex>{}(arg);                       \
+#define INSTANTIATE_TEST(ITYPE, JTYPE)                                       \
+    if(f32r_case)                                                            \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, float, float, float, float>{}(arg);        \
+    }                                                                        \
+    else if(f64r_case)                                                       \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, double, double, double, double>{}(arg);    \
+    }                                                                        \
+    else if(f32c_case)                                                       \
+    {                                                                        \
+        return TEST<ITYPE,                                                   \
+                    JTYPE,                                                   \
+                    rocsparse_float_complex,                                 \
+                    rocsparse_float_complex,                                 \
+                    rocsparse_float_complex,                                 \
+                    rocsparse_float_complex>{}(arg);                         \
+    }                                                                        \
+    else if(f64c_case)                                                       \
+    {                                                                        \
+        return TEST<ITYPE,                                                   \
+                    JTYPE,                                                   \
+                    rocsparse_double_complex,                                \
+                    rocsparse_double_complex,                                \
+                    rocsparse_double_complex,                                \
+                    rocsparse_double_complex>{}(arg);                        \
+    }                                                                        \
+    else if(i8r_i8r_i32r_i32r_case)                                          \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, int8_t, int8_t, int32_t, int32_t>{}(arg);  \
+    }                                                                        \
+    else if(i8r_i8r_f32r_f32r_case)                                          \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, int8_t, int8_t, float, float>{}(arg);      \
+    }                                                                        \
+    else if(f16r_f32r_f32r_f32r_case)                                        \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, _Float16, float, float, float>{}(arg);     \
+    }                                                                        \
+    else if(bf16r_f32r_f32r_f32r_case)                                       \
+    {                                                                        \
+        return TEST<ITYPE, JTYPE, hip_bfloat16, float, float, float>{}(arg); \
+    }                                                                        \
+    else if(f32r_f32c_f32c_f32c_case)                                        \
+    {                                                                        \
+        return TEST<ITYPE,                                                   \
+                    JTYPE,                                                   \
+                    float,                                                   \
+                    rocsparse_float_complex,                                 \
+                    rocsparse_float_complex,                                 \
+                    rocsparse_float_complex>{}(arg);                         \
+    }                                                                        \
+    else if(f64r_f64c_f64c_f64c_case)                                        \
+    {                                                                        \
+        return TEST<ITYPE,                                                   \
+                    JTYPE,                                                   \
+                    double,                                                  \
+                    rocsparse_double_complex,                                \
+                    rocsparse_double_complex,                                \
+                    rocsparse_double_complex>{}(arg);                        \
     }
 
     switch(I)
@@ -89,6 +89,18 @@ inline rocsparse_datatype get_datatype<uint32_t>(void)
     return rocsparse_datatype_u32_r;
 }
 
+template <>
+inline rocsparse_datatype get_datatype<_Float16>(void)
+{
+    return rocsparse_datatype_f16_r;
+}
+
+template <>
+inline rocsparse_datatype get_datatype<hip_bfloat16>(void)
+{
+    return rocsparse_datatype_bf16_r;
+}
+
 template <>
 inline rocsparse_datatype get_datatype<float>(void)
 {
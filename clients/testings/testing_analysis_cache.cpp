@@ -0,0 +1,282 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_analysis_cache_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+    rocsparse_handle       handle = local_handle;
+
+    size_t num_entries;
+    size_t num_hits;
+    size_t num_misses;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_analysis_cache_size(nullptr, 0),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_clear_analysis_cache(nullptr),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(nullptr, &num_entries, &num_hits, &num_misses),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(handle, nullptr, &num_hits, &num_misses),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(handle, &num_entries, nullptr, &num_misses),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(handle, &num_entries, &num_hits, nullptr),
+        rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_analysis_cache(const Arguments& arg)
+{
+    auto                      tol   = get_near_check_tol<T>(arg);
+    rocsparse_int             M     = arg.M;
+    rocsparse_int             N     = arg.M;
+    rocsparse_operation       trans = arg.transA;
+    rocsparse_analysis_policy apol  = arg.apol;
+    rocsparse_solve_policy    spol  = arg.spol;
+    rocsparse_index_base      base  = arg.baseA;
+
+    host_scalar<T> h_alpha(static_cast<T>(1));
+    host_scalar<T> h_beta(static_cast<T>(0));
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix infos, the analysis of the second one is taken from the cache
+    rocsparse_local_mat_info info_analysed;
+    rocsparse_local_mat_info info_cached;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Second matrix with the same sparsity pattern and other values
+    host_csr_matrix<T> hB(hA);
+    for(size_t i = 0; i < hB.nnz; ++i)
+    {
+        hB.val[i] = hB.val[i] * static_cast<T>(2);
+    }
+
+    device_csr_matrix<T> dA(hA);
+    device_csr_matrix<T> dB(hB);
+
+    host_dense_matrix<T> hx(M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy_analysed(M, 1);
+    device_dense_matrix<T> dy_cached(M, 1);
+
+#define PARAMS_CSRMV_ANALYSIS(A_, info_) \
+    handle, trans, A_.m, A_.n, A_.nnz, descr, A_.val, A_.ptr, A_.ind, info_
+#define PARAMS_CSRSV_ANALYSIS(A_, info_) \
+    handle, trans, A_.m, A_.nnz, descr, A_.val, A_.ptr, A_.ind, info_, apol, spol, dbuffer
+#define PARAMS_CSRMV(A_, info_, y_)                                                                \
+    handle, trans, A_.m, A_.n, A_.nnz, h_alpha, descr, A_.val, A_.ptr, A_.ind, info_, dx, h_beta, \
+        y_
+#define PARAMS_CSRSV(A_, info_, y_)                                                            \
+    handle, trans, A_.m, A_.nnz, h_alpha, descr, A_.val, A_.ptr, A_.ind, info_, dx, y_, spol, \
+        dbuffer
+
+    void* dbuffer;
+    {
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                             trans,
+                                                             dA.m,
+                                                             dA.nnz,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info_analysed,
+                                                             &buffer_size));
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 4));
+    CHECK_ROCSPARSE_ERROR(rocsparse_clear_analysis_cache(handle));
+
+    if(arg.unit_check)
+    {
+        size_t num_entries, num_hits, num_misses;
+
+        // The analysis of the first matrix is stored, the second one is a hit
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis<T>(PARAMS_CSRMV_ANALYSIS(dA, info_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_CSRMV_ANALYSIS(dB, info_cached)));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrsv_analysis<T>(PARAMS_CSRSV_ANALYSIS(dA, info_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_CSRSV_ANALYSIS(dB, info_cached)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &num_entries, &num_hits, &num_misses));
+
+        if(M > 0)
+        {
+            unit_check_scalar<size_t>(2, num_entries);
+            unit_check_scalar<size_t>(2, num_hits);
+            unit_check_scalar<size_t>(2, num_misses);
+        }
+
+        // The cached analysis data gives the same results as a fresh analysis
+        device_csr_matrix<T>     dB_analysed(hB);
+        rocsparse_local_mat_info info_fresh;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis<T>(PARAMS_CSRMV_ANALYSIS(dB_analysed, info_fresh)));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrsv_analysis<T>(PARAMS_CSRSV_ANALYSIS(dB_analysed, info_fresh)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv<T>(PARAMS_CSRMV(dB_analysed, info_fresh, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(dB, info_cached, dy_cached)));
+
+        host_dense_matrix<T> hy_analysed(dy_analysed);
+        hy_analysed.near_check(dy_cached, tol);
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrsv_solve<T>(PARAMS_CSRSV(dB_analysed, info_fresh, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_CSRSV(dB, info_cached, dy_cached)));
+
+        hy_analysed.transfer_from(dy_analysed);
+        hy_analysed.near_check(dy_cached, tol);
+
+        // Resizing the cache evicts its entries
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &num_entries, &num_hits, &num_misses));
+        unit_check_scalar<size_t>(0, num_entries);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_fresh));
+
+        if(M > 1)
+        {
+            // Another sparsity pattern is a miss
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 4));
+            CHECK_ROCSPARSE_ERROR(rocsparse_clear_analysis_cache(handle));
+
+            host_csr_matrix<T> hC(hA);
+            hC.ind[0] = (hC.ind[0] - base + 1) % N + base;
+
+            device_csr_matrix<T>     dC(hC);
+            rocsparse_local_mat_info info_C;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_CSRMV_ANALYSIS(dA, info_C)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info_C));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_CSRMV_ANALYSIS(dC, info_C)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_get_analysis_cache_info(handle, &num_entries, &num_hits, &num_misses));
+            unit_check_scalar<size_t>(2, num_entries);
+            unit_check_scalar<size_t>(0, num_hits);
+            unit_check_scalar<size_t>(2, num_misses);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info_C));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up, fills the cache
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrsv_analysis<T>(PARAMS_CSRSV_ANALYSIS(dB, info_cached)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_cached));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run, the analysis data is taken from the cache
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrsv_analysis<T>(PARAMS_CSRSV_ANALYSIS(dB, info_cached)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_cached));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        size_t num_entries, num_hits, num_misses;
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &num_entries, &num_hits, &num_misses));
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "hits",
+                            num_hits,
+                            "misses",
+                            num_misses,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS_CSRSV
+#undef PARAMS_CSRMV
+#undef PARAMS_CSRSV_ANALYSIS
+#undef PARAMS_CSRMV_ANALYSIS
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_analysed));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_cached));
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_analysis_cache_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_analysis_cache<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_analysis_cache_extra(const Arguments& arg) {}
@@ -1,6 +1,6 @@
 /*! \file */
 /* ************************************************************************
- * Copyright (C) 2019-2022 Advanced Micro Devices, Inc. All rights Reserved.
+ * Copyright (C) 2019-2023 Advanced Micro Devices, Inc. All rights Reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -59,6 +59,22 @@ void testing_csr2hyb_bad_arg(const Arguments& arg)
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_storage_mode(descr, rocsparse_storage_mode_unsorted));
     EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb<T>(PARAMS), rocsparse_status_not_implemented);
 #undef PARAMS
+
+    // rocsparse_get_hyb_mat_partition
+    rocsparse_int ell_width;
+    rocsparse_int coo_nnz;
+    int64_t       hybmv_bytes;
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_hyb_mat_partition(nullptr, &ell_width, &coo_nnz, &hybmv_bytes),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_hyb_mat_partition(hyb, nullptr, &coo_nnz, &hybmv_bytes),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_hyb_mat_partition(hyb, &ell_width, nullptr, &hybmv_bytes),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_hyb_mat_partition(hyb, &ell_width, &coo_nnz, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -272,6 +288,22 @@ void testing_csr2hyb(const Arguments& arg)
         hhyb_coo_row_ind_gold.unit_check(hhyb_coo_row_ind);
         hhyb_coo_col_ind_gold.unit_check(hhyb_coo_col_ind);
         hhyb_coo_val_gold.unit_check(hhyb_coo_val);
+
+        // Chosen partitioning and predicted hybmv traffic
+        rocsparse_int ell_width_part;
+        rocsparse_int coo_nnz_part;
+        int64_t       hybmv_bytes;
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_hyb_mat_partition(hyb, &ell_width_part, &coo_nnz_part, &hybmv_bytes));
+
+        int64_t hybmv_bytes_gold
+            = int64_t(ell_nnz_gold) * (sizeof(rocsparse_int) + sizeof(T))
+              + int64_t(coo_nnz_gold) * (2 * sizeof(rocsparse_int) + 3 * sizeof(T))
+              + int64_t(nnz) * sizeof(T) + int64_t(M) * 2 * sizeof(T);
+
+        unit_check_scalar<rocsparse_int>(ell_width_gold, ell_width_part);
+        unit_check_scalar<rocsparse_int>(coo_nnz_gold, coo_nnz_part);
+        unit_check_scalar<int64_t>(hybmv_bytes_gold, hybmv_bytes);
     }
 
     if(arg.timing)
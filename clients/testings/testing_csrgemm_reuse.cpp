@@ -440,7 +440,7 @@ void testing_csrgemm_reuse(const Arguments& arg)
     T v_alpha = arg.get_alpha<T>(), v_beta = arg.get_beta<T>();
 
     // Create rocsparse handle
-    rocsparse_local_handle handle;
+    rocsparse_local_handle handle(arg);
 
     // Create matrix descriptor
     rocsparse_local_mat_descr descrA;
@@ -737,8 +737,43 @@ void testing_csrgemm_reuse(const Arguments& arg)
             host_scalar<rocsparse_int> h_out_nnz(d_out_nnz);
             d_C.define(d_C.m, d_C.n, *h_out_nnz, d_C.base);
             CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic(PARAMS_SYMBOLIC(d_A, d_B, d_C, d_D)));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrgemm_numeric<T>(
+                PARAMS_NUMERIC(d_alpha, d_beta, d_A, d_B, d_C, d_D)));
+            h_C.near_check(d_C);
+        }
+
+        {
+            //
+            // GPU, repeated numeric stage reusing the row groups of the symbolic stage
+            //
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_HIP_ERROR(hipMemset(d_C.val, 0, sizeof(T) * d_C.nnz));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrgemm_numeric<T>(
+                PARAMS_NUMERIC(d_alpha, d_beta, d_A, d_B, d_C, d_D)));
+            h_C.near_check(d_C);
+        }
+
+        {
+            //
+            // GPU with sizes mode device, the row group sizes of all stages stay on the
+            // device
+            //
+            device_scalar<rocsparse_int> d_out_nnz;
             CHECK_ROCSPARSE_ERROR(
-                rocsparse_csrgemm_numeric<T>(PARAMS_NUMERIC(d_alpha, d_beta, d_A, d_B, d_C, d_D)));
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_sizes_mode(handle, rocsparse_sizes_mode_device));
+            CHECK_HIP_ERROR(hipMemset(d_C.ptr, 0, sizeof(rocsparse_int) * (d_C.m + 1)));
+            CHECK_HIP_ERROR(hipMemset(d_C.ind, 0, sizeof(rocsparse_int) * d_C.nnz));
+            CHECK_HIP_ERROR(hipMemset(d_C.val, 0, sizeof(T) * d_C.nnz));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(PARAMS_NNZ(d_A, d_B, d_C, d_D, d_out_nnz)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic(PARAMS_SYMBOLIC(d_A, d_B, d_C, d_D)));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrgemm_numeric<T>(
+                PARAMS_NUMERIC(d_alpha, d_beta, d_A, d_B, d_C, d_D)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_sizes_mode(handle, rocsparse_sizes_mode_host));
+
+            host_scalar<rocsparse_int> h_out_nnz(d_out_nnz);
+            unit_check_scalar<rocsparse_int>(h_C.nnz, *h_out_nnz);
             h_C.near_check(d_C);
         }
     }
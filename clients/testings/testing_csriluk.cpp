@@ -0,0 +1,506 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csriluk.hpp"
+
+template <typename T>
+void testing_csriluk_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             level       = 1;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const T*                  csr_val     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    T*                        lu_val      = (T*)0x4;
+    rocsparse_int*            lu_row_ptr  = (rocsparse_int*)0x4;
+    rocsparse_int*            lu_col_ind  = (rocsparse_int*)0x4;
+    rocsparse_analysis_policy analysis    = rocsparse_analysis_policy_force;
+    rocsparse_solve_policy    solve       = rocsparse_solve_policy_auto;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size
+#define PARAMS_ANALYSIS                                                                     \
+    handle, level, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, analysis, solve, \
+        temp_buffer
+#define PARAMS                                                                          \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, lu_val, lu_row_ptr, \
+        lu_col_ind, solve, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csriluk_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    {
+        static constexpr int nargs_to_exclude   = 1;
+        const int            args_to_exclude[1] = {1};
+        auto_testing_bad_arg(
+            rocsparse_csriluk_analysis<T>, nargs_to_exclude, args_to_exclude, PARAMS_ANALYSIS);
+    }
+    auto_testing_bad_arg(rocsparse_csriluk<T>, PARAMS);
+
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_analysis<T>(PARAMS_ANALYSIS),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_storage_mode(descr, rocsparse_storage_mode_unsorted));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_analysis<T>(PARAMS_ANALYSIS),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_storage_mode(descr, rocsparse_storage_mode_sorted));
+
+    // Negative level of fill
+    level = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_analysis<T>(PARAMS_ANALYSIS),
+                            rocsparse_status_invalid_value);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_ANALYSIS
+#undef PARAMS
+
+    // Test rocsparse_csriluk_nnz()
+    rocsparse_int lu_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(nullptr, info, &lu_nnz),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle, nullptr, &lu_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csriluk_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csriluk_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csriluk(const Arguments& arg)
+{
+    rocsparse_int M     = arg.M;
+    rocsparse_int N     = arg.N;
+    rocsparse_int level = arg.K;
+
+    rocsparse_analysis_policy apol = arg.apol;
+    rocsparse_solve_policy    spol = arg.spol;
+    rocsparse_index_base      base = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+        rocsparse_int       lu_nnz;
+        rocsparse_int       pivot;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dlu_row_ptr(safe_size);
+        device_vector<rocsparse_int> dlu_col_ind(safe_size);
+        device_vector<T>             dlu_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dlu_row_ptr || !dlu_col_ind
+           || !dlu_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_buffer_size<T>(handle,
+                                                                 M,
+                                                                 safe_size,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 info,
+                                                                 &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_analysis<T>(handle,
+                                                              level,
+                                                              M,
+                                                              safe_size,
+                                                              descr,
+                                                              dcsr_val,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              info,
+                                                              apol,
+                                                              spol,
+                                                              dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     info,
+                                                     dlu_val,
+                                                     dlu_row_ptr,
+                                                     dlu_col_ind,
+                                                     spol,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle, info, &lu_nnz),
+                                rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_clear(handle, info), rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Symbolic phase
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_analysis<T>(handle,
+                                                        level,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+
+    rocsparse_int lu_nnz;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle, info, &lu_nnz));
+
+    // Allocate device memory for the factors
+    device_vector<rocsparse_int> dlu_row_ptr(M + 1);
+    device_vector<rocsparse_int> dlu_col_ind(lu_nnz);
+    device_vector<T>             dlu_val_1(lu_nnz);
+    device_vector<T>             dlu_val_2(lu_nnz);
+
+    host_vector<rocsparse_int> h_analysis_pivot_1(1);
+    host_vector<rocsparse_int> h_solve_pivot_1(1);
+    host_vector<rocsparse_int> h_solve_pivot_2(1);
+    host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+    host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+    device_vector<rocsparse_int> d_lu_nnz(1);
+    device_vector<rocsparse_int> d_solve_pivot_2(1);
+
+    if(arg.unit_check)
+    {
+        {
+            auto st = rocsparse_csriluk_zero_pivot(handle, info, h_analysis_pivot_1);
+            EXPECT_ROCSPARSE_STATUS(st,
+                                    (h_analysis_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                                  : rocsparse_status_success);
+        }
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csriluk<T>(handle,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            dlu_val_1,
+                                                            dlu_row_ptr,
+                                                            dlu_col_ind,
+                                                            spol,
+                                                            dbuffer));
+        {
+            auto st = rocsparse_csriluk_zero_pivot(handle, info, h_solve_pivot_1);
+            EXPECT_ROCSPARSE_STATUS(st,
+                                    (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                               : rocsparse_status_success);
+        }
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csriluk<T>(handle,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            dlu_val_2,
+                                                            dlu_row_ptr,
+                                                            dlu_col_ind,
+                                                            spol,
+                                                            dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle, info, d_lu_nnz));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_zero_pivot(handle, info, d_solve_pivot_2),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        host_vector<rocsparse_int> hlu_row_ptr(M + 1);
+        host_vector<rocsparse_int> hlu_col_ind(lu_nnz);
+        host_vector<T>             hlu_val_1(lu_nnz);
+        host_vector<T>             hlu_val_2(lu_nnz);
+        host_vector<rocsparse_int> hlu_nnz(1);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hlu_row_ptr, dlu_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hlu_col_ind, dlu_col_ind, sizeof(rocsparse_int) * lu_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hlu_val_1, dlu_val_1, sizeof(T) * lu_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hlu_val_2, dlu_val_2, sizeof(T) * lu_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hlu_nnz, d_lu_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_solve_pivot_2, d_solve_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // CPU csriluk
+        host_vector<rocsparse_int> hlu_row_ptr_gold;
+        host_vector<rocsparse_int> hlu_col_ind_gold;
+        host_vector<T>             hlu_val_gold;
+
+        host_csriluk<T>(level,
+                        M,
+                        hcsr_row_ptr,
+                        hcsr_col_ind,
+                        hcsr_val,
+                        base,
+                        hlu_row_ptr_gold,
+                        hlu_col_ind_gold,
+                        hlu_val_gold,
+                        h_analysis_pivot_gold,
+                        h_solve_pivot_gold);
+
+        // Check sparsity pattern of the factors
+        unit_check_scalar<rocsparse_int>(hlu_col_ind_gold.size(), lu_nnz);
+        unit_check_scalar<rocsparse_int>(lu_nnz, hlu_nnz[0]);
+        hlu_row_ptr_gold.unit_check(hlu_row_ptr);
+        hlu_col_ind_gold.unit_check(hlu_col_ind);
+
+        // Check pivots
+        h_analysis_pivot_gold.unit_check(h_analysis_pivot_1);
+        h_solve_pivot_gold.unit_check(h_solve_pivot_1);
+        h_solve_pivot_gold.unit_check(h_solve_pivot_2);
+
+        // Check factors if no pivot has been found
+        if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+        {
+            hlu_val_gold.near_check(hlu_val_1);
+            hlu_val_gold.near_check(hlu_val_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       dlu_val_1,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        double gpu_analysis_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_analysis<T>(handle,
+                                                            level,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            rocsparse_analysis_policy_force,
+                                                            spol,
+                                                            dbuffer));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       dlu_val_1,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gbyte_count = csrilu0_gbyte_count<T>(M, lu_nnz);
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "level",
+                            level,
+                            "lu nnz",
+                            lu_nnz,
+                            "analysis policy",
+                            rocsparse_analysis2string(apol),
+                            "solve policy",
+                            rocsparse_solve2string(spol),
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            "analysis msec",
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_solve_time_used));
+    }
+
+    // Clear csriluk meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csriluk_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csriluk<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csriluk_extra(const Arguments& arg) {}
@@ -271,6 +271,37 @@ void testing_csritilu0_bad_arg(const Arguments& arg)
 
 #undef PARAMS_COMPUTE
     }
+
+    //
+    // rocsparse_csritilu0_apply.
+    //
+    {
+        rocsparse_int nsweeps = 1;
+        const T*      ilu0    = (const T*)0x4;
+        const T*      x       = (const T*)0x4;
+        T*            y       = (T*)0x4;
+
+#define PARAMS_APPLY handle, nsweeps, m, nnz, ptr, ind, ilu0, base, x, y
+        // 0     1        2  3    4    5    6     7     8  9
+
+        static constexpr int nargs_to_exclude   = 1;
+        static constexpr int args_to_exclude[1] = {1};
+
+        auto_testing_bad_arg(
+            rocsparse_csritilu0_apply<T>, nargs_to_exclude, args_to_exclude, PARAMS_APPLY);
+
+        nsweeps                 = -1;
+        rocsparse_status status = rocsparse_csritilu0_apply<T>(PARAMS_APPLY);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_status_invalid_value, status);
+        nsweeps = 1;
+
+        m      = 2;
+        status = rocsparse_csritilu0_apply<T>(PARAMS_APPLY);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_status_zero_pivot, status);
+        m = 1;
+
+#undef PARAMS_APPLY
+    }
 }
 
 template <typename T>
@@ -613,6 +644,151 @@ void testing_csritilu0(const Arguments& arg)
             {
                 ilu0.near_check(dA_csrilu0.val);
             }
+
+            //
+            // Compute solution with the stopping criteria checked on device, at every sweep
+            // and every 4 sweeps.
+            //
+            const rocsparse_int host_niter = p.maxiter;
+
+            rocsparse_int default_check_interval;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_get_itilu0_check_interval(handle, &default_check_interval));
+
+            static constexpr rocsparse_int check_intervals[] = {1, 4};
+            for(const rocsparse_int check_interval : check_intervals)
+            {
+                hipMemset((T*)ilu0, 0, sizeof(T) * dA.nnz);
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_itilu0_check_interval(handle, check_interval));
+
+                p.maxiter = s_maxiter;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0_compute<T>(
+                    handle,
+                    p.alg,
+                    p.options | rocsparse_itilu0_option_device_stopping_criteria,
+
+                    &p.maxiter,
+                    p.tol,
+
+                    dA.m,
+                    dA.nnz,
+                    dA.ptr,
+                    dA.ind,
+                    dA.val,
+                    ilu0,
+                    dA.base,
+
+                    buffer_size,
+                    buffer));
+
+                //
+                // Convergence can only be detected on a checked sweep.
+                //
+                const rocsparse_int niter_remainder
+                    = (p.maxiter < s_maxiter) ? (p.maxiter % check_interval) : 0;
+                unit_check_scalar<rocsparse_int>(0, niter_remainder);
+
+                //
+                // Checked at every sweep, the device stops at the same sweep as the host.
+                //
+                if(check_interval == 1)
+                {
+                    unit_check_scalar<rocsparse_int>(host_niter, p.maxiter);
+                }
+
+                if(sizeof(floating_data_t<T>) == sizeof(double))
+                {
+                    ilu0.near_check(dA_csrilu0.val, 1.0e-5);
+                }
+                else
+                {
+                    ilu0.near_check(dA_csrilu0.val);
+                }
+            }
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_itilu0_check_interval(handle, default_check_interval));
+
+            //
+            // Apply the factors with Jacobi sweeps, the iterates alternate between two
+            // vectors and zero sweeps only scale by the diagonal.
+            //
+            host_dense_vector<T> hilu0(ilu0);
+            host_dense_vector<T> hx(hA.m);
+            host_dense_vector<T> hy(hA.m);
+            rocsparse_init<T>(hx, hA.m, 1, 1);
+            device_dense_vector<T> dx(hx);
+            device_dense_vector<T> dy(hA.m);
+
+            static constexpr rocsparse_int nsweeps_list[] = {0, 1, 2, 3};
+            for(const rocsparse_int nsweeps : nsweeps_list)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0_apply<T>(
+                    handle, nsweeps, dA.m, dA.nnz, dA.ptr, dA.ind, ilu0, dA.base, dx, dy));
+
+                host_csritilu0_apply<T>(nsweeps, hA.m, hA.ptr, hA.ind, hilu0, hA.base, hx, hy);
+                hy.near_check(dy);
+            }
+
+            //
+            // With more sweeps, the sweeps approach the exact solve with L (unit diagonal)
+            // and U, which they reach once the number of sweeps is the number of levels of
+            // both triangular factors.
+            //
+            host_dense_vector<T>       hz_exact(hA.m);
+            host_dense_vector<T>       hy_exact(hA.m);
+            std::vector<rocsparse_int> depth(hA.m);
+            rocsparse_int              nlevels = 1;
+            for(rocsparse_int i = 0; i < hA.m; ++i)
+            {
+                T sum    = hx[i];
+                depth[i] = 1;
+                for(rocsparse_int k = hA.ptr[i] - hA.base; k < hA.ptr[i + 1] - hA.base; ++k)
+                {
+                    const rocsparse_int j = hA.ind[k] - hA.base;
+                    if(j < i)
+                    {
+                        sum -= hilu0[k] * hz_exact[j];
+                        depth[i] = std::max(depth[i], depth[j] + 1);
+                    }
+                }
+                hz_exact[i] = sum;
+                nlevels     = std::max(nlevels, depth[i]);
+            }
+
+            for(rocsparse_int i = hA.m - 1; i >= 0; --i)
+            {
+                T sum    = hz_exact[i];
+                T diag   = static_cast<T>(1);
+                depth[i] = 1;
+                for(rocsparse_int k = hA.ptr[i] - hA.base; k < hA.ptr[i + 1] - hA.base; ++k)
+                {
+                    const rocsparse_int j = hA.ind[k] - hA.base;
+                    if(j > i)
+                    {
+                        sum -= hilu0[k] * hy_exact[j];
+                        depth[i] = std::max(depth[i], depth[j] + 1);
+                    }
+                    else if(j == i)
+                    {
+                        diag = hilu0[k];
+                    }
+                }
+                hy_exact[i] = sum / diag;
+                nlevels     = std::max(nlevels, depth[i]);
+            }
+
+            // Each sweep is a product with the factors, large matrices with many levels
+            // are skipped
+            if(static_cast<int64_t>(nlevels) * hA.nnz <= 100000000)
+            {
+                host_csritilu0_apply<T>(nlevels, hA.m, hA.ptr, hA.ind, hilu0, hA.base, hx, hy);
+                hy.near_check(hy_exact);
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0_apply<T>(
+                    handle, nlevels, dA.m, dA.nnz, dA.ptr, dA.ind, ilu0, dA.base, dx, dy));
+                hy_exact.near_check(dy);
+            }
         }
     }
 
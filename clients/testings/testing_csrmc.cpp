@@ -0,0 +1,755 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csrmc.hpp"
+
+// Greedy distance-1 coloring of the symmetrized sparsity pattern
+static rocsparse_int host_csrmc_coloring(rocsparse_int                     M,
+                                         const std::vector<rocsparse_int>& csr_row_ptr,
+                                         const std::vector<rocsparse_int>& csr_col_ind,
+                                         rocsparse_index_base              base,
+                                         std::vector<rocsparse_int>&       coloring)
+{
+    std::vector<std::vector<rocsparse_int>> adj(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            rocsparse_int j = csr_col_ind[k] - base;
+            if(j != i)
+            {
+                adj[i].push_back(j);
+                adj[j].push_back(i);
+            }
+        }
+    }
+
+    rocsparse_int              ncolors = 0;
+    std::vector<rocsparse_int> used(M + 1, -1);
+
+    coloring.assign(M, -1);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(auto j : adj[i])
+        {
+            if(coloring[j] != -1)
+            {
+                used[coloring[j]] = i;
+            }
+        }
+
+        rocsparse_int c = 0;
+        while(used[c] == i)
+        {
+            ++c;
+        }
+
+        coloring[i] = c;
+        ncolors     = std::max(ncolors, c + 1);
+    }
+
+    return ncolors;
+}
+
+template <typename T>
+void testing_csrmc_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const T*                  csr_val     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int             ncolors     = safe_size;
+    const rocsparse_int*      coloring    = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    rocsparse_int*            perm        = (rocsparse_int*)0x4;
+    T*                        mc_val      = (T*)0x4;
+    rocsparse_int*            mc_row_ptr  = (rocsparse_int*)0x4;
+    rocsparse_int*            mc_col_ind  = (rocsparse_int*)0x4;
+    rocsparse_int             nsweeps     = 1;
+    int                       symmetric   = 0;
+    const T*                  b           = (const T*)0x4;
+    T*                        x           = (T*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS_REORDER                                                                 \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, info, \
+        perm, mc_val, mc_row_ptr, mc_col_ind, temp_buffer
+#define PARAMS_ILU0 handle, m, nnz, descr, mc_val, mc_row_ptr, mc_col_ind, info
+#define PARAMS_GS \
+    handle, m, nnz, descr, mc_val, mc_row_ptr, mc_col_ind, info, nsweeps, symmetric, b, x
+
+    auto_testing_bad_arg(rocsparse_csrmc_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrmc_reorder<T>, PARAMS_REORDER);
+    auto_testing_bad_arg(rocsparse_csrmcilu0<T>, PARAMS_ILU0);
+    {
+        static constexpr int nargs_to_exclude   = 1;
+        const int            args_to_exclude[1] = {9};
+        auto_testing_bad_arg(rocsparse_csrmcgs<T>, nargs_to_exclude, args_to_exclude, PARAMS_GS);
+    }
+
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_buffer_size(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_reorder<T>(PARAMS_REORDER),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0<T>(PARAMS_ILU0),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcgs<T>(PARAMS_GS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_storage_mode(descr, rocsparse_storage_mode_unsorted));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_buffer_size(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_reorder<T>(PARAMS_REORDER),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0<T>(PARAMS_ILU0), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcgs<T>(PARAMS_GS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_storage_mode(descr, rocsparse_storage_mode_sorted));
+
+    // Reordering has not been performed
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0<T>(PARAMS_ILU0), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcgs<T>(PARAMS_GS), rocsparse_status_invalid_pointer);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_REORDER
+#undef PARAMS_ILU0
+#undef PARAMS_GS
+
+    // Test rocsparse_csrmc_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmc_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_clear(nullptr, info), rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrmc(const Arguments& arg)
+{
+    rocsparse_int M       = arg.M;
+    rocsparse_int N       = arg.N;
+    rocsparse_int nsweeps = arg.K;
+
+    rocsparse_index_base base = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+        rocsparse_int       pivot;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dcoloring(safe_size);
+        device_vector<rocsparse_int> dperm(safe_size);
+        device_vector<rocsparse_int> dmc_row_ptr(safe_size);
+        device_vector<rocsparse_int> dmc_col_ind(safe_size);
+        device_vector<T>             dmc_val(safe_size);
+        device_vector<T>             db(safe_size);
+        device_vector<T>             dx(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcoloring || !dperm || !dmc_row_ptr
+           || !dmc_col_ind || !dmc_val || !db || !dx || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrmc_buffer_size(
+                handle, M, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_reorder<T>(handle,
+                                                           M,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           1,
+                                                           dcoloring,
+                                                           info,
+                                                           dperm,
+                                                           dmc_val,
+                                                           dmc_row_ptr,
+                                                           dmc_col_ind,
+                                                           dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrmcilu0<T>(
+                handle, M, safe_size, descr, dmc_val, dmc_row_ptr, dmc_col_ind, info),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrmcgs<T>(
+                handle, M, safe_size, descr, dmc_val, dmc_row_ptr, dmc_col_ind, info, 1, 1, db, dx),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_clear(handle, info), rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Color the matrix
+    host_vector<rocsparse_int> hcoloring;
+    rocsparse_int              ncolors
+        = host_csrmc_coloring(M, hcsr_row_ptr, hcsr_col_ind, base, hcoloring);
+
+    // Right-hand side and initial guess of the Gauss-Seidel smoother
+    host_vector<T> hb(M);
+    host_vector<T> hx(M);
+    rocsparse_init<T>(hb, 1, M, 1);
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcoloring(M);
+    device_vector<rocsparse_int> dperm(M);
+    device_vector<rocsparse_int> dmc_row_ptr(M + 1);
+    device_vector<rocsparse_int> dmc_col_ind(nnz);
+    device_vector<T>             dmc_val(nnz);
+    device_vector<T>             dmc_ilu0_1(nnz);
+    device_vector<T>             dmc_ilu0_2(nnz);
+    device_vector<T>             db(M);
+    device_vector<T>             dx(M);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoloring, hcoloring, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Reorder the matrix by color
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_reorder<T>(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     ncolors,
+                                                     dcoloring,
+                                                     info,
+                                                     dperm,
+                                                     dmc_val,
+                                                     dmc_row_ptr,
+                                                     dmc_col_ind,
+                                                     dbuffer));
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int>   h_pivot_1(1);
+        host_vector<rocsparse_int>   h_pivot_2(1);
+        device_vector<rocsparse_int> d_pivot_2(1);
+
+        // Pointer mode host
+        CHECK_HIP_ERROR(hipMemcpy(dmc_ilu0_1, dmc_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrmcilu0<T>(
+            handle, M, nnz, descr, dmc_ilu0_1, dmc_row_ptr, dmc_col_ind, info));
+        {
+            auto st = rocsparse_csrmc_zero_pivot(handle, info, h_pivot_1);
+            EXPECT_ROCSPARSE_STATUS(st,
+                                    (h_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                         : rocsparse_status_success);
+        }
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dmc_ilu0_2, dmc_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrmcilu0<T>(
+            handle, M, nnz, descr, dmc_ilu0_2, dmc_row_ptr, dmc_col_ind, info));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, d_pivot_2),
+                                (h_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                     : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        host_vector<rocsparse_int> hperm(M);
+        host_vector<rocsparse_int> hmc_row_ptr(M + 1);
+        host_vector<rocsparse_int> hmc_col_ind(nnz);
+        host_vector<T>             hmc_val(nnz);
+        host_vector<T>             hmc_ilu0_1(nnz);
+        host_vector<T>             hmc_ilu0_2(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hperm, dperm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hmc_row_ptr, dmc_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hmc_col_ind, dmc_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hmc_val, dmc_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hmc_ilu0_1, dmc_ilu0_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hmc_ilu0_2, dmc_ilu0_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(h_pivot_2, d_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // CPU reordering
+        host_vector<rocsparse_int> hperm_gold;
+        host_vector<rocsparse_int> hmc_row_ptr_gold;
+        host_vector<rocsparse_int> hmc_col_ind_gold;
+        host_vector<T>             hmc_val_gold;
+
+        host_csrmc_reorder<T>(M,
+                              hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              hcoloring,
+                              base,
+                              hperm_gold,
+                              hmc_row_ptr_gold,
+                              hmc_col_ind_gold,
+                              hmc_val_gold);
+
+        hperm_gold.unit_check(hperm);
+        hmc_row_ptr_gold.unit_check(hmc_row_ptr);
+        hmc_col_ind_gold.unit_check(hmc_col_ind);
+        hmc_val_gold.unit_check(hmc_val);
+
+        // CPU ILU0 of the color ordered matrix in natural order, which matches the
+        // color by color elimination since rows of the same color are not coupled
+        host_vector<rocsparse_int> h_struct_pivot_gold(1);
+        host_vector<rocsparse_int> h_numeric_pivot_gold(1);
+        host_vector<T>             hmc_ilu0_gold(hmc_val_gold);
+
+        host_csrilu0<T>(M,
+                        hmc_row_ptr_gold,
+                        hmc_col_ind_gold,
+                        hmc_ilu0_gold,
+                        base,
+                        h_struct_pivot_gold,
+                        h_numeric_pivot_gold,
+                        false,
+                        static_cast<floating_data_t<T>>(0),
+                        static_cast<T>(0));
+
+        // Zero pivots are found in a different order, only check their existence
+        if(h_struct_pivot_gold[0] == -1 && h_numeric_pivot_gold[0] == -1)
+        {
+            unit_check_scalar<rocsparse_int>(-1, h_pivot_1[0]);
+            unit_check_scalar<rocsparse_int>(-1, h_pivot_2[0]);
+
+            hmc_ilu0_gold.near_check(hmc_ilu0_1);
+            hmc_ilu0_gold.near_check(hmc_ilu0_2);
+        }
+        else
+        {
+            unit_check_scalar<rocsparse_int>(1, (h_pivot_1[0] != -1) ? 1 : 0);
+            h_pivot_1.unit_check(h_pivot_2);
+        }
+
+        // Gauss-Seidel and symmetric Gauss-Seidel sweeps
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        for(int symmetric = 0; symmetric < 2; ++symmetric)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrmcgs<T>(handle,
+                                                                M,
+                                                                nnz,
+                                                                descr,
+                                                                dmc_val,
+                                                                dmc_row_ptr,
+                                                                dmc_col_ind,
+                                                                info,
+                                                                nsweeps,
+                                                                symmetric,
+                                                                db,
+                                                                dx));
+
+            host_vector<T> hx_1(M);
+            CHECK_HIP_ERROR(hipMemcpy(hx_1, dx, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+            host_vector<T> hx_gold(hx);
+            host_csrmcgs<T>(M,
+                            hmc_row_ptr_gold,
+                            hmc_col_ind_gold,
+                            hmc_val_gold,
+                            base,
+                            nsweeps,
+                            symmetric != 0,
+                            hb,
+                            hx_gold);
+
+            hx_gold.near_check(hx_1);
+        }
+
+        //
+        // Reorder by the coloring of rocsparse_csrcolor, which can leave colors unused.
+        // With fraction_to_color < 1, rows can be left uncolored (-1), which the
+        // reordering rejects.
+        //
+        static constexpr double fractions_to_color[] = {1.0, 0.5};
+        for(const double fraction : fractions_to_color)
+        {
+            if(nnz == 0)
+            {
+                break;
+            }
+
+            rocsparse_local_mat_info info_color;
+
+            const floating_data_t<T>     fraction_to_color = fraction;
+            rocsparse_int                ncolors_color;
+            device_vector<rocsparse_int> dcoloring_color(M);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        &fraction_to_color,
+                                                        &ncolors_color,
+                                                        dcoloring_color,
+                                                        nullptr,
+                                                        info_color));
+
+            host_vector<rocsparse_int> hcoloring_color(M);
+            CHECK_HIP_ERROR(hipMemcpy(hcoloring_color,
+                                      dcoloring_color,
+                                      sizeof(rocsparse_int) * M,
+                                      hipMemcpyDeviceToHost));
+
+            // Uncolored rows, and whether the coloring is a valid distance-1 coloring
+            bool uncolored = false;
+            bool valid     = true;
+            for(rocsparse_int i = 0; i < M; ++i)
+            {
+                uncolored |= (hcoloring_color[i] < 0);
+                for(rocsparse_int k = hcsr_row_ptr[i] - base; k < hcsr_row_ptr[i + 1] - base; ++k)
+                {
+                    const rocsparse_int j = hcsr_col_ind[k] - base;
+                    valid &= (j == i || hcoloring_color[i] != hcoloring_color[j]);
+                }
+            }
+
+            device_vector<rocsparse_int> dperm_color(M);
+            device_vector<rocsparse_int> dmc_row_ptr_color(M + 1);
+            device_vector<rocsparse_int> dmc_col_ind_color(nnz);
+            device_vector<T>             dmc_val_color(nnz);
+
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_csrmc_reorder<T>(handle,
+                                           M,
+                                           nnz,
+                                           descr,
+                                           dcsr_val,
+                                           dcsr_row_ptr,
+                                           dcsr_col_ind,
+                                           ncolors_color,
+                                           dcoloring_color,
+                                           info_color,
+                                           dperm_color,
+                                           dmc_val_color,
+                                           dmc_row_ptr_color,
+                                           dmc_col_ind_color,
+                                           dbuffer),
+                uncolored ? rocsparse_status_invalid_value : rocsparse_status_success);
+
+            if(uncolored)
+            {
+                continue;
+            }
+
+            host_vector<rocsparse_int> hperm_color(M);
+            host_vector<rocsparse_int> hmc_row_ptr_color(M + 1);
+            host_vector<rocsparse_int> hmc_col_ind_color(nnz);
+            host_vector<T>             hmc_val_color(nnz);
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                hperm_color, dperm_color, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hmc_row_ptr_color,
+                                      dmc_row_ptr_color,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hmc_col_ind_color,
+                                      dmc_col_ind_color,
+                                      sizeof(rocsparse_int) * nnz,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hmc_val_color, dmc_val_color, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+            host_vector<rocsparse_int> hperm_color_gold;
+            host_vector<rocsparse_int> hmc_row_ptr_color_gold;
+            host_vector<rocsparse_int> hmc_col_ind_color_gold;
+            host_vector<T>             hmc_val_color_gold;
+
+            host_csrmc_reorder<T>(M,
+                                  hcsr_row_ptr,
+                                  hcsr_col_ind,
+                                  hcsr_val,
+                                  hcoloring_color,
+                                  base,
+                                  hperm_color_gold,
+                                  hmc_row_ptr_color_gold,
+                                  hmc_col_ind_color_gold,
+                                  hmc_val_color_gold);
+
+            hperm_color_gold.unit_check(hperm_color);
+            hmc_row_ptr_color_gold.unit_check(hmc_row_ptr_color);
+            hmc_col_ind_color_gold.unit_check(hmc_col_ind_color);
+            hmc_val_color_gold.unit_check(hmc_val_color);
+
+            // The color by color sweeps only match the row by row sweeps for a valid coloring
+            if(!valid)
+            {
+                continue;
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrmcgs<T>(handle,
+                                                                M,
+                                                                nnz,
+                                                                descr,
+                                                                dmc_val_color,
+                                                                dmc_row_ptr_color,
+                                                                dmc_col_ind_color,
+                                                                info_color,
+                                                                nsweeps,
+                                                                1,
+                                                                db,
+                                                                dx));
+
+            host_vector<T> hx_1(M);
+            CHECK_HIP_ERROR(hipMemcpy(hx_1, dx, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+            host_vector<T> hx_gold(hx);
+            host_csrmcgs<T>(M,
+                            hmc_row_ptr_color_gold,
+                            hmc_col_ind_color_gold,
+                            hmc_val_color_gold,
+                            base,
+                            nsweeps,
+                            true,
+                            hb,
+                            hx_gold);
+
+            hx_gold.near_check(hx_1);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dmc_ilu0_1, dmc_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0<T>(
+                handle, M, nnz, descr, dmc_ilu0_1, dmc_row_ptr, dmc_col_ind, info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcgs<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dmc_val,
+                                                       dmc_row_ptr,
+                                                       dmc_col_ind,
+                                                       info,
+                                                       nsweeps,
+                                                       1,
+                                                       db,
+                                                       dx));
+        }
+
+        double gpu_reorder_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_reorder<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         ncolors,
+                                                         dcoloring,
+                                                         info,
+                                                         dperm,
+                                                         dmc_val,
+                                                         dmc_row_ptr,
+                                                         dmc_col_ind,
+                                                         dbuffer));
+
+        gpu_reorder_time_used = get_time_us() - gpu_reorder_time_used;
+
+        double gpu_ilu0_time_used = 0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dmc_ilu0_1, dmc_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+
+            double gpu_time_used = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0<T>(
+                handle, M, nnz, descr, dmc_ilu0_1, dmc_row_ptr, dmc_col_ind, info));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_ilu0_time_used += get_time_us() - gpu_time_used;
+        }
+
+        gpu_ilu0_time_used /= number_hot_calls;
+
+        double gpu_gs_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcgs<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dmc_val,
+                                                       dmc_row_ptr,
+                                                       dmc_col_ind,
+                                                       info,
+                                                       nsweeps,
+                                                       1,
+                                                       db,
+                                                       dx));
+        }
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        gpu_gs_time_used = (get_time_us() - gpu_gs_time_used) / number_hot_calls;
+
+        double gbyte_count = csrilu0_gbyte_count<T>(M, nnz);
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_ilu0_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "colors",
+                            ncolors,
+                            "sweeps",
+                            nsweeps,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            "reorder msec",
+                            get_gpu_time_msec(gpu_reorder_time_used),
+                            "symgs msec",
+                            get_gpu_time_msec(gpu_gs_time_used),
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_ilu0_time_used));
+    }
+
+    // Clear csrmc meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                            \
+    template void testing_csrmc_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmc<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csrmc_extra(const Arguments& arg) {}
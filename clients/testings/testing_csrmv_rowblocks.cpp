@@ -0,0 +1,220 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_csrmv_rowblocks.hpp"
+#include "tuning.h"
+
+// Row block configuration of csrmvn_adaptive_kernel
+static constexpr int BLOCK_SIZE       = rocsparse_csrmv_adaptive_config::block_size;
+static constexpr int BLOCK_MULTIPLIER = rocsparse_csrmv_adaptive_config::block_multiplier;
+static constexpr int ROWS_FOR_VECTOR  = rocsparse_csrmv_adaptive_config::rows_for_vector;
+static constexpr int WG_SIZE          = rocsparse_csrmv_adaptive_config::wg_size;
+
+// Default row length thresholds of the analysis
+static constexpr int LONG_ROW  = rocsparse_tuning_params{}.csrmv_long_row;
+static constexpr int SHORT_ROW = rocsparse_tuning_params{}.csrmv_short_row;
+
+template <typename T>
+void testing_csrmv_rowblocks_bad_arg(const Arguments& arg)
+{
+    // Empty matrix
+    rocsparse_int              m = 0;
+    std::vector<rocsparse_int> csr_row_ptr(1, 0);
+
+    std::vector<rocsparse_int> row_blocks;
+    std::vector<rocsparse_int> wg_ids;
+    ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+        row_blocks, wg_ids, csr_row_ptr.data(), m, LONG_ROW, SHORT_ROW);
+
+    unit_check_scalar<size_t>(row_blocks.size(), 1);
+    unit_check_scalar<size_t>(wg_ids.size(), 1);
+    unit_check_scalar<rocsparse_int>(row_blocks[0], 0);
+}
+
+template <typename T>
+void testing_csrmv_rowblocks(const Arguments& arg)
+{
+    rocsparse_int        M           = arg.M;
+    rocsparse_int        N           = arg.N;
+    rocsparse_index_base base        = arg.baseA;
+    unsigned int         num_threads = arg.algo;
+
+    // Sample matrix
+    static constexpr bool       to_int    = false;
+    static constexpr bool       full_rank = false;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+
+    rocsparse_int nnz;
+    matrix_factory.init_csr(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+
+    if(M <= 0)
+    {
+        return;
+    }
+
+    // The row block analysis only depends on the row lengths
+    for(rocsparse_int i = 0; i <= M; ++i)
+    {
+        csr_row_ptr[i] -= base;
+    }
+
+    if(arg.unit_check)
+    {
+        // Serial row blocks
+        size_t size = 0;
+        ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            (rocsparse_int*)nullptr,
+            (rocsparse_int*)nullptr,
+            size,
+            csr_row_ptr.data(),
+            M,
+            LONG_ROW,
+            SHORT_ROW,
+            false);
+
+        std::vector<rocsparse_int> row_blocks_gold(size, 0);
+        std::vector<rocsparse_int> wg_ids_gold(size, 0);
+        ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            row_blocks_gold.data(),
+            wg_ids_gold.data(),
+            size,
+            csr_row_ptr.data(),
+            M,
+            LONG_ROW,
+            SHORT_ROW,
+            true);
+
+        row_blocks_gold.resize(size);
+        wg_ids_gold.resize(size);
+
+        unit_check_scalar<bool>(
+            ValidateRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                row_blocks_gold.data(), wg_ids_gold.data(), size, csr_row_ptr.data(), M),
+            true);
+
+        // Single threaded, must be identical to the serial row blocks
+        std::vector<rocsparse_int> row_blocks;
+        std::vector<rocsparse_int> wg_ids;
+        ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            row_blocks, wg_ids, csr_row_ptr.data(), M, LONG_ROW, SHORT_ROW, 1);
+
+        unit_check_scalar<size_t>(row_blocks.size(), size);
+        unit_check_segments<rocsparse_int>(size, row_blocks_gold.data(), row_blocks.data());
+        unit_check_segments<rocsparse_int>(size, wg_ids_gold.data(), wg_ids.data());
+
+        // Multithreaded, chunk boundaries introduce additional row blocks
+        ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            row_blocks, wg_ids, csr_row_ptr.data(), M, LONG_ROW, SHORT_ROW, num_threads);
+
+        unit_check_scalar<bool>(
+            ValidateRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                row_blocks.data(), wg_ids.data(), row_blocks.size(), csr_row_ptr.data(), M),
+            true);
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        std::vector<rocsparse_int> row_blocks;
+        std::vector<rocsparse_int> wg_ids;
+
+        // Serial analysis, including the size query
+        double serial_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            size_t size = 0;
+            ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                (rocsparse_int*)nullptr,
+                (rocsparse_int*)nullptr,
+                size,
+                csr_row_ptr.data(),
+                M,
+                LONG_ROW,
+                SHORT_ROW,
+                false);
+
+            row_blocks.assign(size, 0);
+            wg_ids.assign(size, 0);
+
+            ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                row_blocks.data(),
+                wg_ids.data(),
+                size,
+                csr_row_ptr.data(),
+                M,
+                LONG_ROW,
+                SHORT_ROW,
+                true);
+        }
+
+        serial_time_used = (get_time_us() - serial_time_used) / number_hot_calls;
+
+        size_t serial_size = row_blocks.size();
+
+        // Multithreaded analysis
+        double parallel_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                row_blocks, wg_ids, csr_row_ptr.data(), M, LONG_ROW, SHORT_ROW, num_threads);
+        }
+
+        parallel_time_used = (get_time_us() - parallel_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "threads",
+                            (num_threads == 0 ? ComputeRowBlocksNumThreads(M) : num_threads),
+                            "blocks serial",
+                            serial_size,
+                            "blocks parallel",
+                            row_blocks.size(),
+                            "serial msec",
+                            get_gpu_time_msec(serial_time_used),
+                            "speedup",
+                            serial_time_used / parallel_time_used,
+                            s_timing_info_time,
+                            get_gpu_time_msec(parallel_time_used));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                      \
+    template void testing_csrmv_rowblocks_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmv_rowblocks<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csrmv_rowblocks_extra(const Arguments& arg) {}
@@ -0,0 +1,184 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_import.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+
+#ifdef WIN32
+#ifdef __cpp_lib_filesystem
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static std::string testing_import_matrixmarket_tmpname()
+{
+#ifdef WIN32
+    return (fs::temp_directory_path() / "rocsparse-import-matrixmarket.mtx").string();
+#else
+    char tmp[] = "/tmp/rocsparse-XXXXXX";
+    int  fd    = mkostemp(tmp, O_CLOEXEC);
+    if(fd == -1)
+    {
+        perror("Cannot open temporary file");
+        exit(EXIT_FAILURE);
+    }
+    close(fd);
+    return tmp;
+#endif
+}
+
+template <typename T>
+void testing_import_matrixmarket_bad_arg(const Arguments& arg)
+{
+    host_vector<rocsparse_int> row_ind;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              M;
+    rocsparse_int              N;
+    int64_t                    nnz;
+
+    // Missing file.
+    rocsparse_importer_matrixmarket importer("rocsparse_import_matrixmarket_missing_file.mtx");
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_import_sparse_coo(
+            importer, row_ind, col_ind, val, M, N, nnz, rocsparse_index_base_zero),
+        rocsparse_status_internal_error);
+}
+
+template <typename T>
+void testing_import_matrixmarket(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    // Sample matrix
+    host_vector<rocsparse_int> hcoo_row_ind;
+    host_vector<rocsparse_int> hcoo_col_ind;
+    host_vector<T>             hcoo_val;
+
+    int64_t coo_nnz;
+    matrix_factory.init_coo(hcoo_row_ind, hcoo_col_ind, hcoo_val, M, N, coo_nnz, base);
+    rocsparse_int nnz = rocsparse_convert_to_int(coo_nnz);
+
+    // Export the matrix to a Matrix Market file
+    const std::string filename = testing_import_matrixmarket_tmpname();
+    {
+        rocsparse_exporter_matrixmarket exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write_sparse_coo(
+            M, N, nnz, hcoo_row_ind.data(), hcoo_col_ind.data(), hcoo_val.data(), base));
+    }
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hrow_ind;
+        host_vector<rocsparse_int> hcol_ind;
+        host_vector<T>             hval;
+        rocsparse_int              import_M;
+        rocsparse_int              import_N;
+        int64_t                    import_nnz;
+
+        rocsparse_importer_matrixmarket importer(filename);
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_coo(
+            importer, hrow_ind, hcol_ind, hval, import_M, import_N, import_nnz, base));
+
+        unit_check_scalar(M, import_M);
+        unit_check_scalar(N, import_N);
+        unit_check_scalar(coo_nnz, import_nnz);
+        hcoo_row_ind.unit_check(hrow_ind);
+        hcoo_col_ind.unit_check(hcol_ind);
+        hcoo_val.near_check(hval);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        host_vector<rocsparse_int> hrow_ind;
+        host_vector<rocsparse_int> hcol_ind;
+        host_vector<T>             hval;
+        rocsparse_int              import_M;
+        rocsparse_int              import_N;
+        int64_t                    import_nnz;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_importer_matrixmarket importer(filename);
+            CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_coo(
+                importer, hrow_ind, hcol_ind, hval, import_M, import_N, import_nnz, base));
+        }
+
+        double cpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_importer_matrixmarket importer(filename);
+            CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_coo(
+                importer, hrow_ind, hcol_ind, hval, import_M, import_N, import_nnz, base));
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / number_hot_calls;
+
+        // The bandwidth is measured on the size of the file
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        double        gbyte_count = static_cast<double>(file.tellg()) / 1e9;
+        double        cpu_gbyte   = get_gpu_gbyte(cpu_time_used, gbyte_count);
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            s_timing_info_bandwidth,
+                            cpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(cpu_time_used));
+    }
+
+    remove(filename.c_str());
+}
+
+#define INSTANTIATE(TYPE)                                                          \
+    template void testing_import_matrixmarket_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_import_matrixmarket<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_import_matrixmarket_extra(const Arguments& arg) {}
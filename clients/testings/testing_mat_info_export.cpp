@@ -0,0 +1,283 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_mat_info_export_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+    rocsparse_local_mat_info  local_info;
+
+    rocsparse_handle    handle      = local_handle;
+    rocsparse_mat_descr descr       = local_descr;
+    rocsparse_mat_info  info        = local_info;
+    rocsparse_int       m           = safe_size;
+    rocsparse_int       n           = safe_size;
+    rocsparse_int       nnz         = safe_size;
+    rocsparse_int*      csr_row_ptr = (rocsparse_int*)0x4;
+    rocsparse_int*      csr_col_ind = (rocsparse_int*)0x4;
+    size_t              buffer_size = safe_size;
+    void*               buffer      = (void*)0x4;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_export_mat_info_buffer_size(nullptr, info, &buffer_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_export_mat_info_buffer_size(handle, nullptr, &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_export_mat_info_buffer_size(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+#define CHECK_BAD_ARG(FUNC)                                                                     \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(nullptr, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer),   \
+        rocsparse_status_invalid_handle);                                                       \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, -1, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer),   \
+        rocsparse_status_invalid_size);                                                         \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, -1, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer),   \
+        rocsparse_status_invalid_size);                                                         \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, -1, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer),     \
+        rocsparse_status_invalid_size);                                                         \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, nnz, nullptr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer),  \
+        rocsparse_status_invalid_pointer);                                                      \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, nnz, descr, nullptr, csr_col_ind, info, buffer_size, buffer),        \
+        rocsparse_status_invalid_pointer);                                                      \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, nnz, descr, csr_row_ptr, nullptr, info, buffer_size, buffer),        \
+        rocsparse_status_invalid_pointer);                                                      \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, nullptr, buffer_size, buffer), \
+        rocsparse_status_invalid_pointer);                                                      \
+    EXPECT_ROCSPARSE_STATUS(                                                                    \
+        FUNC(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, nullptr),   \
+        rocsparse_status_invalid_pointer)
+
+    CHECK_BAD_ARG(rocsparse_csr_export_mat_info);
+    CHECK_BAD_ARG(rocsparse_csr_import_mat_info);
+
+#undef CHECK_BAD_ARG
+}
+
+template <typename T>
+void testing_mat_info_export(const Arguments& arg)
+{
+    auto                      tol   = get_near_check_tol<T>(arg);
+    rocsparse_int             M     = arg.M;
+    rocsparse_int             N     = arg.M;
+    rocsparse_operation       trans = arg.transA;
+    rocsparse_analysis_policy apol  = arg.apol;
+    rocsparse_solve_policy    spol  = arg.spol;
+    rocsparse_index_base      base  = arg.baseA;
+
+    host_scalar<T> h_alpha(static_cast<T>(1));
+    host_scalar<T> h_beta(static_cast<T>(0));
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix infos, the analysis is run on the first one and imported into the second
+    rocsparse_local_mat_info info_analysed;
+    rocsparse_local_mat_info info_imported;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // The imported analysis data is bound to the arrays of a second copy of the matrix
+    device_csr_matrix<T> dA(hA);
+    device_csr_matrix<T> dB(hA);
+
+    host_dense_matrix<T> hx(M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy_analysed(M, 1);
+    device_dense_matrix<T> dy_imported(M, 1);
+
+#define PARAMS_EXPORT(A_, info_, size_, buffer_) \
+    handle, A_.m, A_.n, A_.nnz, descr, A_.ptr, A_.ind, info_, size_, buffer_
+#define PARAMS_CSRMV(A_, info_, y_)                                                                \
+    handle, trans, A_.m, A_.n, A_.nnz, h_alpha, descr, A_.val, A_.ptr, A_.ind, info_, dx, h_beta, \
+        y_
+#define PARAMS_CSRSV(A_, info_, y_)                                                            \
+    handle, trans, A_.m, A_.nnz, h_alpha, descr, A_.val, A_.ptr, A_.ind, info_, dx, y_, spol, \
+        dbuffer
+
+    void* dbuffer;
+    {
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                             trans,
+                                                             dA.m,
+                                                             dA.nnz,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info_analysed,
+                                                             &buffer_size));
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+    }
+
+    // Analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(
+        handle, trans, dA.m, dA.n, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_analysed));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                      trans,
+                                                      dA.m,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      info_analysed,
+                                                      apol,
+                                                      spol,
+                                                      dbuffer));
+
+    // Export
+    size_t export_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_export_mat_info_buffer_size(handle, info_analysed, &export_size));
+
+    std::vector<char> export_buffer(export_size);
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_export_mat_info(
+        PARAMS_EXPORT(dA, info_analysed, export_size, export_buffer.data())));
+
+    if(arg.unit_check)
+    {
+        // A buffer too small is rejected
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr_export_mat_info(PARAMS_EXPORT(
+                                    dA, info_analysed, export_size - 1, export_buffer.data())),
+                                rocsparse_status_invalid_size);
+
+        // Import
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_import_mat_info(
+            PARAMS_EXPORT(dB, info_imported, export_size, export_buffer.data())));
+
+        // The imported analysis data gives the same results
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(dA, info_analysed, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(dB, info_imported, dy_imported)));
+
+        host_dense_matrix<T> hy_analysed(dy_analysed);
+        hy_analysed.near_check(dy_imported, tol);
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrsv_solve<T>(PARAMS_CSRSV(dA, info_analysed, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrsv_solve<T>(PARAMS_CSRSV(dB, info_imported, dy_imported)));
+
+        hy_analysed.transfer_from(dy_analysed);
+        hy_analysed.near_check(dy_imported, tol);
+
+        if(M > 1)
+        {
+            // A corrupted buffer is rejected
+            std::vector<char> corrupted_buffer(export_buffer);
+            corrupted_buffer[export_size - 1] ^= 0x1;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csr_import_mat_info(PARAMS_EXPORT(
+                                        dB, info_imported, export_size, corrupted_buffer.data())),
+                                    rocsparse_status_invalid_value);
+
+            // Another sparsity pattern is rejected
+            host_csr_matrix<T> hC(hA);
+            hC.ind[0] = (hC.ind[0] - base + 1) % N + base;
+
+            device_csr_matrix<T> dC(hC);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csr_import_mat_info(PARAMS_EXPORT(
+                                        dC, info_imported, export_size, export_buffer.data())),
+                                    rocsparse_status_invalid_value);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_import_mat_info(
+                PARAMS_EXPORT(dB, info_imported, export_size, export_buffer.data())));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_import_mat_info(
+                PARAMS_EXPORT(dB, info_imported, export_size, export_buffer.data())));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "buffer size",
+                            export_size,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS_CSRSV
+#undef PARAMS_CSRMV
+#undef PARAMS_EXPORT
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                      \
+    template void testing_mat_info_export_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_mat_info_export<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_mat_info_export_extra(const Arguments& arg) {}
@@ -0,0 +1,227 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_memory_pool_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+    rocsparse_handle       handle = local_handle;
+
+    size_t bytes_in_use;
+    size_t bytes_cached;
+    size_t high_water_mark;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_memory_pool_limit(nullptr, 0),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_trim_memory_pool(nullptr), rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_memory_pool_info(nullptr, &bytes_in_use, &bytes_cached, &high_water_mark),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_memory_pool_info(handle, nullptr, &bytes_cached, &high_water_mark),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_memory_pool_info(handle, &bytes_in_use, nullptr, &high_water_mark),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_memory_pool_info(handle, &bytes_in_use, &bytes_cached, nullptr),
+        rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_memory_pool(const Arguments& arg)
+{
+    rocsparse_int             M     = arg.M;
+    rocsparse_int             N     = arg.M;
+    rocsparse_operation       trans = arg.transA;
+    rocsparse_analysis_policy apol  = arg.apol;
+    rocsparse_solve_policy    spol  = arg.spol;
+    rocsparse_index_base      base  = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // The pool is shared by the handles using the same stream, use our own stream
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, nullptr));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        return;
+    }
+
+    device_csr_matrix<T> dA(hA);
+
+#define PARAMS_BUFFER_SIZE(A_) \
+    handle, trans, A_.m, A_.nnz, descr, A_.val, A_.ptr, A_.ind, info, &buffer_size
+#define PARAMS_ANALYSIS(A_) \
+    handle, trans, A_.m, A_.nnz, descr, A_.val, A_.ptr, A_.ind, info, apol, spol, dbuffer
+
+    void* dbuffer;
+    {
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(PARAMS_BUFFER_SIZE(dA)));
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+    }
+
+    if(arg.unit_check)
+    {
+        // Disabled memory pool reports empty statistics
+        const char* env           = getenv("ROCSPARSE_NO_MEMORY_POOL");
+        const bool  pool_disabled = (env != nullptr && atoi(env) == 1);
+
+        size_t in_use[4], cached[4], hwm[4];
+
+        // The analysis data is allocated from the pool
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_memory_pool_info(handle, &in_use[0], &cached[0], &hwm[0]));
+
+        // Clearing the analysis data returns it to the pool
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_memory_pool_info(handle, &in_use[1], &cached[1], &hwm[1]));
+
+        // A second analysis reuses the cached blocks
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_memory_pool_info(handle, &in_use[2], &cached[2], &hwm[2]));
+
+        // Without cache, blocks are released when they are freed
+        CHECK_ROCSPARSE_ERROR(rocsparse_trim_memory_pool(handle));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_limit(handle, 0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_memory_pool_info(handle, &in_use[3], &cached[3], &hwm[3]));
+
+        if(pool_disabled)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                unit_check_scalar<size_t>(0, in_use[i]);
+                unit_check_scalar<size_t>(0, cached[i]);
+                unit_check_scalar<size_t>(0, hwm[i]);
+            }
+        }
+        else if(M > 0)
+        {
+            unit_check_scalar<int32_t>(1, in_use[0] > 0);
+            unit_check_scalar<size_t>(hwm[0], in_use[0] + cached[0]);
+
+            unit_check_scalar<int32_t>(1, in_use[1] < in_use[0]);
+            unit_check_scalar<size_t>(in_use[0], in_use[1] + cached[1]);
+            unit_check_scalar<size_t>(hwm[0], hwm[1]);
+
+            unit_check_scalar<size_t>(in_use[0], in_use[2]);
+            unit_check_scalar<size_t>(cached[0], cached[2]);
+            unit_check_scalar<size_t>(hwm[0], hwm[2]);
+
+            unit_check_scalar<size_t>(in_use[1], in_use[3]);
+            unit_check_scalar<size_t>(0, cached[3]);
+            unit_check_scalar<size_t>(in_use[0], hwm[3]);
+        }
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_memory_pool_limit(handle, std::numeric_limits<size_t>::max()));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run, analysis data is taken from the pool
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        size_t bytes_in_use, bytes_cached, high_water_mark;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_pool_info(
+            handle, &bytes_in_use, &bytes_cached, &high_water_mark));
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "high water mark",
+                            high_water_mark,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS_ANALYSIS
+#undef PARAMS_BUFFER_SIZE
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+#define INSTANTIATE(TYPE)                                                  \
+    template void testing_memory_pool_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_memory_pool<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_memory_pool_extra(const Arguments& arg) {}
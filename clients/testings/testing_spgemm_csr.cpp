@@ -249,10 +249,79 @@ void testing_spgemm_csr_bad_arg(const Arguments& arg)
                                              nullptr,
                                              nullptr),
                             rocsparse_status_invalid_pointer);
+
+    // Single precision matrices with double precision computation are only supported by the
+    // auto and compute stages, the numeric stage is not implemented for mixed types
+    if(ttype == rocsparse_datatype_f64_r)
+    {
+        static constexpr rocsparse_datatype atype = rocsparse_datatype_f32_r;
+
+        rocsparse_local_spmat local_mat_A32(m,
+                                            k,
+                                            nnz_A,
+                                            csr_row_ptr_A,
+                                            csr_col_ind_A,
+                                            csr_val_A,
+                                            itype,
+                                            jtype,
+                                            base,
+                                            atype,
+                                            rocsparse_format_csr);
+        rocsparse_local_spmat local_mat_B32(k,
+                                            n,
+                                            nnz_B,
+                                            csr_row_ptr_B,
+                                            csr_col_ind_B,
+                                            csr_val_B,
+                                            itype,
+                                            jtype,
+                                            base,
+                                            atype,
+                                            rocsparse_format_csr);
+        rocsparse_local_spmat local_mat_C32(m,
+                                            n,
+                                            nnz_C,
+                                            csr_row_ptr_C,
+                                            csr_col_ind_C,
+                                            csr_val_C,
+                                            itype,
+                                            jtype,
+                                            base,
+                                            atype,
+                                            rocsparse_format_csr);
+        rocsparse_local_spmat local_mat_D32(m,
+                                            n,
+                                            nnz_D,
+                                            csr_row_ptr_D,
+                                            csr_col_ind_D,
+                                            csr_val_D,
+                                            itype,
+                                            jtype,
+                                            base,
+                                            atype,
+                                            rocsparse_format_csr);
+
+        size_t buffer_size = safe_size;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spgemm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 alpha,
+                                                 local_mat_A32,
+                                                 local_mat_B32,
+                                                 beta,
+                                                 local_mat_D32,
+                                                 local_mat_C32,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spgemm_stage_numeric,
+                                                 &buffer_size,
+                                                 (void*)0x4),
+                                rocsparse_status_not_implemented);
+    }
 }
 
-template <typename I, typename J, typename T>
-void testing_spgemm_csr(const Arguments& arg)
+template <typename I, typename J, typename S, typename T>
+static void testing_spgemm_csr_template(const Arguments& arg)
 {
     J                    M       = arg.M;
     J                    N       = arg.N;
@@ -280,8 +349,8 @@ void testing_spgemm_csr(const Arguments& arg)
 
     // Create rocsparse handle
     rocsparse_local_handle handle;
-    using host_csr   = host_csr_matrix<T, I, J>;
-    using device_csr = device_csr_matrix<T, I, J>;
+    using host_csr   = host_csr_matrix<S, I, J>;
+    using device_csr = device_csr_matrix<S, I, J>;
 
 #define PARAMS(alpha_, A_, B_, D_, beta_, C_, buffer_)                                        \
     handle, trans_A, trans_B, alpha_, A_, B_, beta_, D_, C_, ttype, alg, stage, &buffer_size, \
@@ -369,7 +438,7 @@ void testing_spgemm_csr(const Arguments& arg)
     static constexpr bool full_rank = false;
 
     {
-        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        rocsparse_matrix_factory<S, I, J> matrix_factory(arg, to_int, full_rank);
         matrix_factory.init_csr(hA, M, K, arg.baseA);
     }
     //
@@ -377,7 +446,7 @@ void testing_spgemm_csr(const Arguments& arg)
     //
     {
         static constexpr bool             noseed = true;
-        rocsparse_matrix_factory<T, I, J> matrix_factory(
+        rocsparse_matrix_factory<S, I, J> matrix_factory(
             arg, rocsparse_matrix_random, to_int, full_rank, noseed);
         matrix_factory.init_csr(hB, K, N, arg.baseB);
         matrix_factory.init_csr(hD, M, N, arg.baseD);
@@ -660,8 +729,19 @@ void testing_spgemm_csr(const Arguments& arg)
         double gflop_count = csrgemm_gflop_count<T, I, J>(
             M, h_alpha_ptr, hA.ptr, hA.ind, hB.ptr, h_beta_ptr, hD.ptr, hA.base);
 
-        double gbyte_count = csrgemm_gbyte_count<T, I, J>(
-            M, N, K, hA.nnz, hB.nnz, C_nnz, hD.nnz, h_alpha_ptr, h_beta_ptr);
+        // Matrix values are stored in S, convert the scalars accordingly
+        const S h_alpha_S = static_cast<S>(h_alpha);
+        const S h_beta_S  = static_cast<S>(h_beta);
+
+        double gbyte_count = csrgemm_gbyte_count<S, I, J>(M,
+                                                          N,
+                                                          K,
+                                                          hA.nnz,
+                                                          hB.nnz,
+                                                          C_nnz,
+                                                          hD.nnz,
+                                                          h_alpha_ptr ? &h_alpha_S : nullptr,
+                                                          h_beta_ptr ? &h_beta_S : nullptr);
 
         double gpu_gbyte  = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
         double gpu_gflops = get_gpu_gflops(gpu_solve_time_used, gflop_count);
@@ -699,6 +779,22 @@ void testing_spgemm_csr(const Arguments& arg)
     }
 }
 
+template <typename I, typename J, typename T>
+void testing_spgemm_csr(const Arguments& arg)
+{
+    // Single precision matrices with double precision computation
+    using float_t = std::conditional_t<std::is_same<T, double>{}, float, T>;
+
+    if(std::is_same<T, double>() && arg.a_type == rocsparse_datatype_f32_r)
+    {
+        testing_spgemm_csr_template<I, J, float_t, T>(arg);
+    }
+    else
+    {
+        testing_spgemm_csr_template<I, J, T, T>(arg);
+    }
+}
+
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
     template void testing_spgemm_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
     template void testing_spgemm_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
@@ -372,6 +372,22 @@ void testing_spmat_descr_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_csc_set_strided_batch(csc, -1, -1, -1),
                             rocsparse_status_invalid_value);
 
+    // rocsparse_ell_set_strided_batch
+    EXPECT_ROCSPARSE_STATUS(rocsparse_ell_set_strided_batch(nullptr, batch_count, batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_ell_set_strided_batch(ell, -1, batch_stride),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_ell_set_strided_batch(ell, batch_count, -1),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_ell_set_strided_batch(ell, -1, -1),
+                            rocsparse_status_invalid_value);
+
+    // rocsparse_spmat_set_values_batch_stride
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmat_set_values_batch_stride(nullptr, batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmat_set_values_batch_stride(csr, -1),
+                            rocsparse_status_invalid_value);
+
     // Destroy valid descriptors
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(coo), rocsparse_status_success);
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(csr), rocsparse_status_success);
@@ -0,0 +1,413 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_spmm_bsr_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle      = local_handle;
+    rocsparse_int        mb          = safe_size;
+    rocsparse_int        n           = safe_size;
+    rocsparse_int        kb          = safe_size;
+    rocsparse_int        nnzb        = safe_size;
+    rocsparse_int        block_dim   = 2;
+    const T*             alpha       = (const T*)0x4;
+    const T*             beta        = (const T*)0x4;
+    void*                bsr_row_ptr = (void*)0x4;
+    void*                bsr_col_ind = (void*)0x4;
+    void*                bsr_val     = (void*)0x4;
+    void*                B           = (void*)0x4;
+    void*                C           = (void*)0x4;
+    rocsparse_operation  trans_A     = rocsparse_operation_none;
+    rocsparse_operation  trans_B     = rocsparse_operation_none;
+    rocsparse_direction  dir         = rocsparse_direction_row;
+    rocsparse_index_base base        = rocsparse_index_base_zero;
+    rocsparse_order      order       = rocsparse_order_column;
+    rocsparse_spmm_alg   alg         = rocsparse_spmm_alg_bsr;
+    rocsparse_spmm_stage stage       = rocsparse_spmm_stage_auto;
+
+    rocsparse_indextype itype = get_indextype<rocsparse_int>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    rocsparse_int m = mb * block_dim;
+    rocsparse_int k = kb * block_dim;
+
+    // SpMM structures
+    rocsparse_local_spmat local_mat_A(mb,
+                                      kb,
+                                      nnzb,
+                                      dir,
+                                      block_dim,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      bsr_val,
+                                      itype,
+                                      itype,
+                                      base,
+                                      ttype,
+                                      rocsparse_format_bsr);
+    rocsparse_local_dnmat local_mat_B(k, n, k, B, ttype, order);
+    rocsparse_local_dnmat local_mat_C(m, n, m, C, ttype, order);
+
+    rocsparse_spmat_descr mat_A = local_mat_A;
+    rocsparse_dnmat_descr mat_B = local_mat_B;
+    rocsparse_dnmat_descr mat_C = local_mat_C;
+
+    int       nargs_to_exclude   = 2;
+    const int args_to_exclude[2] = {11, 12};
+
+#define PARAMS                                                                                  \
+    handle, trans_A, trans_B, alpha, mat_A, mat_B, beta, mat_C, ttype, alg, stage, buffer_size, \
+        temp_buffer
+    {
+        size_t* buffer_size = (size_t*)0x4;
+        void*   temp_buffer = (void*)0x4;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    {
+        size_t* buffer_size = nullptr;
+        void*   temp_buffer = nullptr;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+#undef PARAMS
+
+    // C in row order is not supported
+    rocsparse_local_dnmat local_mat_B_row(k, n, n, B, ttype, rocsparse_order_row);
+    rocsparse_local_dnmat local_mat_C_row(m, n, n, C, ttype, rocsparse_order_row);
+
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           alpha,
+                                           mat_A,
+                                           local_mat_B_row,
+                                           beta,
+                                           local_mat_C_row,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmm_stage_buffer_size,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_not_implemented);
+
+    // BSR does not support the CSR algorithms
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           alpha,
+                                           mat_A,
+                                           mat_B,
+                                           beta,
+                                           mat_C,
+                                           ttype,
+                                           rocsparse_spmm_alg_csr,
+                                           rocsparse_spmm_stage_buffer_size,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_spmm_bsr(const Arguments& arg)
+{
+    rocsparse_int        M         = arg.M;
+    rocsparse_int        N         = arg.N;
+    rocsparse_int        K         = arg.K;
+    rocsparse_int        block_dim = arg.block_dim;
+    rocsparse_operation  trans_A   = arg.transA;
+    rocsparse_operation  trans_B   = arg.transB;
+    rocsparse_direction  direction = arg.direction;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_spmm_alg   alg       = arg.spmm_alg;
+    rocsparse_order      order     = rocsparse_order_column;
+
+    rocsparse_int Mb = -1;
+    rocsparse_int Kb = -1;
+    if(block_dim > 0)
+    {
+        Mb = (M + block_dim - 1) / block_dim;
+        Kb = (K + block_dim - 1) / block_dim;
+    }
+
+    host_scalar<T> h_alpha, h_beta;
+
+    *h_alpha = arg.get_alpha<T>();
+    *h_beta  = arg.get_beta<T>();
+
+    // Data type
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor for the reference
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    if(Mb <= 0 || N <= 0 || Kb <= 0 || block_dim <= 0)
+    {
+        return;
+    }
+
+    // Allocate host memory for output BSR matrix
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    host_gebsr_matrix<T>   hA;
+    device_gebsr_matrix<T> dA;
+
+    matrix_factory.init_bsr(hA, dA, Mb, Kb, base);
+
+    M = Mb * dA.row_block_dim;
+    K = Kb * dA.col_block_dim;
+
+    // Allocate B matrix
+    host_dense_matrix<T> hB_temp((trans_B == rocsparse_operation_none) ? 2 * K : 2 * N,
+                                 (trans_B == rocsparse_operation_none) ? N : K);
+    device_dense_matrix<T> dB_temp((trans_B == rocsparse_operation_none) ? 2 * K : 2 * N,
+                                   (trans_B == rocsparse_operation_none) ? N : K);
+    rocsparse_matrix_utils::init(hB_temp);
+    dB_temp.transfer_from(hB_temp);
+
+    // Layout of B matrix
+    host_dense_matrix_view<T> hB((trans_B == rocsparse_operation_none) ? K : N,
+                                 (trans_B == rocsparse_operation_none) ? N : K,
+                                 hB_temp.data(),
+                                 (trans_B == rocsparse_operation_none) ? 2 * K : 2 * N);
+
+    device_dense_matrix_view<T> dB((trans_B == rocsparse_operation_none) ? K : N,
+                                   (trans_B == rocsparse_operation_none) ? N : K,
+                                   dB_temp.data(),
+                                   (trans_B == rocsparse_operation_none) ? 2 * K : 2 * N);
+
+    // Allocate C matrix
+    host_dense_matrix<T>   hC_temp(2 * M, N);
+    device_dense_matrix<T> dC_temp(2 * M, N);
+    rocsparse_matrix_utils::init(hC_temp);
+    dC_temp.transfer_from(hC_temp);
+
+    // Layout of C matrix
+    host_dense_matrix_view<T>   hC(M, N, hC_temp.data(), 2 * M);
+    device_dense_matrix_view<T> dC(M, N, dC_temp.data(), 2 * M);
+
+    // Create descriptors
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnmat B(dB.m, dB.n, dB.ld, dB.data(), ttype, order);
+    rocsparse_local_dnmat C(dC.m, dC.n, dC.ld, dC.data(), ttype, order);
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         h_alpha,
+                                         A,
+                                         B,
+                                         h_beta,
+                                         C,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmm_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         h_alpha,
+                                         A,
+                                         B,
+                                         h_beta,
+                                         C,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmm_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+#define PARAMS(alpha_, dA_, dB_, beta_, dC_)                                                   \
+    handle, direction, trans_A, trans_B, Mb, N, Kb, dA_.nnzb, alpha_, descr, dA_.val, dA_.ptr, \
+        dA_.ind, dA_.row_block_dim, dB_, dB_.ld, beta_, dC_, dC_.ld
+
+    if(arg.unit_check)
+    {
+        //
+        // Pointer mode host
+        //
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      h_alpha,
+                                                      A,
+                                                      B,
+                                                      h_beta,
+                                                      C,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        //
+        // Compute on host.
+        //
+        {
+            host_dense_matrix<T> hC_copy(hC);
+            host_bsrmm<T>(PARAMS(h_alpha, hA, hB, h_beta, hC));
+            hC.near_check(dC);
+            dC = hC_copy;
+        }
+
+        //
+        // Pointer mode device
+        //
+        device_scalar<T> d_alpha(h_alpha);
+        device_scalar<T> d_beta(h_beta);
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      d_alpha,
+                                                      A,
+                                                      B,
+                                                      d_beta,
+                                                      C,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        hC.near_check(dC);
+    }
+#undef PARAMS
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 h_alpha,
+                                                 A,
+                                                 B,
+                                                 h_beta,
+                                                 C,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 h_alpha,
+                                                 A,
+                                                 B,
+                                                 h_beta,
+                                                 C,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = bsrmm_gflop_count(N, dA.nnzb, block_dim, dC.m * dC.n, *h_beta != static_cast<T>(0));
+        double gbyte_count = bsrmm_gbyte_count<T>(
+            Mb, dA.nnzb, block_dim, dB.m * dB.n, dC.m * dC.n, *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::K,
+                            K,
+                            display_key_t::dir,
+                            direction,
+                            display_key_t::trans_A,
+                            trans_A,
+                            display_key_t::trans_B,
+                            trans_B,
+                            display_key_t::nnzb,
+                            dA.nnzb,
+                            display_key_t::bdim,
+                            block_dim,
+                            display_key_t::alpha,
+                            *h_alpha,
+                            display_key_t::beta,
+                            *h_beta,
+                            display_key_t::algorithm,
+                            rocsparse_spmmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_spmm_bsr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spmm_bsr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_spmm_bsr_extra(const Arguments& arg) {}
@@ -122,8 +122,8 @@ void testing_spmm_csr_bad_arg(const Arguments& arg)
                             rocsparse_status_invalid_pointer);
 }
 
-template <typename I, typename J, typename T>
-void testing_spmm_csr(const Arguments& arg)
+template <typename I, typename J, typename A, typename T>
+static void testing_spmm_csr_template(const Arguments& arg)
 {
     J                    M       = arg.M;
     J                    N       = arg.N;
@@ -140,6 +140,7 @@ void testing_spmm_csr(const Arguments& arg)
     // Index and data type
     rocsparse_indextype itype = get_indextype<I>();
     rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  atype = get_datatype<A>();
     rocsparse_datatype  ttype = get_datatype<T>();
 
     // Create rocsparse handle
@@ -154,7 +155,7 @@ void testing_spmm_csr(const Arguments& arg)
         // Allocate memory on device
         device_vector<I> dcsr_row_ptr(safe_size);
         device_vector<J> dcsr_col_ind(safe_size);
-        device_vector<T> dcsr_val(safe_size);
+        device_vector<A> dcsr_val(safe_size);
         device_vector<T> dB(safe_size);
         device_vector<T> dC(safe_size);
 
@@ -177,16 +178,16 @@ void testing_spmm_csr(const Arguments& arg)
             // Check structures
             I nnz_A = 0;
 
-            rocsparse_local_spmat A(A_m,
-                                    A_n,
-                                    nnz_A,
-                                    dcsr_row_ptr,
-                                    dcsr_col_ind,
-                                    dcsr_val,
-                                    itype,
-                                    jtype,
-                                    base,
-                                    ttype,
+            rocsparse_local_spmat mat_A(A_m,
+                                        A_n,
+                                        nnz_A,
+                                        dcsr_row_ptr,
+                                        dcsr_col_ind,
+                                        dcsr_val,
+                                        itype,
+                                        jtype,
+                                        base,
+                                        atype,
                                     rocsparse_format_csr);
             rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
             rocsparse_local_dnmat C(C_m, C_n, ldc, dC, ttype, order);
@@ -196,7 +197,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                    trans_A,
                                                    trans_B,
                                                    &halpha,
-                                                   A,
+                                                   mat_A,
                                                    B,
                                                    &hbeta,
                                                    C,
@@ -214,7 +215,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                    trans_A,
                                                    trans_B,
                                                    &halpha,
-                                                   A,
+                                                   mat_A,
                                                    B,
                                                    &hbeta,
                                                    C,
@@ -229,7 +230,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                    trans_A,
                                                    trans_B,
                                                    &halpha,
-                                                   A,
+                                                   mat_A,
                                                    B,
                                                    &hbeta,
                                                    C,
@@ -249,10 +250,10 @@ void testing_spmm_csr(const Arguments& arg)
     // Allocate host memory for matrix
     host_vector<I> hcsr_row_ptr;
     host_vector<J> hcsr_col_ind;
-    host_vector<T> hcsr_val;
+    host_vector<A> hcsr_val;
 
     // Allocate host memory for matrix
-    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+    rocsparse_matrix_factory<A, I, J> matrix_factory(arg);
 
     I nnz_A;
     matrix_factory.init_csr(hcsr_row_ptr,
@@ -300,7 +301,7 @@ void testing_spmm_csr(const Arguments& arg)
     // Allocate device memory
     device_vector<I> dcsr_row_ptr(A_m + 1);
     device_vector<J> dcsr_col_ind(nnz_A);
-    device_vector<T> dcsr_val(nnz_A);
+    device_vector<A> dcsr_val(nnz_A);
     device_vector<T> dB(nnz_B);
     device_vector<T> dC_1(nnz_C);
     device_vector<T> dC_2(nnz_C);
@@ -312,7 +313,7 @@ void testing_spmm_csr(const Arguments& arg)
         hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (A_m + 1), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(
         hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(A) * nnz_A, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
@@ -320,16 +321,16 @@ void testing_spmm_csr(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
 
     // Create descriptors
-    rocsparse_local_spmat A(A_m,
-                            A_n,
-                            nnz_A,
-                            dcsr_row_ptr,
-                            dcsr_col_ind,
-                            dcsr_val,
-                            itype,
-                            jtype,
-                            base,
-                            ttype,
+    rocsparse_local_spmat mat_A(A_m,
+                                A_n,
+                                nnz_A,
+                                dcsr_row_ptr,
+                                dcsr_col_ind,
+                                dcsr_val,
+                                itype,
+                                jtype,
+                                base,
+                                atype,
                             rocsparse_format_csr);
     rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
     rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
@@ -341,7 +342,7 @@ void testing_spmm_csr(const Arguments& arg)
                                          trans_A,
                                          trans_B,
                                          &halpha,
-                                         A,
+                                         mat_A,
                                          B,
                                          &hbeta,
                                          C1,
@@ -359,7 +360,7 @@ void testing_spmm_csr(const Arguments& arg)
                                          trans_A,
                                          trans_B,
                                          &halpha,
-                                         A,
+                                         mat_A,
                                          B,
                                          &hbeta,
                                          C1,
@@ -379,7 +380,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                       trans_A,
                                                       trans_B,
                                                       &halpha,
-                                                      A,
+                                                      mat_A,
                                                       B,
                                                       &hbeta,
                                                       C1,
@@ -395,7 +396,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                       trans_A,
                                                       trans_B,
                                                       dalpha,
-                                                      A,
+                                                      mat_A,
                                                       B,
                                                       dbeta,
                                                       C2,
@@ -409,7 +410,13 @@ void testing_spmm_csr(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
 
-        // CPU csrmm
+        // CPU csrmm, computed on the matrix values promoted to the compute type
+        host_vector<T> hcsr_val_T(nnz_A);
+        for(I i = 0; i < nnz_A; ++i)
+        {
+            hcsr_val_T[i] = static_cast<T>(hcsr_val[i]);
+        }
+
         host_csrmm<T, I, J>(A_m,
                             N,
                             A_n,
@@ -418,7 +425,7 @@ void testing_spmm_csr(const Arguments& arg)
                             halpha,
                             hcsr_row_ptr,
                             hcsr_col_ind,
-                            hcsr_val,
+                            hcsr_val_T,
                             hB,
                             ldb,
                             hbeta,
@@ -446,7 +453,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                  trans_A,
                                                  trans_B,
                                                  &halpha,
-                                                 A,
+                                                 mat_A,
                                                  B,
                                                  &hbeta,
                                                  C1,
@@ -466,7 +473,7 @@ void testing_spmm_csr(const Arguments& arg)
                                                  trans_A,
                                                  trans_B,
                                                  &halpha,
-                                                 A,
+                                                 mat_A,
                                                  B,
                                                  &hbeta,
                                                  C1,
@@ -512,6 +519,27 @@ void testing_spmm_csr(const Arguments& arg)
     CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
 }
 
+template <typename I, typename J, typename T>
+void testing_spmm_csr(const Arguments& arg)
+{
+    // Half precision sparse matrices are only supported with single precision dense matrices
+    using half_t     = std::conditional_t<std::is_same<T, float>{}, _Float16, T>;
+    using bfloat16_t = std::conditional_t<std::is_same<T, float>{}, hip_bfloat16, T>;
+
+    if(std::is_same<T, float>() && arg.a_type == rocsparse_datatype_f16_r)
+    {
+        testing_spmm_csr_template<I, J, half_t, T>(arg);
+    }
+    else if(std::is_same<T, float>() && arg.a_type == rocsparse_datatype_bf16_r)
+    {
+        testing_spmm_csr_template<I, J, bfloat16_t, T>(arg);
+    }
+    else
+    {
+        testing_spmm_csr_template<I, J, T, T>(arg);
+    }
+}
+
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
     template void testing_spmm_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
     template void testing_spmm_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
@@ -0,0 +1,498 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename T>
+void testing_spmm_ell_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle      = local_handle;
+    I                    m           = safe_size;
+    I                    n           = safe_size;
+    I                    k           = safe_size;
+    I                    ell_width   = 1;
+    const T*             alpha       = (const T*)0x4;
+    const T*             beta        = (const T*)0x4;
+    void*                ell_val     = (void*)0x4;
+    void*                ell_col_ind = (void*)0x4;
+    void*                B           = (void*)0x4;
+    void*                C           = (void*)0x4;
+    rocsparse_operation  trans_A     = rocsparse_operation_none;
+    rocsparse_operation  trans_B     = rocsparse_operation_none;
+    rocsparse_index_base base        = rocsparse_index_base_zero;
+    rocsparse_order      order       = rocsparse_order_column;
+    rocsparse_spmm_alg   alg         = rocsparse_spmm_alg_default;
+    rocsparse_spmm_stage stage       = rocsparse_spmm_stage_auto;
+
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // SpMM structures
+    rocsparse_local_spmat local_mat_A(m, k, ell_col_ind, ell_val, ell_width, itype, base, ttype);
+    rocsparse_local_dnmat local_mat_B(k, n, k, B, ttype, order);
+    rocsparse_local_dnmat local_mat_C(m, n, m, C, ttype, order);
+
+    rocsparse_spmat_descr mat_A = local_mat_A;
+    rocsparse_dnmat_descr mat_B = local_mat_B;
+    rocsparse_dnmat_descr mat_C = local_mat_C;
+
+    int       nargs_to_exclude   = 2;
+    const int args_to_exclude[2] = {11, 12};
+
+#define PARAMS                                                                                  \
+    handle, trans_A, trans_B, alpha, mat_A, mat_B, beta, mat_C, ttype, alg, stage, buffer_size, \
+        temp_buffer
+    {
+        size_t* buffer_size = (size_t*)0x4;
+        void*   temp_buffer = (void*)0x4;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    {
+        size_t* buffer_size = (size_t*)0x4;
+        void*   temp_buffer = nullptr;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    {
+        size_t* buffer_size = nullptr;
+        void*   temp_buffer = (void*)0x4;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    {
+        size_t* buffer_size = nullptr;
+        void*   temp_buffer = nullptr;
+        auto_testing_bad_arg(rocsparse_spmm, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+#undef PARAMS
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           alpha,
+                                           mat_A,
+                                           mat_B,
+                                           beta,
+                                           mat_C,
+                                           ttype,
+                                           alg,
+                                           stage,
+                                           nullptr,
+                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // ELL only supports the default algorithm
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           alpha,
+                                           mat_A,
+                                           mat_B,
+                                           beta,
+                                           mat_C,
+                                           ttype,
+                                           rocsparse_spmm_alg_csr,
+                                           rocsparse_spmm_stage_buffer_size,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename I, typename T>
+void testing_spmm_ell(const Arguments& arg)
+{
+    I                    M       = arg.M;
+    I                    N       = arg.N;
+    I                    K       = arg.K;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_spmm_alg   alg     = arg.spmm_alg;
+    rocsparse_order      order   = arg.order;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    auto tol = get_near_check_tol<T>(arg);
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const I safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<I> dell_col_ind(safe_size);
+        device_vector<T> dell_val(safe_size);
+        device_vector<T> dB(safe_size);
+        device_vector<T> dC(safe_size);
+
+        // Check SpMM when structures can be created
+        if(M == 0 && N == 0 && K == 0)
+        {
+            // Pointer mode
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            rocsparse_local_spmat A(0, 0, dell_col_ind, dell_val, 0, itype, base, ttype);
+            rocsparse_local_dnmat B(0, 0, 0, dB, ttype, order);
+            rocsparse_local_dnmat C(0, 0, 0, dC, ttype, order);
+
+            size_t buffer_size;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   rocsparse_spmm_stage_buffer_size,
+                                                   &buffer_size,
+                                                   nullptr),
+                                    rocsparse_status_success);
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, safe_size));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   rocsparse_spmm_stage_preprocess,
+                                                   &buffer_size,
+                                                   dbuffer),
+                                    rocsparse_status_success);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   rocsparse_spmm_stage_compute,
+                                                   &buffer_size,
+                                                   dbuffer),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Some matrix properties
+    I A_m = (trans_A == rocsparse_operation_none) ? M : K;
+    I A_n = (trans_A == rocsparse_operation_none) ? K : M;
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<I> hcsr_col_ind;
+    host_vector<T> hcsr_val;
+
+    rocsparse_matrix_factory<T, I, I> matrix_factory(arg);
+
+    I nnz_csr;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, A_m, A_n, nnz_csr, base);
+
+    // The dimensions of a matrix from a file replace the requested ones
+    M = (trans_A == rocsparse_operation_none) ? A_m : A_n;
+    K = (trans_A == rocsparse_operation_none) ? A_n : A_m;
+
+    // Convert to ELL, the reference is computed from the CSR matrix
+    host_vector<I> hell_col_ind;
+    host_vector<T> hell_val;
+
+    I ell_width;
+    host_csr_to_ell(
+        A_m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hell_col_ind, hell_val, ell_width, base, base);
+
+    int64_t nnz_A = (int64_t)A_m * ell_width;
+
+    I B_m = (trans_B == rocsparse_operation_none) ? K : N;
+    I B_n = (trans_B == rocsparse_operation_none) ? N : K;
+    I C_m = M;
+    I C_n = N;
+
+    I ldb = (order == rocsparse_order_column)
+                ? ((trans_B == rocsparse_operation_none) ? (2 * K) : (2 * N))
+                : ((trans_B == rocsparse_operation_none) ? (2 * N) : (2 * K));
+    I ldc = (order == rocsparse_order_column) ? (2 * M) : (2 * N);
+
+    int64_t nrowB = (order == rocsparse_order_column) ? ldb : B_m;
+    int64_t ncolB = (order == rocsparse_order_column) ? B_n : ldb;
+    int64_t nrowC = (order == rocsparse_order_column) ? ldc : C_m;
+    int64_t ncolC = (order == rocsparse_order_column) ? C_n : ldc;
+
+    int64_t nnz_B = nrowB * ncolB;
+    int64_t nnz_C = nrowC * ncolC;
+
+    // Allocate host memory for vectors
+    host_vector<T> hB(nnz_B);
+    host_vector<T> hC_1(nnz_C, 0);
+    host_vector<T> hC_2(nnz_C, 0);
+    host_vector<T> hC_gold(nnz_C, 0);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hB, nnz_B, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C, 1, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate device memory
+    device_vector<I> dell_col_ind(nnz_A);
+    device_vector<T> dell_val(nnz_A);
+    device_vector<T> dB(nnz_B);
+    device_vector<T> dC_1(nnz_C);
+    device_vector<T> dC_2(nnz_C);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dell_col_ind, hell_col_ind.data(), sizeof(I) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dell_val, hell_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(A_m, A_n, dell_col_ind, dell_val, ell_width, itype, base, ttype);
+    rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+    rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
+    rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, order);
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         &halpha,
+                                         A,
+                                         B,
+                                         &hbeta,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmm_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         &halpha,
+                                         A,
+                                         B,
+                                         &hbeta,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmm_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      &halpha,
+                                                      A,
+                                                      B,
+                                                      &hbeta,
+                                                      C1,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      dalpha,
+                                                      A,
+                                                      B,
+                                                      dbeta,
+                                                      C2,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU csrmm
+        host_csrmm<T, I, I>(A_m,
+                            N,
+                            A_n,
+                            trans_A,
+                            trans_B,
+                            halpha,
+                            hcsr_row_ptr.data(),
+                            hcsr_col_ind.data(),
+                            hcsr_val.data(),
+                            hB.data(),
+                            ldb,
+                            hbeta,
+                            hC_gold.data(),
+                            ldc,
+                            order,
+                            base,
+                            false);
+
+        hC_gold.near_check(hC_1, tol);
+        hC_gold.near_check(hC_2, tol);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = spmm_gflop_count(
+            N, nnz_csr, (int64_t)C_m * (int64_t)C_n, hbeta != static_cast<T>(0));
+        double gbyte_count = ellmm_gbyte_count<T, I>(nnz_A,
+                                                     (int64_t)B_m * (int64_t)B_n,
+                                                     (int64_t)C_m * (int64_t)C_n,
+                                                     hbeta != static_cast<T>(0));
+
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "ell_width",
+                            ell_width,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "Algorithm",
+                            rocsparse_spmmalg2string(alg),
+                            s_timing_info_perf,
+                            gpu_gflops,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                               \
+    template void testing_spmm_ell_bad_arg<ITYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_ell<ITYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, float);
+INSTANTIATE(int32_t, double);
+INSTANTIATE(int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, float);
+INSTANTIATE(int64_t, double);
+INSTANTIATE(int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, rocsparse_double_complex);
+void testing_spmm_ell_extra(const Arguments& arg) {}
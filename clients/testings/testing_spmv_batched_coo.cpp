@@ -0,0 +1,405 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename I, typename T>
+void testing_spmv_batched_coo_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle      = local_handle;
+    I                    m           = safe_size;
+    I                    n           = safe_size;
+    int64_t              nnz         = safe_size;
+    void*                coo_row_ind = (void*)0x4;
+    void*                coo_col_ind = (void*)0x4;
+    void*                coo_val     = (void*)0x4;
+    void*                x           = (void*)0x4;
+    void*                y           = (void*)0x4;
+    size_t*              buffer_size = (size_t*)0x4;
+    void*                temp_buffer = (void*)0x4;
+    rocsparse_operation  trans       = rocsparse_operation_none;
+    rocsparse_index_base base        = rocsparse_index_base_zero;
+    rocsparse_spmv_alg   alg         = rocsparse_spmv_alg_default;
+    rocsparse_spmv_stage stage       = rocsparse_spmv_stage_compute;
+
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    T alpha = static_cast<T>(1.0);
+    T beta  = static_cast<T>(0.0);
+
+    // SpMV structures
+    rocsparse_local_spmat local_mat_A(
+        m, n, nnz, coo_row_ind, coo_col_ind, coo_val, itype, base, ttype);
+    rocsparse_local_dnvec local_x(n, x, ttype);
+    rocsparse_local_dnvec local_y(m, y, ttype);
+
+    rocsparse_spmat_descr mat_A = local_mat_A;
+    rocsparse_dnvec_descr vec_x = local_x;
+    rocsparse_dnvec_descr vec_y = local_y;
+
+#define PARAMS                                                                                     \
+    handle, trans, &alpha, mat_A, vec_x, &beta, vec_y, ttype, alg, stage, buffer_size, temp_buffer
+
+    // y_i = A_i * x, with a mismatching number of batches in A
+    EXPECT_ROCSPARSE_STATUS(rocsparse_coo_set_strided_batch(mat_A, 10, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(vec_y, 5, m),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_value);
+
+    // y_i = A * x_i, with a mismatching number of batches in x
+    EXPECT_ROCSPARSE_STATUS(rocsparse_coo_set_strided_batch(mat_A, 1, 0),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(vec_x, 10, n),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_value);
+
+    // Overlapping batches of y
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(vec_x, 5, n),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(vec_y, 5, m - 1),
+                            rocsparse_status_invalid_value);
+
+    // Only general matrices are supported by the batched COO SpMV
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(vec_y, 5, m),
+                            rocsparse_status_success);
+    const rocsparse_matrix_type matrix_type = rocsparse_matrix_type_symmetric;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmat_set_attribute(mat_A,
+                                                          rocsparse_spmat_matrix_type,
+                                                          &matrix_type,
+                                                          sizeof(matrix_type)),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+#undef PARAMS
+}
+
+template <typename I, typename T>
+void testing_spmv_batched_coo(const Arguments& arg)
+{
+    I                    M     = arg.M;
+    I                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+
+    int batch_count_A = arg.batch_count_A;
+    int batch_count_x = arg.batch_count_B;
+    int batch_count_y = arg.batch_count_C;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    if(M <= 0 || N <= 0 || batch_count_y <= 0)
+    {
+        return;
+    }
+
+    // The matrix and x are either shared by all batches or have one batch per y
+    if((batch_count_A != 1 && batch_count_A != batch_count_y)
+       || (batch_count_x != 1 && batch_count_x != batch_count_y))
+    {
+        return;
+    }
+
+    // Generate the sparsity pattern shared by all batches
+    rocsparse_matrix_factory<T, I> matrix_factory(arg);
+
+    host_vector<I> hcoo_row_ind;
+    host_vector<I> hcoo_col_ind;
+    host_vector<T> hcoo_val_temp;
+
+    int64_t nnz_A;
+    matrix_factory.init_coo(hcoo_row_ind, hcoo_col_ind, hcoo_val_temp, M, N, nnz_A, base);
+
+    I x_size = (trans == rocsparse_operation_none) ? N : M;
+    I y_size = (trans == rocsparse_operation_none) ? M : N;
+
+    int64_t values_batch_stride = (batch_count_A > 1) ? nnz_A : 0;
+    int64_t x_batch_stride      = (batch_count_x > 1) ? x_size : 0;
+    int64_t y_batch_stride      = y_size;
+
+    // Every batch of A holds its own values
+    host_vector<T> hcoo_val(batch_count_A * nnz_A);
+    rocsparse_init<T>(hcoo_val, batch_count_A * nnz_A, 1, 1);
+
+    // Fully strided copy of the sparsity pattern
+    host_vector<I> hcoo_row_ind_strided(batch_count_A * nnz_A);
+    host_vector<I> hcoo_col_ind_strided(batch_count_A * nnz_A);
+
+    for(int b = 0; b < batch_count_A; ++b)
+    {
+        for(int64_t j = 0; j < nnz_A; ++j)
+        {
+            hcoo_row_ind_strided[nnz_A * b + j] = hcoo_row_ind[j];
+            hcoo_col_ind_strided[nnz_A * b + j] = hcoo_col_ind[j];
+        }
+    }
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(batch_count_x * x_size);
+    host_vector<T> hy_1(batch_count_y * y_size);
+
+    rocsparse_init<T>(hx, batch_count_x * x_size, 1, 1);
+    rocsparse_init<T>(hy_1, batch_count_y * y_size, 1, 1);
+
+    host_vector<T> hy_2(hy_1);
+    host_vector<T> hy_gold(hy_1);
+
+    // Allocate device memory
+    device_vector<I> dcoo_row_ind(hcoo_row_ind);
+    device_vector<I> dcoo_col_ind(hcoo_col_ind);
+    device_vector<I> dcoo_row_ind_strided(hcoo_row_ind_strided);
+    device_vector<I> dcoo_col_ind_strided(hcoo_col_ind_strided);
+    device_vector<T> dcoo_val(hcoo_val);
+    device_vector<T> dx(hx);
+    device_vector<T> dy_1(hy_1);
+    device_vector<T> dy_2(hy_2);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Matrix batches with fully strided sparsity patterns
+    rocsparse_local_spmat A_strided(
+        M, N, nnz_A, dcoo_row_ind_strided, dcoo_col_ind_strided, dcoo_val, itype, base, ttype);
+
+    // Matrix batches sharing the same sparsity pattern
+    rocsparse_local_spmat A_shared(
+        M, N, nnz_A, dcoo_row_ind, dcoo_col_ind, dcoo_val, itype, base, ttype);
+
+    rocsparse_local_dnvec x(x_size, dx, ttype);
+    rocsparse_local_dnvec y1(y_size, dy_1, ttype);
+    rocsparse_local_dnvec y2(y_size, dy_2, ttype);
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_coo_set_strided_batch(A_strided, batch_count_A, values_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_coo_set_strided_batch(A_shared, batch_count_A, 0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_values_batch_stride(A_shared, values_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, batch_count_x, x_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y1, batch_count_y, y_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y2, batch_count_y, y_batch_stride));
+
+    // Query SpMV buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         &halpha,
+                                         A_strided,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         &halpha,
+                                         A_strided,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host, fully strided sparsity patterns
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      trans,
+                                                      &halpha,
+                                                      A_strided,
+                                                      x,
+                                                      &hbeta,
+                                                      y1,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Pointer mode device, shared sparsity pattern
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      trans,
+                                                      dalpha,
+                                                      A_shared,
+                                                      x,
+                                                      dbeta,
+                                                      y2,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Copy output to host
+        hy_1.transfer_from(dy_1);
+        hy_2.transfer_from(dy_2);
+
+        // CPU coomv_batched
+        host_coomv_batched(trans,
+                           M,
+                           N,
+                           nnz_A,
+                           (int64_t)batch_count_y,
+                           halpha,
+                           hcoo_row_ind.data(),
+                           hcoo_col_ind.data(),
+                           (int64_t)0,
+                           hcoo_val.data(),
+                           values_batch_stride,
+                           hx.data(),
+                           x_batch_stride,
+                           hbeta,
+                           hy_gold.data(),
+                           y_batch_stride,
+                           base);
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 trans,
+                                                 &halpha,
+                                                 A_shared,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 trans,
+                                                 &halpha,
+                                                 A_shared,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = batch_count_y * spmv_gflop_count(M, nnz_A, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = coomv_batched_gbyte_count<T>(M,
+                                                          N,
+                                                          nnz_A,
+                                                          batch_count_A,
+                                                          batch_count_x,
+                                                          batch_count_y,
+                                                          hbeta != static_cast<T>(0));
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz_A",
+                            nnz_A,
+                            "batch_count_A",
+                            batch_count_A,
+                            "batch_count_x",
+                            batch_count_x,
+                            "batch_count_y",
+                            batch_count_y,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            s_timing_info_perf,
+                            gpu_gflops,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                                       \
+    template void testing_spmv_batched_coo_bad_arg<ITYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_batched_coo<ITYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, float);
+INSTANTIATE(int32_t, double);
+INSTANTIATE(int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, float);
+INSTANTIATE(int64_t, double);
+INSTANTIATE(int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, rocsparse_double_complex);
+void testing_spmv_batched_coo_extra(const Arguments& arg) {}
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename A, typename X, typename Y, typename T>
+void testing_spmv_bell_bad_arg(const Arguments& arg)
+{
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle      handle      = local_handle;
+    rocsparse_operation   trans       = rocsparse_operation_none;
+    void*                 alpha       = (void*)0x4;
+    rocsparse_spmat_descr A           = (rocsparse_spmat_descr)0x4;
+    rocsparse_dnvec_descr x           = (rocsparse_dnvec_descr)0x4;
+    void*                 beta        = (void*)0x4;
+    rocsparse_dnvec_descr y           = (rocsparse_dnvec_descr)0x4;
+    rocsparse_datatype    ttype       = get_datatype<T>();
+    rocsparse_spmv_alg    alg         = rocsparse_spmv_alg_ell;
+    rocsparse_spmv_stage  stage       = rocsparse_spmv_stage_auto;
+    size_t*               buffer_size = (size_t*)0x4;
+    void*                 buffer      = (void*)0x4;
+
+#define PARAMS handle, trans, &alpha, A, x, &beta, y, ttype, alg, stage, buffer_size, buffer
+
+    static const int nargs_to_exclude                  = 2;
+    static const int args_to_exclude[nargs_to_exclude] = {10, 11};
+
+    auto_testing_bad_arg(rocsparse_spmv, nargs_to_exclude, args_to_exclude, PARAMS);
+
+#undef PARAMS
+}
+
+template <typename I, typename A, typename X, typename Y, typename T>
+void testing_spmv_bell(const Arguments& arg)
+{
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  atype = get_datatype<A>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    I Mb        = arg.M;
+    I Nb        = arg.N;
+    I block_dim = arg.block_dim;
+
+    rocsparse_operation  trans     = arg.transA;
+    rocsparse_direction  direction = arg.direction;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_spmv_alg   alg       = arg.spmv_alg;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+#define PARAMS(alpha_, A_, x_, beta_, y_, stage_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, stage_, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || Nb <= 0 || block_dim <= 0)
+    {
+        if(Mb == 0 || Nb == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            I M = Mb * block_dim;
+            I N = Nb * block_dim;
+
+            rocsparse_local_spmat A(
+                M, N, direction, block_dim, 0, nullptr, nullptr, itype, base, atype);
+            device_dense_matrix<X> dx;
+            device_dense_matrix<Y> dy;
+            rocsparse_local_dnvec  x(dx);
+            rocsparse_local_dnvec  y(dy);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y, rocsparse_spmv_stage_buffer_size)),
+                rocsparse_status_success);
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y, rocsparse_spmv_stage_compute)),
+                rocsparse_status_success);
+            CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+        }
+        return;
+    }
+
+    // Block structure of the matrix, as an ELL matrix of Mb x Nb blocks
+    host_ell_matrix<A, I> hA;
+    {
+        rocsparse_matrix_factory<A, I, I> matrix_factory(arg, arg.unit_check, false);
+        matrix_factory.init_ell(hA, Mb, Nb, base);
+    }
+
+    const I M          = Mb * block_dim;
+    const I N          = Nb * block_dim;
+    const I bell_width = hA.width;
+
+    // Values of the blocks, taken from the values of the ELL matrix
+    const size_t         nnz_ell    = size_t(Mb) * bell_width;
+    const size_t         block_size = size_t(block_dim) * block_dim;
+    host_dense_vector<A> hA_val(nnz_ell * block_size);
+    for(size_t i = 0; i < hA_val.size(); ++i)
+    {
+        hA_val[i] = hA.val[(i + i / block_size) % nnz_ell];
+    }
+
+    device_ell_matrix<A, I> dA(hA);
+    device_dense_vector<A>  dA_val(hA_val);
+    rocsparse_local_spmat   matA(M,
+                                 N,
+                                 direction,
+                                 block_dim,
+                                 bell_width * block_dim,
+                                 (I*)dA.ind,
+                                 (A*)dA_val,
+                                 itype,
+                                 base,
+                                 atype);
+
+    host_dense_matrix<X> hx((trans == rocsparse_operation_none) ? N : M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<X> dx(hx);
+
+    host_dense_matrix<Y> hy((trans == rocsparse_operation_none) ? M : N, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<Y> dy(hy);
+
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    void*  dbuffer     = nullptr;
+    size_t buffer_size = 0;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmv(PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_buffer_size)));
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Run preprocess
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmv(PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_preprocess)));
+
+    // Pointer mode host
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(
+            PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_compute)));
+
+        {
+            host_dense_matrix<Y> hy_copy(hy);
+
+            //
+            // HOST CALCULATION
+            //
+            host_bellmv<T, I, A, X, Y>(trans,
+                                       direction,
+                                       Mb,
+                                       Nb,
+                                       bell_width * block_dim,
+                                       block_dim,
+                                       *h_alpha,
+                                       hA.ind,
+                                       hA_val,
+                                       hx,
+                                       *h_beta,
+                                       hy,
+                                       base);
+
+            hy.near_check(dy);
+            dy.transfer_from(hy_copy);
+        }
+
+        //
+        // Pointer mode device
+        //
+        {
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(
+                PARAMS(d_alpha, matA, x, d_beta, y, rocsparse_spmv_stage_compute)));
+        }
+
+        hy.near_check(dy);
+    }
+
+    if(arg.timing)
+    {
+        const int number_cold_calls = 2;
+        const int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_compute)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                PARAMS(h_alpha, matA, x, h_beta, y, rocsparse_spmv_stage_compute)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        const int64_t nnz = int64_t(nnz_ell) * block_size;
+
+        const double gflop_count = spmv_gflop_count(M, nnz, *h_beta != static_cast<T>(0));
+        const double gbyte_count = bellmv_gbyte_count<A, X, Y>(
+            Mb, Nb, bell_width, block_dim, *h_beta != static_cast<T>(0));
+
+        const double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        const double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::trans_A,
+                            rocsparse_operation2string(trans),
+                            display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::bdim,
+                            block_dim,
+                            display_key_t::bdir,
+                            rocsparse_direction2string(direction),
+                            display_key_t::alpha,
+                            *h_alpha,
+                            display_key_t::beta,
+                            *h_beta,
+                            display_key_t::algorithm,
+                            rocsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                               \
+    template void testing_spmv_bell_bad_arg<ITYPE, TTYPE, TTYPE, TTYPE, TTYPE>( \
+        const Arguments& arg);                                                  \
+    template void testing_spmv_bell<ITYPE, TTYPE, TTYPE, TTYPE, TTYPE>(const Arguments& arg)
+
+#define INSTANTIATE_MIXED(ITYPE, ATYPE, XTYPE, YTYPE, TTYPE)                    \
+    template void testing_spmv_bell_bad_arg<ITYPE, ATYPE, XTYPE, YTYPE, TTYPE>( \
+        const Arguments& arg);                                                  \
+    template void testing_spmv_bell<ITYPE, ATYPE, XTYPE, YTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, float);
+INSTANTIATE(int32_t, double);
+INSTANTIATE(int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, float);
+INSTANTIATE(int64_t, double);
+INSTANTIATE(int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, rocsparse_double_complex);
+
+INSTANTIATE_MIXED(int32_t, int8_t, int8_t, int32_t, int32_t);
+INSTANTIATE_MIXED(int64_t, int8_t, int8_t, int32_t, int32_t);
+INSTANTIATE_MIXED(int32_t, int8_t, int8_t, float, float);
+INSTANTIATE_MIXED(int64_t, int8_t, int8_t, float, float);
+
+INSTANTIATE_MIXED(int32_t, _Float16, float, float, float);
+INSTANTIATE_MIXED(int64_t, _Float16, float, float, float);
+
+INSTANTIATE_MIXED(int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_MIXED(int64_t, hip_bfloat16, float, float, float);
+
+INSTANTIATE_MIXED(
+    int32_t, float, rocsparse_float_complex, rocsparse_float_complex, rocsparse_float_complex);
+INSTANTIATE_MIXED(
+    int64_t, float, rocsparse_float_complex, rocsparse_float_complex, rocsparse_float_complex);
+
+INSTANTIATE_MIXED(int32_t, float, double, double, double);
+INSTANTIATE_MIXED(int64_t, float, double, double, double);
+
+INSTANTIATE_MIXED(
+    int32_t, double, rocsparse_double_complex, rocsparse_double_complex, rocsparse_double_complex);
+INSTANTIATE_MIXED(
+    int64_t, double, rocsparse_double_complex, rocsparse_double_complex, rocsparse_double_complex);
+
+INSTANTIATE_MIXED(int32_t,
+                  rocsparse_float_complex,
+                  rocsparse_double_complex,
+                  rocsparse_double_complex,
+                  rocsparse_double_complex);
+INSTANTIATE_MIXED(int64_t,
+                  rocsparse_float_complex,
+                  rocsparse_double_complex,
+                  rocsparse_double_complex,
+                  rocsparse_double_complex);
+
+void testing_spmv_bell_extra(const Arguments& arg) {}
@@ -65,6 +65,12 @@ INSTANTIATE_MIXED(int64_t, int64_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE_MIXED(int32_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE_MIXED(int64_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE_MIXED(int64_t, int64_t, int8_t, int8_t, float, float);
+INSTANTIATE_MIXED(int32_t, int32_t, _Float16, float, float, float);
+INSTANTIATE_MIXED(int64_t, int32_t, _Float16, float, float, float);
+INSTANTIATE_MIXED(int64_t, int64_t, _Float16, float, float, float);
+INSTANTIATE_MIXED(int32_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_MIXED(int64_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE_MIXED(int64_t, int64_t, hip_bfloat16, float, float, float);
 INSTANTIATE_MIXED(int32_t,
                   int32_t,
                   float,
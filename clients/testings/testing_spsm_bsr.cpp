@@ -0,0 +1,373 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_spsm_bsr_bad_arg(const Arguments& arg)
+{
+    rocsparse_int mb        = 100;
+    rocsparse_int nnzb      = 100;
+    rocsparse_int block_dim = 2;
+    rocsparse_int nrhs      = 10;
+    T             alpha     = 0.6;
+
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_direction  dir     = rocsparse_direction_row;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_spsm_alg   alg     = rocsparse_spsm_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<rocsparse_int>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_int m = mb * block_dim;
+
+    // SpSM structures
+    rocsparse_local_spmat local_A(mb,
+                                  mb,
+                                  nnzb,
+                                  dir,
+                                  block_dim,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  itype,
+                                  itype,
+                                  base,
+                                  ttype,
+                                  rocsparse_format_bsr);
+    rocsparse_local_dnmat local_B(m, nrhs, m, (void*)0x4, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat local_C(m, nrhs, m, (void*)0x4, ttype, rocsparse_order_column);
+
+    int       nargs_to_exclude   = 2;
+    const int args_to_exclude[2] = {10, 11};
+
+    rocsparse_handle      handle = local_handle;
+    rocsparse_spmat_descr A      = local_A;
+    rocsparse_dnmat_descr B      = local_B;
+    rocsparse_dnmat_descr C      = local_C;
+
+    size_t buffer_size;
+    void*  temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE                                                                   \
+    handle, trans_A, trans_B, &alpha, A, B, C, ttype, alg, rocsparse_spsm_stage_buffer_size, \
+        &buffer_size, temp_buffer
+
+#define PARAMS_ANALYSIS                                                                     \
+    handle, trans_A, trans_B, &alpha, A, B, C, ttype, alg, rocsparse_spsm_stage_preprocess, \
+        &buffer_size, temp_buffer
+
+#define PARAMS_SOLVE                                                                     \
+    handle, trans_A, trans_B, &alpha, A, B, C, ttype, alg, rocsparse_spsm_stage_compute, \
+        &buffer_size, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_spsm, nargs_to_exclude, args_to_exclude, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_spsm, nargs_to_exclude, args_to_exclude, PARAMS_ANALYSIS);
+    auto_testing_bad_arg(rocsparse_spsm, nargs_to_exclude, args_to_exclude, PARAMS_SOLVE);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_ANALYSIS
+#undef PARAMS_SOLVE
+
+    // BSR triangular solve requires 32 bit indices
+    rocsparse_local_spmat local_A_i64(mb,
+                                      mb,
+                                      nnzb,
+                                      dir,
+                                      block_dim,
+                                      (void*)0x4,
+                                      (void*)0x4,
+                                      (void*)0x4,
+                                      rocsparse_indextype_i64,
+                                      rocsparse_indextype_i64,
+                                      base,
+                                      ttype,
+                                      rocsparse_format_bsr);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spsm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           local_A_i64,
+                                           B,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spsm_stage_buffer_size,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_not_implemented);
+}
+
+template <typename T>
+void testing_spsm_bsr(const Arguments& arg)
+{
+    rocsparse_int        M         = arg.M;
+    rocsparse_int        nrhs      = arg.K;
+    rocsparse_int        block_dim = arg.block_dim;
+    rocsparse_operation  trans_A   = arg.transA;
+    rocsparse_operation  trans_B   = arg.transB;
+    rocsparse_direction  dir       = arg.direction;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_spsm_alg   alg       = arg.spsm_alg;
+    rocsparse_diag_type  diag      = arg.diag;
+    rocsparse_fill_mode  uplo      = arg.uplo;
+
+    rocsparse_spsm_stage compute = rocsparse_spsm_stage_compute;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+
+    // Data type
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // BSR dimension
+    rocsparse_int mb = (block_dim > 0) ? (M + block_dim - 1) / block_dim : -1;
+
+    if(mb <= 0 || nrhs <= 0 || block_dim <= 0)
+    {
+        return;
+    }
+
+    // Sample matrix
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    host_gebsr_matrix<T>   hA;
+    device_gebsr_matrix<T> dA;
+    matrix_factory.init_bsr(hA, dA, mb, mb, base);
+
+    M = mb * dA.row_block_dim;
+
+    // Right hand side B and solutions C
+    host_dense_matrix<T> hB((trans_B == rocsparse_operation_none) ? M : nrhs,
+                            (trans_B == rocsparse_operation_none) ? nrhs : M);
+    rocsparse_matrix_utils::init(hB);
+
+    device_dense_matrix<T> dB(hB), dC_1(hB.m, hB.n), dC_2(hB.m, hB.n);
+    device_scalar<T>       d_alpha(h_alpha);
+
+    // Create descriptors
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnmat B(dB.m, dB.n, dB.ld, dB, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C1(dC_1.m, dC_1.n, dC_1.ld, dC_1, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C2(dC_2.m, dC_2.n, dC_2.ld, dC_2, ttype, rocsparse_order_column);
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A, rocsparse_spmat_fill_mode, &uplo, sizeof(uplo)));
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A, rocsparse_spmat_diag_type, &diag, sizeof(diag)));
+
+    // Query SpSM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         h_alpha,
+                                         A,
+                                         B,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spsm_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Perform analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         h_alpha,
+                                         A,
+                                         B,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spsm_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Solve on host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spsm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      h_alpha,
+                                                      A,
+                                                      B,
+                                                      C1,
+                                                      ttype,
+                                                      alg,
+                                                      compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Solve on device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spsm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      d_alpha,
+                                                      A,
+                                                      B,
+                                                      C2,
+                                                      ttype,
+                                                      alg,
+                                                      compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // CPU bsrsm
+        host_dense_matrix<T>       hC_gold(hB.m, hB.n);
+        host_scalar<rocsparse_int> h_analysis_pivot, h_solve_pivot;
+        host_bsrsm<T>(mb,
+                      nrhs,
+                      hA.nnzb,
+                      dir,
+                      trans_A,
+                      trans_B,
+                      *h_alpha,
+                      hA.ptr,
+                      hA.ind,
+                      hA.val,
+                      hA.row_block_dim,
+                      hB,
+                      hB.ld,
+                      hC_gold,
+                      hC_gold.ld,
+                      diag,
+                      uplo,
+                      base,
+                      h_analysis_pivot,
+                      h_solve_pivot);
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hC_gold.near_check(dC_1);
+            hC_gold.near_check(dC_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 h_alpha,
+                                                 A,
+                                                 B,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 h_alpha,
+                                                 A,
+                                                 B,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = spsv_gflop_count(M, size_t(dA.nnzb) * dA.row_block_dim * dA.row_block_dim, diag)
+              * nrhs;
+        double gbyte_count = bsrsv_gbyte_count<T>(mb, dA.nnzb, dA.row_block_dim) * nrhs;
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::K,
+                            nrhs,
+                            display_key_t::nnzb,
+                            dA.nnzb,
+                            display_key_t::bdim,
+                            dA.row_block_dim,
+                            display_key_t::dir,
+                            dir,
+                            display_key_t::alpha,
+                            *h_alpha,
+                            display_key_t::algorithm,
+                            rocsparse_spsmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_spsm_bsr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spsm_bsr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_spsm_bsr_extra(const Arguments& arg) {}
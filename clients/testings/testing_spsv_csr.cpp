@@ -322,6 +322,43 @@ void testing_spsv_csr(const Arguments& arg)
                                          nullptr,
                                          dbuffer));
 
+    if(arg.unit_check)
+    {
+        // The preprocess stage gathers the levels of the triangular matrix
+        int64_t nlevels;
+        int64_t max_level_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+            A, rocsparse_spmat_spsv_nlevels, &nlevels, sizeof(nlevels)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+            A, rocsparse_spmat_spsv_max_level_size, &max_level_size, sizeof(max_level_size)));
+
+        // The level sizes are only gathered for the level set algorithm
+        const bool level_set = (alg == rocsparse_spsv_alg_level_set);
+        const int  valid     = (nlevels >= 1 && nlevels <= M)
+                          && (level_set ? (max_level_size >= 1 && max_level_size <= M
+                                           && nlevels * max_level_size >= M)
+                                        : (max_level_size == 0));
+        unit_check_scalar<int>(1, valid);
+
+        // The level set solve requires the levels of its own preprocess stage
+        if(!level_set)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spsv(handle,
+                                                   trans_A,
+                                                   &halpha,
+                                                   A,
+                                                   x,
+                                                   y1,
+                                                   ttype,
+                                                   rocsparse_spsv_alg_level_set,
+                                                   rocsparse_spsv_stage_compute,
+                                                   &buffer_size,
+                                                   dbuffer),
+                                    rocsparse_status_invalid_value);
+        }
+    }
+
     if(arg.unit_check)
     {
         // Solve on host
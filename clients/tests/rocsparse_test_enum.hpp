@@ -31,6 +31,7 @@ static constexpr std::size_t countof2(T (&)[N])
 
 // clang-format off
 #define ROCSPARSE_FOREACH_TEST_ENUM		\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(analysis_cache)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(axpby)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(axpyi)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsr2csr)				\
@@ -80,10 +81,13 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(csritilu0)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrsldu)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrilu0)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csriluk)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csrmc)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrilusv)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrmm)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrmv_managed)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csrmv_rowblocks)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrsm)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrsort)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrsv)					\
@@ -118,7 +122,10 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(hyb2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hybmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(identity)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(import_matrixmarket)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(inverse_permutation)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(mat_info_export)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(memory_pool)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(nnz)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_percentage)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr)				\
@@ -136,21 +143,29 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(spgemm_csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmat_descr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_bell)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_bsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_csc)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_ell)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_bell)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_coo)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_csc)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_csr)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_ell)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_coo)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_csr)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_bell)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_bsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo_aos)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csc)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_ell)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_bsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_bsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spitsv_csr)				\
@@ -129,6 +129,158 @@ rocsparse_status rocsparse_set_stream(rocsparse_handle handle, hipStream_t strea
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_stream(rocsparse_handle handle, hipStream_t* stream);
 
+/*! \ingroup aux_module
+ *  \brief Limit the memory cached by the memory pool of the library context
+ *
+ *  \details
+ *  Temporary device memory allocated by rocSPARSE on the stream of the library
+ *  context, e.g. during the analysis of a matrix, is taken from a stream-ordered
+ *  memory pool. Freed blocks are cached in size classes and reused by subsequent
+ *  allocations on this stream. The pool is shared by all library contexts using the
+ *  same stream. \p rocsparse_set_memory_pool_limit sets the maximum number of bytes
+ *  the pool keeps cached, cached blocks exceeding the limit are released. By default,
+ *  the size of the cache is not limited. The memory pool can be disabled by setting
+ *  the environment variable ROCSPARSE_NO_MEMORY_POOL to 1.
+ *
+ *  @param[in]
+ *  handle           the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  max_cached_bytes maximum number of bytes cached by the memory pool.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_memory_pool_limit(rocsparse_handle handle, size_t max_cached_bytes);
+
+/*! \ingroup aux_module
+ *  \brief Release the memory cached by the memory pool of the library context
+ *
+ *  \details
+ *  \p rocsparse_trim_memory_pool releases all the blocks cached by the memory pool
+ *  of the library context stream and resets its high water mark to the number of
+ *  bytes in use.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_trim_memory_pool(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Get the statistics of the memory pool of the library context
+ *
+ *  \details
+ *  \p rocsparse_get_memory_pool_info returns the number of bytes in use and the
+ *  number of bytes cached by the memory pool of the library context stream, and the
+ *  largest number of bytes held by the pool since its creation or the last call to
+ *  rocsparse_trim_memory_pool(). All values are zero if the memory pool is disabled.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  bytes_in_use    number of bytes currently allocated from the pool.
+ *  @param[out]
+ *  bytes_cached    number of bytes cached by the pool for reuse.
+ *  @param[out]
+ *  high_water_mark largest number of bytes held by the pool.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p bytes_in_use, \p bytes_cached or
+ *           \p high_water_mark pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_memory_pool_info(rocsparse_handle handle,
+                                                size_t*          bytes_in_use,
+                                                size_t*          bytes_cached,
+                                                size_t*          high_water_mark);
+
+/*! \ingroup aux_module
+ *  \brief Set the size of the analysis data cache of the library context
+ *
+ *  \details
+ *  The library context can keep a copy of the data computed by
+ *  rocsparse_csrmv_analysis(), rocsparse_csrsv_analysis(), rocsparse_csrsm_analysis(),
+ *  rocsparse_csrilu0_analysis(), rocsparse_csric0_analysis(), their BSR variants and
+ *  rocsparse_csrgemm_nnz(), keyed by a fingerprint of the sparsity pattern computed
+ *  on the device. When one of these routines is called again for the same sparsity
+ *  pattern, e.g. with a matrix rebuilt with the same structure, other arrays and
+ *  another matrix info structure, the cached data is reused instead of being
+ *  recomputed. \p rocsparse_set_analysis_cache_size sets the maximum number of
+ *  cached analyses, the least recently used ones are released when the cache is full.
+ *  A size of zero disables the cache. By default, the cache is disabled, unless the
+ *  environment variable ROCSPARSE_ANALYSIS_CACHE is set to 1, which sets its size to
+ *  16.
+ *
+ *  \note
+ *  When the cache is enabled, the analysis routines synchronize the stream to
+ *  compute the fingerprint of the sparsity pattern.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  max_entries maximum number of analyses kept in the cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t max_entries);
+
+/*! \ingroup aux_module
+ *  \brief Release the analysis data cache of the library context
+ *
+ *  \details
+ *  \p rocsparse_clear_analysis_cache releases all the analyses cached by the library
+ *  context and resets the statistics returned by rocsparse_get_analysis_cache_info().
+ *  The size of the cache is unchanged.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_clear_analysis_cache(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Get the statistics of the analysis data cache of the library context
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_cache_info returns the number of analyses held by the
+ *  cache of the library context, and the number of lookups that found or did not
+ *  find a matching sparsity pattern since the creation of the library context or the
+ *  last call to rocsparse_clear_analysis_cache().
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  num_entries number of analyses held by the cache.
+ *  @param[out]
+ *  num_hits    number of analyses reused from the cache.
+ *  @param[out]
+ *  num_misses  number of analyses not found in the cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p num_entries, \p num_hits or
+ *           \p num_misses pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_analysis_cache_info(rocsparse_handle handle,
+                                                   size_t*          num_entries,
+                                                   size_t*          num_hits,
+                                                   size_t*          num_misses);
+
 /*! \ingroup aux_module
  *  \brief Specify pointer mode
  *
@@ -170,6 +322,106 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify sizes mode
+ *
+ *  \details
+ *  \p rocsparse_set_sizes_mode specifies the sizes mode to be used by the rocSPARSE
+ *  library context and all subsequent function calls. By default, sizes computed on
+ *  the device may be copied to the host, which synchronizes the stream. With
+ *  \ref rocsparse_sizes_mode_device, the row group sizes of rocsparse_csrgemm_nnz(),
+ *  rocsparse_csrgemm_symbolic() and rocsparse_Xcsrgemm_numeric() stay on the device and
+ *  the following kernels are launched over all rows of a group, and rocsparse_Xcsrmv()
+ *  does not query the completion of its analysis. With \ref rocsparse_pointer_mode_device,
+ *  the number of non-zero entries written by rocsparse_csrgemm_nnz() is then not read back,
+ *  such that it can be consumed by the following stages without synchronization. Streams
+ *  being captured are handled as \ref rocsparse_sizes_mode_device.
+ *
+ *  \note
+ *  The csrgemm stages fall back to host sizes if \f$B\f$ or \f$D\f$ is unsorted.
+ *  rocsparse_csr2hyb(), rocsparse_Xcsrcolor(), rocsparse_Xcsrmv_analysis() of symmetric
+ *  matrices and rocsparse_spgemm() with \ref rocsparse_spgemm_stage_nnz still
+ *  synchronize, since the sizes they compute size allocations, loops or kernel selection
+ *  on the host.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  sizes_mode      the sizes mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p sizes_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_sizes_mode(rocsparse_handle handle, rocsparse_sizes_mode sizes_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current sizes mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_sizes_mode gets the rocSPARSE library context sizes mode which
+ *  is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  sizes_mode      the sizes mode that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p sizes_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_sizes_mode(rocsparse_handle      handle,
+                                          rocsparse_sizes_mode* sizes_mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify the convergence check interval of the iterative ILU0
+ *
+ *  \details
+ *  \p rocsparse_set_itilu0_check_interval specifies the number of sweeps between two
+ *  convergence checks of rocsparse_Xcsritilu0_compute(), when
+ *  \ref rocsparse_itilu0_option_device_stopping_criteria is set. The convergence is then
+ *  checked on the device, and the sweeps following convergence return immediately, such
+ *  that the stream is synchronized once, at the end of the factorization. The residual
+ *  is only computed for the sweeps that are checked and the sweeps preceding them, unless
+ *  the convergence history is logged. The default interval is 1.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  check_interval  the number of sweeps between two convergence checks.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p check_interval is not positive.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_itilu0_check_interval(rocsparse_handle handle,
+                                                     rocsparse_int    check_interval);
+
+/*! \ingroup aux_module
+ *  \brief Get the convergence check interval of the iterative ILU0
+ *
+ *  \details
+ *  \p rocsparse_get_itilu0_check_interval gets the number of sweeps between two
+ *  convergence checks on the device of rocsparse_Xcsritilu0_compute().
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  check_interval  the number of sweeps between two convergence checks.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p check_interval pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_itilu0_check_interval(rocsparse_handle handle,
+                                                     rocsparse_int*   check_interval);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -470,6 +722,34 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_copy_hyb_mat(rocsparse_hyb_mat dest, const rocsparse_hyb_mat src);
 
+/*! \ingroup aux_module
+ *  \brief Get the partitioning of a \p HYB matrix structure
+ *
+ *  \details
+ *  \p rocsparse_get_hyb_mat_partition returns the ELL width and the number of COO
+ *  non-zero entries chosen by rocsparse_csr2hyb(), together with the memory traffic
+ *  in bytes that rocsparse_hybmv() is predicted to move for this partitioning. The
+ *  prediction is the quantity minimized by \ref rocsparse_hyb_partition_cost.
+ *
+ *  @param[in]
+ *  hyb         the hybrid matrix structure.
+ *  @param[out]
+ *  ell_width   width of the ELL part of the HYB matrix.
+ *  @param[out]
+ *  coo_nnz     number of non-zero entries of the COO part of the HYB matrix.
+ *  @param[out]
+ *  hybmv_bytes predicted memory traffic of rocsparse_hybmv() in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p hyb, \p ell_width, \p coo_nnz or
+ *          \p hybmv_bytes pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_hyb_mat_partition(const rocsparse_hyb_mat hyb,
+                                                 rocsparse_int*          ell_width,
+                                                 rocsparse_int*          coo_nnz,
+                                                 int64_t*                hybmv_bytes);
+
 /*! \ingroup aux_module
  *  \brief Destroy a \p HYB matrix structure
  *
@@ -536,6 +816,154 @@ rocsparse_status rocsparse_copy_mat_info(rocsparse_mat_info dest, const rocspars
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Get the size of the buffer required to export a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_export_mat_info_buffer_size returns the size of the host buffer
+ *  required by rocsparse_csr_export_mat_info() to export the analysis data held by
+ *  the matrix info structure. If a csrmv analysis is still running on the device,
+ *  this function waits for its completion.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        the matrix info structure.
+ *  @param[out]
+ *  buffer_size number of bytes of the host buffer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_export_mat_info_buffer_size(rocsparse_handle         handle,
+                                                       const rocsparse_mat_info info,
+                                                       size_t*                  buffer_size);
+
+/*! \ingroup aux_module
+ *  \brief Export the analysis data of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_csr_export_mat_info copies the analysis data gathered in the matrix
+ *  info structure by rocsparse_csrmv_analysis(), rocsparse_csrsv_analysis(),
+ *  rocsparse_csrsm_analysis(), rocsparse_csrilu0_analysis() and
+ *  rocsparse_csric0_analysis() to a host buffer, e.g. to be written to a file. The
+ *  buffer also holds a fingerprint of the sparsity pattern of the matrix, computed on
+ *  the device, such that the analysis data can only be imported back with
+ *  rocsparse_csr_import_mat_info() for the same sparsity pattern. All the analysis
+ *  data of \p info must have been computed for the given matrix.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  \note
+ *  The exported data is specific to the version of the library and to the index
+ *  types. It does not depend on the values of the matrix.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        the matrix info structure holding the analysis data.
+ *  @param[in]
+ *  buffer_size size of \p buffer, as returned by
+ *              rocsparse_export_mat_info_buffer_size().
+ *  @param[out]
+ *  buffer      host buffer the analysis data is exported to.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, does not
+ *          match the analysis data, or \p buffer_size is too small.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *          \p csr_col_ind, \p info or \p buffer pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_export_mat_info(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const rocsparse_mat_info  info,
+                                               size_t                    buffer_size,
+                                               void*                     buffer);
+
+/*! \ingroup aux_module
+ *  \brief Import the analysis data of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_csr_import_mat_info restores the analysis data exported by
+ *  rocsparse_csr_export_mat_info(), such that the analysis routines do not need to be
+ *  called again, e.g. when an application restarts with the same sparsity pattern.
+ *  The fingerprint of the sparsity pattern of the matrix is computed on the device
+ *  and compared to the one stored in \p buffer. The imported analysis data replaces
+ *  the analysis data held by \p info, and is bound to \p descr, \p csr_row_ptr
+ *  and \p csr_col_ind as if the analysis routines had been called with them. If
+ *  the buffer is invalid, \p info is left unchanged.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        the matrix info structure the analysis data is imported to.
+ *  @param[in]
+ *  buffer_size size of \p buffer.
+ *  @param[in]
+ *  buffer      host buffer holding the exported analysis data.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or does not
+ *          match the exported analysis data.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *          \p csr_col_ind, \p info or \p buffer pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p buffer is corrupted, has been exported
+ *          by another version of the library or for another sparsity pattern.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_import_mat_info(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t                    buffer_size,
+                                               const void*               buffer);
+
 /*! \ingroup aux_module
  *  \brief Create a color info structure
  *
@@ -1715,6 +2143,54 @@ rocsparse_status rocsparse_csc_set_strided_batch(rocsparse_spmat_descr descr,
                                                  int64_t               offsets_batch_stride,
                                                  int64_t               rows_values_batch_stride);
 
+/*! \ingroup aux_module
+ *  \brief Set the batch count and batch stride in the sparse ELL matrix descriptor
+ *
+ *  \details
+ *  The batch stride applies to both the column indices and the values arrays of the
+ *  sparse ELL matrix.
+ *
+ *  @param[inout]
+ *  descr        the pointer to the sparse ELL matrix descriptor.
+ *  @param[in]
+ *  batch_count  batch_count of the sparse ELL matrix.
+ *  @param[in]
+ *  batch_stride batch stride of the sparse ELL matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_size if \p batch_count or \p batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ell_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               batch_stride);
+
+/*! \ingroup aux_module
+ *  \brief Set the values batch stride in the sparse matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_spmat_set_values_batch_stride sets the batch stride of the values
+ *  array independently of the batch strides of the index arrays. Combined with index
+ *  batch strides of zero, it describes a batch of sparse matrices sharing the same
+ *  sparsity pattern. \ref rocsparse_coo_set_strided_batch,
+ *  \ref rocsparse_csr_set_strided_batch, \ref rocsparse_csc_set_strided_batch and
+ *  \ref rocsparse_ell_set_strided_batch reset the values batch stride to their values
+ *  batch stride, and must therefore be called first.
+ *
+ *  @param[inout]
+ *  descr               the pointer to the sparse matrix descriptor.
+ *  @param[in]
+ *  values_batch_stride batch stride of the values array of the sparse matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_value if \p values_batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_set_values_batch_stride(rocsparse_spmat_descr descr,
+                                                         int64_t               values_batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Get the requested attribute data from the sparse matrix descriptor
  *
@@ -1763,6 +2239,110 @@ rocsparse_status rocsparse_spmat_set_attribute(rocsparse_spmat_descr     descr,
                                                const void*               data,
                                                size_t                    data_size);
 
+/*! \ingroup aux_module
+ *  \brief Get the size of the buffer required to export the analysis data of a
+ *  sparse matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_spmat_export_analysis_buffer_size returns the size of the host
+ *  buffer required by rocsparse_spmat_export_analysis().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  mat         the sparse matrix descriptor.
+ *  @param[out]
+ *  buffer_size number of bytes of the host buffer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p mat or \p buffer_size pointer is invalid.
+ *  \retval rocsparse_status_not_initialized \p mat has not been initialized.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_export_analysis_buffer_size(
+    rocsparse_handle handle, rocsparse_const_spmat_descr mat, size_t* buffer_size);
+
+/*! \ingroup aux_module
+ *  \brief Export the analysis data of a sparse matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_spmat_export_analysis copies the analysis data gathered by the
+ *  preprocess stages of rocsparse_spmv(), rocsparse_spsv() and rocsparse_spsm() to a
+ *  host buffer, together with a fingerprint of the sparsity pattern of the matrix.
+ *  See rocsparse_csr_export_mat_info().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  \note
+ *  Only the \ref rocsparse_format_csr format is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  mat         the sparse matrix descriptor.
+ *  @param[in]
+ *  buffer_size size of \p buffer, as returned by
+ *              rocsparse_spmat_export_analysis_buffer_size().
+ *  @param[out]
+ *  buffer      host buffer the analysis data is exported to.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p mat or \p buffer pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p buffer_size is too small.
+ *  \retval rocsparse_status_not_initialized \p mat has not been initialized.
+ *  \retval rocsparse_status_not_implemented the format or the index types of \p mat
+ *          are not supported.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_export_analysis(rocsparse_handle            handle,
+                                                 rocsparse_const_spmat_descr mat,
+                                                 size_t                      buffer_size,
+                                                 void*                       buffer);
+
+/*! \ingroup aux_module
+ *  \brief Import the analysis data of a sparse matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_spmat_import_analysis restores the analysis data exported by
+ *  rocsparse_spmat_export_analysis(), after checking the fingerprint of the sparsity
+ *  pattern of \p mat. The preprocess stages of rocsparse_spmv(), rocsparse_spsv() and
+ *  rocsparse_spsm() then skip the analysis. See rocsparse_csr_import_mat_info().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  \note
+ *  Only the \ref rocsparse_format_csr format is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  mat         the sparse matrix descriptor.
+ *  @param[in]
+ *  buffer_size size of \p buffer.
+ *  @param[in]
+ *  buffer      host buffer holding the exported analysis data.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p mat or \p buffer pointer is invalid.
+ *  \retval rocsparse_status_invalid_size the size of \p mat does not match the
+ *          exported analysis data.
+ *  \retval rocsparse_status_invalid_value \p buffer is corrupted, has been exported
+ *          by another version of the library or for another sparsity pattern.
+ *  \retval rocsparse_status_not_initialized \p mat has not been initialized.
+ *  \retval rocsparse_status_not_implemented the format or the index types of \p mat
+ *          are not supported.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_import_analysis(rocsparse_handle      handle,
+                                                 rocsparse_spmat_descr mat,
+                                                 size_t                buffer_size,
+                                                 const void*           buffer);
+
 /*! \ingroup aux_module
  *  \brief Create a dense vector descriptor
  *  \details
@@ -1876,6 +2456,43 @@ rocsparse_status rocsparse_const_dnvec_get_values(rocsparse_const_dnvec_descr de
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnvec_set_values(rocsparse_dnvec_descr descr, void* values);
 
+/*! \ingroup aux_module
+ *  \brief Get the batch count and batch stride from the dense vector descriptor
+ *
+ *  @param[in]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[out]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[out]
+ *  batch_stride the batch stride in the dense vector.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr, \p batch_count or \p batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
+/*! \ingroup aux_module
+ *  \brief Set the batch count and batch stride in the dense vector descriptor
+ *
+ *  @param[inout]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[in]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[in]
+ *  batch_stride the batch stride in the dense vector.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_value if \p batch_count or \p batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Create a dense matrix descriptor
  *  \details
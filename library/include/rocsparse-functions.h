@@ -13258,6 +13258,1163 @@ rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
                                     void*                     temp_buffer);
 /**@}*/
 
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsriluk_analysis(), rocsparse_dcsriluk_analysis(),
+*  rocsparse_ccsriluk_analysis(), rocsparse_zcsriluk_analysis(), rocsparse_scsriluk(),
+*  rocsparse_dcsriluk(), rocsparse_ccsriluk() and rocsparse_zcsriluk(). The temporary
+*  storage buffer must be allocated by the user. The size of the temporary storage
+*  buffer is identical to the size returned by rocsparse_scsrilu0_buffer_size(),
+*  rocsparse_dcsrilu0_buffer_size(), rocsparse_ccsrilu0_buffer_size() and
+*  rocsparse_zcsrilu0_buffer_size() and does not depend on the level of fill.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsriluk_analysis(), rocsparse_dcsriluk_analysis(),
+*              rocsparse_ccsriluk_analysis(), rocsparse_zcsriluk_analysis(),
+*              rocsparse_scsriluk(), rocsparse_dcsriluk(), rocsparse_ccsriluk() and
+*              rocsparse_zcsriluk().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsriluk_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsriluk_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_analysis performs the symbolic phase of the incomplete LU
+*  factorization with level of fill \f$k\f$ of a sparse \f$m \times m\f$ CSR matrix
+*  \f$A\f$. An entry \f$(i,j)\f$ is part of the sparsity pattern of the factors, if its
+*  level of fill
+*  \f[
+*    lev(i,j) = \min_{p < \min(i,j)} \left( lev(i,p) + lev(p,j) + 1 \right),
+*  \f]
+*  starting from \f$lev(i,j) = 0\f$ for the entries of \f$A\f$, does not exceed
+*  \f$k\f$. The sparsity pattern is computed in \f$k\f$ parallel passes, each merging
+*  the rows of the current pattern using hash tables, and is analysed for
+*  rocsparse_scsriluk(), rocsparse_dcsriluk(), rocsparse_ccsriluk() and
+*  rocsparse_zcsriluk() afterwards. Its number of non-zero entries can be obtained by
+*  rocsparse_csriluk_nnz(). The analysis meta data can be cleared by
+*  rocsparse_csriluk_clear().
+*
+*  \p rocsparse_csriluk_analysis reports structural zero pivots of the factors, which
+*  can be obtained by rocsparse_csriluk_zero_pivot().
+*
+*  \note
+*  A level of fill of 0 results in the sparsity pattern of rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0().
+*
+*  \note
+*  Passes whose rows can exceed 4095 non-zero entries, including the intermediate
+*  entries, use hash tables in global memory and are considerably slower.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  level       level of fill \f$k \ge 0\f$.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force. With
+*              \ref rocsparse_analysis_policy_reuse, the symbolic phase is skipped if
+*              \p info already holds the sparsity pattern of the same level of fill.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p level, \p analysis or \p solve is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or a
+*              row of the factors exceeds the supported number of non-zero entries.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             level,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             level,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsriluk_analysis(rocsparse_handle               handle,
+                                             rocsparse_int                  level,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsriluk_analysis(rocsparse_handle                handle,
+                                             rocsparse_int                   level,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_nnz returns the number of non-zero entries of the incomplete
+*  LU factors, that has been computed by rocsparse_scsriluk_analysis(),
+*  rocsparse_dcsriluk_analysis(), rocsparse_ccsriluk_analysis() or
+*  rocsparse_zcsriluk_analysis(). It is required to allocate the column indices and
+*  values of the factors.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  lu_nnz      pointer to the number of non-zero entries of the factors, can be in host
+*              or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p lu_nnz pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_csriluk_nnz(rocsparse_handle handle, rocsparse_mat_info info, rocsparse_int* lu_nnz);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsriluk(),
+*  rocsparse_dcsriluk(), rocsparse_ccsriluk() or rocsparse_zcsriluk() computation. The
+*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
+*  base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csriluk_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_clear deallocates all memory that was allocated by
+*  rocsparse_scsriluk_analysis(), rocsparse_dcsriluk_analysis(),
+*  rocsparse_ccsriluk_analysis() or rocsparse_zcsriluk_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csriluk_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk computes the incomplete LU factorization with level of fill
+*  \f$k\f$ and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*  on the sparsity pattern computed by rocsparse_scsriluk_analysis(),
+*  rocsparse_dcsriluk_analysis(), rocsparse_ccsriluk_analysis() or
+*  rocsparse_zcsriluk_analysis(). The factors are stored in the CSR matrix
+*  \p lu_val, \p lu_row_ptr and \p lu_col_ind, which uses the same index base as
+*  \f$A\f$ and has the number of non-zero entries returned by
+*  rocsparse_csriluk_nnz(). The entries of \f$A\f$ are copied into the factors,
+*  which are then computed by the same sync-free scheme as rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). Numeric
+*  boosting, enabled by rocsparse_scsrilu0_numeric_boost(),
+*  rocsparse_dcsrilu0_numeric_boost(), rocsparse_ccsrilu0_numeric_boost() or
+*  rocsparse_zcsrilu0_numeric_boost(), applies to \p rocsparse_csriluk as well.
+*
+*  \p rocsparse_csriluk requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsriluk_buffer_size(), rocsparse_dcsriluk_buffer_size(),
+*  rocsparse_ccsriluk_buffer_size() or rocsparse_zcsriluk_buffer_size().
+*  \p rocsparse_csriluk reports the first zero pivot (either numerical or structural
+*  zero). The zero pivot status can be obtained by calling
+*  rocsparse_csriluk_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  lu_val      array of \p lu_nnz elements holding the incomplete LU factors.
+*  @param[out]
+*  lu_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*              incomplete LU factors.
+*  @param[out]
+*  lu_col_ind  array of \p lu_nnz elements containing the column indices of the
+*              incomplete LU factors.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid, or \p m does not
+*              match the analysis step.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p lu_val, \p lu_row_ptr, \p lu_col_ind or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  \code{.c}
+*      // Obtain required buffer size
+*      size_t buffer_size;
+*      rocsparse_dcsriluk_buffer_size(handle,
+*                                     m,
+*                                     nnz,
+*                                     descr,
+*                                     csr_val,
+*                                     csr_row_ptr,
+*                                     csr_col_ind,
+*                                     info,
+*                                     &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Symbolic phase with level of fill 1
+*      rocsparse_dcsriluk_analysis(handle,
+*                                  1,
+*                                  m,
+*                                  nnz,
+*                                  descr,
+*                                  csr_val,
+*                                  csr_row_ptr,
+*                                  csr_col_ind,
+*                                  info,
+*                                  rocsparse_analysis_policy_reuse,
+*                                  rocsparse_solve_policy_auto,
+*                                  temp_buffer);
+*
+*      // Allocate the incomplete LU factors
+*      rocsparse_int lu_nnz;
+*      rocsparse_csriluk_nnz(handle, info, &lu_nnz);
+*
+*      rocsparse_int* lu_row_ptr;
+*      rocsparse_int* lu_col_ind;
+*      double*        lu_val;
+*      hipMalloc(&lu_row_ptr, sizeof(rocsparse_int) * (m + 1));
+*      hipMalloc(&lu_col_ind, sizeof(rocsparse_int) * lu_nnz);
+*      hipMalloc(&lu_val, sizeof(double) * lu_nnz);
+*
+*      // Compute incomplete LU factorization
+*      rocsparse_dcsriluk(handle,
+*                         m,
+*                         nnz,
+*                         descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         info,
+*                         lu_val,
+*                         lu_row_ptr,
+*                         lu_col_ind,
+*                         rocsparse_solve_policy_auto,
+*                         temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csriluk_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("A has structural and/or numerical zero at A(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // The factors can now be used by rocsparse_dcsrsv_analysis() and
+*      // rocsparse_dcsrsv_solve() to apply the preconditioner
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    float*                    lu_val,
+                                    rocsparse_int*            lu_row_ptr,
+                                    rocsparse_int*            lu_col_ind,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    double*                   lu_val,
+                                    rocsparse_int*            lu_row_ptr,
+                                    rocsparse_int*            lu_col_ind,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsriluk(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_float_complex*       lu_val,
+                                    rocsparse_int*                 lu_row_ptr,
+                                    rocsparse_int*                 lu_col_ind,
+                                    rocsparse_solve_policy         policy,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsriluk(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_double_complex*       lu_val,
+                                    rocsparse_int*                  lu_row_ptr,
+                                    rocsparse_int*                  lu_col_ind,
+                                    rocsparse_solve_policy          policy,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Multicolor reordering of a CSR matrix
+*
+*  \details
+*  \p rocsparse_csrmc_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_scsrmc_reorder(), rocsparse_dcsrmc_reorder(),
+*  rocsparse_ccsrmc_reorder() and rocsparse_zcsrmc_reorder(). The temporary storage
+*  buffer must be allocated by the user.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrmc_reorder(), rocsparse_dcsrmc_reorder(),
+*              rocsparse_ccsrmc_reorder() and rocsparse_zcsrmc_reorder().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmc_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             size_t*                   buffer_size);
+
+/*! \ingroup precond_module
+*  \brief Multicolor reordering of a CSR matrix
+*
+*  \details
+*  \p rocsparse_csrmc_reorder takes a distance-1 coloring of the sparse \f$m \times m\f$
+*  CSR matrix \f$A\f$, e.g. computed by rocsparse_scsrcolor(), rocsparse_dcsrcolor(),
+*  rocsparse_ccsrcolor() or rocsparse_zcsrcolor(), and computes the color ordered
+*  matrix
+*  \f[
+*    A_{mc} = P A P^T,
+*  \f]
+*  where the permutation \f$P\f$ sorts the rows by color. Rows of the same color keep
+*  their relative order. The permutation is returned in \p perm, such that row \f$i\f$
+*  of \f$A_{mc}\f$ is row \p perm[i] of \f$A\f$ (zero based). The column indices of
+*  \f$A_{mc}\f$ are sorted.
+*
+*  Since rows of the same color are not coupled, all entries left of the diagonal of a
+*  row of \f$A_{mc}\f$ belong to rows of previous colors. The color partition is stored
+*  in the \ref rocsparse_mat_info structure and consumed by rocsparse_scsrmcilu0(),
+*  rocsparse_dcsrmcilu0(), rocsparse_ccsrmcilu0(), rocsparse_zcsrmcilu0(),
+*  rocsparse_scsrmcgs(), rocsparse_dcsrmcgs(), rocsparse_ccsrmcgs() and
+*  rocsparse_zcsrmcgs(), which process one color at a time.
+*
+*  \note
+*  The colors in \p coloring must be in the range \f$[0, ncolors)\f$, otherwise
+*  \ref rocsparse_status_invalid_value is returned. This includes the rows that
+*  rocsparse_scsrcolor(), rocsparse_dcsrcolor(), rocsparse_ccsrcolor() and
+*  rocsparse_zcsrcolor() leave uncolored (-1) if \p fraction_to_color is less than 1.
+*  Colors without rows are allowed. The colors must form a valid distance-1 coloring of
+*  the (symmetric) sparsity pattern of \f$A\f$, otherwise the multicolor preconditioners
+*  are undefined.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  ncolors     number of colors of the coloring.
+*  @param[in]
+*  coloring    array of \p m elements containing the color of each row.
+*  @param[out]
+*  info        structure that holds the color partition of the color ordered matrix.
+*  @param[out]
+*  perm        array of \p m elements containing the row permutation.
+*  @param[out]
+*  mc_val      array of \p nnz elements of the color ordered CSR matrix.
+*  @param[out]
+*  mc_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*              color ordered CSR matrix.
+*  @param[out]
+*  mc_col_ind  array of \p nnz elements containing the column indices of the color
+*              ordered CSR matrix.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csrmc_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_value \p coloring contains colors outside of
+*              \f$[0, ncolors)\f$.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p coloring, \p info, \p perm, \p mc_val,
+*              \p mc_row_ptr, \p mc_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR storage format.
+*  The following example computes a multicolor ILU0 preconditioner of \f$A\f$.
+*  \code{.c}
+*      // Color the matrix
+*      double         fraction_to_color = 1.0;
+*      rocsparse_int  ncolors;
+*      rocsparse_int* coloring;
+*      hipMalloc(&coloring, sizeof(rocsparse_int) * m);
+*
+*      rocsparse_dcsrcolor(handle,
+*                          m,
+*                          nnz,
+*                          descr,
+*                          csr_val,
+*                          csr_row_ptr,
+*                          csr_col_ind,
+*                          &fraction_to_color,
+*                          &ncolors,
+*                          coloring,
+*                          nullptr,
+*                          info);
+*
+*      // Obtain the required buffer size
+*      size_t buffer_size;
+*      rocsparse_csrmc_buffer_size(handle,
+*                                  m,
+*                                  nnz,
+*                                  descr,
+*                                  csr_row_ptr,
+*                                  csr_col_ind,
+*                                  &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Allocate the color ordered matrix
+*      rocsparse_int* perm;
+*      rocsparse_int* mc_row_ptr;
+*      rocsparse_int* mc_col_ind;
+*      double*        mc_val;
+*      hipMalloc(&perm, sizeof(rocsparse_int) * m);
+*      hipMalloc(&mc_row_ptr, sizeof(rocsparse_int) * (m + 1));
+*      hipMalloc(&mc_col_ind, sizeof(rocsparse_int) * nnz);
+*      hipMalloc(&mc_val, sizeof(double) * nnz);
+*
+*      // Reorder the matrix by color
+*      rocsparse_dcsrmc_reorder(handle,
+*                               m,
+*                               nnz,
+*                               descr,
+*                               csr_val,
+*                               csr_row_ptr,
+*                               csr_col_ind,
+*                               ncolors,
+*                               coloring,
+*                               info,
+*                               perm,
+*                               mc_val,
+*                               mc_row_ptr,
+*                               mc_col_ind,
+*                               temp_buffer);
+*
+*      // Compute incomplete LU factorization of the color ordered matrix
+*      rocsparse_dcsrmcilu0(handle, m, nnz, descr, mc_val, mc_row_ptr, mc_col_ind, info);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csrmc_zero_pivot(handle,
+*                                                                   info,
+*                                                                   &position))
+*      {
+*          printf("A_mc has structural and/or numerical zero at A_mc(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmc_reorder(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             ncolors,
+                                          const rocsparse_int*      coloring,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_int*            perm,
+                                          float*                    mc_val,
+                                          rocsparse_int*            mc_row_ptr,
+                                          rocsparse_int*            mc_col_ind,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmc_reorder(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             ncolors,
+                                          const rocsparse_int*      coloring,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_int*            perm,
+                                          double*                   mc_val,
+                                          rocsparse_int*            mc_row_ptr,
+                                          rocsparse_int*            mc_col_ind,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmc_reorder(rocsparse_handle               handle,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           csr_row_ptr,
+                                          const rocsparse_int*           csr_col_ind,
+                                          rocsparse_int                  ncolors,
+                                          const rocsparse_int*           coloring,
+                                          rocsparse_mat_info             info,
+                                          rocsparse_int*                 perm,
+                                          rocsparse_float_complex*       mc_val,
+                                          rocsparse_int*                 mc_row_ptr,
+                                          rocsparse_int*                 mc_col_ind,
+                                          void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmc_reorder(rocsparse_handle                handle,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            csr_row_ptr,
+                                          const rocsparse_int*            csr_col_ind,
+                                          rocsparse_int                   ncolors,
+                                          const rocsparse_int*            coloring,
+                                          rocsparse_mat_info              info,
+                                          rocsparse_int*                  perm,
+                                          rocsparse_double_complex*       mc_val,
+                                          rocsparse_int*                  mc_row_ptr,
+                                          rocsparse_int*                  mc_col_ind,
+                                          void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Multicolor incomplete LU factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p rocsparse_csrmc_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrmcilu0(),
+*  rocsparse_dcsrmcilu0(), rocsparse_ccsrmcilu0() or rocsparse_zcsrmcilu0()
+*  computation. The first zero pivot \f$j\f$ at \f$A_{mc,j,j}\f$ is stored in
+*  \p position, using same index base as the CSR matrix. \f$j\f$ refers to a row of the
+*  color ordered matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrmc_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the reordering
+*              step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmc_zero_pivot(rocsparse_handle   handle,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Multicolor reordering of a CSR matrix
+*
+*  \details
+*  \p rocsparse_csrmc_clear deallocates all memory that was allocated by
+*  rocsparse_scsrmc_reorder(), rocsparse_dcsrmc_reorder(), rocsparse_ccsrmc_reorder()
+*  or rocsparse_zcsrmc_reorder(). This is especially useful, if memory is an issue and
+*  the color partition is not required for further computation.
+*
+*  \note
+*  Calling \p rocsparse_csrmc_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the reordering
+*              step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmc_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Multicolor incomplete LU factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p rocsparse_csrmcilu0 computes the incomplete LU factorization with 0 fill-ins and
+*  no pivoting of the color ordered sparse \f$m \times m\f$ CSR matrix \f$A_{mc}\f$,
+*  computed by rocsparse_scsrmc_reorder(), rocsparse_dcsrmc_reorder(),
+*  rocsparse_ccsrmc_reorder() or rocsparse_zcsrmc_reorder(), such that
+*  \f[
+*    A_{mc} \approx LU
+*  \f]
+*  The factorization is performed in place and processes one color at a time. Since
+*  rows of the same color are independent, all rows of a color are factorized in
+*  parallel, regardless of the number of dependency levels of \f$A\f$. The factors
+*  differ from the ones of rocsparse_scsrilu0() applied to \f$A\f$, since the
+*  elimination order changes.
+*
+*  \p rocsparse_csrmcilu0 reports the first zero pivot (either numerical or structural
+*  zero). The zero pivot status can be obtained by calling
+*  rocsparse_csrmc_zero_pivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  mc_val      array of \p nnz elements of the color ordered CSR matrix, overwritten
+*              by the incomplete LU factors.
+*  @param[in]
+*  mc_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*              color ordered CSR matrix.
+*  @param[in]
+*  mc_col_ind  array of \p nnz elements containing the column indices of the color
+*              ordered CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the reordering
+*              step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p mc_val, \p mc_row_ptr,
+*              \p mc_col_ind or \p info pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    mc_val,
+                                      const rocsparse_int*      mc_row_ptr,
+                                      const rocsparse_int*      mc_col_ind,
+                                      rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   mc_val,
+                                      const rocsparse_int*      mc_row_ptr,
+                                      const rocsparse_int*      mc_col_ind,
+                                      rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_float_complex*  mc_val,
+                                      const rocsparse_int*      mc_row_ptr,
+                                      const rocsparse_int*      mc_col_ind,
+                                      rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_double_complex* mc_val,
+                                      const rocsparse_int*      mc_row_ptr,
+                                      const rocsparse_int*      mc_col_ind,
+                                      rocsparse_mat_info        info);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Multicolor Gauss-Seidel smoother using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrmcgs performs \p nsweeps Gauss-Seidel sweeps on the system
+*  \f[
+*    A_{mc} x = b,
+*  \f]
+*  where \f$A_{mc}\f$ is the color ordered sparse \f$m \times m\f$ CSR matrix computed
+*  by rocsparse_scsrmc_reorder(), rocsparse_dcsrmc_reorder(),
+*  rocsparse_ccsrmc_reorder() or rocsparse_zcsrmc_reorder(). Each sweep relaxes
+*  \f[
+*    x_i = \frac{1}{a_{ii}} \left( b_i - \sum_{j \neq i} a_{ij} x_j \right)
+*  \f]
+*  color by color, all rows of a color in parallel. If \p symmetric is non-zero, each
+*  forward sweep is followed by a backward sweep over the colors in reverse order,
+*  starting at the second to last color.
+*  \p x holds the initial guess on entry and is updated in place. \p b and \p x are
+*  given in the color ordering, i.e. entry \f$i\f$ corresponds to row \p perm[i] of
+*  \f$A\f$.
+*
+*  \note
+*  Rows without a diagonal entry are not updated. Numerical zeros on the diagonal are
+*  not checked.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  mc_val      array of \p nnz elements of the color ordered CSR matrix.
+*  @param[in]
+*  mc_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*              color ordered CSR matrix.
+*  @param[in]
+*  mc_col_ind  array of \p nnz elements containing the column indices of the color
+*              ordered CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the reordering
+*              step.
+*  @param[in]
+*  nsweeps     number of sweeps.
+*  @param[in]
+*  symmetric   perform symmetric Gauss-Seidel sweeps, if non-zero.
+*  @param[in]
+*  b           array of \p m elements containing the right-hand side.
+*  @param[inout]
+*  x           array of \p m elements containing the initial guess on entry and the
+*              relaxed solution on exit.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nsweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p mc_val, \p mc_row_ptr,
+*              \p mc_col_ind, \p info, \p b or \p x pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmcgs(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              mc_val,
+                                    const rocsparse_int*      mc_row_ptr,
+                                    const rocsparse_int*      mc_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    int                       symmetric,
+                                    const float*              b,
+                                    float*                    x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmcgs(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             mc_val,
+                                    const rocsparse_int*      mc_row_ptr,
+                                    const rocsparse_int*      mc_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    int                       symmetric,
+                                    const double*             b,
+                                    double*                   x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmcgs(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* mc_val,
+                                    const rocsparse_int*           mc_row_ptr,
+                                    const rocsparse_int*           mc_col_ind,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_int                  nsweeps,
+                                    int                            symmetric,
+                                    const rocsparse_float_complex* b,
+                                    rocsparse_float_complex*       x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmcgs(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* mc_val,
+                                    const rocsparse_int*            mc_row_ptr,
+                                    const rocsparse_int*            mc_col_ind,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_int                   nsweeps,
+                                    int                             symmetric,
+                                    const rocsparse_double_complex* b,
+                                    rocsparse_double_complex*       x);
+/**@}*/
+
 /*! \ingroup precond_module
 *  \brief Iterative Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
 *  storage format.
@@ -13593,6 +14750,112 @@ rocsparse_status rocsparse_zcsritilu0_history(rocsparse_handle     handle,
 
 /**@}*/
 
+/*! \ingroup precond_module
+*  \brief Apply the iterative incomplete LU factorization with 0 fill-ins as a preconditioner.
+*
+*  \details
+*  \p rocsparse_csritilu0_apply computes an approximation of
+*  \f[
+*    y = (LU)^{-1} x,
+*  \f]
+*  where \f$L\f$ and \f$U\f$ are the factors computed by rocsparse_scsritilu0_compute(),
+*  rocsparse_dcsritilu0_compute(), rocsparse_ccsritilu0_compute() or
+*  rocsparse_zcsritilu0_compute(), stored in the pattern of the sparse CSR matrix \f$A\f$.
+*  The triangular systems \f$Lz = x\f$ and \f$Uy = z\f$ are approximated with \p nsweeps
+*  Jacobi sweeps each, starting from \f$z = x\f$ and \f$y = D^{-1}z\f$, where \f$D\f$ is
+*  the diagonal of \f$U\f$. Each sweep is a single kernel, without synchronization nor
+*  conversion of the factors.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  nsweeps     number of Jacobi sweeps for each triangular factor.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  ilu0        incomplete factorization computed by rocsparse_csritilu0_compute().
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  x           array of \p m elements.
+*  @param[out]
+*  y           array of \p m elements.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_value \p nsweeps or \p idx_base is invalid.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind,
+*              \p ilu0, \p x or \p y pointer is invalid.
+*  \retval     rocsparse_status_zero_pivot \p nnz is lower than \p m.
+*
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritilu0_apply(rocsparse_handle     handle,
+                                            rocsparse_int        nsweeps,
+                                            rocsparse_int        m,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const float*         ilu0,
+                                            rocsparse_index_base idx_base,
+                                            const float*         x,
+                                            float*               y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritilu0_apply(rocsparse_handle     handle,
+                                            rocsparse_int        nsweeps,
+                                            rocsparse_int        m,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const double*        ilu0,
+                                            rocsparse_index_base idx_base,
+                                            const double*        x,
+                                            double*              y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritilu0_apply(rocsparse_handle               handle,
+                                            rocsparse_int                  nsweeps,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            const rocsparse_float_complex* ilu0,
+                                            rocsparse_index_base           idx_base,
+                                            const rocsparse_float_complex* x,
+                                            rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritilu0_apply(rocsparse_handle                handle,
+                                            rocsparse_int                   nsweeps,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            const rocsparse_double_complex* ilu0,
+                                            rocsparse_index_base            idx_base,
+                                            const rocsparse_double_complex* x,
+                                            rocsparse_double_complex*       y);
+/**@}*/
+
 /*! \ingroup precond_module
 *  \brief Tridiagonal solver with pivoting
 *
@@ -16704,8 +17967,9 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 *                  \p partition_type == \ref rocsparse_hyb_partition_user).
 *  @param[in]
 *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
-*                  \ref rocsparse_hyb_partition_user or
-*                  \ref rocsparse_hyb_partition_max.
+*                  \ref rocsparse_hyb_partition_user,
+*                  \ref rocsparse_hyb_partition_max or
+*                  \ref rocsparse_hyb_partition_cost.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
@@ -21298,6 +22562,17 @@ rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
 *  |-------------------------|--------------------------|--------------------------|
 *  \endverbatim
 *
+*  Mixed half precisions:
+*  \verbatim
+*  |---------------------------|----------------------------|
+*  |             A             |    X / Y / compute_type    |
+*  |---------------------------|----------------------------|
+*  | rocsparse_datatype_f16_r  |  rocsparse_datatype_f32_r  |
+*  |---------------------------|----------------------------|
+*  | rocsparse_datatype_bf16_r |  rocsparse_datatype_f32_r  |
+*  |---------------------------|----------------------------|
+*  \endverbatim
+*
 *  Mixed-regular real precisions
 *  \verbatim
 *  |----------------------------|----------------------------|
@@ -21336,7 +22611,50 @@ rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
 *
 *  \note
 *  The sparse matrix formats currently supported are: rocsparse_format_bsr, rocsparse_format_coo,
-*  rocsparse_format_coo_aos, rocsparse_format_csr, rocsparse_format_csc and rocsparse_format_ell.
+*  rocsparse_format_coo_aos, rocsparse_format_csr, rocsparse_format_csc, rocsparse_format_ell and
+*  rocsparse_format_bell. Blocked ELL matrices are supported with the
+*  \ref rocsparse_spmv_alg_default and \ref rocsparse_spmv_alg_ell algorithms and do not require
+*  any preprocessing.
+*
+*  \note
+*  Batched SpMV is supported for the rocsparse_format_coo and rocsparse_format_csr formats with
+*  general or triangular (CSR only) matrices. The batch count of \p y is set with
+*  \ref rocsparse_dnvec_set_strided_batch and defines the number of products computed in a single
+*  launch. The batch count of \p mat and \p x must either be one, in which case they are shared by
+*  all batches, or equal to the batch count of \p y. Batches of \p mat are described with
+*  \ref rocsparse_coo_set_strided_batch or \ref rocsparse_csr_set_strided_batch. Matrices sharing
+*  the same sparsity pattern are described by setting the index batch strides to zero and the
+*  values batch stride with \ref rocsparse_spmat_set_values_batch_stride. All batches must have
+*  the same number of non-zero entries. The batched computation ignores \p alg and does not
+*  require any preprocessing.
+*
+*  \note
+*  With \ref rocsparse_spmv_alg_auto, the \ref rocsparse_spmv_stage_preprocess stage selects
+*  the algorithm once per matrix and operation and caches it in \p mat, a call with another
+*  \p trans selects it again. CSR and CSC matrices choose between
+*  \ref rocsparse_spmv_alg_csr_adaptive and \ref rocsparse_spmv_alg_csr_stream from the mean,
+*  maximum and standard deviation of the row lengths, COO matrices choose between
+*  \ref rocsparse_spmv_alg_coo and \ref rocsparse_spmv_alg_coo_atomic from the mean row
+*  length. If the environment variable ROCSPARSE_SPMV_AUTOTUNE is set to 1, the candidate
+*  algorithms are timed on the device instead, using a copy of \p y in \p temp_buffer. The
+*  selected algorithm can be queried with \ref rocsparse_spmat_get_attribute and
+*  \ref rocsparse_spmat_spmv_alg, it is reset when the pointers of \p mat are changed.
+*
+*  \note
+*  With \ref rocsparse_spmv_alg_csr_binned, the \ref rocsparse_spmv_stage_preprocess stage
+*  sorts the rows of a CSR matrix into bins of 1, 2-4, 5-16, 17-64, 65-2048 and more non-zero
+*  entries, and the \ref rocsparse_spmv_stage_compute stage launches one kernel per bin with a
+*  thread, a group of lanes, a wavefront, a block or multiple blocks per row. The binned rows
+*  are stored in \p temp_buffer, which must not be modified between the two stages. Transposed
+*  products and symmetric matrices are computed with \ref rocsparse_spmv_alg_csr_stream.
+*
+*  \note
+*  With \ref rocsparse_spmv_alg_csr_merge, the \ref rocsparse_spmv_stage_compute stage splits
+*  the merge path of the row ends and non-zero entries of a CSR matrix evenly across the
+*  threads, independent of the row lengths. It does not require the
+*  \ref rocsparse_spmv_stage_preprocess stage, \p temp_buffer holds the partition and the
+*  partial sums of rows crossing block boundaries. Transposed products and symmetric matrices
+*  are computed with \ref rocsparse_spmv_alg_csr_stream.
 *
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
@@ -21603,6 +22921,17 @@ ROCSPARSE_EXPORT rocsparse_status rocsparse_spmv(rocsparse_handle            han
 *  |-------------------------|--------------------------|--------------------------|
 *  \endverbatim
 *
+*  Mixed half precisions:
+*  \verbatim
+*  |---------------------------|----------------------------|
+*  |             A             |    X / Y / compute_type    |
+*  |---------------------------|----------------------------|
+*  | rocsparse_datatype_f16_r  |  rocsparse_datatype_f32_r  |
+*  |---------------------------|----------------------------|
+*  | rocsparse_datatype_bf16_r |  rocsparse_datatype_f32_r  |
+*  |---------------------------|----------------------------|
+*  \endverbatim
+*
 *  Mixed-regular Complex precisions
 *  \verbatim
 *  |----------------------------|----------------------------|
@@ -21734,6 +23063,21 @@ __attribute__((deprecated("This function is deprecated and will be removed in a
 *  Currently, only \p trans == \ref rocsparse_operation_none and \p trans == \ref rocsparse_operation_transpose is supported.
 *
 *  \note
+*  With \ref rocsparse_spsv_alg_level_set, CSR matrices are solved level by level, where a
+*  level holds the rows that only depend on rows of previous levels. Large levels are solved
+*  by a kernel each, consecutive small levels are solved by a single block that synchronizes
+*  between the levels. The preprocess stage gathers the number of levels and the size of the
+*  largest level, which can be queried with the \ref rocsparse_spmat_spsv_nlevels and
+*  \ref rocsparse_spmat_spsv_max_level_size attributes. The compute stage returns
+*  \ref rocsparse_status_invalid_value if the preprocess stage was run with another
+*  algorithm. Other formats use the default algorithm.
+*
+*  \note
+*  SpSV supports the \ref rocsparse_format_csr, \ref rocsparse_format_coo and \ref rocsparse_format_bsr
+*  formats. BSR matrices require \ref rocsparse_indextype_i32 indices, the block direction is taken
+*  from the matrix descriptor.
+*
+*  \note
 *  Only the \ref rocsparse_spsv_stage_buffer_size stage and the \ref rocsparse_spsv_stage_compute stage
 *  support execution in a hipGraph context. The \ref rocsparse_spsv_stage_preprocess stage does not support hipGraph.
 *
@@ -22069,6 +23413,11 @@ rocsparse_status rocsparse_spitsv(rocsparse_handle            handle,
 *  Currently, only \p trans_B == \ref rocsparse_operation_none and \p trans_B == \ref rocsparse_operation_transpose is supported.
 *
 *  \note
+*  SpSM supports the \ref rocsparse_format_csr, \ref rocsparse_format_coo and \ref rocsparse_format_bsr
+*  formats. BSR matrices require \ref rocsparse_indextype_i32 indices, the block direction is taken
+*  from the matrix descriptor.
+*
+*  \note
 *  Only the \ref rocsparse_spsm_stage_buffer_size stage and the \ref rocsparse_spsm_stage_compute stage
 *  support execution in a hipGraph context. The \ref rocsparse_spsm_stage_preprocess stage does not support hipGraph.
 *
@@ -22327,13 +23676,27 @@ rocsparse_status rocsparse_spsm(rocsparse_handle            handle,
 *  support execution in a hipGraph context. The \ref rocsparse_spmm_stage_preprocess stage does not support hipGraph.
 *
 *  \note
-*  Currently, only CSR, COO and Blocked ELL sparse formats are supported.
+*  Currently, only CSR, CSC, COO, ELL, Blocked ELL and BSR sparse formats are supported.
+*
+*  \note
+*  For the ELL format, batches are set with \ref rocsparse_ell_set_strided_batch, and all
+*  precisions of the COO format are supported. For the BSR format, only rocsparse_indextype_i32
+*  indices, uniform precisions, \p trans_A == \ref rocsparse_operation_none, a single sparse
+*  matrix and \p mat_C in rocsparse_order_column are supported, and \p mat_B in
+*  rocsparse_order_row cannot be conjugate transposed. The \ref rocsparse_spmm_stage_preprocess
+*  stage selects the BSR kernel for the block dimension and the number of columns of \p mat_C.
+*
+*  \note
+*  For CSR, CSC and COO formats, \p mat_A may also hold rocsparse_datatype_f16_r or
+*  rocsparse_datatype_bf16_r values when \p mat_B, \p mat_C and \p compute_type are
+*  rocsparse_datatype_f32_r. The products are accumulated in single precision.
 *
 *  \note
 *  Different algorithms are available which can provide better performance for different matrices.
 *  Currently, the available algorithms are rocsparse_spmm_alg_csr, rocsparse_spmm_alg_csr_row_split
 *  or rocsparse_spmm_alg_csr_merge for CSR matrices, rocsparse_spmm_alg_bell for Blocked ELL matrices and
-*  rocsparse_spmm_alg_coo_segmented or rocsparse_spmm_alg_coo_atomic for COO matrices. Additionally,
+*  rocsparse_spmm_alg_coo_segmented or rocsparse_spmm_alg_coo_atomic for COO matrices and
+*  rocsparse_spmm_alg_bsr for BSR matrices. ELL matrices only use rocsparse_spmm_alg_default. Additionally,
 *  one can specify the algorithm to be rocsparse_spmm_alg_default. In the case of CSR matrices this will
 *  set the algorithm to be rocsparse_spmm_alg_csr, in the case of Blocked ELL matrices this will set the
 *  algorithm to be rocsparse_spmm_alg_bell and for COO matrices it will set the algorithm to be
@@ -22756,6 +24119,12 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *        host. It may return before the actual computation has finished.
 *  \note Please note, that for rare matrix products with more than 4096 non-zero entries
 *  per row, additional temporary storage buffer is allocated by the algorithm.
+*  \note All sparse matrices must share the same data type. \p compute_type must match
+*  this data type, except for CSR matrices of type \ref rocsparse_datatype_f32_r, which
+*  can be multiplied with \p compute_type == \ref rocsparse_datatype_f64_r. Then
+*  \f$\alpha\f$ and \f$\beta\f$ are double precision scalars, the products are
+*  accumulated in double precision and \f$C\f$ is rounded to single precision. This mixed
+*  precision computation is not supported by the \ref rocsparse_spgemm_stage_numeric stage.
 *
 *  \note
 *  This routine does not support execution in a hipGraph context.
@@ -22799,8 +24168,9 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *  \retval rocsparse_status_memory_error additional buffer for long rows could not be
 *          allocated.
 *  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none or
-*          \p trans_B != \ref rocsparse_operation_none.
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none or the combination of data types
+*          and \p compute_type is not supported.
 *
 *  \par Example
 *  \code{.c}
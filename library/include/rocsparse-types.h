@@ -341,7 +341,9 @@ typedef enum rocsparse_hyb_partition_
 {
     rocsparse_hyb_partition_auto = 0, /**< automatically decide on ELL nnz per row. */
     rocsparse_hyb_partition_user = 1, /**< user given ELL nnz per row. */
-    rocsparse_hyb_partition_max  = 2 /**< max ELL nnz per row, no COO part. */
+    rocsparse_hyb_partition_max  = 2, /**< max ELL nnz per row, no COO part. */
+    rocsparse_hyb_partition_cost = 3 /**< ELL nnz per row minimizing the predicted hybmv
+                                           memory traffic, based on the row length histogram. */
 } rocsparse_hyb_partition;
 
 /*! \ingroup types_module
@@ -385,6 +387,24 @@ typedef enum rocsparse_pointer_mode_
     rocsparse_pointer_mode_device = 1 /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates if sizes computed on the device are copied to the host.
+ *
+ *  \details
+ *  The \ref rocsparse_sizes_mode indicates whether the library may copy sizes that it
+ *  computes on the device, such as group sizes or row block counts, back to the host
+ *  and synchronize the stream to read them. With \ref rocsparse_sizes_mode_device,
+ *  the compute stages that support it launch from sizes kept on the device or gathered
+ *  during their analysis stages, and do not synchronize. The \ref rocsparse_sizes_mode
+ *  can be changed by rocsparse_set_sizes_mode(). The currently used sizes mode can be
+ *  obtained by rocsparse_get_sizes_mode().
+ */
+typedef enum rocsparse_sizes_mode_
+{
+    rocsparse_sizes_mode_host   = 0, /**< sizes may be copied to the host. */
+    rocsparse_sizes_mode_device = 1 /**< sizes stay in device memory. */
+} rocsparse_sizes_mode;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -393,10 +413,11 @@ typedef enum rocsparse_pointer_mode_
  */
 typedef enum rocsparse_layer_mode
 {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2, /**< layer is in benchmarking mode. */
-    rocsparse_layer_mode_log_debug = 0x4 /**< layer is in debug mode. */
+    rocsparse_layer_mode_none        = 0x0, /**< layer is not active. */
+    rocsparse_layer_mode_log_trace   = 0x1, /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench   = 0x2, /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_log_debug   = 0x4, /**< layer is in debug mode. */
+    rocsparse_layer_mode_log_profile = 0x8 /**< layer is in profiling mode. */
 } rocsparse_layer_mode;
 
 /*! \ingroup types_module
@@ -464,14 +485,16 @@ typedef enum rocsparse_indextype_
  */
 typedef enum rocsparse_datatype_
 {
-    rocsparse_datatype_f32_r = 151, /**< 32 bit floating point, real. */
-    rocsparse_datatype_f64_r = 152, /**< 64 bit floating point, real. */
-    rocsparse_datatype_f32_c = 154, /**< 32 bit floating point, complex. */
-    rocsparse_datatype_f64_c = 155, /**< 64 bit floating point, complex. */
-    rocsparse_datatype_i8_r  = 160, /**<  8-bit signed integer, real */
-    rocsparse_datatype_u8_r  = 161, /**<  8-bit unsigned integer, real */
-    rocsparse_datatype_i32_r = 162, /**< 32-bit signed integer, real */
-    rocsparse_datatype_u32_r = 163 /**< 32-bit unsigned integer, real */
+    rocsparse_datatype_f16_r  = 150, /**< 16 bit floating point, real. */
+    rocsparse_datatype_f32_r  = 151, /**< 32 bit floating point, real. */
+    rocsparse_datatype_f64_r  = 152, /**< 64 bit floating point, real. */
+    rocsparse_datatype_f32_c  = 154, /**< 32 bit floating point, complex. */
+    rocsparse_datatype_f64_c  = 155, /**< 64 bit floating point, complex. */
+    rocsparse_datatype_i8_r   = 160, /**<  8-bit signed integer, real */
+    rocsparse_datatype_u8_r   = 161, /**<  8-bit unsigned integer, real */
+    rocsparse_datatype_i32_r  = 162, /**< 32-bit signed integer, real */
+    rocsparse_datatype_u32_r  = 163, /**< 32-bit unsigned integer, real */
+    rocsparse_datatype_bf16_r = 168 /**< 16 bit bfloat floating point, real. */
 } rocsparse_datatype;
 
 /*! \ingroup types_module
@@ -510,10 +533,20 @@ typedef enum rocsparse_order_
  */
 typedef enum rocsparse_spmat_attribute_
 {
-    rocsparse_spmat_fill_mode    = 0, /**< Fill mode attribute. */
-    rocsparse_spmat_diag_type    = 1, /**< Diag type attribute. */
-    rocsparse_spmat_matrix_type  = 2, /**< Matrix type attribute. */
-    rocsparse_spmat_storage_mode = 3 /**< Matrix storage attribute. */
+    rocsparse_spmat_fill_mode           = 0, /**< Fill mode attribute. */
+    rocsparse_spmat_diag_type           = 1, /**< Diag type attribute. */
+    rocsparse_spmat_matrix_type         = 2, /**< Matrix type attribute. */
+    rocsparse_spmat_storage_mode        = 3, /**< Matrix storage attribute. */
+    rocsparse_spmat_spmv_alg            = 4, /**< SpMV algorithm selected by
+                                                  \ref rocsparse_spmv_alg_auto (read only). */
+    rocsparse_spmat_spsv_nlevels        = 5, /**< Number of levels of the triangular matrix,
+                                                  gathered in the SpSV preprocess stage
+                                                  (int64_t, read only). */
+    rocsparse_spmat_spsv_max_level_size = 6 /**< Number of rows of the largest level of the
+                                                 triangular matrix, gathered in the SpSV
+                                                 preprocess stage of
+                                                 \ref rocsparse_spsv_alg_level_set, 0 for
+                                                 other algorithms (int64_t, read only). */
 } rocsparse_spmat_attribute;
 
 /*! \ingroup types_module
@@ -545,12 +578,13 @@ typedef enum rocsparse_itilu0_alg_
  */
 typedef enum rocsparse_itilu0_option_
 {
-    rocsparse_itilu0_option_verbose                = 1, /**< Compute a stopping criteria. */
-    rocsparse_itilu0_option_stopping_criteria      = 2, /**< Compute a stopping criteria. */
-    rocsparse_itilu0_option_compute_nrm_correction = 4, /**< Compute correction */
-    rocsparse_itilu0_option_compute_nrm_residual   = 8, /**< Compute residual */
-    rocsparse_itilu0_option_convergence_history    = 16, /**< Log convergence history */
-    rocsparse_itilu0_option_coo_format             = 32 /**< Use internal coordinate format. */
+    rocsparse_itilu0_option_verbose                  = 1, /**< Compute a stopping criteria. */
+    rocsparse_itilu0_option_stopping_criteria        = 2, /**< Compute a stopping criteria. */
+    rocsparse_itilu0_option_compute_nrm_correction   = 4, /**< Compute correction */
+    rocsparse_itilu0_option_compute_nrm_residual     = 8, /**< Compute residual */
+    rocsparse_itilu0_option_convergence_history      = 16, /**< Log convergence history */
+    rocsparse_itilu0_option_coo_format               = 32, /**< Use internal coordinate format. */
+    rocsparse_itilu0_option_device_stopping_criteria = 64 /**< Check the stopping criteria on device. */
 } rocsparse_itilu0_option;
 
 /*! \ingroup types_module
@@ -613,9 +647,15 @@ typedef enum rocsparse_spmv_alg_
     rocsparse_spmv_alg_coo          = 1, /**< COO SpMV algorithm 1 (segmented) for COO matrices. */
     rocsparse_spmv_alg_csr_adaptive = 2, /**< CSR SpMV algorithm 1 (adaptive) for CSR matrices. */
     rocsparse_spmv_alg_csr_stream   = 3, /**< CSR SpMV algorithm 2 (stream) for CSR matrices. */
-    rocsparse_spmv_alg_ell          = 4, /**< ELL SpMV algorithm for ELL matrices. */
+    rocsparse_spmv_alg_ell          = 4, /**< ELL SpMV algorithm for (Blocked) ELL matrices. */
     rocsparse_spmv_alg_coo_atomic   = 5, /**< COO SpMV algorithm 2 (atomic) for COO matrices. */
-    rocsparse_spmv_alg_bsr          = 6 /**< BSR SpMV algorithm 1 for BSR matrices. */
+    rocsparse_spmv_alg_bsr          = 6, /**< BSR SpMV algorithm 1 for BSR matrices. */
+    rocsparse_spmv_alg_auto         = 7, /**< SpMV algorithm selected in the preprocess stage
+                                              from the matrix structure. */
+    rocsparse_spmv_alg_csr_binned   = 8, /**< CSR SpMV algorithm 3 (row length bins) for CSR
+                                              matrices. */
+    rocsparse_spmv_alg_csr_merge    = 9 /**< CSR SpMV algorithm 4 (merge path) for CSR
+                                             matrices. */
 } rocsparse_spmv_alg;
 
 /*! \ingroup types_module
@@ -627,7 +667,8 @@ typedef enum rocsparse_spmv_alg_
  */
 typedef enum rocsparse_spsv_alg_
 {
-    rocsparse_spsv_alg_default = 0, /**< Default SpSV algorithm for the given format. */
+    rocsparse_spsv_alg_default   = 0, /**< Default SpSV algorithm for the given format. */
+    rocsparse_spsv_alg_level_set = 1 /**< Level set SpSV algorithm for CSR matrices. */
 } rocsparse_spsv_alg;
 
 /*! \ingroup types_module
@@ -58,6 +58,114 @@ void hyb_coo_nnz(rocsparse_int        m,
     }
 }
 
+// Histogram of CSR row lengths, clamped to the maximum ELL width. Bins that fit
+// into the block are accumulated in shared memory first.
+template <unsigned int BLOCKSIZE>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void hyb_row_length_histogram(rocsparse_int        m,
+                              rocsparse_int        max_width,
+                              const rocsparse_int* csr_row_ptr,
+                              rocsparse_int*       hist)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ rocsparse_int shist[BLOCKSIZE];
+    shist[tid] = 0;
+
+    __syncthreads();
+
+    if(gid < m)
+    {
+        rocsparse_int row_nnz = min(csr_row_ptr[gid + 1] - csr_row_ptr[gid], max_width);
+
+        if(row_nnz < BLOCKSIZE)
+        {
+            atomicAdd(&shist[row_nnz], 1);
+        }
+        else
+        {
+            atomicAdd(&hist[row_nnz], 1);
+        }
+    }
+
+    __syncthreads();
+
+    if(tid <= max_width && shist[tid] > 0)
+    {
+        atomicAdd(&hist[tid], shist[tid]);
+    }
+}
+
+// Select the ELL width that minimizes the HYB SpMV memory traffic. Extending the
+// ELL part by column k costs m * ell_bytes and saves cnt(k) * coo_bytes, where cnt(k)
+// is the number of rows with at least k entries. Since cnt(k) is non-increasing, the
+// optimal width is the largest k for which the extension still pays off. The suffix
+// sums of the histogram are computed from the top bin downwards by a single block.
+template <unsigned int BLOCKSIZE>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void hyb_cost_ell_width(rocsparse_int        m,
+                        rocsparse_int        max_width,
+                        int64_t              ell_bytes,
+                        int64_t              coo_bytes,
+                        const rocsparse_int* hist,
+                        rocsparse_int*       ell_width)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[BLOCKSIZE];
+    __shared__ rocsparse_int swidth;
+
+    if(tid == 0)
+    {
+        swidth = 0;
+    }
+
+    rocsparse_int carry = 0;
+
+    for(rocsparse_int top = max_width; top > 0; top -= BLOCKSIZE)
+    {
+        rocsparse_int k = top - tid;
+
+        sdata[tid] = (k > 0) ? hist[k] : 0;
+
+        __syncthreads();
+
+        // Inclusive scan over the chunk, bins in descending order
+        for(unsigned int j = 1; j < BLOCKSIZE; j <<= 1)
+        {
+            rocsparse_int t = (tid >= j) ? sdata[tid - j] : 0;
+
+            __syncthreads();
+
+            sdata[tid] += t;
+
+            __syncthreads();
+        }
+
+        rocsparse_int cnt = carry + sdata[tid];
+
+        if(k > 0 && cnt * coo_bytes > m * ell_bytes)
+        {
+            atomicMax(&swidth, k);
+        }
+
+        carry += sdata[BLOCKSIZE - 1];
+
+        __syncthreads();
+
+        if(swidth > 0)
+        {
+            break;
+        }
+    }
+
+    if(tid == 0)
+    {
+        *ell_width = swidth;
+    }
+}
+
 // CSR to HYB format conversion kernel
 template <unsigned int BLOCKSIZE, typename T>
 ROCSPARSE_KERNEL(BLOCKSIZE)
@@ -283,6 +283,10 @@ rocsparse_status rocsparse_bsr2csr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f bsr2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xbsr2csr"), rocsparse_get_datatype<T>(), mb, nb, block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(direction))
     {
@@ -68,6 +68,15 @@ rocsparse_status rocsparse_bsrpad_value_template(rocsparse_handle          handl
     log_bench(
         handle, "./rocsparse-bench -f bsrpad_value -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrpad_value"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     // Check sizes
     if(m < 0 || mb < 0 || nnzb < 0 || block_dim <= 0)
     {
@@ -109,6 +109,9 @@ rocsparse_status rocsparse_coo2csr_impl(rocsparse_handle     handle,
 
     log_bench(handle, "./rocsparse-bench -f coo2csr", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_coo2csr", nnz, m);
+
     if(rocsparse_enum_utils::is_invalid(idx_base))
     {
         return rocsparse_status_invalid_value;
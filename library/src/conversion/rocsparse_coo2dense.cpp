@@ -65,6 +65,10 @@ rocsparse_status rocsparse_coo2dense_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f coo2dense -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcoo2dense"), rocsparse_get_datatype<T>(), m, n, nnz);
+
     // Check matrix descriptor
     if(descr == nullptr)
     {
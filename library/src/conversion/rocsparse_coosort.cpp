@@ -52,6 +52,9 @@ try
               (const void*&)coo_col_ind,
               (const void*&)buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_coosort_buffer_size", m, n, nnz);
+
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
@@ -143,6 +146,9 @@ try
 
     log_bench(handle, "./rocsparse-bench -f coosort", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_coosort_by_row", m, n, nnz);
+
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
@@ -166,6 +166,10 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2bsr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsr2bsr"), rocsparse_get_datatype<T>(), m, n, block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(direction))
     {
@@ -480,6 +484,9 @@ try
 
     log_bench(handle, "./rocsparse-bench -f csr2bsr_nnz", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csr2bsr_nnz", m, n, block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(direction))
     {
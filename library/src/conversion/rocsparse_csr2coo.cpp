@@ -193,6 +193,9 @@ rocsparse_status rocsparse_csr2coo_impl(rocsparse_handle     handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2coo ", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csr2coo", nnz, m);
+
     // Check index base
     if(rocsparse_enum_utils::is_invalid(idx_base))
     {
@@ -276,6 +276,10 @@ rocsparse_status rocsparse_csr2csc_impl(rocsparse_handle     handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2csc -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsr2csc"), rocsparse_get_datatype<T>(), m, n, nnz);
+
     // Check action
     if(rocsparse_enum_utils::is_invalid(copy_values))
     {
@@ -495,6 +499,9 @@ rocsparse_status rocsparse_csr2csc_buffer_size_impl(rocsparse_handle handle,
               copy_values,
               (const void*&)buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csr2csc_buffer_size", m, n, nnz);
+
     // Check action
     if(rocsparse_enum_utils::is_invalid(copy_values))
     {
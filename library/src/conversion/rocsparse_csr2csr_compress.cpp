@@ -69,6 +69,14 @@ rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          h
     log_bench(
         handle, "./rocsparse-bench -f csr2csr_compress -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsr2csr_compress"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                nnz_A);
+
     // Check matrix descriptor
     if(descr_A == nullptr)
     {
@@ -69,6 +69,10 @@ rocsparse_status rocsparse_csr2ell_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2ell -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsr2ell"), rocsparse_get_datatype<T>(), m, ell_width);
+
     // Check matrix type
     if(csr_descr->type != rocsparse_matrix_type_general)
     {
@@ -185,6 +189,9 @@ try
               (const void*&)ell_descr,
               (const void*&)ell_width);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csr2ell_width", m);
+
     // Check matrix type
     if(csr_descr->type != rocsparse_matrix_type_general)
     {
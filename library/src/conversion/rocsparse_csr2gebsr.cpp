@@ -180,6 +180,15 @@ rocsparse_status rocsparse_csr2gebsr_buffer_size_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsr2gebsr_buffer_size"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                row_block_dim,
+                                                col_block_dim);
+
     //
     // Check direction
     //
@@ -294,6 +303,15 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2gebsr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsr2gebsr"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                row_block_dim,
+                                                col_block_dim);
+
     //
     // Check direction
     //
@@ -847,6 +865,10 @@ try
 
     log_bench(handle, "./rocsparse-bench -f csr2gebsr_nnz", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csr2gebsr_nnz", m, n, row_block_dim, col_block_dim);
+
     //
     // Check direction
     //
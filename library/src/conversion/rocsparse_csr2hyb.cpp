@@ -72,6 +72,10 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csr2hyb -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsr2hyb"), rocsparse_get_datatype<T>(), m, n);
+
     // Check matrix type
     if(descr->type != rocsparse_matrix_type_general)
     {
@@ -149,12 +153,13 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     }
 
     // Clear HYB structure if already allocated
-    hyb->m         = m;
-    hyb->n         = n;
-    hyb->partition = partition_type;
-    hyb->ell_nnz   = 0;
-    hyb->ell_width = 0;
-    hyb->coo_nnz   = 0;
+    hyb->m           = m;
+    hyb->n           = n;
+    hyb->partition   = partition_type;
+    hyb->ell_nnz     = 0;
+    hyb->ell_width   = 0;
+    hyb->coo_nnz     = 0;
+    hyb->hybmv_bytes = 0;
 
     if(std::is_same<T, float>{})
     {
@@ -194,6 +199,12 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(hyb->coo_val, handle->stream));
     }
 
+    // Bytes moved by hybmv per ELL slot (column index and value, padding included) and
+    // the additional bytes per COO entry (row and column index, value and the atomic
+    // read-modify-write of y)
+    static constexpr size_t ell_entry_bytes = sizeof(rocsparse_int) + sizeof(T);
+    static constexpr size_t coo_entry_bytes = 2 * sizeof(rocsparse_int) + 3 * sizeof(T);
+
     // Determine ELL width
 
 #define CSR2ELL_DIM 512
@@ -210,6 +221,51 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         // ELL width determined by average nnz per row
         hyb->ell_width = (csr_nnz - 1) / m + 1;
     }
+    else if(partition_type == rocsparse_hyb_partition_cost)
+    {
+        // Allocate workspace for the row length histogram and the resulting width
+        rocsparse_int* workspace = nullptr;
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+            (void**)&workspace, sizeof(rocsparse_int) * (max_row_nnz + 2), handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            workspace, 0, sizeof(rocsparse_int) * (max_row_nnz + 2), handle->stream));
+
+        // Row length histogram, clamped to the maximum ELL width
+        hipLaunchKernelGGL((hyb_row_length_histogram<CSR2ELL_DIM>),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           max_row_nnz,
+                           csr_row_ptr,
+                           workspace);
+
+        // ELL width that minimizes the predicted hybmv traffic
+        hipLaunchKernelGGL((hyb_cost_ell_width<CSR2ELL_DIM>),
+                           dim3(1),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           max_row_nnz,
+                           static_cast<int64_t>(ell_entry_bytes),
+                           static_cast<int64_t>(coo_entry_bytes),
+                           workspace,
+                           workspace + max_row_nnz + 1);
+
+        // Copy ell width back to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hyb->ell_width,
+                                           workspace + max_row_nnz + 1,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(workspace, handle->stream));
+    }
     else
     {
         // Allocate workspace
@@ -371,6 +427,13 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(workspace, handle->stream));
 #undef CSR2ELL_DIM
 
+    // Predicted hybmv memory traffic, including one read of x per non-zero and
+    // one read and write of y per row
+    hyb->hybmv_bytes = static_cast<int64_t>(hyb->ell_nnz) * ell_entry_bytes
+                       + static_cast<int64_t>(hyb->coo_nnz) * coo_entry_bytes
+                       + static_cast<int64_t>(csr_nnz) * sizeof(T)
+                       + static_cast<int64_t>(m) * 2 * sizeof(T);
+
     return rocsparse_status_success;
 }
 
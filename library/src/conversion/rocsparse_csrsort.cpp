@@ -53,6 +53,9 @@ try
               (const void*&)csr_col_ind,
               (const void*&)buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csrsort_buffer_size", m, n, nnz);
+
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
@@ -139,6 +142,9 @@ try
 
     log_bench(handle, "./rocsparse-bench -f csrsort", "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csrsort", m, n, nnz);
+
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
@@ -82,6 +82,14 @@ rocsparse_status rocsparse_csx2dense_impl(rocsparse_handle          handle,
               "--indexbaseA",
               descr->base);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        is_row_oriented ? "rocsparse_csr2dense" : "rocsparse_csc2dense",
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     if(rocsparse_enum_utils::is_invalid(order))
     {
         return rocsparse_status_invalid_value;
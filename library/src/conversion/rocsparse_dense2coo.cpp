@@ -66,6 +66,10 @@ rocsparse_status rocsparse_dense2coo_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f dense2coo -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xdense2coo"), rocsparse_get_datatype<T>(), m, n);
+
     // Check order
     if(rocsparse_enum_utils::is_invalid(order))
     {
@@ -85,6 +85,14 @@ rocsparse_status rocsparse_dense2csx_impl(rocsparse_handle          handle,
               "--indexbaseA",
               descr_A->base);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        is_row_oriented ? "rocsparse_dense2csr" : "rocsparse_dense2csc",
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     // Check order
     if(rocsparse_enum_utils::is_invalid(order))
     {
@@ -72,6 +72,10 @@ rocsparse_status rocsparse_ell2csr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f ell2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xell2csr"), rocsparse_get_datatype<T>(), m, n, ell_width);
+
     // Check matrix type
     if(ell_descr->type != rocsparse_matrix_type_general)
     {
@@ -195,6 +199,9 @@ try
               (const void*&)csr_row_ptr,
               (const void*&)csr_nnz);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_ell2csr_nnz", m, n, ell_width);
+
     // Check matrix type
     if(ell_descr->type != rocsparse_matrix_type_general)
     {
@@ -411,6 +411,15 @@ rocsparse_status rocsparse_gebsr2csr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f gebsr2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xgebsr2csr"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nb,
+                                                row_block_dim,
+                                                col_block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(direction))
     {
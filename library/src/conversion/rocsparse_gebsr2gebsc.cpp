@@ -74,6 +74,16 @@ rocsparse_status rocsparse_gebsr2gebsc_template(rocsparse_handle     handle,
     log_bench(
         handle, "./rocsparse-bench -f gebsr2gebsc -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xgebsr2gebsc"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                row_block_dim,
+                                                col_block_dim);
+
     // Check rocsparse_action
     if(rocsparse_enum_utils::is_invalid(copy_values))
     {
@@ -308,6 +318,16 @@ rocsparse_status rocsparse_gebsr2gebsc_buffer_size_template(rocsparse_handle
               col_block_dim,
               (const void*&)p_buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                "rocsparse_gebsr2gebsc_buffer_size",
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                row_block_dim,
+                                                col_block_dim);
+
     // Check sizes
     if(mb < 0 || nb < 0 || nnzb < 0 || row_block_dim <= 0 || col_block_dim <= 0)
     {
@@ -105,6 +105,14 @@ rocsparse_status rocsparse_gebsr2gebsr_buffer_size_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xgebsr2csr_buffer_size"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nb,
+                                                nnzb);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
@@ -244,6 +252,10 @@ rocsparse_status rocsparse_gebsr2gebsr_template(rocsparse_handle          handle
     log_bench(
         handle, "./rocsparse-bench -f gebsr2gebsr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xgebsr2gebsr"), rocsparse_get_datatype<T>(), mb, nb, nnzb);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
@@ -747,6 +759,9 @@ try
               (const void*&)nnz_total_dev_host_ptr,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_gebsr2gebsr_nnz", mb, nb, nnzb);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
@@ -64,6 +64,10 @@ rocsparse_status rocsparse_hyb2csr_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f hyb2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xhyb2csr"), rocsparse_get_datatype<T>());
+
     // Check matrix type
     if(descr->type != rocsparse_matrix_type_general)
     {
@@ -226,6 +230,9 @@ try
               (const void*&)csr_row_ptr,
               (const void*&)buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_hyb2csr_buffer_size");
+
     // Check matrix type
     if(descr->type != rocsparse_matrix_type_general)
     {
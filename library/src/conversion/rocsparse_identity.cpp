@@ -68,6 +68,9 @@ rocsparse_status rocsparse_create_identity_permutation_impl(rocsparse_handle han
 
     log_bench(handle, "./rocsparse-bench -f identity", "-n", n);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_create_identity_permutation", n);
+
     // Check sizes
     if(n < 0)
     {
@@ -103,6 +103,9 @@ rocsparse_status rocsparse_inverse_permutation_impl(rocsparse_handle handle_,
         handle_, "rocsparse_inverse_permutation", n_, (const void*&)p_, (const void*&)q_, base_);
     log_bench(handle_, "./rocsparse-bench -f inverse_permutation", "-n", n_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_inverse_permutation");
+
     // Check sizes
     if(n_ < 0)
     {
@@ -157,6 +157,10 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
     log_bench(
         handle, "./rocsparse_bench", "-f", "nnz", "--dir", dir, "-m", m, "-n", n, "--denseld", ld);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_nnz", rocsparse_get_datatype<T>(), m, n);
+
     //
     // Check validity of the direction.
     //
@@ -76,6 +76,10 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     log_bench(
         handle, "./rocsparse-bench -f nnz_compress -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xnnz_compress"), rocsparse_get_datatype<T>(), m);
+
     // Check matrix descriptor
     if(descr_A == nullptr)
     {
@@ -171,6 +171,15 @@ rocsparse_status rocsparse_prune_csr2csr_buffer_size_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_csr2csr_buffer_size"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n,
+        nnz_A);
+
     // Check matrix descriptor
     if(csr_descr_A == nullptr || csr_descr_C == nullptr)
     {
@@ -265,6 +274,14 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xprune_csr2csr_nnz"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                nnz_A);
+
     // Check matrix descriptor
     if(csr_descr_A == nullptr || csr_descr_C == nullptr)
     {
@@ -443,6 +460,10 @@ rocsparse_status rocsparse_prune_csr2csr_template(rocsparse_handle          hand
     log_bench(
         handle, "./rocsparse-bench -f prune_csr2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xprune_csr2csr"), rocsparse_get_datatype<T>(), m, n, nnz_A);
+
     // Check matrix descriptor
     if(csr_descr_A == nullptr || csr_descr_C == nullptr)
     {
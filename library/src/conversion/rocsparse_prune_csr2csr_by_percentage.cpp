@@ -180,6 +180,15 @@ rocsparse_status rocsparse_prune_csr2csr_by_percentage_buffer_size_template(
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_csr2csr_by_percentage_buffer_size"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n,
+        nnz_A);
+
     // Check matrix sorting mode
     if(csr_descr_A->storage_mode != rocsparse_storage_mode_sorted)
     {
@@ -272,6 +281,15 @@ rocsparse_status
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_csr2csr_nnz_by_percentage"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n,
+        nnz_A);
+
     // Check matrix descriptor
     if(csr_descr_A == nullptr || csr_descr_C == nullptr || info == nullptr)
     {
@@ -501,6 +519,15 @@ rocsparse_status
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_csr2csr_by_percentage"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n,
+        nnz_A);
+
     // Check matrix descriptor
     if(csr_descr_A == nullptr || csr_descr_C == nullptr || info == nullptr)
     {
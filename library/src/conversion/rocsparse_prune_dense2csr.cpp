@@ -104,6 +104,14 @@ rocsparse_status rocsparse_prune_dense2csr_buffer_size_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_dense2csr_buffer_size"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     // Check matrix sorting mode
     if(descr->storage_mode != rocsparse_storage_mode_sorted)
     {
@@ -170,6 +178,10 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xprune_dense2csr_nnz"), rocsparse_get_datatype<T>(), m, n);
+
     // Check matrix descriptor
     if(descr == nullptr)
     {
@@ -372,6 +384,10 @@ rocsparse_status rocsparse_prune_dense2csr_template(rocsparse_handle          ha
     log_bench(
         handle, "./rocsparse-bench -f prune_dense2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xprune_dense2csr"), rocsparse_get_datatype<T>(), m, n);
+
     // Check matrix descriptor
     if(descr == nullptr)
     {
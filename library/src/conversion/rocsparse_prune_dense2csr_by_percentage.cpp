@@ -106,6 +106,14 @@ rocsparse_status
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_dense2csr_by_percentage_buffer_size"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     // Check matrix sorting mode
     if(descr->storage_mode != rocsparse_storage_mode_sorted)
     {
@@ -175,6 +183,14 @@ rocsparse_status
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_dense2csr_nnz_by_percentage"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     // Check matrix descriptor
     if(descr == nullptr || info == nullptr)
     {
@@ -417,6 +433,14 @@ rocsparse_status rocsparse_prune_dense2csr_by_percentage_template(rocsparse_hand
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle,
+        replaceX<T>("rocsparse_Xprune_dense2csr_by_percentage"),
+        rocsparse_get_datatype<T>(),
+        m,
+        n);
+
     // Check matrix descriptor
     if(descr == nullptr || info == nullptr)
     {
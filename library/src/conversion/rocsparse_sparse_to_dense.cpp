@@ -172,6 +172,9 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_sparse_dense");
+
     // Check alg
     if(rocsparse_enum_utils::is_invalid(alg))
     {
@@ -53,9 +53,9 @@ void csrgemm_copy(I size,
     out[idx] = in[idx] - idx_base_in + idx_base_out;
 }
 
-// Copy and scale an array
-template <unsigned int BLOCKSIZE, typename I, typename T>
-ROCSPARSE_DEVICE_ILF void csrgemm_copy_scale_device(I size, T alpha, const T* in, T* out)
+// Copy and scale an array, the scaling is computed in the precision of alpha
+template <unsigned int BLOCKSIZE, typename I, typename T, typename A>
+ROCSPARSE_DEVICE_ILF void csrgemm_copy_scale_device(I size, T alpha, const A* in, A* out)
 {
     I idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
 
@@ -64,7 +64,7 @@ ROCSPARSE_DEVICE_ILF void csrgemm_copy_scale_device(I size, T alpha, const T* in
         return;
     }
 
-    out[idx] = alpha * in[idx];
+    out[idx] = static_cast<A>(alpha * in[idx]);
 }
 
 // Compute number of intermediate products of each row
@@ -407,22 +407,21 @@ template <unsigned int BLOCKSIZE,
           unsigned int HASHVAL,
           typename I,
           typename J>
-ROCSPARSE_KERNEL(BLOCKSIZE)
-void csrgemm_nnz_wf_per_row(J m,
-                            const J* __restrict__ offset,
-                            const J* __restrict__ perm,
-                            const I* __restrict__ csr_row_ptr_A,
-                            const J* __restrict__ csr_col_ind_A,
-                            const I* __restrict__ csr_row_ptr_B,
-                            const J* __restrict__ csr_col_ind_B,
-                            const I* __restrict__ csr_row_ptr_D,
-                            const J* __restrict__ csr_col_ind_D,
-                            I* __restrict__ row_nnz,
-                            rocsparse_index_base idx_base_A,
-                            rocsparse_index_base idx_base_B,
-                            rocsparse_index_base idx_base_D,
-                            bool                 mul,
-                            bool                 add)
+ROCSPARSE_DEVICE_ILF void csrgemm_nnz_wf_per_row_device(J m,
+                                                        const J* __restrict__ offset,
+                                                        const J* __restrict__ perm,
+                                                        const I* __restrict__ csr_row_ptr_A,
+                                                        const J* __restrict__ csr_col_ind_A,
+                                                        const I* __restrict__ csr_row_ptr_B,
+                                                        const J* __restrict__ csr_col_ind_B,
+                                                        const I* __restrict__ csr_row_ptr_D,
+                                                        const J* __restrict__ csr_col_ind_D,
+                                                        I* __restrict__ row_nnz,
+                                                        rocsparse_index_base idx_base_A,
+                                                        rocsparse_index_base idx_base_B,
+                                                        rocsparse_index_base idx_base_D,
+                                                        bool                 mul,
+                                                        bool                 add)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -510,7 +509,9 @@ void csrgemm_nnz_wf_per_row(J m,
     }
 }
 
-// Compute non-zero entries per row, where each row is processed by a single block
+// Compute non-zero entries per row of a row group, where each row is processed by a single
+// wavefront. Without group_end, the grid covers the m rows of the group. Otherwise, the
+// size of the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -518,20 +519,73 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J>
 ROCSPARSE_KERNEL(BLOCKSIZE)
-void csrgemm_nnz_block_per_row(const J* __restrict__ offset,
-                               const J* __restrict__ perm,
-                               const I* __restrict__ csr_row_ptr_A,
-                               const J* __restrict__ csr_col_ind_A,
-                               const I* __restrict__ csr_row_ptr_B,
-                               const J* __restrict__ csr_col_ind_B,
-                               const I* __restrict__ csr_row_ptr_D,
-                               const J* __restrict__ csr_col_ind_D,
-                               I* __restrict__ row_nnz,
-                               rocsparse_index_base idx_base_A,
-                               rocsparse_index_base idx_base_B,
-                               rocsparse_index_base idx_base_D,
-                               bool                 mul,
-                               bool                 add)
+void csrgemm_nnz_wf_per_row(J m,
+                            const J* __restrict__ offset,
+                            const J* __restrict__ group_end,
+                            const J* __restrict__ perm,
+                            const I* __restrict__ csr_row_ptr_A,
+                            const J* __restrict__ csr_col_ind_A,
+                            const I* __restrict__ csr_row_ptr_B,
+                            const J* __restrict__ csr_col_ind_B,
+                            const I* __restrict__ csr_row_ptr_D,
+                            const J* __restrict__ csr_col_ind_D,
+                            I* __restrict__ row_nnz,
+                            rocsparse_index_base idx_base_A,
+                            rocsparse_index_base idx_base_B,
+                            rocsparse_index_base idx_base_D,
+                            bool                 mul,
+                            bool                 add)
+{
+    J size   = (group_end != nullptr) ? *group_end - *offset : m;
+    J rows   = BLOCKSIZE / WFSIZE;
+    J stride = static_cast<J>(hipGridDim_x) * rows;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) * rows + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_nnz_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(size - shift,
+                                                                            &group_offset,
+                                                                            perm,
+                                                                            csr_row_ptr_A,
+                                                                            csr_col_ind_A,
+                                                                            csr_row_ptr_B,
+                                                                            csr_col_ind_B,
+                                                                            csr_row_ptr_D,
+                                                                            csr_col_ind_D,
+                                                                            row_nnz,
+                                                                            idx_base_A,
+                                                                            idx_base_B,
+                                                                            idx_base_D,
+                                                                            mul,
+                                                                            add);
+
+        // Wait for all wavefronts to release their hash tables
+        __syncthreads();
+    }
+}
+
+// Compute non-zero entries per row, where each row is processed by a single block
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          typename I,
+          typename J>
+ROCSPARSE_DEVICE_ILF void csrgemm_nnz_block_per_row_device(const J* __restrict__ offset,
+                                                           const J* __restrict__ perm,
+                                                           const I* __restrict__ csr_row_ptr_A,
+                                                           const J* __restrict__ csr_col_ind_A,
+                                                           const I* __restrict__ csr_row_ptr_B,
+                                                           const J* __restrict__ csr_col_ind_B,
+                                                           const I* __restrict__ csr_row_ptr_D,
+                                                           const J* __restrict__ csr_col_ind_D,
+                                                           I* __restrict__ row_nnz,
+                                                           rocsparse_index_base idx_base_A,
+                                                           rocsparse_index_base idx_base_B,
+                                                           rocsparse_index_base idx_base_D,
+                                                           bool                 mul,
+                                                           bool                 add)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -625,6 +679,59 @@ void csrgemm_nnz_block_per_row(const J* __restrict__ offset,
     }
 }
 
+// Compute non-zero entries per row of a row group, where each row is processed by a single
+// block. Without group_end, there is a block per row of the group. Otherwise, the size of
+// the group is only known on the device and the blocks stride over its rows.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          typename I,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrgemm_nnz_block_per_row(const J* __restrict__ offset,
+                               const J* __restrict__ group_end,
+                               const J* __restrict__ perm,
+                               const I* __restrict__ csr_row_ptr_A,
+                               const J* __restrict__ csr_col_ind_A,
+                               const I* __restrict__ csr_row_ptr_B,
+                               const J* __restrict__ csr_col_ind_B,
+                               const I* __restrict__ csr_row_ptr_D,
+                               const J* __restrict__ csr_col_ind_D,
+                               I* __restrict__ row_nnz,
+                               rocsparse_index_base idx_base_A,
+                               rocsparse_index_base idx_base_B,
+                               rocsparse_index_base idx_base_D,
+                               bool                 mul,
+                               bool                 add)
+{
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_nnz_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(&group_offset,
+                                                                               perm,
+                                                                               csr_row_ptr_A,
+                                                                               csr_col_ind_A,
+                                                                               csr_row_ptr_B,
+                                                                               csr_col_ind_B,
+                                                                               csr_row_ptr_D,
+                                                                               csr_col_ind_D,
+                                                                               row_nnz,
+                                                                               idx_base_A,
+                                                                               idx_base_B,
+                                                                               idx_base_D,
+                                                                               mul,
+                                                                               add);
+
+        // Wait for the hash table to be released
+        __syncthreads();
+    }
+}
+
 // Compute non-zero entries per row, where each row is processed by a single block.
 // Splitting row into several chunks such that we can use shared memory to store whether
 // a column index is populated or not.
@@ -634,23 +741,23 @@ template <unsigned int BLOCKSIZE,
           unsigned int CHUNKSIZE,
           typename I,
           typename J>
-ROCSPARSE_KERNEL(BLOCKSIZE)
-void csrgemm_nnz_block_per_row_multipass(J n,
-                                         const J* __restrict__ offset,
-                                         const J* __restrict__ perm,
-                                         const I* __restrict__ csr_row_ptr_A,
-                                         const J* __restrict__ csr_col_ind_A,
-                                         const I* __restrict__ csr_row_ptr_B,
-                                         const J* __restrict__ csr_col_ind_B,
-                                         const I* __restrict__ csr_row_ptr_D,
-                                         const J* __restrict__ csr_col_ind_D,
-                                         I* __restrict__ row_nnz,
-                                         I* __restrict__ workspace_B,
-                                         rocsparse_index_base idx_base_A,
-                                         rocsparse_index_base idx_base_B,
-                                         rocsparse_index_base idx_base_D,
-                                         bool                 mul,
-                                         bool                 add)
+ROCSPARSE_DEVICE_ILF void
+    csrgemm_nnz_block_per_row_multipass_device(J n,
+                                               const J* __restrict__ offset,
+                                               const J* __restrict__ perm,
+                                               const I* __restrict__ csr_row_ptr_A,
+                                               const J* __restrict__ csr_col_ind_A,
+                                               const I* __restrict__ csr_row_ptr_B,
+                                               const J* __restrict__ csr_col_ind_B,
+                                               const I* __restrict__ csr_row_ptr_D,
+                                               const J* __restrict__ csr_col_ind_D,
+                                               I* __restrict__ row_nnz,
+                                               I* __restrict__ workspace_B,
+                                               rocsparse_index_base idx_base_A,
+                                               rocsparse_index_base idx_base_B,
+                                               rocsparse_index_base idx_base_D,
+                                               bool                 mul,
+                                               bool                 add)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -836,6 +943,63 @@ void csrgemm_nnz_block_per_row_multipass(J n,
     }
 }
 
+// Compute non-zero entries per row of the last row group, where each row is processed by a
+// single block in multiple passes. Without group_end, there is a block per row of the group.
+// Otherwise, the size of the group is only known on the device and the blocks stride over
+// its rows.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          typename I,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrgemm_nnz_block_per_row_multipass(J n,
+                                         const J* __restrict__ offset,
+                                         const J* __restrict__ group_end,
+                                         const J* __restrict__ perm,
+                                         const I* __restrict__ csr_row_ptr_A,
+                                         const J* __restrict__ csr_col_ind_A,
+                                         const I* __restrict__ csr_row_ptr_B,
+                                         const J* __restrict__ csr_col_ind_B,
+                                         const I* __restrict__ csr_row_ptr_D,
+                                         const J* __restrict__ csr_col_ind_D,
+                                         I* __restrict__ row_nnz,
+                                         I* __restrict__ workspace_B,
+                                         rocsparse_index_base idx_base_A,
+                                         rocsparse_index_base idx_base_B,
+                                         rocsparse_index_base idx_base_D,
+                                         bool                 mul,
+                                         bool                 add)
+{
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_nnz_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(n,
+                                                                                 &group_offset,
+                                                                                 perm,
+                                                                                 csr_row_ptr_A,
+                                                                                 csr_col_ind_A,
+                                                                                 csr_row_ptr_B,
+                                                                                 csr_col_ind_B,
+                                                                                 csr_row_ptr_D,
+                                                                                 csr_col_ind_D,
+                                                                                 row_nnz,
+                                                                                 workspace_B,
+                                                                                 idx_base_A,
+                                                                                 idx_base_B,
+                                                                                 idx_base_D,
+                                                                                 mul,
+                                                                                 add);
+
+        // Wait for the row nnz to be written before the shared memory is reset
+        __syncthreads();
+    }
+}
+
 // Compute column entries and accumulate values, where each row is processed by a single wavefront
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
@@ -843,7 +1007,8 @@ template <unsigned int BLOCKSIZE,
           unsigned int HASHVAL,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A>
 ROCSPARSE_DEVICE_ILF void csrgemm_fill_wf_per_row_device(J m,
                                                          J nk,
                                                          const J* __restrict__ offset,
@@ -851,17 +1016,17 @@ ROCSPARSE_DEVICE_ILF void csrgemm_fill_wf_per_row_device(J m,
                                                          T alpha,
                                                          const I* __restrict__ csr_row_ptr_A,
                                                          const J* __restrict__ csr_col_ind_A,
-                                                         const T* __restrict__ csr_val_A,
+                                                         const A* __restrict__ csr_val_A,
                                                          const I* __restrict__ csr_row_ptr_B,
                                                          const J* __restrict__ csr_col_ind_B,
-                                                         const T* __restrict__ csr_val_B,
+                                                         const A* __restrict__ csr_val_B,
                                                          T beta,
                                                          const I* __restrict__ csr_row_ptr_D,
                                                          const J* __restrict__ csr_col_ind_D,
-                                                         const T* __restrict__ csr_val_D,
+                                                         const A* __restrict__ csr_val_D,
                                                          const I* __restrict__ csr_row_ptr_C,
                                                          J* __restrict__ csr_col_ind_C,
-                                                         T* __restrict__ csr_val_C,
+                                                         A* __restrict__ csr_val_C,
                                                          rocsparse_index_base idx_base_A,
                                                          rocsparse_index_base idx_base_B,
                                                          rocsparse_index_base idx_base_C,
@@ -989,7 +1154,7 @@ ROCSPARSE_DEVICE_ILF void csrgemm_fill_wf_per_row_device(J m,
 
         // Write column and accumulated value to the obtained position in C
         csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = data[i];
+        csr_val_C[idx_C]     = static_cast<A>(data[i]);
     }
 }
 
@@ -1000,24 +1165,25 @@ template <unsigned int BLOCKSIZE,
           unsigned int HASHVAL,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A>
 ROCSPARSE_DEVICE_ILF void csrgemm_fill_block_per_row_device(J nk,
                                                             const J* __restrict__ offset_,
                                                             const J* __restrict__ perm,
                                                             T alpha,
                                                             const I* __restrict__ csr_row_ptr_A,
                                                             const J* __restrict__ csr_col_ind_A,
-                                                            const T* __restrict__ csr_val_A,
+                                                            const A* __restrict__ csr_val_A,
                                                             const I* __restrict__ csr_row_ptr_B,
                                                             const J* __restrict__ csr_col_ind_B,
-                                                            const T* __restrict__ csr_val_B,
+                                                            const A* __restrict__ csr_val_B,
                                                             T beta,
                                                             const I* __restrict__ csr_row_ptr_D,
                                                             const J* __restrict__ csr_col_ind_D,
-                                                            const T* __restrict__ csr_val_D,
+                                                            const A* __restrict__ csr_val_D,
                                                             const I* __restrict__ csr_row_ptr_C,
                                                             J* __restrict__ csr_col_ind_C,
-                                                            T* __restrict__ csr_val_C,
+                                                            A* __restrict__ csr_val_C,
                                                             rocsparse_index_base idx_base_A,
                                                             rocsparse_index_base idx_base_B,
                                                             rocsparse_index_base idx_base_C,
@@ -1197,7 +1363,7 @@ ROCSPARSE_DEVICE_ILF void csrgemm_fill_block_per_row_device(J nk,
 
         // Write column and accumulated value to the obtain position in C
         csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = val_C;
+        csr_val_C[idx_C]     = static_cast<A>(val_C);
     }
 }
 
@@ -1210,7 +1376,8 @@ template <unsigned int BLOCKSIZE,
           unsigned int CHUNKSIZE,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A>
 ROCSPARSE_DEVICE_ILF void
     csrgemm_fill_block_per_row_multipass_device(J n,
                                                 const J* __restrict__ offset_,
@@ -1218,17 +1385,17 @@ ROCSPARSE_DEVICE_ILF void
                                                 T alpha,
                                                 const I* __restrict__ csr_row_ptr_A,
                                                 const J* __restrict__ csr_col_ind_A,
-                                                const T* __restrict__ csr_val_A,
+                                                const A* __restrict__ csr_val_A,
                                                 const I* __restrict__ csr_row_ptr_B,
                                                 const J* __restrict__ csr_col_ind_B,
-                                                const T* __restrict__ csr_val_B,
+                                                const A* __restrict__ csr_val_B,
                                                 T beta,
                                                 const I* __restrict__ csr_row_ptr_D,
                                                 const J* __restrict__ csr_col_ind_D,
-                                                const T* __restrict__ csr_val_D,
+                                                const A* __restrict__ csr_val_D,
                                                 const I* __restrict__ csr_row_ptr_C,
                                                 J* __restrict__ csr_col_ind_C,
-                                                T* __restrict__ csr_val_C,
+                                                A* __restrict__ csr_val_C,
                                                 I* __restrict__ workspace_B,
                                                 rocsparse_index_base idx_base_A,
                                                 rocsparse_index_base idx_base_B,
@@ -1450,7 +1617,7 @@ ROCSPARSE_DEVICE_ILF void
             if(has_nnz)
             {
                 csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
-                csr_val_C[idx]     = value;
+                csr_val_C[idx]     = static_cast<A>(value);
             }
 
             // Last thread in block writes the block-wide offset into C such that all subsequent
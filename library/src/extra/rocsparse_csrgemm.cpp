@@ -34,9 +34,10 @@ template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL,
+          typename T,
           typename I,
           typename J,
-          typename T,
+          typename A,
           typename U>
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_fill_wf_per_row(J m,
@@ -46,17 +47,17 @@ void csrgemm_fill_wf_per_row(J m,
                              U alpha_device_host,
                              const I* __restrict__ csr_row_ptr_A,
                              const J* __restrict__ csr_col_ind_A,
-                             const T* __restrict__ csr_val_A,
+                             const A* __restrict__ csr_val_A,
                              const I* __restrict__ csr_row_ptr_B,
                              const J* __restrict__ csr_col_ind_B,
-                             const T* __restrict__ csr_val_B,
+                             const A* __restrict__ csr_val_B,
                              U beta_device_host,
                              const I* __restrict__ csr_row_ptr_D,
                              const J* __restrict__ csr_col_ind_D,
-                             const T* __restrict__ csr_val_D,
+                             const A* __restrict__ csr_val_D,
                              const I* __restrict__ csr_row_ptr_C,
                              J* __restrict__ csr_col_ind_C,
-                             T* __restrict__ csr_val_C,
+                             A* __restrict__ csr_val_C,
                              rocsparse_index_base idx_base_A,
                              rocsparse_index_base idx_base_B,
                              rocsparse_index_base idx_base_C,
@@ -95,9 +96,10 @@ template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL,
+          typename T,
           typename I,
           typename J,
-          typename T,
+          typename A,
           typename U>
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_fill_block_per_row(J nk,
@@ -106,17 +108,17 @@ void csrgemm_fill_block_per_row(J nk,
                                 U alpha_device_host,
                                 const I* __restrict__ csr_row_ptr_A,
                                 const J* __restrict__ csr_col_ind_A,
-                                const T* __restrict__ csr_val_A,
+                                const A* __restrict__ csr_val_A,
                                 const I* __restrict__ csr_row_ptr_B,
                                 const J* __restrict__ csr_col_ind_B,
-                                const T* __restrict__ csr_val_B,
+                                const A* __restrict__ csr_val_B,
                                 U beta_device_host,
                                 const I* __restrict__ csr_row_ptr_D,
                                 const J* __restrict__ csr_col_ind_D,
-                                const T* __restrict__ csr_val_D,
+                                const A* __restrict__ csr_val_D,
                                 const I* __restrict__ csr_row_ptr_C,
                                 J* __restrict__ csr_col_ind_C,
-                                T* __restrict__ csr_val_C,
+                                A* __restrict__ csr_val_C,
                                 rocsparse_index_base idx_base_A,
                                 rocsparse_index_base idx_base_B,
                                 rocsparse_index_base idx_base_C,
@@ -153,9 +155,10 @@ void csrgemm_fill_block_per_row(J nk,
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int CHUNKSIZE,
+          typename T,
           typename I,
           typename J,
-          typename T,
+          typename A,
           typename U>
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_fill_block_per_row_multipass(J n,
@@ -164,17 +167,17 @@ void csrgemm_fill_block_per_row_multipass(J n,
                                           U alpha_device_host,
                                           const I* __restrict__ csr_row_ptr_A,
                                           const J* __restrict__ csr_col_ind_A,
-                                          const T* __restrict__ csr_val_A,
+                                          const A* __restrict__ csr_val_A,
                                           const I* __restrict__ csr_row_ptr_B,
                                           const J* __restrict__ csr_col_ind_B,
-                                          const T* __restrict__ csr_val_B,
+                                          const A* __restrict__ csr_val_B,
                                           U beta_device_host,
                                           const I* __restrict__ csr_row_ptr_D,
                                           const J* __restrict__ csr_col_ind_D,
-                                          const T* __restrict__ csr_val_D,
+                                          const A* __restrict__ csr_val_D,
                                           const I* __restrict__ csr_row_ptr_C,
                                           J* __restrict__ csr_col_ind_C,
-                                          T* __restrict__ csr_val_C,
+                                          A* __restrict__ csr_val_C,
                                           I* __restrict__ workspace_B,
                                           rocsparse_index_base idx_base_A,
                                           rocsparse_index_base idx_base_B,
@@ -212,9 +215,10 @@ void csrgemm_fill_block_per_row_multipass(J n,
 
 // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
 // if I == J == int64_t, as required size would exceed available memory
-template <typename I,
+template <typename T,
+          typename I,
           typename J,
-          typename T,
+          typename A,
           typename U,
           typename std::enable_if<
               std::is_same<T, rocsparse_double_complex>::value
@@ -234,17 +238,17 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 U                    alpha_device_host,
                                                 const I*             csr_row_ptr_A,
                                                 const J*             csr_col_ind_A,
-                                                const T*             csr_val_A,
+                                                const A*             csr_val_A,
                                                 const I*             csr_row_ptr_B,
                                                 const J*             csr_col_ind_B,
-                                                const T*             csr_val_B,
+                                                const A*             csr_val_B,
                                                 U                    beta_device_host,
                                                 const I*             csr_row_ptr_D,
                                                 const J*             csr_col_ind_D,
-                                                const T*             csr_val_D,
+                                                const A*             csr_val_D,
                                                 const I*             csr_row_ptr_C,
                                                 J*                   csr_col_ind_C,
-                                                T*                   csr_val_C,
+                                                A*                   csr_val_C,
                                                 rocsparse_index_base base_A,
                                                 rocsparse_index_base base_B,
                                                 rocsparse_index_base base_C,
@@ -255,9 +259,10 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_internal_error;
 }
 
-template <typename I,
+template <typename T,
+          typename I,
           typename J,
-          typename T,
+          typename A,
           typename U,
           typename std::enable_if<
               std::is_same<T, float>::value
@@ -277,17 +282,17 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 U                    alpha_device_host,
                                                 const I*             csr_row_ptr_A,
                                                 const J*             csr_col_ind_A,
-                                                const T*             csr_val_A,
+                                                const A*             csr_val_A,
                                                 const I*             csr_row_ptr_B,
                                                 const J*             csr_col_ind_B,
-                                                const T*             csr_val_B,
+                                                const A*             csr_val_B,
                                                 U                    beta_device_host,
                                                 const I*             csr_row_ptr_D,
                                                 const J*             csr_col_ind_D,
-                                                const T*             csr_val_D,
+                                                const A*             csr_val_D,
                                                 const I*             csr_row_ptr_C,
                                                 J*                   csr_col_ind_C,
-                                                T*                   csr_val_C,
+                                                A*                   csr_val_C,
                                                 rocsparse_index_base base_A,
                                                 rocsparse_index_base base_B,
                                                 rocsparse_index_base base_C,
@@ -298,35 +303,38 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 64
 #define CSRGEMM_HASHSIZE 4096
-    hipLaunchKernelGGL(
-        (csrgemm_fill_block_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_FLL_HASH>),
-        dim3(group_size),
-        dim3(CSRGEMM_DIM),
-        0,
-        handle->stream,
-        std::max(k, n),
-        group_offset,
-        perm,
-        alpha_device_host,
-        csr_row_ptr_A,
-        csr_col_ind_A,
-        csr_val_A,
-        csr_row_ptr_B,
-        csr_col_ind_B,
-        csr_val_B,
-        beta_device_host,
-        csr_row_ptr_D,
-        csr_col_ind_D,
-        csr_val_D,
-        csr_row_ptr_C,
-        csr_col_ind_C,
-        csr_val_C,
-        base_A,
-        base_B,
-        base_C,
-        base_D,
-        mul,
-        add);
+    hipLaunchKernelGGL((csrgemm_fill_block_per_row<CSRGEMM_DIM,
+                                                   CSRGEMM_SUB,
+                                                   CSRGEMM_HASHSIZE,
+                                                   CSRGEMM_FLL_HASH,
+                                                   T>),
+                       dim3(group_size),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       handle->stream,
+                       std::max(k, n),
+                       group_offset,
+                       perm,
+                       alpha_device_host,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_val_B,
+                       beta_device_host,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_val_D,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       base_A,
+                       base_B,
+                       base_C,
+                       base_D,
+                       mul,
+                       add);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -334,7 +342,7 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T, typename U>
+template <typename T, typename I, typename J, typename A, typename U>
 static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle    handle,
                                                                rocsparse_operation trans_A,
                                                                rocsparse_operation trans_B,
@@ -344,22 +352,22 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                U alpha_device_host,
                                                                const rocsparse_mat_descr descr_A,
                                                                I                         nnz_A,
-                                                               const T*                  csr_val_A,
+                                                               const A*                  csr_val_A,
                                                                const I* csr_row_ptr_A,
                                                                const J* csr_col_ind_A,
                                                                const rocsparse_mat_descr descr_B,
                                                                I                         nnz_B,
-                                                               const T*                  csr_val_B,
+                                                               const A*                  csr_val_B,
                                                                const I* csr_row_ptr_B,
                                                                const J* csr_col_ind_B,
                                                                U        beta_device_host,
                                                                const rocsparse_mat_descr descr_D,
                                                                I                         nnz_D,
-                                                               const T*                  csr_val_D,
+                                                               const A*                  csr_val_D,
                                                                const I* csr_row_ptr_D,
                                                                const J* csr_col_ind_D,
                                                                const rocsparse_mat_descr descr_C,
-                                                               T*                        csr_val_C,
+                                                               A*                        csr_val_C,
                                                                const I* csr_row_ptr_C,
                                                                J*       csr_col_ind_C,
                                                                const rocsparse_mat_info info_C,
@@ -428,9 +436,9 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     // Permutation array
     J* d_perm = nullptr;
 
-    // If maximum of row nnz exceeds 16, we process the rows in groups of
-    // similar sized row nnz
-    if(nnz_max > 16)
+    // If maximum of row nnz exceeds the grouping threshold (16 by default), we process
+    // the rows in groups of similar sized row nnz
+    if(nnz_max > handle->tuning.csrgemm_group_nnz)
     {
         // Group size buffer
         J* d_group_size = reinterpret_cast<J*>(buffer);
@@ -535,36 +543,39 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 16
-        hipLaunchKernelGGL(
-            (csrgemm_fill_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_FLL_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[0],
-            std::max(k, n),
-            &d_group_offset[0],
-            d_perm,
-            alpha_device_host,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_val_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_val_B,
-            beta_device_host,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_val_D,
-            csr_row_ptr_C,
-            csr_col_ind_C,
-            csr_val_C,
-            base_A,
-            base_B,
-            descr_C->base,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+        hipLaunchKernelGGL((csrgemm_fill_wf_per_row<CSRGEMM_DIM,
+                                                    CSRGEMM_SUB,
+                                                    CSRGEMM_HASHSIZE,
+                                                    CSRGEMM_FLL_HASH,
+                                                    T>),
+                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[0],
+                           std::max(k, n),
+                           &d_group_offset[0],
+                           d_perm,
+                           alpha_device_host,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           beta_device_host,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           base_A,
+                           base_B,
+                           descr_C->base,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -576,36 +587,39 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 32
-        hipLaunchKernelGGL(
-            (csrgemm_fill_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_FLL_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[1],
-            std::max(k, n),
-            &d_group_offset[1],
-            d_perm,
-            alpha_device_host,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_val_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_val_B,
-            beta_device_host,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_val_D,
-            csr_row_ptr_C,
-            csr_col_ind_C,
-            csr_val_C,
-            base_A,
-            base_B,
-            descr_C->base,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+        hipLaunchKernelGGL((csrgemm_fill_wf_per_row<CSRGEMM_DIM,
+                                                    CSRGEMM_SUB,
+                                                    CSRGEMM_HASHSIZE,
+                                                    CSRGEMM_FLL_HASH,
+                                                    T>),
+                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[1],
+                           std::max(k, n),
+                           &d_group_offset[1],
+                           d_perm,
+                           alpha_device_host,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           beta_device_host,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           base_A,
+                           base_B,
+                           descr_C->base,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -620,7 +634,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         hipLaunchKernelGGL((csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                        CSRGEMM_SUB,
                                                        CSRGEMM_HASHSIZE,
-                                                       CSRGEMM_FLL_HASH>),
+                                                       CSRGEMM_FLL_HASH,
+                                                       T>),
                            dim3(h_group_size[2]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -662,7 +677,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         hipLaunchKernelGGL((csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                        CSRGEMM_SUB,
                                                        CSRGEMM_HASHSIZE,
-                                                       CSRGEMM_FLL_HASH>),
+                                                       CSRGEMM_FLL_HASH,
+                                                       T>),
                            dim3(h_group_size[3]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -704,7 +720,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         hipLaunchKernelGGL((csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                        CSRGEMM_SUB,
                                                        CSRGEMM_HASHSIZE,
-                                                       CSRGEMM_FLL_HASH>),
+                                                       CSRGEMM_FLL_HASH,
+                                                       T>),
                            dim3(h_group_size[4]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -746,7 +763,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         hipLaunchKernelGGL((csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                        CSRGEMM_SUB,
                                                        CSRGEMM_HASHSIZE,
-                                                       CSRGEMM_FLL_HASH>),
+                                                       CSRGEMM_FLL_HASH,
+                                                       T>),
                            dim3(h_group_size[5]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -783,33 +801,33 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     // Group 6: 2049 - 4096 non-zeros per row
     if(h_group_size[6] > 0 && !exceeding_smem)
     {
-        RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                   h_group_size[6],
-                                                   &d_group_offset[6],
-                                                   d_perm,
-                                                   m,
-                                                   n,
-                                                   k,
-                                                   alpha_device_host,
-                                                   csr_row_ptr_A,
-                                                   csr_col_ind_A,
-                                                   csr_val_A,
-                                                   csr_row_ptr_B,
-                                                   csr_col_ind_B,
-                                                   csr_val_B,
-                                                   beta_device_host,
-                                                   csr_row_ptr_D,
-                                                   csr_col_ind_D,
-                                                   csr_val_D,
-                                                   csr_row_ptr_C,
-                                                   csr_col_ind_C,
-                                                   csr_val_C,
-                                                   base_A,
-                                                   base_B,
-                                                   descr_C->base,
-                                                   base_D,
-                                                   info_C->csrgemm_info->mul,
-                                                   info_C->csrgemm_info->add));
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher<T>(handle,
+                                                      h_group_size[6],
+                                                      &d_group_offset[6],
+                                                      d_perm,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha_device_host,
+                                                      csr_row_ptr_A,
+                                                      csr_col_ind_A,
+                                                      csr_val_A,
+                                                      csr_row_ptr_B,
+                                                      csr_col_ind_B,
+                                                      csr_val_B,
+                                                      beta_device_host,
+                                                      csr_row_ptr_D,
+                                                      csr_col_ind_D,
+                                                      csr_val_D,
+                                                      csr_row_ptr_C,
+                                                      csr_col_ind_C,
+                                                      csr_val_C,
+                                                      base_A,
+                                                      base_B,
+                                                      descr_C->base,
+                                                      base_D,
+                                                      info_C->csrgemm_info->mul,
+                                                      info_C->csrgemm_info->add));
     }
 #endif
 
@@ -837,7 +855,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         }
 
         hipLaunchKernelGGL(
-            (csrgemm_fill_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
+            (csrgemm_fill_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE, T>),
             dim3(h_group_size[7]),
             dim3(CSRGEMM_DIM),
             0,
@@ -879,7 +897,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A>
 static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_handle          handle,
                                                                   rocsparse_operation       trans_A,
                                                                   rocsparse_operation       trans_B,
@@ -889,22 +907,22 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
                                                                   const T*                  alpha,
                                                                   const rocsparse_mat_descr descr_A,
                                                                   I                         nnz_A,
-                                                                  const T* csr_val_A,
+                                                                  const A* csr_val_A,
                                                                   const I* csr_row_ptr_A,
                                                                   const J* csr_col_ind_A,
                                                                   const rocsparse_mat_descr descr_B,
                                                                   I                         nnz_B,
-                                                                  const T* csr_val_B,
+                                                                  const A* csr_val_B,
                                                                   const I* csr_row_ptr_B,
                                                                   const J* csr_col_ind_B,
                                                                   const T* beta,
                                                                   const rocsparse_mat_descr descr_D,
                                                                   I                         nnz_D,
-                                                                  const T* csr_val_D,
+                                                                  const A* csr_val_D,
                                                                   const I* csr_row_ptr_D,
                                                                   const J* csr_col_ind_D,
                                                                   const rocsparse_mat_descr descr_C,
-                                                                  T*       csr_val_C,
+                                                                  A*       csr_val_C,
                                                                   const I* csr_row_ptr_C,
                                                                   J*       csr_col_ind_C,
                                                                   const rocsparse_mat_info info_C,
@@ -1073,71 +1091,71 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
     // Perform gemm calculation
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        return rocsparse_csrgemm_calc_template(handle,
-                                               trans_A,
-                                               trans_B,
-                                               m,
-                                               n,
-                                               k,
-                                               alpha,
-                                               descr_A,
-                                               nnz_A,
-                                               csr_val_A,
-                                               csr_row_ptr_A,
-                                               csr_col_ind_A,
-                                               descr_B,
-                                               nnz_B,
-                                               csr_val_B,
-                                               csr_row_ptr_B,
-                                               csr_col_ind_B,
-                                               beta,
-                                               descr_D,
-                                               nnz_D,
-                                               csr_val_D,
-                                               csr_row_ptr_D,
-                                               csr_col_ind_D,
-                                               descr_C,
-                                               csr_val_C,
-                                               csr_row_ptr_C,
-                                               csr_col_ind_C,
-                                               info_C,
-                                               temp_buffer);
+        return rocsparse_csrgemm_calc_template<T>(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_val_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C,
+                                                  temp_buffer);
     }
     else
     {
-        return rocsparse_csrgemm_calc_template(handle,
-                                               trans_A,
-                                               trans_B,
-                                               m,
-                                               n,
-                                               k,
-                                               *alpha,
-                                               descr_A,
-                                               nnz_A,
-                                               csr_val_A,
-                                               csr_row_ptr_A,
-                                               csr_col_ind_A,
-                                               descr_B,
-                                               nnz_B,
-                                               csr_val_B,
-                                               csr_row_ptr_B,
-                                               csr_col_ind_B,
-                                               *beta,
-                                               descr_D,
-                                               nnz_D,
-                                               csr_val_D,
-                                               csr_row_ptr_D,
-                                               csr_col_ind_D,
-                                               descr_C,
-                                               csr_val_C,
-                                               csr_row_ptr_C,
-                                               csr_col_ind_C,
-                                               info_C,
-                                               temp_buffer);
+        return rocsparse_csrgemm_calc_template<T>(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  *alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  *beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_val_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C,
+                                                  temp_buffer);
     }
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A>
 static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle          handle,
                                                                rocsparse_operation       trans_A,
                                                                rocsparse_operation       trans_B,
@@ -1147,16 +1165,16 @@ static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle
                                                                const T*                  alpha,
                                                                const rocsparse_mat_descr descr_A,
                                                                I                         nnz_A,
-                                                               const T*                  csr_val_A,
+                                                               const A*                  csr_val_A,
                                                                const I* csr_row_ptr_A,
                                                                const J* csr_col_ind_A,
                                                                const rocsparse_mat_descr descr_B,
                                                                I                         nnz_B,
-                                                               const T*                  csr_val_B,
+                                                               const A*                  csr_val_B,
                                                                const I* csr_row_ptr_B,
                                                                const J* csr_col_ind_B,
                                                                const rocsparse_mat_descr descr_C,
-                                                               T*                        csr_val_C,
+                                                               A*                        csr_val_C,
                                                                const I* csr_row_ptr_C,
                                                                J*       csr_col_ind_C,
                                                                const rocsparse_mat_info info_C,
@@ -1262,90 +1280,90 @@ static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle
     // Perform gemm calculation
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        return rocsparse_csrgemm_calc_template(handle,
-                                               trans_A,
-                                               trans_B,
-                                               m,
-                                               n,
-                                               k,
-                                               alpha,
-                                               descr_A,
-                                               nnz_A,
-                                               csr_val_A,
-                                               csr_row_ptr_A,
-                                               csr_col_ind_A,
-                                               descr_B,
-                                               nnz_B,
-                                               csr_val_B,
-                                               csr_row_ptr_B,
-                                               csr_col_ind_B,
-                                               (const T*)nullptr,
-                                               nullptr,
-                                               (I)0,
-                                               (const T*)nullptr,
-                                               (const I*)nullptr,
-                                               (const J*)nullptr,
-                                               descr_C,
-                                               csr_val_C,
-                                               csr_row_ptr_C,
-                                               csr_col_ind_C,
-                                               info_C,
-                                               temp_buffer);
+        return rocsparse_csrgemm_calc_template<T>(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  (const T*)nullptr,
+                                                  nullptr,
+                                                  (I)0,
+                                                  (const A*)nullptr,
+                                                  (const I*)nullptr,
+                                                  (const J*)nullptr,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C,
+                                                  temp_buffer);
     }
     else
     {
-        return rocsparse_csrgemm_calc_template(handle,
-                                               trans_A,
-                                               trans_B,
-                                               m,
-                                               n,
-                                               k,
-                                               *alpha,
-                                               descr_A,
-                                               nnz_A,
-                                               csr_val_A,
-                                               csr_row_ptr_A,
-                                               csr_col_ind_A,
-                                               descr_B,
-                                               nnz_B,
-                                               csr_val_B,
-                                               csr_row_ptr_B,
-                                               csr_col_ind_B,
-                                               static_cast<const T>(0),
-                                               nullptr,
-                                               (I)0,
-                                               (const T*)nullptr,
-                                               (const I*)nullptr,
-                                               (const J*)nullptr,
-                                               descr_C,
-                                               csr_val_C,
-                                               csr_row_ptr_C,
-                                               csr_col_ind_C,
-                                               info_C,
-                                               temp_buffer);
+        return rocsparse_csrgemm_calc_template<T>(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  *alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  static_cast<const T>(0),
+                                                  nullptr,
+                                                  (I)0,
+                                                  (const A*)nullptr,
+                                                  (const I*)nullptr,
+                                                  (const J*)nullptr,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C,
+                                                  temp_buffer);
     }
 }
 
-template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+template <unsigned int BLOCKSIZE, typename I, typename A, typename U>
 ROCSPARSE_KERNEL(BLOCKSIZE)
-void csrgemm_copy_scale(I size, U alpha_device_host, const T* __restrict__ in, T* __restrict__ out)
+void csrgemm_copy_scale(I size, U alpha_device_host, const A* __restrict__ in, A* __restrict__ out)
 {
     auto alpha = load_scalar_device_host(alpha_device_host);
     csrgemm_copy_scale_device<BLOCKSIZE>(size, alpha, in, out);
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A>
 static inline rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handle,
                                                                J                         m,
                                                                J                         n,
                                                                const T*                  beta,
                                                                const rocsparse_mat_descr descr_D,
                                                                I                         nnz_D,
-                                                               const T*                  csr_val_D,
+                                                               const A*                  csr_val_D,
                                                                const I* csr_row_ptr_D,
                                                                const J* csr_col_ind_D,
                                                                const rocsparse_mat_descr descr_C,
-                                                               T*                        csr_val_C,
+                                                               A*                        csr_val_C,
                                                                const I* csr_row_ptr_C,
                                                                J*       csr_col_ind_C,
                                                                const rocsparse_mat_info info_C,
@@ -1476,7 +1494,7 @@ static inline rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A>
 rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             rocsparse_operation       trans_A,
                                             rocsparse_operation       trans_B,
@@ -1486,22 +1504,22 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             const T*                  alpha,
                                             const rocsparse_mat_descr descr_A,
                                             I                         nnz_A,
-                                            const T*                  csr_val_A,
+                                            const A*                  csr_val_A,
                                             const I*                  csr_row_ptr_A,
                                             const J*                  csr_col_ind_A,
                                             const rocsparse_mat_descr descr_B,
                                             I                         nnz_B,
-                                            const T*                  csr_val_B,
+                                            const A*                  csr_val_B,
                                             const I*                  csr_row_ptr_B,
                                             const J*                  csr_col_ind_B,
                                             const T*                  beta,
                                             const rocsparse_mat_descr descr_D,
                                             I                         nnz_D,
-                                            const T*                  csr_val_D,
+                                            const A*                  csr_val_D,
                                             const I*                  csr_row_ptr_D,
                                             const J*                  csr_col_ind_D,
                                             const rocsparse_mat_descr descr_C,
-                                            T*                        csr_val_C,
+                                            A*                        csr_val_C,
                                             const I*                  csr_row_ptr_C,
                                             J*                        csr_col_ind_C,
                                             const rocsparse_mat_info  info_C,
@@ -1560,6 +1578,17 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
               "--beta",
               LOG_BENCH_SCALAR_VALUE(handle, beta));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsrgemm"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                k,
+                                                nnz_A,
+                                                nnz_B,
+                                                nnz_D);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -1677,36 +1706,36 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     }
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                       \
-    template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE>( \
-        rocsparse_handle          handle,                                      \
-        rocsparse_operation       trans_A,                                     \
-        rocsparse_operation       trans_B,                                     \
-        JTYPE                     m,                                           \
-        JTYPE                     n,                                           \
-        JTYPE                     k,                                           \
-        const TTYPE*              alpha,                                       \
-        const rocsparse_mat_descr descr_A,                                     \
-        ITYPE                     nnz_A,                                       \
-        const TTYPE*              csr_val_A,                                   \
-        const ITYPE*              csr_row_ptr_A,                               \
-        const JTYPE*              csr_col_ind_A,                               \
-        const rocsparse_mat_descr descr_B,                                     \
-        ITYPE                     nnz_B,                                       \
-        const TTYPE*              csr_val_B,                                   \
-        const ITYPE*              csr_row_ptr_B,                               \
-        const JTYPE*              csr_col_ind_B,                               \
-        const TTYPE*              beta,                                        \
-        const rocsparse_mat_descr descr_D,                                     \
-        ITYPE                     nnz_D,                                       \
-        const TTYPE*              csr_val_D,                                   \
-        const ITYPE*              csr_row_ptr_D,                               \
-        const JTYPE*              csr_col_ind_D,                               \
-        const rocsparse_mat_descr descr_C,                                     \
-        TTYPE*                    csr_val_C,                                   \
-        const ITYPE*              csr_row_ptr_C,                               \
-        JTYPE*                    csr_col_ind_C,                               \
-        const rocsparse_mat_info  info_C,                                      \
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
+    template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                             \
+        rocsparse_operation       trans_A,                                            \
+        rocsparse_operation       trans_B,                                            \
+        JTYPE                     m,                                                  \
+        JTYPE                     n,                                                  \
+        JTYPE                     k,                                                  \
+        const TTYPE*              alpha,                                              \
+        const rocsparse_mat_descr descr_A,                                            \
+        ITYPE                     nnz_A,                                              \
+        const TTYPE*              csr_val_A,                                          \
+        const ITYPE*              csr_row_ptr_A,                                      \
+        const JTYPE*              csr_col_ind_A,                                      \
+        const rocsparse_mat_descr descr_B,                                            \
+        ITYPE                     nnz_B,                                              \
+        const TTYPE*              csr_val_B,                                          \
+        const ITYPE*              csr_row_ptr_B,                                      \
+        const JTYPE*              csr_col_ind_B,                                      \
+        const TTYPE*              beta,                                               \
+        const rocsparse_mat_descr descr_D,                                            \
+        ITYPE                     nnz_D,                                              \
+        const TTYPE*              csr_val_D,                                          \
+        const ITYPE*              csr_row_ptr_D,                                      \
+        const JTYPE*              csr_col_ind_D,                                      \
+        const rocsparse_mat_descr descr_C,                                            \
+        TTYPE*                    csr_val_C,                                          \
+        const ITYPE*              csr_row_ptr_C,                                      \
+        JTYPE*                    csr_col_ind_C,                                      \
+        const rocsparse_mat_info  info_C,                                             \
         void*                     temp_buffer);
 
 INSTANTIATE(int32_t, int32_t, float);
@@ -1723,6 +1752,43 @@ INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 #undef INSTANTIATE
 
+#define INSTANTIATE_MIXED(ITYPE, JTYPE, TTYPE, ATYPE)                                 \
+    template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE, ATYPE>( \
+        rocsparse_handle          handle,                                             \
+        rocsparse_operation       trans_A,                                            \
+        rocsparse_operation       trans_B,                                            \
+        JTYPE                     m,                                                  \
+        JTYPE                     n,                                                  \
+        JTYPE                     k,                                                  \
+        const TTYPE*              alpha,                                              \
+        const rocsparse_mat_descr descr_A,                                            \
+        ITYPE                     nnz_A,                                              \
+        const ATYPE*              csr_val_A,                                          \
+        const ITYPE*              csr_row_ptr_A,                                      \
+        const JTYPE*              csr_col_ind_A,                                      \
+        const rocsparse_mat_descr descr_B,                                            \
+        ITYPE                     nnz_B,                                              \
+        const ATYPE*              csr_val_B,                                          \
+        const ITYPE*              csr_row_ptr_B,                                      \
+        const JTYPE*              csr_col_ind_B,                                      \
+        const TTYPE*              beta,                                               \
+        const rocsparse_mat_descr descr_D,                                            \
+        ITYPE                     nnz_D,                                              \
+        const ATYPE*              csr_val_D,                                          \
+        const ITYPE*              csr_row_ptr_D,                                      \
+        const JTYPE*              csr_col_ind_D,                                      \
+        const rocsparse_mat_descr descr_C,                                            \
+        ATYPE*                    csr_val_C,                                          \
+        const ITYPE*              csr_row_ptr_C,                                      \
+        JTYPE*                    csr_col_ind_C,                                      \
+        const rocsparse_mat_info  info_C,                                             \
+        void*                     temp_buffer);
+
+INSTANTIATE_MIXED(int32_t, int32_t, double, float);
+INSTANTIATE_MIXED(int64_t, int32_t, double, float);
+INSTANTIATE_MIXED(int64_t, int64_t, double, float);
+#undef INSTANTIATE_MIXED
+
 /*
  * ===========================================================================
  *    C wrapper
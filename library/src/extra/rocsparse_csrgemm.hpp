@@ -30,6 +30,13 @@
 #define CSRGEMM_NNZ_HASH 79
 #define CSRGEMM_FLL_HASH 137
 
+// Number of blocks launched for a row group whose size is only known on the device, that is
+// in device sizes mode. The blocks stride over the rows of the group.
+static inline int csrgemm_device_group_blocks(rocsparse_handle handle)
+{
+    return 16 * handle->properties.multiProcessorCount;
+}
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle          handle,
                                                         rocsparse_operation       trans_A,
@@ -79,7 +86,7 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
                                                 const rocsparse_mat_info  info_C,
                                                 void*                     temp_buffer);
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A>
 rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             rocsparse_operation       trans_A,
                                             rocsparse_operation       trans_B,
@@ -89,22 +96,22 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             const T*                  alpha,
                                             const rocsparse_mat_descr descr_A,
                                             I                         nnz_A,
-                                            const T*                  csr_val_A,
+                                            const A*                  csr_val_A,
                                             const I*                  csr_row_ptr_A,
                                             const J*                  csr_col_ind_A,
                                             const rocsparse_mat_descr descr_B,
                                             I                         nnz_B,
-                                            const T*                  csr_val_B,
+                                            const A*                  csr_val_B,
                                             const I*                  csr_row_ptr_B,
                                             const J*                  csr_col_ind_B,
                                             const T*                  beta,
                                             const rocsparse_mat_descr descr_D,
                                             I                         nnz_D,
-                                            const T*                  csr_val_D,
+                                            const A*                  csr_val_D,
                                             const I*                  csr_row_ptr_D,
                                             const J*                  csr_col_ind_D,
                                             const rocsparse_mat_descr descr_C,
-                                            T*                        csr_val_C,
+                                            A*                        csr_val_C,
                                             const I*                  csr_row_ptr_C,
                                             J*                        csr_col_ind_C,
                                             const rocsparse_mat_info  info_C,
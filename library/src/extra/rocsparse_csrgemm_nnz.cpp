@@ -23,6 +23,7 @@
  * ************************************************************************ */
 
 #include "../conversion/rocsparse_identity.hpp"
+#include "../util/rocsparse_analysis_cache.hpp"
 #include "csrgemm_device.h"
 #include "definitions.h"
 #include "rocsparse_csrgemm.hpp"
@@ -478,6 +479,17 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
               (const void*&)info_C,
               (const void*&)buffer_size);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsrgemm_buffer_size"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                k,
+                                                nnz_A,
+                                                nnz_B,
+                                                nnz_D);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -679,11 +691,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle
     // When scaling a matrix, nnz of C will always be equal to nnz of D
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(nnz_C, &nnz_D, sizeof(I), hipMemcpyHostToDevice, stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        RETURN_IF_HIP_ERROR(rocsparse_assign_async(nnz_C, nnz_D, stream));
     }
     else
     {
@@ -746,6 +754,14 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     bool mul = info_C->csrgemm_info->mul;
     bool add = info_C->csrgemm_info->add;
 
+    // In device sizes mode, the row groups are formed and launched without copying their
+    // sizes to the host. The last group can only be rejected for unsorted B and D on the
+    // host, such that unsorted matrices fall back to the host sizes.
+    const bool sizes_on_device
+        = rocsparse_sizes_on_device(handle)
+          && (!mul || descr_B->storage_mode == rocsparse_storage_mode_sorted)
+          && (!add || descr_D->storage_mode == rocsparse_storage_mode_sorted);
+
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -773,30 +789,35 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
 
-    // Determine maximum of all intermediate products
-    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-    rocprim_buffer = reinterpret_cast<void*>(buffer);
-    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-
-    I int_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Determine maximum of all intermediate products, the rows are always grouped in
+    // device sizes mode
+    I int_max = 0;
+
+    if(!sizes_on_device)
+    {
+        RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                            rocprim_size,
+                                            csr_row_ptr_C,
+                                            csr_row_ptr_C + m,
+                                            0,
+                                            m,
+                                            rocprim::maximum<I>(),
+                                            stream));
+        rocprim_buffer = reinterpret_cast<void*>(buffer);
+        RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
+                                            rocprim_size,
+                                            csr_row_ptr_C,
+                                            csr_row_ptr_C + m,
+                                            0,
+                                            m,
+                                            rocprim::maximum<I>(),
+                                            stream));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
 
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
@@ -811,9 +832,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     // Permutation array
     J* d_perm = nullptr;
 
-    // If maximum of intermediate products exceeds 32, we process the rows in groups of
-    // similar sized intermediate products
-    if(int_max > 32)
+    // Number of blocks of each group in device sizes mode
+    const J group_blocks = csrgemm_device_group_blocks(handle);
+
+    // If maximum of intermediate products exceeds the grouping threshold (32 by default),
+    // we process the rows in groups of similar sized intermediate products
+    if(sizes_on_device || int_max > handle->tuning.csrgemm_group_products)
     {
         // Group size buffer
         J* d_group_size = reinterpret_cast<J*>(buffer);
@@ -838,13 +862,13 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            d_group_size);
 #undef CSRGEMM_DIM
 
-        // Exclusive sum to obtain group offsets
+        // Exclusive sum to obtain group offsets, the last offset ends the last group
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
                                                     rocprim_size,
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
         rocprim_buffer = reinterpret_cast<void*>(buffer);
@@ -853,19 +877,22 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
 
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        if(!sizes_on_device)
+        {
+            // Copy group sizes to host
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
+                                               d_group_size,
+                                               sizeof(J) * CSRGEMM_MAXGROUPS,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
 
         // Permutation temporary arrays
         J* tmp_vals = reinterpret_cast<J*>(buffer);
@@ -906,19 +933,21 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     // Compute non-zero entries per row for each group
 
     // Group 0: 0 - 32 intermediate products
-    if(h_group_size[0] > 0)
+    if(sizes_on_device || h_group_size[0] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 4
 #define CSRGEMM_HASHSIZE 32
         hipLaunchKernelGGL(
             (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            dim3(sizes_on_device ? group_blocks
+                                 : (h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
             dim3(CSRGEMM_DIM),
             0,
             stream,
             h_group_size[0],
             &d_group_offset[0],
+            sizes_on_device ? &d_group_offset[1] : nullptr,
             d_perm,
             csr_row_ptr_A,
             csr_col_ind_A,
@@ -938,19 +967,21 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 1: 33 - 64 intermediate products
-    if(h_group_size[1] > 0)
+    if(sizes_on_device || h_group_size[1] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 64
         hipLaunchKernelGGL(
             (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            dim3(sizes_on_device ? group_blocks
+                                 : (h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
             dim3(CSRGEMM_DIM),
             0,
             stream,
             h_group_size[1],
             &d_group_offset[1],
+            sizes_on_device ? &d_group_offset[2] : nullptr,
             d_perm,
             csr_row_ptr_A,
             csr_col_ind_A,
@@ -970,7 +1001,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 2: 65 - 512 intermediate products
-    if(h_group_size[2] > 0)
+    if(sizes_on_device || h_group_size[2] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
@@ -979,11 +1010,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[2]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[2]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            &d_group_offset[2],
+                           sizes_on_device ? &d_group_offset[3] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1003,7 +1035,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 3: 513 - 1024 intermediate products
-    if(h_group_size[3] > 0)
+    if(sizes_on_device || h_group_size[3] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
@@ -1012,11 +1044,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[3]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[3]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            &d_group_offset[3],
+                           sizes_on_device ? &d_group_offset[4] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1036,7 +1069,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 4: 1025 - 2048 intermediate products
-    if(h_group_size[4] > 0)
+    if(sizes_on_device || h_group_size[4] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -1045,11 +1078,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[4]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[4]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            &d_group_offset[4],
+                           sizes_on_device ? &d_group_offset[5] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1069,7 +1103,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 5: 2049 - 4096 intermediate products
-    if(h_group_size[5] > 0)
+    if(sizes_on_device || h_group_size[5] > 0)
     {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
@@ -1078,11 +1112,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[5]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[5]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            &d_group_offset[5],
+                           sizes_on_device ? &d_group_offset[6] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1102,7 +1137,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 6: 4097 - 8192 intermediate products
-    if(h_group_size[6] > 0)
+    if(sizes_on_device || h_group_size[6] > 0)
     {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
@@ -1111,11 +1146,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[6]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[6]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            &d_group_offset[6],
+                           sizes_on_device ? &d_group_offset[7] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1135,7 +1171,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
 
     // Group 7: more than 8192 intermediate products
-    if(h_group_size[7] > 0)
+    if(sizes_on_device || h_group_size[7] > 0)
     {
         // Matrices B and D must be sorted in order to run this path
         if(descr_B->storage_mode == rocsparse_storage_mode_unsorted
@@ -1159,12 +1195,13 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 
         hipLaunchKernelGGL(
             (csrgemm_nnz_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
-            dim3(h_group_size[7]),
+            dim3(sizes_on_device ? group_blocks : h_group_size[7]),
             dim3(CSRGEMM_DIM),
             0,
             stream,
             n,
             &d_group_offset[7],
+            sizes_on_device ? &d_group_offset[CSRGEMM_MAXGROUPS] : nullptr,
             d_perm,
             csr_row_ptr_A,
             csr_col_ind_A,
@@ -1640,6 +1677,10 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
               (const void*&)info_C,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csrgemm_nnz", m, n, k, nnz_A, nnz_B, nnz_D);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -1663,6 +1704,9 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // The row groups of the previous symbolic stage are not valid anymore
+    info_C->csrgemm_info->group_size.clear();
+
     // quick return
     if(m == 0 || n == 0
        || (info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == false))
@@ -1693,74 +1737,157 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
         return rocsparse_status_success;
     }
 
+    const bool mul = info_C->csrgemm_info->mul;
+    const bool add = info_C->csrgemm_info->add;
+
+    // Look for the structure of C of a previous call with the same sparsity patterns
+    const bool use_cache = rocsparse_analysis_cache_enabled(handle->analysis_cache);
+
+    rocsparse_analysis_cache_key key;
+
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_csrgemm_key_template(handle,
+                                                                                trans_A,
+                                                                                trans_B,
+                                                                                m,
+                                                                                n,
+                                                                                k,
+                                                                                mul,
+                                                                                add,
+                                                                                descr_A,
+                                                                                nnz_A,
+                                                                                csr_row_ptr_A,
+                                                                                csr_col_ind_A,
+                                                                                descr_B,
+                                                                                nnz_B,
+                                                                                csr_row_ptr_B,
+                                                                                csr_col_ind_B,
+                                                                                descr_D,
+                                                                                nnz_D,
+                                                                                csr_row_ptr_D,
+                                                                                csr_col_ind_D,
+                                                                                descr_C,
+                                                                                &key));
+
+        bool    found      = false;
+        int64_t cached_nnz = 0;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_find_csrgemm_nnz(
+            handle->analysis_cache, key, csr_row_ptr_C, &cached_nnz, handle->stream, &found));
+
+        if(found)
+        {
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                RETURN_IF_HIP_ERROR(
+                    rocsparse_assign_async(nnz_C, static_cast<I>(cached_nnz), handle->stream));
+            }
+            else
+            {
+                *nnz_C = static_cast<I>(cached_nnz);
+            }
+
+            return rocsparse_status_success;
+        }
+    }
+
+    rocsparse_status status;
+
     // Either mult, add or multadd need to be performed
-    if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
+    if(mul == true && add == true)
     {
         // C = alpha * A * B + beta * D
-        return rocsparse_csrgemm_nnz_multadd(handle,
-                                             trans_A,
-                                             trans_B,
-                                             m,
-                                             n,
-                                             k,
-                                             descr_A,
-                                             nnz_A,
-                                             csr_row_ptr_A,
-                                             csr_col_ind_A,
-                                             descr_B,
-                                             nnz_B,
-                                             csr_row_ptr_B,
-                                             csr_col_ind_B,
-                                             descr_D,
-                                             nnz_D,
-                                             csr_row_ptr_D,
-                                             csr_col_ind_D,
-                                             descr_C,
-                                             csr_row_ptr_C,
-                                             nnz_C,
-                                             info_C,
-                                             temp_buffer);
-    }
-    else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
+        status = rocsparse_csrgemm_nnz_multadd(handle,
+                                               trans_A,
+                                               trans_B,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               csr_row_ptr_A,
+                                               csr_col_ind_A,
+                                               descr_B,
+                                               nnz_B,
+                                               csr_row_ptr_B,
+                                               csr_col_ind_B,
+                                               descr_D,
+                                               nnz_D,
+                                               csr_row_ptr_D,
+                                               csr_col_ind_D,
+                                               descr_C,
+                                               csr_row_ptr_C,
+                                               nnz_C,
+                                               info_C,
+                                               temp_buffer);
+    }
+    else if(mul == true && add == false)
     {
         // C = alpha * A * B
-        return rocsparse_csrgemm_nnz_mult(handle,
-                                          trans_A,
-                                          trans_B,
-                                          m,
-                                          n,
-                                          k,
-                                          descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
-                                          descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
-                                          descr_C,
-                                          csr_row_ptr_C,
-                                          nnz_C,
-                                          info_C,
-                                          temp_buffer);
+        status = rocsparse_csrgemm_nnz_mult(handle,
+                                            trans_A,
+                                            trans_B,
+                                            m,
+                                            n,
+                                            k,
+                                            descr_A,
+                                            nnz_A,
+                                            csr_row_ptr_A,
+                                            csr_col_ind_A,
+                                            descr_B,
+                                            nnz_B,
+                                            csr_row_ptr_B,
+                                            csr_col_ind_B,
+                                            descr_C,
+                                            csr_row_ptr_C,
+                                            nnz_C,
+                                            info_C,
+                                            temp_buffer);
     }
     else
     {
-        assert(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true);
+        assert(mul == false && add == true);
         // C = beta * D
-        return rocsparse_csrgemm_nnz_scal(handle,
-                                          m,
-                                          n,
-                                          descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
-                                          descr_C,
-                                          csr_row_ptr_C,
-                                          nnz_C,
-                                          info_C,
-                                          temp_buffer);
+        status = rocsparse_csrgemm_nnz_scal(handle,
+                                            m,
+                                            n,
+                                            descr_D,
+                                            nnz_D,
+                                            csr_row_ptr_D,
+                                            csr_col_ind_D,
+                                            descr_C,
+                                            csr_row_ptr_C,
+                                            nnz_C,
+                                            info_C,
+                                            temp_buffer);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    // Keep a copy of the structure of C for the next products with these sparsity patterns.
+    // In device sizes mode, a nnz of C in device memory is not read back to be cached.
+    if(use_cache
+       && !(rocsparse_sizes_on_device(handle)
+            && handle->pointer_mode == rocsparse_pointer_mode_device))
+    {
+        I nnz_C_host;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &nnz_C_host, nnz_C, sizeof(I), hipMemcpyDeviceToHost, handle->stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        }
+        else
+        {
+            nnz_C_host = *nnz_C;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_insert_csrgemm_nnz(
+            handle->analysis_cache, key, csr_row_ptr_C, nnz_C_host, handle->stream));
     }
+
+    return rocsparse_status_success;
 }
 
 #define INSTANTIATE(ITYPE, JTYPE)                                           \
@@ -818,6 +818,8 @@ __forceinline__ __device__ __host__ T load_scalar_device_host_permissive(const T
     return (xp) ? *xp : static_cast<T>(0);
 }
 
+// Without group_end, the grid covers the m rows of the row group. Otherwise, the size
+// of the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -830,6 +832,7 @@ ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_numeric_fill_wf_per_row_kernel(J m,
                                             J nk,
                                             const J* __restrict__ offset,
+                                            const J* __restrict__ group_end,
                                             const J* __restrict__ perm,
                                             U alpha_device_host,
                                             const I* __restrict__ csr_row_ptr_A,
@@ -854,33 +857,48 @@ void csrgemm_numeric_fill_wf_per_row_kernel(J m,
 {
     auto alpha = load_scalar_device_host_permissive(alpha_device_host);
     auto beta  = load_scalar_device_host_permissive(beta_device_host);
-    csrgemm_numeric_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
-        m,
-        nk,
-        offset,
-        perm,
-        (mul) ? alpha : static_cast<T>(0),
-        csr_row_ptr_A,
-        csr_col_ind_A,
-        csr_val_A,
-        csr_row_ptr_B,
-        csr_col_ind_B,
-        csr_val_B,
-        (add) ? beta : static_cast<T>(0),
-        csr_row_ptr_D,
-        csr_col_ind_D,
-        csr_val_D,
-        csr_row_ptr_C,
-        csr_col_ind_C,
-        csr_val_C,
-        idx_base_A,
-        idx_base_B,
-        idx_base_C,
-        idx_base_D,
-        mul,
-        add);
+
+    J size   = (group_end != nullptr) ? *group_end - *offset : m;
+    J rows   = BLOCKSIZE / WFSIZE;
+    J stride = static_cast<J>(hipGridDim_x) * rows;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) * rows + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_numeric_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+            size - shift,
+            nk,
+            &group_offset,
+            perm,
+            (mul) ? alpha : static_cast<T>(0),
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            (add) ? beta : static_cast<T>(0),
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_val_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for all wavefronts to release their hash tables
+        __syncthreads();
+    }
 }
 
+// Without group_end, there is a block per row of the row group. Otherwise, the size of
+// the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -892,6 +910,7 @@ template <unsigned int BLOCKSIZE,
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_numeric_fill_block_per_row_kernel(J nk,
                                                const J* __restrict__ offset,
+                                               const J* __restrict__ group_end,
                                                const J* __restrict__ perm,
                                                U alpha_device_host,
                                                const I* __restrict__ csr_row_ptr_A,
@@ -916,32 +935,46 @@ void csrgemm_numeric_fill_block_per_row_kernel(J nk,
 {
     auto alpha = load_scalar_device_host_permissive(alpha_device_host);
     auto beta  = load_scalar_device_host_permissive(beta_device_host);
-    csrgemm_numeric_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
-        nk,
-        offset,
-        perm,
-        (mul) ? alpha : static_cast<T>(0),
-        csr_row_ptr_A,
-        csr_col_ind_A,
-        csr_val_A,
-        csr_row_ptr_B,
-        csr_col_ind_B,
-        csr_val_B,
-        (add) ? beta : static_cast<T>(0),
-        csr_row_ptr_D,
-        csr_col_ind_D,
-        csr_val_D,
-        csr_row_ptr_C,
-        csr_col_ind_C,
-        csr_val_C,
-        idx_base_A,
-        idx_base_B,
-        idx_base_C,
-        idx_base_D,
-        mul,
-        add);
+
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_numeric_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+            nk,
+            &group_offset,
+            perm,
+            (mul) ? alpha : static_cast<T>(0),
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            (add) ? beta : static_cast<T>(0),
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_val_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for the block to release its shared memory
+        __syncthreads();
+    }
 }
 
+// Without group_end, there is a block per row of the row group. Otherwise, the size of
+// the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int CHUNKSIZE,
@@ -952,6 +985,7 @@ template <unsigned int BLOCKSIZE,
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_numeric_fill_block_per_row_multipass_kernel(J n,
                                                          const J* __restrict__ offset,
+                                                         const J* __restrict__ group_end,
                                                          const J* __restrict__ perm,
                                                          U alpha_device_host,
                                                          const I* __restrict__ csr_row_ptr_A,
@@ -977,31 +1011,43 @@ void csrgemm_numeric_fill_block_per_row_multipass_kernel(J n,
 {
     auto alpha = load_scalar_device_host_permissive(alpha_device_host);
     auto beta  = load_scalar_device_host_permissive(beta_device_host);
-    csrgemm_numeric_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
-        n,
-        offset,
-        perm,
-        (mul) ? alpha : static_cast<T>(0),
-        csr_row_ptr_A,
-        csr_col_ind_A,
-        csr_val_A,
-        csr_row_ptr_B,
-        csr_col_ind_B,
-        csr_val_B,
-        (add) ? beta : static_cast<T>(0),
-        csr_row_ptr_D,
-        csr_col_ind_D,
-        csr_val_D,
-        csr_row_ptr_C,
-        csr_col_ind_C,
-        csr_val_C,
-        workspace_B,
-        idx_base_A,
-        idx_base_B,
-        idx_base_C,
-        idx_base_D,
-        mul,
-        add);
+
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_numeric_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+            n,
+            &group_offset,
+            perm,
+            (mul) ? alpha : static_cast<T>(0),
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            (add) ? beta : static_cast<T>(0),
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_val_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            workspace_B,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for the block to release its shared memory
+        __syncthreads();
+    }
 }
 
 // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
@@ -1021,6 +1067,7 @@ template <typename I,
 static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     handle,
                                                         J                    group_size,
                                                         const J*             group_offset,
+                                                        const J*             group_end,
                                                         const J*             perm,
                                                         J                    m,
                                                         J                    n,
@@ -1064,6 +1111,7 @@ template <typename I,
 static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     handle,
                                                         J                    group_size,
                                                         const J*             group_offset,
+                                                        const J*             group_end,
                                                         const J*             perm,
                                                         J                    m,
                                                         J                    n,
@@ -1103,6 +1151,7 @@ static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     han
                        handle->stream,
                        std::max(k, n),
                        group_offset,
+                       group_end,
                        perm,
                        alpha_device_host,
                        csr_row_ptr_A,
@@ -1171,19 +1220,48 @@ static inline rocsparse_status
     bb += sizeof(J) * 256;
     const J* d_group_size = reinterpret_cast<const J*>(bb);
 
-    J h_group_size[CSRGEMM_MAXGROUPS + 1];
+    J h_group_size[CSRGEMM_MAXGROUPS + 1] = {};
+
+    // Set if the group sizes are only known on the device
+    bool sizes_on_device = false;
 
-    // Copy group sizes to host
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
-                                       d_group_size,
-                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    // Number of blocks of each group in device sizes mode
+    const J group_blocks = csrgemm_device_group_blocks(handle);
+
+    if(info_C->csrgemm_info->group_size.size() == CSRGEMM_MAXGROUPS + 1)
+    {
+        // Use the group sizes gathered during the symbolic stage, such that repeated
+        // numeric stages do not synchronize and can be captured into a graph
+        for(int g = 0; g <= CSRGEMM_MAXGROUPS; ++g)
+        {
+            h_group_size[g] = static_cast<J>(info_C->csrgemm_info->group_size[g]);
+        }
+    }
+    else if(rocsparse_sizes_on_device(handle)
+            && (!info_C->csrgemm_info->mul
+                || descr_B->storage_mode == rocsparse_storage_mode_sorted)
+            && (!info_C->csrgemm_info->add
+                || descr_D->storage_mode == rocsparse_storage_mode_sorted))
+    {
+        // The symbolic stage in device sizes mode has grouped the rows without recording
+        // the group sizes, launch from the group offsets on the device
+        sizes_on_device = true;
+    }
+    else
+    {
+        // Copy group sizes to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                           d_group_size,
+                                           sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    }
 
+    // The rows are always grouped in device sizes mode
     J nnz_max = h_group_size[CSRGEMM_MAXGROUPS];
-    if(nnz_max > 16)
+    if(sizes_on_device || nnz_max > 16)
     {
 
         bb += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
@@ -1215,7 +1293,7 @@ static inline rocsparse_status
 
     // Group 0: 0 - 16 non-zeros per row
 
-    if(h_group_size[0] > 0)
+    if(sizes_on_device || h_group_size[0] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
@@ -1224,13 +1302,16 @@ static inline rocsparse_status
                                                                    CSRGEMM_SUB,
                                                                    CSRGEMM_HASHSIZE,
                                                                    CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(sizes_on_device
+                                    ? group_blocks
+                                    : (h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            h_group_size[0],
                            std::max(k, n),
                            &d_group_offset[0],
+                           sizes_on_device ? &d_group_offset[1] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1258,7 +1339,7 @@ static inline rocsparse_status
     }
 
     // Group 1: 17 - 32 non-zeros per row
-    if(h_group_size[1] > 0)
+    if(sizes_on_device || h_group_size[1] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -1267,13 +1348,16 @@ static inline rocsparse_status
                                                                    CSRGEMM_SUB,
                                                                    CSRGEMM_HASHSIZE,
                                                                    CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(sizes_on_device
+                                    ? group_blocks
+                                    : (h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            h_group_size[1],
                            std::max(k, n),
                            &d_group_offset[1],
+                           sizes_on_device ? &d_group_offset[2] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1301,7 +1385,7 @@ static inline rocsparse_status
     }
 
     // Group 2: 33 - 256 non-zeros per row
-    if(h_group_size[2] > 0)
+    if(sizes_on_device || h_group_size[2] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
@@ -1310,12 +1394,13 @@ static inline rocsparse_status
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
                                                                       CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[2]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[2]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[2],
+                           sizes_on_device ? &d_group_offset[3] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1343,7 +1428,7 @@ static inline rocsparse_status
     }
 
     // Group 3: 257 - 512 non-zeros per row
-    if(h_group_size[3] > 0)
+    if(sizes_on_device || h_group_size[3] > 0)
     {
 
 #define CSRGEMM_DIM 256
@@ -1353,12 +1438,13 @@ static inline rocsparse_status
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
                                                                       CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[3]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[3]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[3],
+                           sizes_on_device ? &d_group_offset[4] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1386,7 +1472,7 @@ static inline rocsparse_status
     }
 
     // Group 4: 513 - 1024 non-zeros per row
-    if(h_group_size[4] > 0)
+    if(sizes_on_device || h_group_size[4] > 0)
     {
 
 #define CSRGEMM_DIM 512
@@ -1396,12 +1482,13 @@ static inline rocsparse_status
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
                                                                       CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[4]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[4]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[4],
+                           sizes_on_device ? &d_group_offset[5] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1429,7 +1516,7 @@ static inline rocsparse_status
     }
 
     // Group 5: 1025 - 2048 non-zeros per row
-    if(h_group_size[5] > 0)
+    if(sizes_on_device || h_group_size[5] > 0)
     {
 
 #define CSRGEMM_DIM 1024
@@ -1439,12 +1526,13 @@ static inline rocsparse_status
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
                                                                       CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[5]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[5]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[5],
+                           sizes_on_device ? &d_group_offset[6] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1473,41 +1561,43 @@ static inline rocsparse_status
 
 #ifndef rocsparse_ILP64
     // Group 6: 2049 - 4096 non-zeros per row
-    if(h_group_size[6] > 0 && !exceeding_smem)
+    if((sizes_on_device || h_group_size[6] > 0) && !exceeding_smem)
     {
 
-        RETURN_IF_ROCSPARSE_ERROR(csrgemm_numeric_launcher(handle,
-                                                           h_group_size[6],
-                                                           &d_group_offset[6],
-                                                           d_perm,
-                                                           m,
-                                                           n,
-                                                           k,
-                                                           alpha_device_host,
-                                                           csr_row_ptr_A,
-                                                           csr_col_ind_A,
-                                                           csr_val_A,
-                                                           csr_row_ptr_B,
-                                                           csr_col_ind_B,
-                                                           csr_val_B,
-                                                           beta_device_host,
-                                                           csr_row_ptr_D,
-                                                           csr_col_ind_D,
-                                                           csr_val_D,
-                                                           csr_row_ptr_C,
-                                                           csr_col_ind_C,
-                                                           csr_val_C,
-                                                           base_A,
-                                                           base_B,
-                                                           descr_C->base,
-                                                           base_D,
-                                                           info_C->csrgemm_info->mul,
-                                                           info_C->csrgemm_info->add));
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_numeric_launcher(handle,
+                                     sizes_on_device ? group_blocks : h_group_size[6],
+                                     &d_group_offset[6],
+                                     sizes_on_device ? &d_group_offset[7] : nullptr,
+                                     d_perm,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha_device_host,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     csr_val_A,
+                                     csr_row_ptr_B,
+                                     csr_col_ind_B,
+                                     csr_val_B,
+                                     beta_device_host,
+                                     csr_row_ptr_D,
+                                     csr_col_ind_D,
+                                     csr_val_D,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     csr_val_C,
+                                     base_A,
+                                     base_B,
+                                     descr_C->base,
+                                     base_D,
+                                     info_C->csrgemm_info->mul,
+                                     info_C->csrgemm_info->add));
     }
 #endif
 
     // Group 7: more than 4096 non-zeros per row
-    if(h_group_size[7] > 0)
+    if(sizes_on_device || h_group_size[7] > 0)
     {
         // Matrices B and D must be sorted in order to run this path
         if(descr_B->storage_mode == rocsparse_storage_mode_unsorted
@@ -1532,12 +1622,13 @@ static inline rocsparse_status
         hipLaunchKernelGGL((csrgemm_numeric_fill_block_per_row_multipass_kernel<CSRGEMM_DIM,
                                                                                 CSRGEMM_SUB,
                                                                                 CSRGEMM_CHUNKSIZE>),
-                           dim3(h_group_size[7]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[7]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            n,
                            &d_group_offset[7],
+                           sizes_on_device ? &d_group_offset[CSRGEMM_MAXGROUPS] : nullptr,
                            d_perm,
                            alpha_device_host,
                            csr_row_ptr_A,
@@ -1890,6 +1981,18 @@ rocsparse_status rocsparse_csrgemm_numeric_log_and_detect_bad_arg(rocsparse_hand
               "--beta",
               LOG_BENCH_SCALAR_VALUE(handle, beta));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xcsrgemm_numeric"),
+                                                rocsparse_get_datatype<T>(),
+                                                m,
+                                                n,
+                                                k,
+                                                nnz_A,
+                                                nnz_B,
+                                                nnz_D,
+                                                nnz_C);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
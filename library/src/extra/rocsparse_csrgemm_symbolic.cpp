@@ -308,6 +308,8 @@ ROCSPARSE_DEVICE_ILF void
     }
 }
 
+// Without group_end, there is a block per row of the row group. Otherwise, the size of
+// the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int CHUNKSIZE,
@@ -316,6 +318,7 @@ template <unsigned int BLOCKSIZE,
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_symbolic_fill_block_per_row_multipass(J n,
                                                    const J* __restrict__ offset,
+                                                   const J* __restrict__ group_end,
                                                    const J* __restrict__ perm,
                                                    const I* __restrict__ csr_row_ptr_A,
                                                    const J* __restrict__ csr_col_ind_A,
@@ -333,25 +336,36 @@ void csrgemm_symbolic_fill_block_per_row_multipass(J n,
                                                    bool                 mul,
                                                    bool                 add)
 {
-    csrgemm_symbolic_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
-        n,
-        offset,
-        perm,
-        csr_row_ptr_A,
-        csr_col_ind_A,
-        csr_row_ptr_B,
-        csr_col_ind_B,
-        csr_row_ptr_D,
-        csr_col_ind_D,
-        csr_row_ptr_C,
-        csr_col_ind_C,
-        workspace_B,
-        idx_base_A,
-        idx_base_B,
-        idx_base_C,
-        idx_base_D,
-        mul,
-        add);
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_symbolic_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+            n,
+            &group_offset,
+            perm,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            workspace_B,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for the block to release its shared memory
+        __syncthreads();
+    }
 }
 
 template <unsigned int BLOCKSIZE, unsigned int GROUPS, typename I>
@@ -742,6 +756,8 @@ ROCSPARSE_DEVICE_ILF void
     }
 }
 
+// Without group_end, the grid covers the m rows of the row group. Otherwise, the size
+// of the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -752,6 +768,7 @@ ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_symbolic_fill_wf_per_row(J m,
                                       J nk,
                                       const J* __restrict__ offset,
+                                      const J* __restrict__ group_end,
                                       const J* __restrict__ perm,
 
                                       const I* __restrict__ csr_row_ptr_A,
@@ -773,24 +790,37 @@ void csrgemm_symbolic_fill_wf_per_row(J m,
                                       bool                 mul,
                                       bool                 add)
 {
-    csrgemm_symbolic_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(m,
-                                                                                  nk,
-                                                                                  offset,
-                                                                                  perm,
-                                                                                  csr_row_ptr_A,
-                                                                                  csr_col_ind_A,
-                                                                                  csr_row_ptr_B,
-                                                                                  csr_col_ind_B,
-                                                                                  csr_row_ptr_D,
-                                                                                  csr_col_ind_D,
-                                                                                  csr_row_ptr_C,
-                                                                                  csr_col_ind_C,
-                                                                                  idx_base_A,
-                                                                                  idx_base_B,
-                                                                                  idx_base_C,
-                                                                                  idx_base_D,
-                                                                                  mul,
-                                                                                  add);
+    J size   = (group_end != nullptr) ? *group_end - *offset : m;
+    J rows   = BLOCKSIZE / WFSIZE;
+    J stride = static_cast<J>(hipGridDim_x) * rows;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) * rows + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_symbolic_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+            size - shift,
+            nk,
+            &group_offset,
+            perm,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for all wavefronts to release their hash tables
+        __syncthreads();
+    }
 }
 
 // Compute column entries and accumulate values, where each row is processed by a single block
@@ -985,6 +1015,8 @@ ROCSPARSE_DEVICE_ILF void
     }
 }
 
+// Without group_end, there is a block per row of the row group. Otherwise, the size of
+// the group is only known on the device and the blocks stride over its rows.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -994,6 +1026,7 @@ template <unsigned int BLOCKSIZE,
 ROCSPARSE_KERNEL(BLOCKSIZE)
 void csrgemm_symbolic_fill_block_per_row(J nk,
                                          const J* __restrict__ offset,
+                                         const J* __restrict__ group_end,
                                          const J* __restrict__ perm,
                                          const I* __restrict__ csr_row_ptr_A,
                                          const J* __restrict__ csr_col_ind_A,
@@ -1010,29 +1043,42 @@ void csrgemm_symbolic_fill_block_per_row(J nk,
                                          bool                 mul,
                                          bool                 add)
 {
-    csrgemm_symbolic_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
-                                                                                     offset,
-                                                                                     perm,
-                                                                                     csr_row_ptr_A,
-                                                                                     csr_col_ind_A,
-                                                                                     csr_row_ptr_B,
-                                                                                     csr_col_ind_B,
-                                                                                     csr_row_ptr_D,
-                                                                                     csr_col_ind_D,
-                                                                                     csr_row_ptr_C,
-                                                                                     csr_col_ind_C,
-                                                                                     idx_base_A,
-                                                                                     idx_base_B,
-                                                                                     idx_base_C,
-                                                                                     idx_base_D,
-                                                                                     mul,
-                                                                                     add);
+    J stride = hipGridDim_x;
+    J size   = (group_end != nullptr) ? *group_end - *offset : stride;
+
+    for(J shift = 0; static_cast<J>(hipBlockIdx_x) + shift < size; shift += stride)
+    {
+        J group_offset = *offset + shift;
+
+        csrgemm_symbolic_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+            nk,
+            &group_offset,
+            perm,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_row_ptr_D,
+            csr_col_ind_D,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C,
+            idx_base_D,
+            mul,
+            add);
+
+        // Wait for the block to release its shared memory
+        __syncthreads();
+    }
 }
 
 template <typename I, typename J>
 static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 J                    group_size,
                                                 const J*             group_offset,
+                                                const J*             group_end,
                                                 const J*             perm,
                                                 J                    m,
                                                 J                    n,
@@ -1065,6 +1111,7 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                        handle->stream,
                        std::max(k, n),
                        group_offset,
+                       group_end,
                        perm,
                        csr_row_ptr_A,
                        csr_col_ind_A,
@@ -1098,6 +1145,10 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
     // Flag for exceeding shared memory
     constexpr bool exceeding_smem = false;
 
+    // In device sizes mode, the rows are always grouped and the group sizes stay on the
+    // device
+    const bool sizes_on_device = rocsparse_sizes_on_device(handle);
+
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -1122,11 +1173,15 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
                        workspace);
 #undef CSRGEMM_DIM
 
-    J nnz_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    J nnz_max = 0;
+
+    if(!sizes_on_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
 
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
@@ -1140,7 +1195,7 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
     J* d_group_size = reinterpret_cast<J*>(buffer);
     buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_size, 0, sizeof(J) * CSRGEMM_MAXGROUPS, stream));
-    if(nnz_max > 16)
+    if(sizes_on_device || nnz_max > 16)
     {
         // Group size buffer
 
@@ -1177,14 +1232,25 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
                            stream,
                            d_group_size);
 #undef CSRGEMM_DIM
+
+        if(sizes_on_device)
+        {
+            // Store the maximum row nnz before the group offsets overwrite it
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_group_size + CSRGEMM_MAXGROUPS,
+                                               workspace,
+                                               sizeof(J),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
         size_t rocprim_size;
-        // Exclusive sum to obtain group offsets
+        // Exclusive sum to obtain group offsets, the last offset ends the last group
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
                                                     rocprim_size,
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
         void* rocprim_buffer = reinterpret_cast<void*>(buffer);
@@ -1193,7 +1259,7 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
 
@@ -1224,10 +1290,17 @@ static inline rocsparse_status rocsparse_csrgemm_symbolic_calc_preprocess_templa
             hipMemcpyAsync(d_group_size, &m, sizeof(J), hipMemcpyHostToDevice, stream));
         RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
     }
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        d_group_size + CSRGEMM_MAXGROUPS, &nnz_max, sizeof(J), hipMemcpyHostToDevice, stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(!sizes_on_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_group_size + CSRGEMM_MAXGROUPS,
+                                           &nnz_max,
+                                           sizeof(J),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
 
     // Compute columns and accumulate values for each group
     ROCSPARSE_RETURN_STATUS(success);
@@ -1266,18 +1339,45 @@ static inline rocsparse_status
     bb += sizeof(J) * 256;
     const J* d_group_size = reinterpret_cast<const J*>(bb);
 
-    J h_group_size[CSRGEMM_MAXGROUPS + 1];
+    J h_group_size[CSRGEMM_MAXGROUPS + 1] = {};
+
+    // In device sizes mode, the groups are launched without copying their sizes to the
+    // host. The last group can only be rejected for unsorted B and D on the host, such
+    // that unsorted matrices fall back to the host sizes.
+    const bool sizes_on_device
+        = rocsparse_sizes_on_device(handle)
+          && (!info_C->csrgemm_info->mul
+              || descr_B->storage_mode == rocsparse_storage_mode_sorted)
+          && (!info_C->csrgemm_info->add
+              || descr_D->storage_mode == rocsparse_storage_mode_sorted);
 
-    // Copy group sizes to host
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
-                                       d_group_size,
-                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    // Number of blocks of each group in device sizes mode
+    const J group_blocks = csrgemm_device_group_blocks(handle);
+
+    if(sizes_on_device)
+    {
+        // The numeric stage launches from the group sizes on the device as well
+        info_C->csrgemm_info->group_size.clear();
+    }
+    else
+    {
+        // Copy group sizes to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                           d_group_size,
+                                           sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+        // Keep the group sizes, such that the numeric stage does not need to copy them again
+        info_C->csrgemm_info->group_size.assign(h_group_size,
+                                                h_group_size + CSRGEMM_MAXGROUPS + 1);
+    }
+
+    // The rows are always grouped in device sizes mode
     J nnz_max = h_group_size[CSRGEMM_MAXGROUPS];
-    if(nnz_max > 16)
+    if(sizes_on_device || nnz_max > 16)
     {
 
         bb += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
@@ -1302,7 +1402,7 @@ static inline rocsparse_status
     constexpr bool exceeding_smem = false;
 
     // Group 0: 0 - 16 non-zeros per row
-    if(h_group_size[0] > 0)
+    if(sizes_on_device || h_group_size[0] > 0)
     {
 
 #define CSRGEMM_DIM 256
@@ -1312,13 +1412,16 @@ static inline rocsparse_status
                                                              CSRGEMM_SUB,
                                                              CSRGEMM_HASHSIZE,
                                                              CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(sizes_on_device
+                                    ? group_blocks
+                                    : (h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            h_group_size[0],
                            std::max(k, n),
                            &d_group_offset[0],
+                           sizes_on_device ? &d_group_offset[1] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1340,7 +1443,7 @@ static inline rocsparse_status
     }
 
     // Group 1: 17 - 32 non-zeros per row
-    if(h_group_size[1] > 0)
+    if(sizes_on_device || h_group_size[1] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -1350,13 +1453,16 @@ static inline rocsparse_status
                                                              CSRGEMM_SUB,
                                                              CSRGEMM_HASHSIZE,
                                                              CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(sizes_on_device
+                                    ? group_blocks
+                                    : (h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            h_group_size[1],
                            std::max(k, n),
                            &d_group_offset[1],
+                           sizes_on_device ? &d_group_offset[2] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1378,7 +1484,7 @@ static inline rocsparse_status
     }
 
     // Group 2: 33 - 256 non-zeros per row
-    if(h_group_size[2] > 0)
+    if(sizes_on_device || h_group_size[2] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
@@ -1387,12 +1493,13 @@ static inline rocsparse_status
                                                                 CSRGEMM_SUB,
                                                                 CSRGEMM_HASHSIZE,
                                                                 CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[2]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[2]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[2],
+                           sizes_on_device ? &d_group_offset[3] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1414,7 +1521,7 @@ static inline rocsparse_status
     }
 
     // Group 3: 257 - 512 non-zeros per row
-    if(h_group_size[3] > 0)
+    if(sizes_on_device || h_group_size[3] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 32
@@ -1423,12 +1530,13 @@ static inline rocsparse_status
                                                                 CSRGEMM_SUB,
                                                                 CSRGEMM_HASHSIZE,
                                                                 CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[3]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[3]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[3],
+                           sizes_on_device ? &d_group_offset[4] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1450,7 +1558,7 @@ static inline rocsparse_status
     }
 
     // Group 4: 513 - 1024 non-zeros per row
-    if(h_group_size[4] > 0)
+    if(sizes_on_device || h_group_size[4] > 0)
     {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 32
@@ -1459,12 +1567,13 @@ static inline rocsparse_status
                                                                 CSRGEMM_SUB,
                                                                 CSRGEMM_HASHSIZE,
                                                                 CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[4]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[4]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[4],
+                           sizes_on_device ? &d_group_offset[5] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1486,7 +1595,7 @@ static inline rocsparse_status
     }
 
     // Group 5: 1025 - 2048 non-zeros per row
-    if(h_group_size[5] > 0)
+    if(sizes_on_device || h_group_size[5] > 0)
     {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
@@ -1495,12 +1604,13 @@ static inline rocsparse_status
                                                                 CSRGEMM_SUB,
                                                                 CSRGEMM_HASHSIZE,
                                                                 CSRGEMM_FLL_HASH>),
-                           dim3(h_group_size[5]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[5]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            std::max(k, n),
                            &d_group_offset[5],
+                           sizes_on_device ? &d_group_offset[6] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1523,34 +1633,36 @@ static inline rocsparse_status
 
 #ifndef rocsparse_ILP64
     // Group 6: 2049 - 4096 non-zeros per row
-    if(h_group_size[6] > 0 && !exceeding_smem)
+    if((sizes_on_device || h_group_size[6] > 0) && !exceeding_smem)
     {
-        RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                   h_group_size[6],
-                                                   &d_group_offset[6],
-                                                   d_perm,
-                                                   m,
-                                                   n,
-                                                   k,
-                                                   csr_row_ptr_A,
-                                                   csr_col_ind_A,
-                                                   csr_row_ptr_B,
-                                                   csr_col_ind_B,
-                                                   csr_row_ptr_D,
-                                                   csr_col_ind_D,
-                                                   csr_row_ptr_C,
-                                                   csr_col_ind_C,
-                                                   base_A,
-                                                   base_B,
-                                                   descr_C->base,
-                                                   base_D,
-                                                   info_C->csrgemm_info->mul,
-                                                   info_C->csrgemm_info->add));
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_launcher(handle,
+                             sizes_on_device ? group_blocks : h_group_size[6],
+                             &d_group_offset[6],
+                             sizes_on_device ? &d_group_offset[7] : nullptr,
+                             d_perm,
+                             m,
+                             n,
+                             k,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             csr_row_ptr_B,
+                             csr_col_ind_B,
+                             csr_row_ptr_D,
+                             csr_col_ind_D,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             base_A,
+                             base_B,
+                             descr_C->base,
+                             base_D,
+                             info_C->csrgemm_info->mul,
+                             info_C->csrgemm_info->add));
     }
 #endif
 
     // Group 7: more than 4096 non-zeros per row
-    if(h_group_size[7] > 0)
+    if(sizes_on_device || h_group_size[7] > 0)
     {
         // Matrices B and D must be sorted in order to run this path
         if(descr_B->storage_mode == rocsparse_storage_mode_unsorted
@@ -1575,12 +1687,13 @@ static inline rocsparse_status
         hipLaunchKernelGGL((csrgemm_symbolic_fill_block_per_row_multipass<CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_CHUNKSIZE>),
-                           dim3(h_group_size[7]),
+                           dim3(sizes_on_device ? group_blocks : h_group_size[7]),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            n,
                            &d_group_offset[7],
+                           sizes_on_device ? &d_group_offset[CSRGEMM_MAXGROUPS] : nullptr,
                            d_perm,
                            csr_row_ptr_A,
                            csr_col_ind_A,
@@ -1720,6 +1833,10 @@ rocsparse_status
               (const void*&)info_C,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csrgemm_symbolic", m, n, k, nnz_A, nnz_B, nnz_D, nnz_C);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
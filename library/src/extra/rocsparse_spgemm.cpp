@@ -27,7 +27,7 @@
 #include "rocsparse_bsrgemm.hpp"
 #include "rocsparse_csrgemm.hpp"
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename S>
 rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
                                            rocsparse_operation         trans_A,
                                            rocsparse_operation         trans_B,
@@ -45,6 +45,7 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
 template <typename... Ts>
 rocsparse_status rocsparse_spgemm_template_dispatch(rocsparse_indextype itype,
                                                     rocsparse_indextype jtype,
+                                                    rocsparse_datatype  atype,
                                                     rocsparse_datatype  ctype,
                                                     Ts&&... params)
 {
@@ -71,26 +72,36 @@ rocsparse_status rocsparse_spgemm_template_dispatch(rocsparse_indextype itype,
             {
             case rocsparse_datatype_f32_r:
             {
-                return rocsparse_spgemm_template<int32_t, int32_t, float>(params...);
+                return rocsparse_spgemm_template<int32_t, int32_t, float, float>(params...);
             }
             case rocsparse_datatype_f64_r:
             {
-                return rocsparse_spgemm_template<int32_t, int32_t, double>(params...);
+                if(atype == rocsparse_datatype_f32_r)
+                {
+                    return rocsparse_spgemm_template<int32_t, int32_t, double, float>(params...);
+                }
+                return rocsparse_spgemm_template<int32_t, int32_t, double, double>(params...);
             }
             case rocsparse_datatype_f32_c:
             {
-                return rocsparse_spgemm_template<int32_t, int32_t, rocsparse_float_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int32_t,
+                                                 int32_t,
+                                                 rocsparse_float_complex,
+                                                 rocsparse_float_complex>(params...);
             }
             case rocsparse_datatype_f64_c:
             {
-                return rocsparse_spgemm_template<int32_t, int32_t, rocsparse_double_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int32_t,
+                                                 int32_t,
+                                                 rocsparse_double_complex,
+                                                 rocsparse_double_complex>(params...);
             }
             case rocsparse_datatype_i8_r:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -112,26 +123,36 @@ rocsparse_status rocsparse_spgemm_template_dispatch(rocsparse_indextype itype,
             {
             case rocsparse_datatype_f32_r:
             {
-                return rocsparse_spgemm_template<int64_t, int32_t, float>(params...);
+                return rocsparse_spgemm_template<int64_t, int32_t, float, float>(params...);
             }
             case rocsparse_datatype_f64_r:
             {
-                return rocsparse_spgemm_template<int64_t, int32_t, double>(params...);
+                if(atype == rocsparse_datatype_f32_r)
+                {
+                    return rocsparse_spgemm_template<int64_t, int32_t, double, float>(params...);
+                }
+                return rocsparse_spgemm_template<int64_t, int32_t, double, double>(params...);
             }
             case rocsparse_datatype_f32_c:
             {
-                return rocsparse_spgemm_template<int64_t, int32_t, rocsparse_float_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int64_t,
+                                                 int32_t,
+                                                 rocsparse_float_complex,
+                                                 rocsparse_float_complex>(params...);
             }
             case rocsparse_datatype_f64_c:
             {
-                return rocsparse_spgemm_template<int64_t, int32_t, rocsparse_double_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int64_t,
+                                                 int32_t,
+                                                 rocsparse_double_complex,
+                                                 rocsparse_double_complex>(params...);
             }
             case rocsparse_datatype_i8_r:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -143,26 +164,36 @@ rocsparse_status rocsparse_spgemm_template_dispatch(rocsparse_indextype itype,
             {
             case rocsparse_datatype_f32_r:
             {
-                return rocsparse_spgemm_template<int64_t, int64_t, float>(params...);
+                return rocsparse_spgemm_template<int64_t, int64_t, float, float>(params...);
             }
             case rocsparse_datatype_f64_r:
             {
-                return rocsparse_spgemm_template<int64_t, int64_t, double>(params...);
+                if(atype == rocsparse_datatype_f32_r)
+                {
+                    return rocsparse_spgemm_template<int64_t, int64_t, double, float>(params...);
+                }
+                return rocsparse_spgemm_template<int64_t, int64_t, double, double>(params...);
             }
             case rocsparse_datatype_f32_c:
             {
-                return rocsparse_spgemm_template<int64_t, int64_t, rocsparse_float_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int64_t,
+                                                 int64_t,
+                                                 rocsparse_float_complex,
+                                                 rocsparse_float_complex>(params...);
             }
             case rocsparse_datatype_f64_c:
             {
-                return rocsparse_spgemm_template<int64_t, int64_t, rocsparse_double_complex>(
-                    params...);
+                return rocsparse_spgemm_template<int64_t,
+                                                 int64_t,
+                                                 rocsparse_double_complex,
+                                                 rocsparse_double_complex>(params...);
             }
             case rocsparse_datatype_i8_r:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -174,7 +205,7 @@ rocsparse_status rocsparse_spgemm_template_dispatch(rocsparse_indextype itype,
     return rocsparse_status_invalid_value;
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename S>
 rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
                                            rocsparse_operation         trans_A,
                                            rocsparse_operation         trans_B,
@@ -191,6 +222,13 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
 {
     ROCSPARSE_DEBUG_VERBOSE("begin");
 
+    // Mixed precision computation is only supported by the CSR compute stage
+    if(std::is_same<T, S>::value == false
+       && (A->format != rocsparse_format_csr || stage == rocsparse_spgemm_stage_numeric))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     switch(stage)
     {
     case rocsparse_spgemm_stage_auto:
@@ -198,54 +236,54 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
         if(temp_buffer == nullptr)
         {
             RETURN_IF_ROCSPARSE_ERROR(
-                (rocsparse_spgemm_template<I, J, T>(handle,
-                                                    trans_A,
-                                                    trans_B,
-                                                    alpha,
-                                                    A,
-                                                    B,
-                                                    beta,
-                                                    D,
-                                                    C,
-                                                    alg,
-                                                    rocsparse_spgemm_stage_buffer_size,
-                                                    buffer_size,
-                                                    temp_buffer)));
+                (rocsparse_spgemm_template<I, J, T, S>(handle,
+                                                       trans_A,
+                                                       trans_B,
+                                                       alpha,
+                                                       A,
+                                                       B,
+                                                       beta,
+                                                       D,
+                                                       C,
+                                                       alg,
+                                                       rocsparse_spgemm_stage_buffer_size,
+                                                       buffer_size,
+                                                       temp_buffer)));
 
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
         else if(C->nnz == 0)
         {
-            return rocsparse_spgemm_template<I, J, T>(handle,
-                                                      trans_A,
-                                                      trans_B,
-                                                      alpha,
-                                                      A,
-                                                      B,
-                                                      beta,
-                                                      D,
-                                                      C,
-                                                      alg,
-                                                      rocsparse_spgemm_stage_nnz,
-                                                      buffer_size,
-                                                      temp_buffer);
+            return rocsparse_spgemm_template<I, J, T, S>(handle,
+                                                         trans_A,
+                                                         trans_B,
+                                                         alpha,
+                                                         A,
+                                                         B,
+                                                         beta,
+                                                         D,
+                                                         C,
+                                                         alg,
+                                                         rocsparse_spgemm_stage_nnz,
+                                                         buffer_size,
+                                                         temp_buffer);
         }
         else
         {
-            return rocsparse_spgemm_template<I, J, T>(handle,
-                                                      trans_A,
-                                                      trans_B,
-                                                      alpha,
-                                                      A,
-                                                      B,
-                                                      beta,
-                                                      D,
-                                                      C,
-                                                      alg,
-                                                      rocsparse_spgemm_stage_compute,
-                                                      buffer_size,
-                                                      temp_buffer);
+            return rocsparse_spgemm_template<I, J, T, S>(handle,
+                                                         trans_A,
+                                                         trans_B,
+                                                         alpha,
+                                                         A,
+                                                         B,
+                                                         beta,
+                                                         D,
+                                                         C,
+                                                         alg,
+                                                         rocsparse_spgemm_stage_compute,
+                                                         buffer_size,
+                                                         temp_buffer);
         }
         break;
     }
@@ -426,22 +464,22 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
                                               (const T*)alpha,
                                               A->descr,
                                               (I)A->nnz,
-                                              (const T*)A->const_val_data,
+                                              (const S*)A->const_val_data,
                                               (const I*)A->const_row_data,
                                               (const J*)A->const_col_data,
                                               B->descr,
                                               (I)B->nnz,
-                                              (const T*)B->const_val_data,
+                                              (const S*)B->const_val_data,
                                               (const I*)B->const_row_data,
                                               (const J*)B->const_col_data,
                                               (const T*)beta,
                                               D->descr,
                                               (I)D->nnz,
-                                              (const T*)D->const_val_data,
+                                              (const S*)D->const_val_data,
                                               (const I*)D->const_row_data,
                                               (const J*)D->const_col_data,
                                               C->descr,
-                                              (T*)C->val_data,
+                                              (S*)C->val_data,
                                               (const I*)C->const_row_data,
                                               (J*)C->col_data,
                                               C->info,
@@ -631,6 +669,9 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_spgemm", compute_type);
+
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
         return rocsparse_status_invalid_value;
@@ -686,9 +727,16 @@ try
         return rocsparse_status_not_implemented;
     }
 
-    // Check for matching data types while we do not support mixed precision computation
-    if(compute_type != A->data_type || compute_type != B->data_type || compute_type != C->data_type
-       || compute_type != D->data_type)
+    // Check for matching data types of all sparse matrices
+    if(A->data_type != B->data_type || A->data_type != C->data_type || A->data_type != D->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check for matching compute type, the only mixed precision computation supported
+    // is single precision matrices with double precision accumulation
+    if(compute_type != A->data_type
+       && (compute_type != rocsparse_datatype_f64_r || A->data_type != rocsparse_datatype_f32_r))
     {
         return rocsparse_status_not_implemented;
     }
@@ -702,6 +750,7 @@ try
 
     return rocsparse_spgemm_template_dispatch(A->row_type,
                                               A->col_type,
+                                              A->data_type,
                                               compute_type,
                                               handle,
                                               trans_A,
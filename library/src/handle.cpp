@@ -24,6 +24,7 @@
 #include "handle.h"
 #include "definitions.h"
 #include "logging.h"
+#include "profile.h"
 #include "utility.h"
 
 #include <hip/hip_runtime.h>
@@ -49,6 +50,9 @@ _rocsparse_handle::_rocsparse_handle()
     asic_rev = 0;
 #endif
 
+    // Kernel selection parameters
+    rocsparse_tuning_select(&tuning, properties.gcnArchName, wavefront_size);
+
     // Layer mode
     char* str_layer_mode;
     if((str_layer_mode = getenv("ROCSPARSE_LAYER")) == NULL)
@@ -77,6 +81,12 @@ _rocsparse_handle::_rocsparse_handle()
     THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&cone, sizeof(rocsparse_float_complex)));
     THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&zone, sizeof(rocsparse_double_complex)));
 
+    // Memory pool of the default stream
+    memory_pool = rocsparse_memory_pool_acquire(device, stream);
+
+    // Analysis data cache
+    analysis_cache = rocsparse_analysis_cache_create();
+
     // Execute empty kernel for initialization
     hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
 
@@ -119,6 +129,13 @@ _rocsparse_handle::_rocsparse_handle()
     {
         open_log_stream(&log_debug_os, &log_debug_ofs, "ROCSPARSE_LOG_DEBUG_PATH");
     }
+
+    // Open log_profile file and start profiling
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        open_log_stream(&log_profile_os, &log_profile_ofs, "ROCSPARSE_LOG_PROFILE_PATH");
+        profiler = std::make_shared<rocsparse_profiler>();
+    }
 }
 
 /*******************************************************************************
@@ -126,12 +143,29 @@ _rocsparse_handle::_rocsparse_handle()
  ******************************************************************************/
 _rocsparse_handle::~_rocsparse_handle()
 {
+    // Write the profiling summary, in JSON format if the file name ends with .json
+    if(profiler != nullptr)
+    {
+        const char* path = getenv("ROCSPARSE_LOG_PROFILE_PATH");
+        std::string ext  = (path != nullptr) ? std::string(path) : std::string();
+        bool        json = ext.size() >= 5 && ext.compare(ext.size() - 5, 5, ".json") == 0;
+
+        profiler->write(*log_profile_os, json);
+        profiler = nullptr;
+    }
+
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(buffer));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(sone));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(done));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(cone));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(zone));
 
+    // Release the analysis data cache before the memory pool
+    rocsparse_analysis_cache_destroy(analysis_cache);
+
+    // Release the memory pool
+    rocsparse_memory_pool_release(memory_pool);
+
     // Close log files
     if(log_trace_ofs.is_open())
     {
@@ -145,6 +179,10 @@ _rocsparse_handle::~_rocsparse_handle()
     {
         log_debug_ofs.close();
     }
+    if(log_profile_ofs.is_open())
+    {
+        log_profile_ofs.close();
+    }
 }
 
 /*******************************************************************************
@@ -159,6 +197,12 @@ _rocsparse_handle::~_rocsparse_handle()
 rocsparse_status _rocsparse_handle::set_stream(hipStream_t user_stream)
 {
     // TODO check if stream is valid
+    if(user_stream != stream)
+    {
+        // Switch to the memory pool of the new stream
+        rocsparse_memory_pool_release(memory_pool);
+        memory_pool = rocsparse_memory_pool_acquire(device, user_stream);
+    }
     stream = user_stream;
     return rocsparse_status_success;
 }
@@ -172,6 +216,30 @@ rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Returns true if sizes computed on the device must not be copied back to
+ * the host, that is if the sizes mode is device or the stream is being captured.
+ *******************************************************************************/
+bool rocsparse_sizes_on_device(rocsparse_handle handle)
+{
+    // Synchronizing a stream that is being captured would invalidate the capture
+    return handle->sizes_mode == rocsparse_sizes_mode_device
+           || rocsparse_stream_is_capturing(handle);
+}
+
+/********************************************************************************
+ * \brief Returns true if the stream of the handle is being captured into a graph.
+ *******************************************************************************/
+bool rocsparse_stream_is_capturing(rocsparse_handle handle)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(handle->stream, &capture_status) != hipSuccess)
+    {
+        return true;
+    }
+    return capture_status != hipStreamCaptureStatusNone;
+}
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -210,6 +278,9 @@ rocsparse_status rocsparse_copy_csrmv_info(rocsparse_csrmv_info       dest,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Wait for a pending device analysis of the source
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_csrmv_info_size(src, true));
+
     // check if destination already contains data. If it does, verify its allocated arrays are the same size as source
     bool previously_created = false;
     previously_created |= (dest->size != 0);
@@ -338,6 +409,65 @@ rocsparse_status rocsparse_copy_csrmv_info(rocsparse_csrmv_info       dest,
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Update the number of row blocks of csrmv info, once the device
+ * analysis has completed. If blocking is set, wait for its completion.
+ *******************************************************************************/
+rocsparse_status rocsparse_update_csrmv_info_size(rocsparse_csrmv_info info, bool blocking)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Nothing pending
+    if(!info->size_pending)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(blocking)
+    {
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(info->size_event));
+    }
+    else
+    {
+        hipError_t status = hipEventQuery(info->size_event);
+
+        if(status == hipErrorNotReady)
+        {
+            // Device analysis still running, keep the upper bound
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_HIP_ERROR(status);
+    }
+
+    // Number of row blocks plus the terminating entry
+    switch(info->index_type_I)
+    {
+    case rocsparse_indextype_u16:
+    {
+        info->size = *static_cast<const uint16_t*>(info->size_host) + 1;
+        break;
+    }
+    case rocsparse_indextype_i32:
+    {
+        info->size = *static_cast<const int32_t*>(info->size_host) + 1;
+        break;
+    }
+    case rocsparse_indextype_i64:
+    {
+        info->size = *static_cast<const int64_t*>(info->size_host) + 1;
+        break;
+    }
+    }
+
+    info->size_pending = false;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief Destroy csrmv info.
  *******************************************************************************/
@@ -348,6 +478,19 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         return rocsparse_status_success;
     }
 
+    // Pinned host memory must not be released while the device analysis is pending
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_csrmv_info_size(info, true));
+
+    if(info->size_event != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipEventDestroy(info->size_event));
+    }
+
+    if(info->size_host != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipHostFree(info->size_host));
+    }
+
     // Clean up row blocks
     if(info->size > 0)
     {
@@ -415,6 +558,7 @@ rocsparse_status rocsparse_copy_trm_info(rocsparse_trm_info dest, const rocspars
     previously_created |= (dest->trmt_perm != nullptr);
     previously_created |= (dest->trmt_row_ptr != nullptr);
     previously_created |= (dest->trmt_col_ind != nullptr);
+    previously_created |= (dest->level_ptr != nullptr);
 
     previously_created |= (dest->m != 0);
     previously_created |= (dest->nnz != 0);
@@ -429,6 +573,7 @@ rocsparse_status rocsparse_copy_trm_info(rocsparse_trm_info dest, const rocspars
         // Sparsity pattern of dest and src must match
         bool invalid = false;
         invalid |= (dest->max_nnz != src->max_nnz);
+        invalid |= (dest->nlevels != src->nlevels);
         invalid |= (dest->m != src->m);
         invalid |= (dest->nnz != src->nnz);
         invalid |= (dest->index_type_I != src->index_type_I);
@@ -533,6 +678,23 @@ rocsparse_status rocsparse_copy_trm_info(rocsparse_trm_info dest, const rocspars
             dest->trmt_col_ind, src->trmt_col_ind, J_size * src->nnz, hipMemcpyDeviceToDevice));
     }
 
+    if(src->level_ptr != nullptr)
+    {
+        if(dest->level_ptr == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                rocsparse_hipMalloc((void**)&(dest->level_ptr), J_size * (src->nlevels + 1)));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(dest->level_ptr,
+                                      src->level_ptr,
+                                      J_size * (src->nlevels + 1),
+                                      hipMemcpyDeviceToDevice));
+    }
+
+    dest->nlevels        = src->nlevels;
+    dest->max_level_size = src->max_level_size;
+    dest->host_level_ptr = src->host_level_ptr;
+
     dest->max_nnz      = src->max_nnz;
     dest->m            = src->m;
     dest->nnz          = src->nnz;
@@ -589,6 +751,13 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trmt_col_ind = nullptr;
     }
 
+    // Clear level set arrays
+    if(info->level_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->level_ptr));
+        info->level_ptr = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -691,6 +860,8 @@ rocsparse_status rocsparse_copy_csrgemm_info(rocsparse_csrgemm_info       dest,
     dest->mul = src->mul;
     dest->add = src->add;
 
+    dest->group_size = src->group_size;
+
     return rocsparse_status_success;
 }
 
@@ -787,3 +958,225 @@ rocsparse_status rocsparse_destroy_csritsv_info(rocsparse_csritsv_info info)
     }
     return rocsparse_status_success;
 }
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the sparsity pattern of the
+ * incomplete LU factorization with level of fill, gathered during
+ * csriluk_analysis. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csriluk_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Copy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_copy_csriluk_info(rocsparse_csriluk_info       dest,
+                                             const rocsparse_csriluk_info src)
+{
+    if(dest == nullptr || src == nullptr || dest == src)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Sparsity pattern of dest and src must match, if dest already holds one
+    if(dest->lu_row_ptr != nullptr && (dest->m != src->m || dest->lu_nnz != src->lu_nnz))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(src->lu_row_ptr != nullptr)
+    {
+        if(dest->lu_row_ptr == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&(dest->lu_row_ptr),
+                                                    sizeof(rocsparse_int) * (src->m + 1)));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(dest->lu_row_ptr,
+                                      src->lu_row_ptr,
+                                      sizeof(rocsparse_int) * (src->m + 1),
+                                      hipMemcpyDeviceToDevice));
+    }
+
+    if(src->lu_col_ind != nullptr)
+    {
+        if(dest->lu_col_ind == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&(dest->lu_col_ind),
+                                                    sizeof(rocsparse_int) * src->lu_nnz));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(dest->lu_col_ind,
+                                      src->lu_col_ind,
+                                      sizeof(rocsparse_int) * src->lu_nnz,
+                                      hipMemcpyDeviceToDevice));
+    }
+
+    if(src->lu_info != nullptr)
+    {
+        if(dest->lu_info == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&dest->lu_info));
+        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_copy_trm_info(dest->lu_info, src->lu_info));
+
+        // The analysed sparsity pattern is owned by the csriluk info struct
+        dest->lu_info->trm_row_ptr = dest->lu_row_ptr;
+        dest->lu_info->trm_col_ind = dest->lu_col_ind;
+    }
+
+    dest->level  = src->level;
+    dest->m      = src->m;
+    dest->lu_nnz = src->lu_nnz;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up
+    if(info->lu_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->lu_row_ptr));
+        info->lu_row_ptr = nullptr;
+    }
+
+    if(info->lu_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->lu_col_ind));
+        info->lu_col_ind = nullptr;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->lu_info));
+    info->lu_info = nullptr;
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrmc_info is a structure holding the color partition of the
+ * color ordered matrix, gathered during csrmc_reorder. It must be initialized
+ * using the rocsparse_create_csrmc_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrmc_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmc_info(rocsparse_csrmc_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrmc_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Copy csrmc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_copy_csrmc_info(rocsparse_csrmc_info       dest,
+                                           const rocsparse_csrmc_info src)
+{
+    if(dest == nullptr || src == nullptr || dest == src)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Size of dest and src must match, if dest already holds a color partition
+    if(dest->diag_ind != nullptr && dest->m != src->m)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(src->diag_ind != nullptr)
+    {
+        if(dest->diag_ind == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                rocsparse_hipMalloc((void**)&(dest->diag_ind), sizeof(rocsparse_int) * src->m));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(dest->diag_ind,
+                                      src->diag_ind,
+                                      sizeof(rocsparse_int) * src->m,
+                                      hipMemcpyDeviceToDevice));
+    }
+
+    dest->m         = src->m;
+    dest->ncolors   = src->ncolors;
+    dest->color_ptr = src->color_ptr;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy csrmc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmc_info(rocsparse_csrmc_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up
+    if(info->diag_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->diag_ind));
+        info->diag_ind = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
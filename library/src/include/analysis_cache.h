@@ -0,0 +1,152 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse.h"
+
+#include <hip/hip_runtime_api.h>
+
+struct _rocsparse_trm_info;
+struct _rocsparse_csrmv_info;
+
+//
+// Cache of analysis data keyed by a fingerprint of the sparsity pattern.
+//
+// Each handle owns a cache holding a copy of the most recently computed analysis
+// data. When an analysis routine is called for a sparsity pattern that has been
+// analysed before, possibly with other arrays and another rocsparse_mat_info, the
+// cached data is copied into the matrix info instead of being recomputed. Entries
+// are evicted in least recently used order once the capacity is reached. A capacity
+// of zero, the default unless ROCSPARSE_ANALYSIS_CACHE is set, disables the cache.
+//
+struct _rocsparse_analysis_cache;
+typedef _rocsparse_analysis_cache* rocsparse_analysis_cache;
+
+//
+// Kind of analysis data held by a cache entry.
+//
+typedef enum rocsparse_analysis_cache_kind_
+{
+    rocsparse_analysis_cache_kind_trm         = 0,
+    rocsparse_analysis_cache_kind_csrmv       = 1,
+    rocsparse_analysis_cache_kind_csrgemm_nnz = 2
+} rocsparse_analysis_cache_kind;
+
+//
+// Key of a cache entry. hash is the fingerprint of the sparsity pattern, or the
+// combined fingerprints of all the patterns involved. sizes holds (m, n, nnz), or
+// (m, n, k) for csrgemm. options holds the parameters the analysis depends on, e.g.
+// the operation, the fill mode and the diagonal type.
+//
+struct rocsparse_analysis_cache_key
+{
+    rocsparse_analysis_cache_kind kind = rocsparse_analysis_cache_kind_trm;
+    uint64_t                      hash{};
+    int64_t                       sizes[3]{};
+    rocsparse_indextype           index_type_I = rocsparse_indextype_u16;
+    rocsparse_indextype           index_type_J = rocsparse_indextype_u16;
+    int                           options[4]{};
+
+    bool operator==(const rocsparse_analysis_cache_key& that) const;
+};
+
+//
+// Create a cache, with the default capacity, and destroy it.
+//
+rocsparse_analysis_cache rocsparse_analysis_cache_create();
+void                     rocsparse_analysis_cache_destroy(rocsparse_analysis_cache cache);
+
+//
+// Return true if the capacity is not zero, i.e. analysis routines must compute the
+// fingerprint of their sparsity pattern and look it up.
+//
+bool rocsparse_analysis_cache_enabled(const _rocsparse_analysis_cache* cache);
+
+//
+// Set the maximum number of entries, evicting the least recently used ones.
+//
+rocsparse_status rocsparse_analysis_cache_set_capacity(rocsparse_analysis_cache cache,
+                                                       size_t                   max_entries);
+
+//
+// Release all entries and reset the statistics.
+//
+rocsparse_status rocsparse_analysis_cache_clear(rocsparse_analysis_cache cache);
+
+//
+// Number of entries, and number of lookups that found or missed an entry.
+//
+void rocsparse_analysis_cache_get_info(const _rocsparse_analysis_cache* cache,
+                                       size_t*                          num_entries,
+                                       size_t*                          num_hits,
+                                       size_t*                          num_misses);
+
+//
+// Triangular analysis data (csrsv, csrsm, csrilu0, csric0 and their BSR variants),
+// with the zero pivot found by the analysis. On a hit, the arrays of trm and the
+// zero pivot are allocated, if needed, and filled. The pointers to the matrix
+// arrays are left to the caller.
+//
+rocsparse_status rocsparse_analysis_cache_find_trm(rocsparse_analysis_cache            cache,
+                                                   const rocsparse_analysis_cache_key& key,
+                                                   _rocsparse_trm_info*                trm,
+                                                   void**                              zero_pivot,
+                                                   hipStream_t                         stream,
+                                                   bool*                               found);
+rocsparse_status rocsparse_analysis_cache_insert_trm(rocsparse_analysis_cache            cache,
+                                                     const rocsparse_analysis_cache_key& key,
+                                                     const _rocsparse_trm_info*          trm,
+                                                     const void*                         zero_pivot,
+                                                     hipStream_t                         stream);
+
+//
+// csrmv analysis data (CSR-Adaptive row blocks).
+//
+rocsparse_status rocsparse_analysis_cache_find_csrmv(rocsparse_analysis_cache            cache,
+                                                     const rocsparse_analysis_cache_key& key,
+                                                     _rocsparse_csrmv_info*              csrmv,
+                                                     bool*                               found);
+rocsparse_status rocsparse_analysis_cache_insert_csrmv(rocsparse_analysis_cache            cache,
+                                                       const rocsparse_analysis_cache_key& key,
+                                                       const _rocsparse_csrmv_info*        csrmv,
+                                                       hipStream_t                         stream);
+
+//
+// csrgemm symbolic stage, i.e. the row pointer array and the number of non-zero
+// entries of C computed by csrgemm_nnz. On a hit, csr_row_ptr_C is filled and the
+// number of non-zero entries is returned in nnz_C, on the host.
+//
+rocsparse_status rocsparse_analysis_cache_find_csrgemm_nnz(rocsparse_analysis_cache cache,
+                                                           const rocsparse_analysis_cache_key& key,
+                                                           void*       csr_row_ptr_C,
+                                                           int64_t*    nnz_C,
+                                                           hipStream_t stream,
+                                                           bool*       found);
+rocsparse_status
+    rocsparse_analysis_cache_insert_csrgemm_nnz(rocsparse_analysis_cache            cache,
+                                                const rocsparse_analysis_cache_key& key,
+                                                const void*                         csr_row_ptr_C,
+                                                int64_t                             nnz_C,
+                                                hipStream_t                         stream);
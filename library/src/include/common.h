@@ -28,6 +28,7 @@
 #ifdef WIN32
 #include <intrin.h>
 #endif
+#include <hip/hip_bfloat16.h>
 #include <hip/hip_runtime.h>
 
 // clang-format off
@@ -64,6 +65,8 @@ __device__ __host__ __forceinline__ unsigned int fnp2(unsigned int x)
 }
 
 __device__ __forceinline__ int8_t rocsparse_ldg(const int8_t* ptr) { return __ldg(ptr); }
+__device__ __forceinline__ _Float16 rocsparse_ldg(const _Float16* ptr) { return *ptr; }
+__device__ __forceinline__ hip_bfloat16 rocsparse_ldg(const hip_bfloat16* ptr) { return *ptr; }
 __device__ __forceinline__ int32_t rocsparse_ldg(const int32_t* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ int64_t rocsparse_ldg(const int64_t* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ float rocsparse_ldg(const float* ptr) { return __ldg(ptr); }
@@ -123,6 +126,8 @@ __device__ __forceinline__ rocsparse_double_complex rocsparse_sqrt(rocsparse_dou
 }
 
 __device__ __forceinline__ int32_t rocsparse_conj(const int32_t& x) { return x; }
+__device__ __forceinline__ _Float16 rocsparse_conj(const _Float16& x) { return x; }
+__device__ __forceinline__ hip_bfloat16 rocsparse_conj(const hip_bfloat16& x) { return x; }
 __device__ __forceinline__ float rocsparse_conj(const float& x) { return x; }
 __device__ __forceinline__ double rocsparse_conj(const double& x) { return x; }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_conj(const rocsparse_float_complex& x) { return std::conj(x); }
@@ -163,6 +168,8 @@ __device__ __forceinline__ double rocsparse_nontemporal_load(const double* ptr)
 __device__ __forceinline__ rocsparse_float_complex rocsparse_nontemporal_load(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__builtin_nontemporal_load((const float*)ptr), __builtin_nontemporal_load((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_nontemporal_load(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__builtin_nontemporal_load((const double*)ptr), __builtin_nontemporal_load((const double*)ptr + 1)); }
 __device__ __forceinline__ int8_t rocsparse_nontemporal_load(const int8_t* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ _Float16 rocsparse_nontemporal_load(const _Float16* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ hip_bfloat16 rocsparse_nontemporal_load(const hip_bfloat16* ptr) { hip_bfloat16 val; val.data = __builtin_nontemporal_load(&ptr->data); return val; }
 __device__ __forceinline__ int32_t rocsparse_nontemporal_load(const int32_t* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ int64_t rocsparse_nontemporal_load(const int64_t* ptr) { return __builtin_nontemporal_load(ptr); }
 
@@ -47,7 +47,12 @@ public:
     ENVARIABLE(VERBOSE)               \
     ENVARIABLE(MEMSTAT)               \
     ENVARIABLE(MEMSTAT_FORCE_MANAGED) \
-    ENVARIABLE(MEMSTAT_GUARDS)
+    ENVARIABLE(MEMSTAT_GUARDS)        \
+    ENVARIABLE(CSRMV_HOST_ANALYSIS)   \
+    ENVARIABLE(CSRMV_CHECK_ANALYSIS)  \
+    ENVARIABLE(NO_MEMORY_POOL)        \
+    ENVARIABLE(ANALYSIS_CACHE)        \
+    ENVARIABLE(SPMV_AUTOTUNE)
 
     //
     // Specification of the enum and the array of all values.
@@ -24,18 +24,26 @@
 
 #pragma once
 
+#include "analysis_cache.h"
+#include "memory_pool.h"
 #include "rocsparse.h"
+#include "tuning.h"
 
 #include <fstream>
 #include <hip/hip_runtime_api.h>
 #include <iostream>
+#include <memory>
 #include <vector>
 
+class rocsparse_profiler;
+
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
 typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
 typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
 typedef struct _rocsparse_csritsv_info* rocsparse_csritsv_info;
+typedef struct _rocsparse_csriluk_info* rocsparse_csriluk_info;
+typedef struct _rocsparse_csrmc_info*   rocsparse_csrmc_info;
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -64,10 +72,16 @@ struct _rocsparse_handle
     int wavefront_size;
     // asic revision
     int asic_rev;
+    // kernel selection parameters of the device
+    rocsparse_tuning_params tuning;
     // stream ; default stream is system stream NULL
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // sizes mode ; default mode is host
+    rocsparse_sizes_mode sizes_mode = rocsparse_sizes_mode_host;
+    // number of iterative ILU0 sweeps between two device convergence checks
+    rocsparse_int itilu0_check_interval = 1;
     // logging mode
     rocsparse_layer_mode layer_mode;
     // device buffer
@@ -79,16 +93,36 @@ struct _rocsparse_handle
     // device complex one
     rocsparse_float_complex*  cone;
     rocsparse_double_complex* zone;
+    // stream-ordered memory pool of the stream
+    rocsparse_memory_pool memory_pool{};
+    // analysis data cache, keyed by sparsity pattern
+    rocsparse_analysis_cache analysis_cache{};
 
     // logging streams
     std::ofstream log_trace_ofs;
     std::ofstream log_bench_ofs;
     std::ofstream log_debug_ofs;
+    std::ofstream log_profile_ofs;
     std::ostream* log_trace_os{};
     std::ostream* log_bench_os{};
     std::ostream* log_debug_os{};
+    std::ostream* log_profile_os{};
+
+    // profiler, shared with the routines being profiled
+    std::shared_ptr<rocsparse_profiler> profiler;
 };
 
+/********************************************************************************
+ * \brief Returns true if sizes computed on the device must not be copied back to
+ * the host, that is if the sizes mode is device or the stream is being captured.
+ *******************************************************************************/
+bool rocsparse_sizes_on_device(rocsparse_handle handle);
+
+/********************************************************************************
+ * \brief Returns true if the stream of the handle is being captured into a graph.
+ *******************************************************************************/
+bool rocsparse_stream_is_capturing(rocsparse_handle handle);
+
 /********************************************************************************
  * \brief rocsparse_mat_descr is a structure holding the rocsparse matrix
  * descriptor. It must be initialized using rocsparse_create_mat_descr()
@@ -141,6 +175,9 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_col_ind{};
     void*          coo_val{};
 
+    // predicted hybmv memory traffic in bytes
+    int64_t hybmv_bytes{};
+
     rocsparse_datatype data_type_T = rocsparse_datatype_f32_r;
 };
 
@@ -178,8 +215,10 @@ struct _rocsparse_mat_info
     rocsparse_trm_info     csrsmt_lower_info{};
     rocsparse_csrgemm_info csrgemm_info{};
     rocsparse_csritsv_info csritsv_info{};
+    rocsparse_csriluk_info csriluk_info{};
+    rocsparse_csrmc_info   csrmc_info{};
 
-    // zero pivot for csrsv, csrsm, csrilu0, csric0
+    // zero pivot for csrsv, csrsm, csrilu0, csriluk, csrmcilu0, csric0
     void* zero_pivot{};
 
     // numeric boost for ilu0
@@ -215,6 +254,15 @@ struct _rocsparse_csrmv_info
     unsigned int* wg_flags{};
     void*         wg_ids{};
 
+    // exact number of row blocks computed by the device analysis, copied
+    // asynchronously to pinned host memory. Until size_event has completed,
+    // size holds an upper bound and unused row blocks are skipped. The pinned
+    // memory and the event are only released with the info, since freeing
+    // pinned memory synchronizes the device.
+    void*      size_host{};
+    hipEvent_t size_event{};
+    bool       size_pending{};
+
     // some data to verify correct execution
     rocsparse_operation         trans = rocsparse_operation_none;
     int64_t                     m{};
@@ -243,6 +291,12 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
 rocsparse_status rocsparse_copy_csrmv_info(rocsparse_csrmv_info       dest,
                                            const rocsparse_csrmv_info src);
 
+/********************************************************************************
+ * \brief Update the number of row blocks of csrmv info, once the device
+ * analysis has completed. If blocking is set, wait for its completion.
+ *******************************************************************************/
+rocsparse_status rocsparse_update_csrmv_info_size(rocsparse_csrmv_info info, bool blocking);
+
 /********************************************************************************
  * \brief Destroy csrmv info.
  *******************************************************************************/
@@ -262,6 +316,14 @@ struct _rocsparse_trm_info
     void* trmt_row_ptr{};
     void* trmt_col_ind{};
 
+    // number of levels and rows of the largest level
+    int64_t nlevels{};
+    int64_t max_level_size{};
+    // device array to hold the start of each level in row_map, followed by m
+    void* level_ptr{};
+    // host copy of level_ptr, to schedule the level set solve
+    std::vector<int64_t> host_level_ptr{};
+
     // some data to verify correct execution
     int64_t                     m{};
     int64_t                     nnz{};
@@ -331,6 +393,90 @@ rocsparse_status rocsparse_copy_csritsv_info(rocsparse_csritsv_info       dest,
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csritsv_info(rocsparse_csritsv_info info);
 
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the sparsity pattern of the
+ * incomplete LU factorization with level of fill, gathered during
+ * csriluk_analysis. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+struct _rocsparse_csriluk_info
+{
+    // level of fill
+    int64_t level{};
+
+    // sparsity pattern of the incomplete LU factors, in the index base of A
+    int64_t m{};
+    int64_t lu_nnz{};
+    void*   lu_row_ptr{};
+    void*   lu_col_ind{};
+
+    // analysis meta data of the sparsity pattern of the incomplete LU factors
+    rocsparse_trm_info lu_info{};
+};
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the sparsity pattern of the
+ * incomplete LU factorization with level of fill, gathered during
+ * csriluk_analysis. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info);
+
+/********************************************************************************
+ * \brief Copy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_copy_csriluk_info(rocsparse_csriluk_info       dest,
+                                             const rocsparse_csriluk_info src);
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrmc_info is a structure holding the color partition of the
+ * color ordered matrix, gathered during csrmc_reorder. It must be initialized
+ * using the rocsparse_create_csrmc_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrmc_info().
+ *******************************************************************************/
+struct _rocsparse_csrmc_info
+{
+    // number of rows of the color ordered matrix
+    int64_t m{};
+
+    // number of colors
+    int64_t ncolors{};
+
+    // host array of ncolors + 1 offsets of the colors into the rows of the color
+    // ordered matrix
+    std::vector<rocsparse_int> color_ptr{};
+
+    // position of the diagonal entry of each row of the color ordered matrix, -1 if
+    // the row has no diagonal entry
+    void* diag_ind{};
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrmc_info is a structure holding the color partition of the
+ * color ordered matrix, gathered during csrmc_reorder. It must be initialized
+ * using the rocsparse_create_csrmc_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrmc_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmc_info(rocsparse_csrmc_info* info);
+
+/********************************************************************************
+ * \brief Copy csrmc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_copy_csrmc_info(rocsparse_csrmc_info       dest,
+                                           const rocsparse_csrmc_info src);
+
+/********************************************************************************
+ * \brief Destroy csrmc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmc_info(rocsparse_csrmc_info info);
+
 /********************************************************************************
  * \brief rocsparse_csrgemm_info is a structure holding the rocsparse csrgemm
  * info data gathered during csrgemm_buffer_size. It must be initialized using
@@ -343,6 +489,10 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+
+    // Row group sizes followed by the maximum row nnz of C, gathered during the
+    // symbolic stage, empty otherwise
+    std::vector<int64_t> group_size;
 };
 
 /********************************************************************************
@@ -396,6 +546,17 @@ struct _rocsparse_spmat_descr
 
     mutable bool analysed{};
 
+    // SpMV algorithm selected by rocsparse_spmv_alg_auto and the operation it was selected for
+    mutable rocsparse_spmv_alg  spmv_alg{};
+    mutable rocsparse_operation spmv_alg_trans{};
+
+    // Row counts of the rocsparse_spmv_alg_csr_binned bins, gathered in the preprocess stage
+    mutable std::vector<int64_t> spmv_bin_size{};
+
+    // Number of levels and rows of the largest level, gathered in the SpSV preprocess stage
+    mutable int64_t spsv_nlevels{};
+    mutable int64_t spsv_max_level_size{};
+
     int64_t rows{};
     int64_t cols{};
     int64_t nnz{};
@@ -429,6 +590,7 @@ struct _rocsparse_spmat_descr
     int64_t batch_stride{};
     int64_t offsets_batch_stride{};
     int64_t columns_values_batch_stride{};
+    int64_t values_batch_stride{};
 };
 
 struct _rocsparse_dnvec_descr
@@ -439,6 +601,9 @@ struct _rocsparse_dnvec_descr
     void*              values{};
     const void*        const_values{};
     rocsparse_datatype data_type{};
+
+    int64_t batch_count{};
+    int64_t batch_stride{};
 };
 
 struct _rocsparse_dnmat_descr
@@ -0,0 +1,85 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <hip/hip_runtime_api.h>
+
+//
+// Stream-ordered caching allocator.
+//
+// A pool serves the device allocations issued on one stream of one device. It is
+// shared by all handles using this stream and lives as long as one of them does.
+// Blocks are rounded up to one of four size classes per power of two, at most 25%
+// above the request, and cached in size-class bins when they are freed, so that
+// repeated analyses or buffer allocations do not go back to the HIP runtime. Blocks
+// leaving the pool are freed with hipFreeAsync. Allocations issued on a stream without
+// pool, larger than the largest size class or during stream capture are forwarded to
+// hipMallocAsync.
+//
+struct _rocsparse_memory_pool;
+typedef _rocsparse_memory_pool* rocsparse_memory_pool;
+
+//
+// Get the pool of (device, stream), creating it if needed. Return nullptr if the
+// pool is disabled through ROCSPARSE_NO_MEMORY_POOL.
+//
+rocsparse_memory_pool rocsparse_memory_pool_acquire(int device, hipStream_t stream);
+
+//
+// Release a pool obtained from rocsparse_memory_pool_acquire. When the last user
+// releases it, the cached blocks are freed, and the blocks still in use are freed
+// when they are returned.
+//
+void rocsparse_memory_pool_release(rocsparse_memory_pool pool);
+
+//
+// Set the maximum number of bytes the pool keeps cached.
+//
+hipError_t rocsparse_memory_pool_set_limit(rocsparse_memory_pool pool, size_t max_cached_bytes);
+
+//
+// Free all cached blocks and reset the high water mark.
+//
+hipError_t rocsparse_memory_pool_trim(rocsparse_memory_pool pool);
+
+//
+// Bytes in use, bytes cached and high water mark of the bytes held by the pool.
+//
+void rocsparse_memory_pool_get_info(rocsparse_memory_pool pool,
+                                    size_t*               bytes_in_use,
+                                    size_t*               bytes_cached,
+                                    size_t*               high_water_mark);
+
+//
+// Number of bytes allocated with rocsparse_memory_pool_malloc_async by the calling thread.
+//
+size_t rocsparse_memory_pool_thread_allocated_bytes();
+
+//
+// Allocation routines behind the memstat.h macros.
+//
+hipError_t rocsparse_memory_pool_malloc_async(void** mem, size_t nbytes, hipStream_t stream);
+hipError_t rocsparse_memory_pool_free_async(void* mem, hipStream_t stream);
+hipError_t rocsparse_memory_pool_free(void* mem);
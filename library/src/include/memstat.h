@@ -32,17 +32,19 @@
 //
 #ifndef ROCSPARSE_WITH_MEMSTAT
 
+#include "memory_pool.h"
+
 #define rocsparse_hipMalloc(p_, nbytes_) hipMalloc(p_, nbytes_)
-#define rocsparse_hipFree(p_) hipFree(p_)
 
-// if hip version is atleast 5.3.0 hipMallocAsync and hipFreeAsync are defined
-#if HIP_VERSION >= 50300000
-#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) hipMallocAsync(p_, nbytes_, stream_)
-#define rocsparse_hipFreeAsync(p_, stream_) hipFreeAsync(p_, stream_)
-#else
-#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) hipMalloc(p_, nbytes_)
-#define rocsparse_hipFreeAsync(p_, stream_) hipFree(p_)
-#endif
+//
+// Stream-ordered allocations are served by the memory pool of the stream, if any.
+// Freeing a pointer that does not belong to a pool falls back to HIP.
+//
+#define rocsparse_hipFree(p_) rocsparse_memory_pool_free((void*)(p_))
+
+#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) \
+    rocsparse_memory_pool_malloc_async((void**)(p_), (nbytes_), stream_)
+#define rocsparse_hipFreeAsync(p_, stream_) rocsparse_memory_pool_free_async((void*)(p_), stream_)
 
 #define rocsparse_hipHostMalloc(p_, nbytes_) hipHostMalloc(p_, nbytes_)
 #define rocsparse_hipHostFree(p_) hipHostFree(p_)
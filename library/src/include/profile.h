@@ -0,0 +1,204 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+#include "logging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+//
+// Profiling layer, enabled with rocsparse_layer_mode_log_profile.
+//
+// The routines that declare a rocsparse_profile_guard are profiled. The guard measures the
+// wall time until the routine returns and the GPU time between two events recorded on the
+// stream of the handle. Calls are aggregated per routine, data type and size bucket, the
+// size bucket being the largest power of two not larger than the largest integral argument.
+// The summary is written when the handle is destroyed.
+//
+class rocsparse_profiler
+{
+public:
+    rocsparse_profiler();
+    ~rocsparse_profiler();
+
+    hipError_t get_event(hipEvent_t* event);
+
+    // Record a completed call. The events are owned by the profiler from now on.
+    void record(const std::string& name,
+                const std::string& type,
+                int64_t            size,
+                double             wall_time_us,
+                hipEvent_t         start,
+                hipEvent_t         stop,
+                double             flops,
+                double             bytes,
+                size_t             device_bytes,
+                size_t             buffer_bytes);
+
+    // Write the summary, in JSON format if json is true, in CSV format otherwise.
+    void write(std::ostream& os, bool json);
+
+private:
+    struct entry
+    {
+        int64_t calls        = 0;
+        double  wall_time_us = 0.0;
+        int64_t gpu_calls    = 0;
+        double  gpu_time_us  = 0.0;
+        double  flops        = 0.0;
+        double  bytes        = 0.0;
+        size_t  device_bytes = 0;
+        size_t  buffer_bytes = 0;
+    };
+
+    struct pending
+    {
+        entry*     e;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    // Accumulate the GPU time of the completed calls, wait for all of them if wait is true.
+    void resolve(bool wait);
+
+    std::mutex                                                 mutex;
+    std::map<std::tuple<std::string, std::string, int>, entry> entries;
+    std::vector<pending>                                       pending_events;
+    std::vector<hipEvent_t>                                    events;
+};
+
+//
+// Profiling guard of a routine. A routine is profiled from the declaration of its guard,
+// after its arguments are logged, until it returns:
+//
+//     const rocsparse_profile_guard profile_guard(
+//         handle, replaceX<T>("rocsparse_Xcsrmv"), rocsparse_get_datatype<T>(), m, n, nnz);
+//
+// The data type and the size of the call are taken from the first rocsparse_datatype and
+// the largest integral argument following the name. Templated routines pass the data type
+// of their value type with rocsparse_get_datatype, see utility.h. The routine reports its estimated work
+// with log_profile and the size of its temporary buffer with log_profile_buffer, see
+// utility.h. The work and the buffers of nested guards are accounted to the outer routine.
+//
+class rocsparse_profile_guard
+{
+public:
+    template <typename... Ts>
+    rocsparse_profile_guard(rocsparse_handle handle, const std::string& name, const Ts&... xs)
+    {
+        if(handle != nullptr && handle->profiler != nullptr)
+        {
+            int64_t     size = -1;
+            std::string type;
+            each_args(profile_arg{size, type}, xs...);
+            this->begin(handle, name, type, size);
+        }
+    }
+
+    ~rocsparse_profile_guard();
+
+    rocsparse_profile_guard(const rocsparse_profile_guard&) = delete;
+    rocsparse_profile_guard& operator=(const rocsparse_profile_guard&) = delete;
+
+    // Add the estimated work of the innermost routine being profiled on this thread.
+    static void add_work(double flops, double bytes);
+
+    // Report the temporary buffer of the innermost routine being profiled on this thread.
+    static void add_buffer(size_t buffer_size);
+
+private:
+    // Collect the size and the data type of a routine from its arguments
+    struct profile_arg
+    {
+        int64_t&     size;
+        std::string& type;
+
+        template <typename T>
+        void operator()(const T& x) const
+        {
+            using is_size = std::integral_constant<bool,
+                                                   std::is_integral<T>::value
+                                                       && !std::is_same<T, bool>::value>;
+            this->integral(x, is_size{});
+        }
+
+        void operator()(const rocsparse_datatype& x) const
+        {
+            if(this->type.empty())
+            {
+                this->type = rocsparse_profile_guard::datatype_name(x);
+            }
+        }
+
+        template <typename T>
+        void integral(const T& x, std::true_type) const
+        {
+            this->size = std::max(this->size, static_cast<int64_t>(x));
+        }
+
+        template <typename T>
+        void integral(const T& x, std::false_type) const
+        {
+        }
+    };
+
+    static const char* datatype_name(rocsparse_datatype datatype);
+
+    void begin(rocsparse_handle   handle,
+               const std::string& name,
+               const std::string& type,
+               int64_t            size);
+
+    std::shared_ptr<rocsparse_profiler> profiler;
+
+    std::string name;
+    std::string type;
+    int64_t     size = -1;
+
+    hipStream_t stream = nullptr;
+    hipEvent_t  start  = nullptr;
+    hipEvent_t  stop   = nullptr;
+
+    std::chrono::steady_clock::time_point wall_start;
+
+    double flops              = 0.0;
+    double bytes              = 0.0;
+    size_t buffer_bytes       = 0;
+    size_t device_bytes_start = 0;
+
+    rocsparse_profile_guard* parent = nullptr;
+
+    static thread_local rocsparse_profile_guard* s_current;
+};
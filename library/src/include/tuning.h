@@ -0,0 +1,91 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include <cstdint>
+
+//
+// Compile time configuration of the CSR-Adaptive SpMV kernels. BLOCK_SIZE non-zeros are
+// staged in shared memory by each workgroup of WG_SIZE threads, rows of more than
+// BLOCK_SIZE entries are split into chunks of BLOCK_MULTIPLIER * BLOCK_SIZE non-zeros,
+// and row blocks of more than ROWS_FOR_VECTOR rows are reduced by CSR-Stream. These
+// determine the shared memory footprint of the kernels and the encoding of the row
+// blocks, and can thus not be part of the runtime tuning parameters below.
+//
+struct rocsparse_csrmv_adaptive_config
+{
+    static constexpr int block_size       = 1024;
+    static constexpr int block_multiplier = 3;
+    static constexpr int rows_for_vector  = 1;
+    static constexpr int wg_size          = 256;
+};
+
+//
+// Kernel selection parameters that are chosen at run time.
+//
+// Each handle selects the entry of the built-in table that matches the architecture name of
+// its device, e.g. gfx90a, or the generic entry of its wavefront size otherwise. The table
+// has no architecture specific entries yet, so this amounts to the wavefront size defaults.
+// Any of the parameters can then be overridden by the tuning file ROCSPARSE_TUNING_FILE
+// points to.
+// The file consists of "name = value" lines, grouped in sections that apply to a device
+// only if their name, e.g. [gfx90a] or [wave32], matches it. Lines preceding the first
+// section and lines of the section [*] apply to all devices. Later lines take precedence,
+// # starts a comment. Related thresholds the file leaves out of order, e.g. csrmv_short_row
+// above csrmv_long_row, keep their previous values. rocsparse-tune generates the file from
+// parameter sweeps.
+//
+struct rocsparse_tuning_params
+{
+    // CSR-Adaptive analysis. Rows longer than csrmv_long_row entries are not batched with
+    // shorter rows; the host analysis only cuts off a series of long rows at a row shorter
+    // than csrmv_short_row entries. The device analysis starts a new row block every
+    // csrmv_row_window rows.
+    int32_t csrmv_long_row   = 128;
+    int32_t csrmv_short_row  = 32;
+    int32_t csrmv_row_window = 1024;
+
+    // CSR SpMM (row split and general algorithms). The rows of A are processed by
+    // sub-wavefronts of 8, 16, 32 or 64 threads for an average row length below
+    // csrmm_nnz_per_row[0], [1], [2] and above, respectively.
+    int32_t csrmm_nnz_per_row[3] = {16, 32, 64};
+
+    // SpGEMM. Rows are sorted into groups of similar size once the longest row of C has more
+    // than csrgemm_group_nnz entries, and once the longest row of intermediate products
+    // has more than csrgemm_group_products entries when computing the non-zero pattern.
+    // Smaller values than the defaults merely enable the grouping more often, larger values
+    // are clamped to the defaults as the first group cannot hold longer rows.
+    int32_t csrgemm_group_nnz      = 16;
+    int32_t csrgemm_group_products = 32;
+};
+
+//
+// Select the tuning parameters of a device from its architecture name, e.g.
+// "gfx90a:sramecc+:xnack-", and its wavefront size, and apply the tuning file.
+//
+void rocsparse_tuning_select(rocsparse_tuning_params* params,
+                             const char*              arch_name,
+                             int                      wavefront_size);
@@ -27,8 +27,10 @@
 #include "definitions.h"
 #include "handle.h"
 #include "logging.h"
+#include "profile.h"
 #include <algorithm>
 #include <exception>
+#include <hip/hip_bfloat16.h>
 
 // Return the leftmost significant bit position
 #if defined(rocsparse_ILP64)
@@ -112,6 +114,39 @@ void log_trace(rocsparse_handle handle, H head, Ts&&... xs)
     }
 }
 
+// if profiling is turned on with
+// (handle->layer_mode & rocsparse_layer_mode_log_profile) == true
+// then
+// log_profile will add the estimated number of floating point
+// operations and bytes moved to the routine being profiled,
+// see rocsparse_profile_guard
+static inline void log_profile(rocsparse_handle handle, double flops, double bytes)
+{
+    if(nullptr != handle)
+    {
+        if(handle->layer_mode & rocsparse_layer_mode_log_profile)
+        {
+            rocsparse_profile_guard::add_work(flops, bytes);
+        }
+    }
+}
+
+// if profiling is turned on with
+// (handle->layer_mode & rocsparse_layer_mode_log_profile) == true
+// then
+// log_profile_buffer will report the size of the temporary
+// buffer used by the routine being profiled
+static inline void log_profile_buffer(rocsparse_handle handle, size_t buffer_size)
+{
+    if(nullptr != handle)
+    {
+        if(handle->layer_mode & rocsparse_layer_mode_log_profile)
+        {
+            rocsparse_profile_guard::add_buffer(buffer_size);
+        }
+    }
+}
+
 // if bench logging is turned on with
 // (handle->layer_mode & rocsparse_layer_mode_log_bench) == true
 // then
@@ -254,6 +289,71 @@ std::string replaceX(std::string input_string)
     return input_string;
 }
 
+// returns the rocsparse_datatype of typename T, to report the data type of a templated
+// routine, see rocsparse_profile_guard
+template <typename T>
+inline rocsparse_datatype rocsparse_get_datatype();
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<float>()
+{
+    return rocsparse_datatype_f32_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<double>()
+{
+    return rocsparse_datatype_f64_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<rocsparse_float_complex>()
+{
+    return rocsparse_datatype_f32_c;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<rocsparse_double_complex>()
+{
+    return rocsparse_datatype_f64_c;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<int8_t>()
+{
+    return rocsparse_datatype_i8_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<uint8_t>()
+{
+    return rocsparse_datatype_u8_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<int32_t>()
+{
+    return rocsparse_datatype_i32_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<uint32_t>()
+{
+    return rocsparse_datatype_u32_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<_Float16>()
+{
+    return rocsparse_datatype_f16_r;
+}
+
+template <>
+inline rocsparse_datatype rocsparse_get_datatype<hip_bfloat16>()
+{
+    return rocsparse_datatype_bf16_r;
+}
+
 //
 // These macros can be redefined if the developer includes src/include/debug.h
 //
@@ -380,6 +480,20 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_storage_mode value_)
     return true;
 };
 
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_sizes_mode value_)
+{
+    switch(value_)
+    {
+    case rocsparse_sizes_mode_host:
+    case rocsparse_sizes_mode_device:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
 template <>
 inline bool rocsparse_enum_utils::is_invalid(rocsparse_index_base value_)
 {
@@ -467,6 +581,8 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_datatype value_)
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return false;
     }
@@ -510,6 +626,7 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_hyb_partition value)
     case rocsparse_hyb_partition_auto:
     case rocsparse_hyb_partition_user:
     case rocsparse_hyb_partition_max:
+    case rocsparse_hyb_partition_cost:
     {
         return false;
     }
@@ -571,6 +688,9 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spmv_alg value_)
     case rocsparse_spmv_alg_ell:
     case rocsparse_spmv_alg_coo_atomic:
     case rocsparse_spmv_alg_bsr:
+    case rocsparse_spmv_alg_auto:
+    case rocsparse_spmv_alg_csr_binned:
+    case rocsparse_spmv_alg_csr_merge:
     {
         return false;
     }
@@ -584,6 +704,7 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spsv_alg value_)
     switch(value_)
     {
     case rocsparse_spsv_alg_default:
+    case rocsparse_spsv_alg_level_set:
     {
         return false;
     }
@@ -0,0 +1,162 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "common.h"
+
+// Index of the entry (r, c) of a block of a Blocked ELL matrix
+template <rocsparse_direction DIR, typename I>
+ROCSPARSE_DEVICE_ILF int64_t bell_block_ind(int64_t block, I r, I c, I block_dim)
+{
+    return (DIR == rocsparse_direction_row) ? block * block_dim * block_dim + block_dim * r + c
+                                            : block * block_dim * block_dim + block_dim * c + r;
+}
+
+// Blocked ELL SpMV for general, non-transposed matrices. Each thread computes
+// one row, such that consecutive threads read consecutive entries of the blocks
+// stored column-wise.
+template <unsigned int        BLOCKSIZE,
+          rocsparse_direction DIR,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void bellmvn_device(I                    mb,
+                                         I                    nb,
+                                         I                    bell_width,
+                                         I                    block_dim,
+                                         T                    alpha,
+                                         const I*             bell_col_ind,
+                                         const A*             bell_val,
+                                         const X*             x,
+                                         T                    beta,
+                                         Y*                   y,
+                                         rocsparse_index_base idx_base)
+{
+    int64_t row = static_cast<int64_t>(BLOCKSIZE) * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= static_cast<int64_t>(mb) * block_dim)
+    {
+        return;
+    }
+
+    I block_row = row / block_dim;
+    I r         = row % block_dim;
+
+    T sum = static_cast<T>(0);
+    for(I p = 0; p < bell_width; ++p)
+    {
+        int64_t block     = ELL_IND(block_row, (int64_t)p, mb, bell_width);
+        I       block_col = rocsparse_ldg(bell_col_ind + block) - idx_base;
+
+        // Padded blocks
+        if(block_col < 0 || block_col >= nb)
+        {
+            continue;
+        }
+
+        const X* xb = x + static_cast<int64_t>(block_dim) * block_col;
+
+        for(I c = 0; c < block_dim; ++c)
+        {
+            sum = rocsparse_fma<T>(
+                rocsparse_nontemporal_load(bell_val + bell_block_ind<DIR>(block, r, c, block_dim)),
+                rocsparse_ldg(xb + c),
+                sum);
+        }
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        Y yv = rocsparse_nontemporal_load(y + row);
+        rocsparse_nontemporal_store(rocsparse_fma<T>(beta, yv, alpha * sum), y + row);
+    }
+    else
+    {
+        rocsparse_nontemporal_store(alpha * sum, y + row);
+    }
+}
+
+// Blocked ELL SpMV for general, (conjugate) transposed matrices
+template <unsigned int        BLOCKSIZE,
+          rocsparse_direction DIR,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void bellmvt_device(rocsparse_operation  trans,
+                                         I                    mb,
+                                         I                    nb,
+                                         I                    bell_width,
+                                         I                    block_dim,
+                                         T                    alpha,
+                                         const I*             bell_col_ind,
+                                         const A*             bell_val,
+                                         const X*             x,
+                                         Y*                   y,
+                                         rocsparse_index_base idx_base)
+{
+    int64_t row = static_cast<int64_t>(BLOCKSIZE) * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= static_cast<int64_t>(mb) * block_dim)
+    {
+        return;
+    }
+
+    I block_row = row / block_dim;
+    I r         = row % block_dim;
+
+    T row_val = alpha * rocsparse_ldg(x + row);
+
+    for(I p = 0; p < bell_width; ++p)
+    {
+        int64_t block     = ELL_IND(block_row, (int64_t)p, mb, bell_width);
+        I       block_col = rocsparse_ldg(bell_col_ind + block) - idx_base;
+
+        // Padded blocks
+        if(block_col < 0 || block_col >= nb)
+        {
+            continue;
+        }
+
+        Y* yb = y + static_cast<int64_t>(block_dim) * block_col;
+
+        for(I c = 0; c < block_dim; ++c)
+        {
+            A val
+                = rocsparse_nontemporal_load(bell_val + bell_block_ind<DIR>(block, r, c, block_dim));
+
+            if(trans == rocsparse_operation_conjugate_transpose)
+            {
+                val = rocsparse_conj(val);
+            }
+
+            atomicAdd(&yb[c], row_val * val);
+        }
+    }
+}
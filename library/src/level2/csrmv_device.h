@@ -1,6 +1,6 @@
 /*! \file */
 /* ************************************************************************
- * Copyright (C) 2018-2022 Advanced Micro Devices, Inc. All rights Reserved.
+ * Copyright (C) 2018-2023 Advanced Micro Devices, Inc. All rights Reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -476,3 +476,406 @@ ROCSPARSE_DEVICE_ILF void csrmvn_adaptive_device(bool                 conj,
         }
     }
 }
+
+// Device side CSR-Adaptive row block analysis.
+//
+// The host analysis walks the rows serially and cuts a row block whenever the
+// accumulated number of non-zeros would exceed the local memory capacity. On
+// the device, every row decides independently whether it starts a new row block:
+//
+// - Rows are grouped by the window of BLOCKSIZE / 2 non-zeros their first entry
+//   falls into. Every row that is part of a multi-row block holds at most
+//   BLOCKSIZE / 2 entries, thus a row block never exceeds BLOCKSIZE non-zeros.
+// - Rows with more than BLOCKSIZE / 2 entries are placed into their own row block.
+//   If they exceed BLOCKSIZE entries, they are split across multiple workgroups
+//   (CSR-LongRows).
+// - Short rows (<= long_row entries) and long rows are never mixed.
+// - A row block never spans more than row_window rows.
+template <rocsparse_int BLOCKSIZE, rocsparse_int BLOCK_MULTIPLIER, typename I, typename J>
+ROCSPARSE_DEVICE_ILF I csrmvn_adaptive_analysis_num_wgs(const I* csr_row_ptr,
+                                                        J        row,
+                                                        int32_t  long_row,
+                                                        int32_t  row_window)
+{
+    I row_begin  = csr_row_ptr[row];
+    I row_length = csr_row_ptr[row + 1] - row_begin;
+
+    if(row_length > BLOCKSIZE)
+    {
+        // Check to ensure #workgroups can fit in 32 bits, if not
+        // then the last workgroup will do all the remaining work
+        I num_wgs = (row_length - 1) / (BLOCK_MULTIPLIER * BLOCKSIZE) + 1;
+        return (num_wgs < static_cast<I>(INT_MAX)) ? num_wgs : static_cast<I>(INT_MAX);
+    }
+
+    if(row == 0 || row_length > BLOCKSIZE / 2 || (row % row_window) == 0)
+    {
+        return 1;
+    }
+
+    I prev_begin  = csr_row_ptr[row - 1];
+    I prev_length = row_begin - prev_begin;
+
+    if(prev_length > BLOCKSIZE / 2)
+    {
+        return 1;
+    }
+
+    if((row_length > long_row) != (prev_length > long_row))
+    {
+        return 1;
+    }
+
+    // Index base shifts all windows equally and can thus be ignored
+    if((row_begin / (BLOCKSIZE / 2)) != (prev_begin / (BLOCKSIZE / 2)))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+template <unsigned int  BLOCKSIZE,
+          rocsparse_int CSRMV_BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          typename I,
+          typename J>
+ROCSPARSE_DEVICE_ILF void csrmvn_adaptive_analysis_count_device(
+    J m, const I* csr_row_ptr, int32_t long_row, int32_t row_window, I* num_wgs)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    // Last entry is required for the exclusive scan to hold the total
+    num_wgs[row] = (row < m)
+                       ? csrmvn_adaptive_analysis_num_wgs<CSRMV_BLOCKSIZE, BLOCK_MULTIPLIER>(
+                           csr_row_ptr, row, long_row, row_window)
+                       : static_cast<I>(0);
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_DEVICE_ILF void csrmvn_adaptive_analysis_init_device(
+    J m, size_t size, I* row_blocks, unsigned int* wg_flags, J* wg_ids)
+{
+    size_t gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    // Unused row blocks point past the last row, the kernel will skip them
+    row_blocks[gid] = m;
+    wg_flags[gid]   = 0U;
+    wg_ids[gid]     = static_cast<J>(0);
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_DEVICE_ILF void
+    csrmvn_adaptive_analysis_fill_device(J m, const I* wg_offset, I* row_blocks, J* wg_ids)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    I offset = wg_offset[row];
+    I nwgs   = wg_offset[row + 1] - offset;
+
+    // All workgroups of a long row start at the same row
+    for(I w = 0; w < nwgs; ++w)
+    {
+        row_blocks[offset + w] = row;
+        wg_ids[offset + w]     = static_cast<J>(w);
+    }
+}
+
+template <unsigned int  BLOCKSIZE,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_SIZE,
+          typename I,
+          typename J>
+ROCSPARSE_DEVICE_ILF void
+    csrmvn_adaptive_analysis_reduction_device(const I* total, const I* row_blocks, J* wg_ids)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= *total)
+    {
+        return;
+    }
+
+    I num_rows = row_blocks[gid + 1] - row_blocks[gid];
+
+    // If this row block fits into CSR-Stream, store how many threads
+    // can be used to do a parallel reduction (see numThreadsForReduction())
+    if(num_rows > ROWS_FOR_VECTOR)
+    {
+        wg_ids[gid] = static_cast<J>(WG_SIZE >> (32 - __clz(static_cast<int>(num_rows - 1))));
+    }
+}
+
+// Binned csrmv analysis, rows are assigned to bins by their length
+// (<= 1, 2-4, 5-16, 17-64, <= MAX_BLOCK_ROW_NNZ and longer rows)
+template <unsigned int BLOCKSIZE,
+          unsigned int NBINS,
+          unsigned int MAX_BLOCK_ROW_NNZ,
+          typename I,
+          typename J>
+ROCSPARSE_DEVICE_ILF void csrmvn_binned_analysis_count_device(J        m,
+                                                              const I* csr_row_ptr,
+                                                              int*     bin_key,
+                                                              J*       bin_row,
+                                                              J*       bin_size,
+                                                              I*       max_row_nnz)
+{
+    __shared__ J shared_size[NBINS];
+    __shared__ I shared_max;
+
+    int tid = hipThreadIdx_x;
+    J   row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    if(tid < NBINS)
+    {
+        shared_size[tid] = static_cast<J>(0);
+    }
+
+    if(tid == 0)
+    {
+        shared_max = static_cast<I>(0);
+    }
+
+    __syncthreads();
+
+    if(row < m)
+    {
+        I row_nnz = csr_row_ptr[row + 1] - csr_row_ptr[row];
+
+        int bin = (row_nnz <= 1)                   ? 0
+                  : (row_nnz <= 4)                 ? 1
+                  : (row_nnz <= 16)                ? 2
+                  : (row_nnz <= 64)                ? 3
+                  : (row_nnz <= MAX_BLOCK_ROW_NNZ) ? 4
+                                                   : 5;
+
+        bin_key[row] = bin;
+        bin_row[row] = row;
+
+        atomicAdd(&shared_size[bin], static_cast<J>(1));
+
+        // Longest row of the multi block bin determines the number of blocks per row
+        if(bin == NBINS - 1)
+        {
+            atomicMax(&shared_max, row_nnz);
+        }
+    }
+
+    __syncthreads();
+
+    if(tid < NBINS && shared_size[tid] > 0)
+    {
+        atomicAdd(&bin_size[tid], shared_size[tid]);
+    }
+
+    if(tid == 0 && shared_max > 0)
+    {
+        atomicMax(max_row_nnz, shared_max);
+    }
+}
+
+// Binned csrmv for short rows, each group of WF_SIZE lanes processes one row of the bin
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_binned_wf_device(bool                 conj,
+                                                  J                    nrows,
+                                                  const J*             bin_row,
+                                                  T                    alpha,
+                                                  const I*             csr_row_ptr,
+                                                  const J*             csr_col_ind,
+                                                  const A*             csr_val,
+                                                  const X*             x,
+                                                  T                    beta,
+                                                  Y*                   y,
+                                                  rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    J   idx = (static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    J row       = bin_row[idx];
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(I j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        sum = rocsparse_fma<T>(
+            alpha * conj_val(csr_val[j], conj), rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+    }
+
+    // Obtain row sum using parallel reduction
+    sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+    // Last lane of each group writes result into global memory
+    if(lid == WF_SIZE - 1)
+    {
+        if(beta == static_cast<T>(0))
+        {
+            y[row] = sum;
+        }
+        else
+        {
+            y[row] = rocsparse_fma<T>(beta, y[row], sum);
+        }
+    }
+}
+
+// Binned csrmv for long rows, each block processes one row of the bin
+template <unsigned int BLOCKSIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_binned_block_device(bool                 conj,
+                                                     const J*             bin_row,
+                                                     T                    alpha,
+                                                     const I*             csr_row_ptr,
+                                                     const J*             csr_col_ind,
+                                                     const A*             csr_val,
+                                                     const X*             x,
+                                                     T                    beta,
+                                                     Y*                   y,
+                                                     rocsparse_index_base idx_base)
+{
+    __shared__ T sdata[BLOCKSIZE];
+
+    int tid = hipThreadIdx_x;
+
+    J row       = bin_row[hipBlockIdx_x];
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(I j = row_begin + tid; j < row_end; j += BLOCKSIZE)
+    {
+        sum = rocsparse_fma<T>(
+            alpha * conj_val(csr_val[j], conj), rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+    }
+
+    sdata[tid] = sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        if(beta == static_cast<T>(0))
+        {
+            y[row] = sdata[0];
+        }
+        else
+        {
+            y[row] = rocsparse_fma<T>(beta, y[row], sdata[0]);
+        }
+    }
+}
+
+// Scale the rows of the multi block bin with beta before the blocks accumulate into them
+template <typename J, typename Y, typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_binned_scale_device(J nrows, const J* bin_row, T beta, Y* y)
+{
+    J idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    J row = bin_row[idx];
+
+    if(beta == static_cast<T>(0))
+    {
+        y[row] = static_cast<Y>(0);
+    }
+    else
+    {
+        y[row] *= beta;
+    }
+}
+
+// Binned csrmv for very long rows, blocks_per_row blocks process one row of the bin and
+// accumulate their partial sums atomically
+template <unsigned int BLOCKSIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_binned_multiblock_device(bool                 conj,
+                                                          J                    blocks_per_row,
+                                                          const J*             bin_row,
+                                                          T                    alpha,
+                                                          const I*             csr_row_ptr,
+                                                          const J*             csr_col_ind,
+                                                          const A*             csr_val,
+                                                          const X*             x,
+                                                          Y*                   y,
+                                                          rocsparse_index_base idx_base)
+{
+    __shared__ T sdata[BLOCKSIZE];
+
+    int tid = hipThreadIdx_x;
+    J   idx = hipBlockIdx_x / blocks_per_row;
+    J   bid = hipBlockIdx_x % blocks_per_row;
+
+    J row       = bin_row[idx];
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Blocks of shorter rows might not have any work
+    if(row_begin + bid * BLOCKSIZE >= row_end)
+    {
+        return;
+    }
+
+    T sum = static_cast<T>(0);
+
+    for(I j = row_begin + bid * BLOCKSIZE + tid; j < row_end; j += blocks_per_row * BLOCKSIZE)
+    {
+        sum = rocsparse_fma<T>(
+            alpha * conj_val(csr_val[j], conj), rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+    }
+
+    sdata[tid] = sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicAdd(&y[row], sdata[0]);
+    }
+}
@@ -0,0 +1,263 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+// See Merrill D., Garland M. (2016) Merge-based Parallel Sparse Matrix-Vector Multiplication.
+// In: SC '16: Proceedings of the International Conference for High Performance Computing,
+// Networking, Storage and Analysis. https://doi.org/10.1109/SC.2016.57
+//
+// The merge path of a CSR matrix walks the m row end offsets and the nnz entries, consuming
+// an entry while the current row has one left and a row end otherwise. Its m + nnz items are
+// split evenly across threads and blocks, independent of the row lengths.
+
+// Returns the row coordinate of the merge path on the given diagonal, searched in [lo, hi]
+template <typename I, typename J>
+ROCSPARSE_DEVICE_ILF J csrmvn_merge_path_search(
+    int64_t diag, J lo, J hi, const I* __restrict__ csr_row_ptr, rocsparse_index_base idx_base)
+{
+    while(lo < hi)
+    {
+        J mid = lo + (hi - lo) / 2;
+
+        // Row end offset of mid is consumed before the diagonal
+        if(static_cast<int64_t>(csr_row_ptr[mid + 1] - idx_base) + mid + 1 <= diag)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Determines the start row of each block, nblocks + 1 coordinates in total
+template <unsigned int BLOCKSIZE, unsigned int ITEMS_PER_BLOCK, typename I, typename J>
+ROCSPARSE_DEVICE_ILF void csrmvn_merge_path_partition_device(J m,
+                                                             I nnz,
+                                                             I nblocks,
+                                                             const I* __restrict__ csr_row_ptr,
+                                                             J* __restrict__ row_limits,
+                                                             rocsparse_index_base idx_base)
+{
+    I bid = static_cast<I>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(bid > nblocks)
+    {
+        return;
+    }
+
+    int64_t diag = min(static_cast<int64_t>(bid) * ITEMS_PER_BLOCK, static_cast<int64_t>(m) + nnz);
+
+    J lo = static_cast<J>(max(diag - nnz, static_cast<int64_t>(0)));
+    J hi = static_cast<J>(min(diag, static_cast<int64_t>(m)));
+
+    row_limits[bid] = csrmvn_merge_path_search(diag, lo, hi, csr_row_ptr, idx_base);
+}
+
+// Each thread walks ITEMS_PER_THREAD consecutive items of the merge path of its block. Rows
+// ending within a thread are written to y, partial sums of rows that continue into the next
+// thread are carried out. The carries of a block are combined by a segmented scan and added
+// to their rows, the carry of the last row of the block is left for the fixup kernel.
+template <unsigned int BLOCKSIZE,
+          unsigned int ITEMS_PER_THREAD,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_merge_path_device(bool conj,
+                                                   J    m,
+                                                   I    nnz,
+                                                   const J* __restrict__ row_limits,
+                                                   T        alpha,
+                                                   const I* __restrict__ csr_row_ptr,
+                                                   const J* __restrict__ csr_col_ind,
+                                                   const A* __restrict__ csr_val,
+                                                   const X* __restrict__ x,
+                                                   T beta,
+                                                   Y* __restrict__ y,
+                                                   J* __restrict__ carry_row,
+                                                   T* __restrict__ carry_val,
+                                                   rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    I   bid = hipBlockIdx_x;
+
+    __shared__ J shared_row[BLOCKSIZE];
+    __shared__ T shared_val[BLOCKSIZE];
+
+    // Merge path coordinates of the block
+    int64_t path_end    = static_cast<int64_t>(m) + nnz;
+    int64_t block_begin = min(static_cast<int64_t>(bid) * BLOCKSIZE * ITEMS_PER_THREAD, path_end);
+    int64_t block_end   = min(block_begin + BLOCKSIZE * ITEMS_PER_THREAD, path_end);
+
+    J row_begin = row_limits[bid];
+    J row_end   = row_limits[bid + 1];
+    I nz_begin  = static_cast<I>(block_begin - row_begin);
+    I nz_end    = static_cast<I>(block_end - row_end);
+
+    // Merge path coordinates of the thread, searched within the block
+    int64_t diag     = min(block_begin + tid * ITEMS_PER_THREAD, block_end);
+    int64_t diag_end = min(diag + ITEMS_PER_THREAD, block_end);
+
+    J lo = static_cast<J>(max(static_cast<int64_t>(row_begin), diag - nz_end));
+    J hi = static_cast<J>(min(static_cast<int64_t>(row_end), diag - nz_begin));
+
+    J row = csrmvn_merge_path_search(diag, lo, hi, csr_row_ptr, idx_base);
+    I nz  = static_cast<I>(diag - row);
+
+    I row_nz_end = (row < m) ? csr_row_ptr[row + 1] - idx_base : nnz;
+
+    T sum = static_cast<T>(0);
+
+    for(; diag < diag_end; ++diag)
+    {
+        if(nz < row_nz_end)
+        {
+            sum = rocsparse_fma<T>(alpha * conj_val(csr_val[nz], conj),
+                                   rocsparse_ldg(x + csr_col_ind[nz] - idx_base),
+                                   sum);
+            ++nz;
+        }
+        else
+        {
+            // Row end, the carries of preceding threads are added after the block scan
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma<T>(beta, y[row], sum);
+            }
+
+            sum = static_cast<T>(0);
+            ++row;
+            row_nz_end = (row < m) ? csr_row_ptr[row + 1] - idx_base : nnz;
+        }
+    }
+
+    // Carry out, threads ending in the same row are adjacent
+    shared_row[tid] = row;
+    shared_val[tid] = sum;
+    __syncthreads();
+
+    // Segmented scan of the carries
+    for(int j = 1; j < BLOCKSIZE; j <<= 1)
+    {
+        if(tid >= j && row == shared_row[tid - j])
+        {
+            sum = sum + shared_val[tid - j];
+        }
+        __syncthreads();
+        shared_val[tid] = sum;
+        __syncthreads();
+    }
+
+    if(tid < BLOCKSIZE - 1)
+    {
+        // The last thread of a segment holds its sum, the row has been completed by the
+        // next thread
+        if(row != shared_row[tid + 1])
+        {
+            y[row] = y[row] + sum;
+        }
+    }
+    else
+    {
+        // The last row of the block continues into the next block
+        carry_row[bid] = row;
+        carry_val[bid] = sum;
+    }
+}
+
+// Adds the block carries to y. Each block of the fixup kernel combines the carries of
+// BLOCKSIZE consecutive merge path blocks by a segmented scan, the last carry of each row
+// holds its sum. Rows whose carries continue into a neighbouring chunk are added atomically.
+template <unsigned int BLOCKSIZE, typename I, typename J, typename Y, typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_merge_path_fixup_device(J m,
+                                                         I nblocks,
+                                                         const J* __restrict__ carry_row,
+                                                         const T* __restrict__ carry_val,
+                                                         Y* __restrict__ y)
+{
+    int tid         = hipThreadIdx_x;
+    I   chunk_begin = static_cast<I>(hipBlockIdx_x) * BLOCKSIZE;
+    I   bid         = chunk_begin + tid;
+
+    __shared__ J shared_row[BLOCKSIZE];
+    __shared__ T shared_val[BLOCKSIZE];
+
+    // Carry rows are non-decreasing, padding past the last block belongs to the end of the path
+    J row = (bid < nblocks) ? carry_row[bid] : m;
+    T sum = (bid < nblocks) ? carry_val[bid] : static_cast<T>(0);
+
+    shared_row[tid] = row;
+    shared_val[tid] = sum;
+    __syncthreads();
+
+    // Segmented scan of the carries
+    for(int j = 1; j < BLOCKSIZE; j <<= 1)
+    {
+        if(tid >= j && row == shared_row[tid - j])
+        {
+            sum = sum + shared_val[tid - j];
+        }
+        __syncthreads();
+        shared_val[tid] = sum;
+        __syncthreads();
+    }
+
+    // The carry of the last block belongs to the end of the path
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Only the last carry of a row within the chunk adds its sum
+    if(tid < BLOCKSIZE - 1 && row == shared_row[tid + 1])
+    {
+        return;
+    }
+
+    bool continues = (tid == BLOCKSIZE - 1 && bid + 1 < nblocks && carry_row[bid + 1] == row)
+                     || (chunk_begin > 0 && shared_row[0] == row
+                         && carry_row[chunk_begin - 1] == row);
+
+    if(continues)
+    {
+        atomicAdd(&y[row], static_cast<Y>(sum));
+    }
+    else
+    {
+        y[row] = y[row] + sum;
+    }
+}
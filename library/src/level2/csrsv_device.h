@@ -509,3 +509,219 @@ ROCSPARSE_DEVICE_ILF void csrsv_device(J m,
         atomicOr(&done_array[row], 1);
     }
 }
+
+// Marks the start of each level in the level sorted row map, followed by the end of the
+// last level. The depth of a row is its level + 1, the rows of the matrix are sorted by depth.
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsv_analysis_level_ptr_kernel(J m,
+                                     const int* __restrict__ sorted_depth,
+                                     J* __restrict__ level_begin)
+{
+    J idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= m)
+    {
+        return;
+    }
+
+    int depth = sorted_depth[idx];
+
+    if(idx == 0 || sorted_depth[idx - 1] != depth)
+    {
+        level_begin[depth - 1] = idx;
+    }
+
+    if(idx == m - 1)
+    {
+        level_begin[depth] = m;
+    }
+}
+
+// Solves a single row with a wavefront. All rows this row depends on have been
+// solved already, thus there is no need to wait for any dependency.
+template <unsigned int WF_SIZE, typename I, typename J, typename T>
+ROCSPARSE_DEVICE_ILF void csrsv_level_row_device(J row,
+                                                 int lid,
+                                                 T alpha,
+                                                 const I* __restrict__ csr_row_ptr,
+                                                 const J* __restrict__ csr_col_ind,
+                                                 const T* __restrict__ csr_val,
+                                                 const T* __restrict__ x,
+                                                 T* __restrict__ y,
+                                                 T* __restrict__ diagonal,
+                                                 J* __restrict__ zero_pivot,
+                                                 rocsparse_index_base idx_base,
+                                                 rocsparse_fill_mode  fill_mode,
+                                                 rocsparse_diag_type  diag_type)
+{
+    // Current row entry point and exit point
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable.
+    T local_sum = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * rocsparse_nontemporal_load(x + row);
+    }
+
+    for(I j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        J local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Local value this lane operates with
+        T local_val = rocsparse_nontemporal_load(csr_val + j);
+
+        // Entries on the wrong side of the diagonal are ignored
+        if((fill_mode == rocsparse_fill_mode_upper && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_lower && local_col > row))
+        {
+            continue;
+        }
+
+        // Diagonal entry
+        if(local_col == row)
+        {
+            // If diagonal type is non unit, do division by diagonal entry
+            // This is not required for unit diagonal for obvious reasons
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                // Check for numerical zero
+                if(local_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, row + idx_base);
+                    local_val = static_cast<T>(1);
+                }
+
+                *diagonal = static_cast<T>(1) / local_val;
+            }
+
+            continue;
+        }
+
+        // Local sum computation for each lane
+        local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
+    }
+
+    // Gather all local sums for each lane
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    // If we have non unit diagonal, take the diagonal into account
+    // For unit diagonal, this would be multiplication with one
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        __threadfence_block();
+
+        local_sum = local_sum * (*diagonal);
+    }
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Store the rows result in y
+        y[row] = local_sum;
+    }
+}
+
+// Solves all rows of a single level, a wavefront per row.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+ROCSPARSE_DEVICE_ILF void csrsv_level_device(J level_begin,
+                                             J level_end,
+                                             T alpha,
+                                             const I* __restrict__ csr_row_ptr,
+                                             const J* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             const T* __restrict__ x,
+                                             T* __restrict__ y,
+                                             const J* __restrict__ map,
+                                             J* __restrict__ zero_pivot,
+                                             rocsparse_index_base idx_base,
+                                             rocsparse_fill_mode  fill_mode,
+                                             rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Index into the row map
+    J idx = level_begin + hipBlockIdx_x * (BLOCKSIZE / WF_SIZE) + wid;
+
+    // Do not run out of bounds
+    if(idx >= level_end)
+    {
+        return;
+    }
+
+    csrsv_level_row_device<WF_SIZE>(map[idx],
+                                    lid,
+                                    alpha,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    csr_val,
+                                    x,
+                                    y,
+                                    &diagonal[wid],
+                                    zero_pivot,
+                                    idx_base,
+                                    fill_mode,
+                                    diag_type);
+}
+
+// Solves a sequence of consecutive levels with a single block. The block synchronizes
+// after each level, instead of launching a kernel per level.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+ROCSPARSE_DEVICE_ILF void csrsv_level_fused_device(int64_t level_first,
+                                                   int64_t level_last,
+                                                   const J* __restrict__ level_ptr,
+                                                   T alpha,
+                                                   const I* __restrict__ csr_row_ptr,
+                                                   const J* __restrict__ csr_col_ind,
+                                                   const T* __restrict__ csr_val,
+                                                   const T* __restrict__ x,
+                                                   T* __restrict__ y,
+                                                   const J* __restrict__ map,
+                                                   J* __restrict__ zero_pivot,
+                                                   rocsparse_index_base idx_base,
+                                                   rocsparse_fill_mode  fill_mode,
+                                                   rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    for(int64_t level = level_first; level < level_last; ++level)
+    {
+        J level_begin = level_ptr[level];
+        J level_end   = level_ptr[level + 1];
+
+        for(J idx = level_begin + wid; idx < level_end; idx += BLOCKSIZE / WF_SIZE)
+        {
+            csrsv_level_row_device<WF_SIZE>(map[idx],
+                                            lid,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            y,
+                                            &diagonal[wid],
+                                            zero_pivot,
+                                            idx_base,
+                                            fill_mode,
+                                            diag_type);
+        }
+
+        // Results of this level need to be visible to the whole block
+        __threadfence_block();
+        __syncthreads();
+    }
+}
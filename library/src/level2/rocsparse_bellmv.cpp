@@ -0,0 +1,453 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_bellmv.hpp"
+
+#include "bellmv_device.h"
+#include "definitions.h"
+#include "ellmv_device.h"
+#include "utility.h"
+
+template <unsigned int        BLOCKSIZE,
+          rocsparse_direction DIR,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void bellmvn_kernel(I mb,
+                    I nb,
+                    I bell_width,
+                    I block_dim,
+                    U alpha_device_host,
+                    const I* __restrict__ bell_col_ind,
+                    const A* __restrict__ bell_val,
+                    const X* __restrict__ x,
+                    U beta_device_host,
+                    Y* __restrict__ y,
+                    rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        bellmvn_device<BLOCKSIZE, DIR>(
+            mb, nb, bell_width, block_dim, alpha, bell_col_ind, bell_val, x, beta, y, idx_base);
+    }
+}
+
+template <unsigned int        BLOCKSIZE,
+          rocsparse_direction DIR,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void bellmvt_kernel(rocsparse_operation trans,
+                    I                   mb,
+                    I                   nb,
+                    I                   bell_width,
+                    I                   block_dim,
+                    U                   alpha_device_host,
+                    const I* __restrict__ bell_col_ind,
+                    const A* __restrict__ bell_val,
+                    const X* __restrict__ x,
+                    Y* __restrict__ y,
+                    rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        bellmvt_device<BLOCKSIZE, DIR>(
+            trans, mb, nb, bell_width, block_dim, alpha, bell_col_ind, bell_val, x, y, idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void bellmvt_scale_kernel(I size, U scalar_device_host, Y* __restrict__ data)
+{
+    auto scalar = load_scalar_device_host(scalar_device_host);
+    if(scalar != 1)
+    {
+        ellmvt_scale_device(size, scalar, data);
+    }
+}
+
+template <rocsparse_direction DIR, typename I, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_bellmv_dispatch_dir(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      I                         mb,
+                                                      I                         nb,
+                                                      I                         bell_width,
+                                                      I                         block_dim,
+                                                      U                         alpha_device_host,
+                                                      const rocsparse_mat_descr descr,
+                                                      const I*                  bell_col_ind,
+                                                      const A*                  bell_val,
+                                                      const X*                  x,
+                                                      U                         beta_device_host,
+                                                      Y*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of rows and columns
+    int64_t m = static_cast<int64_t>(mb) * block_dim;
+    int64_t n = static_cast<int64_t>(nb) * block_dim;
+
+    // Run different bellmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define BELLMVN_DIM 512
+        bellmvn_kernel<BELLMVN_DIM, DIR>
+            <<<(m - 1) / BELLMVN_DIM + 1, BELLMVN_DIM, 0, stream>>>(mb,
+                                                                    nb,
+                                                                    bell_width,
+                                                                    block_dim,
+                                                                    alpha_device_host,
+                                                                    bell_col_ind,
+                                                                    bell_val,
+                                                                    x,
+                                                                    beta_device_host,
+                                                                    y,
+                                                                    descr->base);
+#undef BELLMVN_DIM
+    }
+    else
+    {
+#define BELLMVT_DIM 1024
+        // Scale y with beta
+        bellmvt_scale_kernel<BELLMVT_DIM>
+            <<<(n - 1) / BELLMVT_DIM + 1, BELLMVT_DIM, 0, stream>>>(n, beta_device_host, y);
+
+        bellmvt_kernel<BELLMVT_DIM, DIR>
+            <<<(m - 1) / BELLMVT_DIM + 1, BELLMVT_DIM, 0, stream>>>(trans,
+                                                                    mb,
+                                                                    nb,
+                                                                    bell_width,
+                                                                    block_dim,
+                                                                    alpha_device_host,
+                                                                    bell_col_ind,
+                                                                    bell_val,
+                                                                    x,
+                                                                    y,
+                                                                    descr->base);
+#undef BELLMVT_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename A, typename X, typename Y, typename U>
+rocsparse_status rocsparse_bellmv_dispatch(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_direction       dir,
+                                           I                         mb,
+                                           I                         nb,
+                                           I                         bell_width,
+                                           I                         block_dim,
+                                           U                         alpha_device_host,
+                                           const rocsparse_mat_descr descr,
+                                           const I*                  bell_col_ind,
+                                           const A*                  bell_val,
+                                           const X*                  x,
+                                           U                         beta_device_host,
+                                           Y*                        y)
+{
+    if(dir == rocsparse_direction_row)
+    {
+        return rocsparse_bellmv_dispatch_dir<rocsparse_direction_row>(handle,
+                                                                      trans,
+                                                                      mb,
+                                                                      nb,
+                                                                      bell_width,
+                                                                      block_dim,
+                                                                      alpha_device_host,
+                                                                      descr,
+                                                                      bell_col_ind,
+                                                                      bell_val,
+                                                                      x,
+                                                                      beta_device_host,
+                                                                      y);
+    }
+    else
+    {
+        return rocsparse_bellmv_dispatch_dir<rocsparse_direction_column>(handle,
+                                                                         trans,
+                                                                         mb,
+                                                                         nb,
+                                                                         bell_width,
+                                                                         block_dim,
+                                                                         alpha_device_host,
+                                                                         descr,
+                                                                         bell_col_ind,
+                                                                         bell_val,
+                                                                         x,
+                                                                         beta_device_host,
+                                                                         y);
+    }
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_bellmv_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_direction       dir,
+                                           I                         mb,
+                                           I                         nb,
+                                           I                         bell_cols,
+                                           I                         block_dim,
+                                           const T*                  alpha_device_host,
+                                           const rocsparse_mat_descr descr,
+                                           const I*                  bell_col_ind,
+                                           const A*                  bell_val,
+                                           const X*                  x,
+                                           const T*                  beta_device_host,
+                                           Y*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbellmv"),
+              trans,
+              dir,
+              mb,
+              nb,
+              bell_cols,
+              block_dim,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)bell_col_ind,
+              (const void*&)bell_val,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    log_bench(handle,
+              "./rocsparse-bench -f bellmv -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--blockdim",
+              block_dim,
+              "--alpha",
+              LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host),
+              "--beta",
+              LOG_BENCH_SCALAR_VALUE(handle, beta_device_host));
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xbellmv"), rocsparse_get_datatype<T>(), mb, nb, block_dim);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || bell_cols < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Sanity check
+    if((mb == 0 || nb == 0) && bell_cols != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Number of blocks per block row
+    I bell_width = bell_cols / block_dim;
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(bell_width > 0 && (bell_val == nullptr || bell_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Estimated work, for the profiling layer
+    const double nnz = double(mb) * bell_width * block_dim * block_dim;
+    log_profile(handle,
+                2.0 * nnz,
+                sizeof(A) * nnz + sizeof(I) * double(mb) * bell_width
+                    + sizeof(X) * double(nb) * block_dim + sizeof(Y) * 2.0 * mb * block_dim);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bellmv_dispatch(handle,
+                                         trans,
+                                         dir,
+                                         mb,
+                                         nb,
+                                         bell_width,
+                                         block_dim,
+                                         alpha_device_host,
+                                         descr,
+                                         bell_col_ind,
+                                         bell_val,
+                                         x,
+                                         beta_device_host,
+                                         y);
+    }
+    else
+    {
+        return rocsparse_bellmv_dispatch(handle,
+                                         trans,
+                                         dir,
+                                         mb,
+                                         nb,
+                                         bell_width,
+                                         block_dim,
+                                         *alpha_device_host,
+                                         descr,
+                                         bell_col_ind,
+                                         bell_val,
+                                         x,
+                                         *beta_device_host,
+                                         y);
+    }
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, ATYPE, XTYPE, YTYPE)                                          \
+    template rocsparse_status rocsparse_bellmv_template(rocsparse_handle          handle,       \
+                                                        rocsparse_operation       trans,        \
+                                                        rocsparse_direction       dir,          \
+                                                        ITYPE                     mb,           \
+                                                        ITYPE                     nb,           \
+                                                        ITYPE                     bell_cols,    \
+                                                        ITYPE                     block_dim,    \
+                                                        const TTYPE*              alpha,        \
+                                                        const rocsparse_mat_descr descr,        \
+                                                        const ITYPE*              bell_col_ind, \
+                                                        const ATYPE*              bell_val,     \
+                                                        const XTYPE*              x,            \
+                                                        const TTYPE*              beta,         \
+                                                        YTYPE*                    y);
+
+INSTANTIATE(float, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float);
+INSTANTIATE(
+    rocsparse_float_complex, int32_t, float, rocsparse_float_complex, rocsparse_float_complex);
+INSTANTIATE(
+    rocsparse_float_complex, int64_t, float, rocsparse_float_complex, rocsparse_float_complex);
+INSTANTIATE(
+    rocsparse_double_complex, int32_t, double, rocsparse_double_complex, rocsparse_double_complex);
+INSTANTIATE(
+    rocsparse_double_complex, int64_t, double, rocsparse_double_complex, rocsparse_double_complex);
+INSTANTIATE(double, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, float, double, double);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
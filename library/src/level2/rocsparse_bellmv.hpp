@@ -0,0 +1,44 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "handle.h"
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_bellmv_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_direction       dir,
+                                           I                         mb,
+                                           I                         nb,
+                                           I                         bell_cols,
+                                           I                         block_dim,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const I*                  bell_col_ind,
+                                           const A*                  bell_val,
+                                           const X*                  x,
+                                           const T*                  beta,
+                                           Y*                        y);
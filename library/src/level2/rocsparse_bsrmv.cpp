@@ -67,6 +67,15 @@ rocsparse_status rocsparse_bsrmv_analysis_template(rocsparse_handle          han
               block_dim,
               (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<A>("rocsparse_Xbsrmv_analysis"),
+                                                rocsparse_get_datatype<A>(),
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                block_dim);
+
     if(rocsparse_enum_utils::is_invalid(dir))
     {
         return rocsparse_status_invalid_value;
@@ -696,6 +705,12 @@ INSTANTIATE(rocsparse_double_complex, int64_t, int64_t);
 INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, int8_t);
 INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, int8_t);
 INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, int8_t);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_MIXED_ANALYSIS
 
 #define INSTANTIATE_MIXED(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)                                 \
@@ -722,6 +737,12 @@ INSTANTIATE_MIXED(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(float, int32_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE_MIXED(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int64_t, hip_bfloat16, float, float);
 INSTANTIATE_MIXED(rocsparse_float_complex,
                   int32_t,
                   int32_t,
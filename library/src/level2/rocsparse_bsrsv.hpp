@@ -1,6 +1,6 @@
 /*! \file */
 /* ************************************************************************
- * Copyright (C) 2020-2022 Advanced Micro Devices, Inc. All rights Reserved.
+ * Copyright (C) 2020-2023 Advanced Micro Devices, Inc. All rights Reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -26,6 +26,20 @@
 
 #include "handle.h"
 
+template <typename T>
+rocsparse_status rocsparse_bsrsv_buffer_size_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info,
+                                                      size_t*                   buffer_size);
+
 template <typename T>
 rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_direction       dir,
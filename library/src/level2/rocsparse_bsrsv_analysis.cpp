@@ -73,6 +73,14 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
               analysis,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrsv_analysis"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     // Check operation
     if(rocsparse_enum_utils::is_invalid(trans))
     {
@@ -272,6 +280,29 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                       \
+    template rocsparse_status rocsparse_bsrsv_analysis_template( \
+        rocsparse_handle          handle,                        \
+        rocsparse_direction       dir,                           \
+        rocsparse_operation       trans,                         \
+        rocsparse_int             mb,                            \
+        rocsparse_int             nnzb,                          \
+        const rocsparse_mat_descr descr,                         \
+        const TTYPE*              bsr_val,                       \
+        const rocsparse_int*      bsr_row_ptr,                   \
+        const rocsparse_int*      bsr_col_ind,                   \
+        rocsparse_int             block_dim,                     \
+        rocsparse_mat_info        info,                          \
+        rocsparse_analysis_policy analysis,                      \
+        rocsparse_solve_policy    solve,                         \
+        void*                     temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 // bsrsv_analysis
 #define C_IMPL(NAME, TYPE)                                                  \
     extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
@@ -26,6 +26,76 @@
 #include "templates.h"
 #include "utility.h"
 
+#include "../level2/rocsparse_csrsv.hpp"
+
+template <typename T>
+rocsparse_status rocsparse_bsrsv_buffer_size_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info,
+                                                      size_t*                   buffer_size)
+{
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes that are not checked by csrsv
+    if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size_template(
+        handle, trans, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, info, buffer_size));
+
+    // Need additional buffer when using transposed
+    if(trans == rocsparse_operation_transpose)
+    {
+        // Remove additional CSR buffer
+        *buffer_size -= ((sizeof(T) * nnzb - 1) / 256 + 1) * 256;
+
+        // Add BSR buffer instead
+        *buffer_size += ((sizeof(T) * size_t(nnzb) * block_dim * block_dim - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TTYPE)                                          \
+    template rocsparse_status rocsparse_bsrsv_buffer_size_template( \
+        rocsparse_handle          handle,                           \
+        rocsparse_direction       dir,                              \
+        rocsparse_operation       trans,                            \
+        rocsparse_int             mb,                               \
+        rocsparse_int             nnzb,                             \
+        const rocsparse_mat_descr descr,                            \
+        const TTYPE*              bsr_val,                          \
+        const rocsparse_int*      bsr_row_ptr,                      \
+        const rocsparse_int*      bsr_col_ind,                      \
+        rocsparse_int             block_dim,                        \
+        rocsparse_mat_info        info,                             \
+        size_t*                   buffer_size);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -33,56 +103,37 @@
  */
 
 // bsrsv_buffer_size
-#define C_IMPL(NAME, TYPE)                                                                         \
-    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                             \
-                                     rocsparse_direction       dir,                                \
-                                     rocsparse_operation       trans,                              \
-                                     rocsparse_int             mb,                                 \
-                                     rocsparse_int             nnzb,                               \
-                                     const rocsparse_mat_descr descr,                              \
-                                     const TYPE*               bsr_val,                            \
-                                     const rocsparse_int*      bsr_row_ptr,                        \
-                                     const rocsparse_int*      bsr_col_ind,                        \
-                                     rocsparse_int             block_dim,                          \
-                                     rocsparse_mat_info        info,                               \
-                                     size_t*                   buffer_size)                        \
-    try                                                                                            \
-    {                                                                                              \
-        /* Check direction */                                                                      \
-        if(rocsparse_enum_utils::is_invalid(dir))                                                  \
-        {                                                                                          \
-            return rocsparse_status_invalid_value;                                                 \
-        }                                                                                          \
-        if(rocsparse_enum_utils::is_invalid(trans))                                                \
-        {                                                                                          \
-            return rocsparse_status_invalid_value;                                                 \
-        }                                                                                          \
-                                                                                                   \
-        /* Check sizes that are not checked by csrsv */                                            \
-        if(block_dim < 0)                                                                          \
-        {                                                                                          \
-            return rocsparse_status_invalid_size;                                                  \
-        }                                                                                          \
-                                                                                                   \
-        rocsparse_status stat = rocsparse_csrsv_buffer_size(                                       \
-            handle, trans, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, info, buffer_size); \
-                                                                                                   \
-        /* Need additional buffer when using transposed */                                         \
-        if(trans == rocsparse_operation_transpose)                                                 \
-        {                                                                                          \
-            /* Remove additional CSR buffer */                                                     \
-            *buffer_size -= ((sizeof(TYPE) * nnzb - 1) / 256 + 1) * 256;                           \
-                                                                                                   \
-            /* Add BSR buffer instead */                                                           \
-            *buffer_size                                                                           \
-                += ((sizeof(TYPE) * size_t(nnzb) * block_dim * block_dim - 1) / 256 + 1) * 256;    \
-        }                                                                                          \
-                                                                                                   \
-        return stat;                                                                               \
-    }                                                                                              \
-    catch(...)                                                                                     \
-    {                                                                                              \
-        return exception_to_rocsparse_status();                                                    \
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_direction       dir,         \
+                                     rocsparse_operation       trans,       \
+                                     rocsparse_int             mb,          \
+                                     rocsparse_int             nnzb,        \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               bsr_val,     \
+                                     const rocsparse_int*      bsr_row_ptr, \
+                                     const rocsparse_int*      bsr_col_ind, \
+                                     rocsparse_int             block_dim,   \
+                                     rocsparse_mat_info        info,        \
+                                     size_t*                   buffer_size) \
+    try                                                                     \
+    {                                                                       \
+        return rocsparse_bsrsv_buffer_size_template(handle,                 \
+                                                    dir,                    \
+                                                    trans,                  \
+                                                    mb,                     \
+                                                    nnzb,                   \
+                                                    descr,                  \
+                                                    bsr_val,                \
+                                                    bsr_row_ptr,            \
+                                                    bsr_col_ind,            \
+                                                    block_dim,              \
+                                                    info,                   \
+                                                    buffer_size);           \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocsparse_status();                             \
     }
 
 C_IMPL(rocsparse_sbsrsv_buffer_size, float);
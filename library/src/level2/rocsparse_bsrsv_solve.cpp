@@ -515,6 +515,10 @@ rocsparse_status rocsparse_bsrsv_solve_template(rocsparse_handle          handle
               "--alpha",
               LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xbsrsv"), rocsparse_get_datatype<T>(), mb, nnzb, block_dim);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -620,6 +624,31 @@ rocsparse_status rocsparse_bsrsv_solve_template(rocsparse_handle          handle
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                    \
+    template rocsparse_status rocsparse_bsrsv_solve_template( \
+        rocsparse_handle          handle,                     \
+        rocsparse_direction       dir,                        \
+        rocsparse_operation       trans,                      \
+        rocsparse_int             mb,                         \
+        rocsparse_int             nnzb,                       \
+        const TTYPE*              alpha_device_host,          \
+        const rocsparse_mat_descr descr,                      \
+        const TTYPE*              bsr_val,                    \
+        const rocsparse_int*      bsr_row_ptr,                \
+        const rocsparse_int*      bsr_col_ind,                \
+        rocsparse_int             block_dim,                  \
+        rocsparse_mat_info        info,                       \
+        const TTYPE*              x,                          \
+        TTYPE*                    y,                          \
+        rocsparse_solve_policy    policy,                     \
+        void*                     temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 // bsrsv_solve
 #define C_IMPL(NAME, TYPE)                                                  \
     extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
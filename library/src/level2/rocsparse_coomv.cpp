@@ -187,6 +187,10 @@ rocsparse_status rocsparse_coomv_analysis_template(rocsparse_handle          han
               (const void*&)coo_row_ind,
               (const void*&)coo_col_ind);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<A>("rocsparse_Xcoomv_analysis"), rocsparse_get_datatype<A>(), m, n, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -643,6 +647,10 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
               "--beta",
               LOG_BENCH_SCALAR_VALUE(handle, beta_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<A>("rocsparse_Xcoomv"), rocsparse_get_datatype<A>(), m, n, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -734,6 +742,11 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz,
+                (2.0 * sizeof(I) + sizeof(A)) * nnz + sizeof(X) * double(n) + sizeof(Y) * 2.0 * m);
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         return rocsparse_coomv_dispatch<T>(handle,
@@ -824,6 +837,10 @@ INSTANTIATE(rocsparse_double_complex, int64_t);
 
 INSTANTIATE_MIXED_ANALYSIS(int32_t, int8_t);
 INSTANTIATE_MIXED_ANALYSIS(int64_t, int8_t);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, hip_bfloat16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, hip_bfloat16);
 #undef INSTANTIATE_MIXED_ANALYSIS
 
 #define INSTANTIATE_MIXED(TTYPE, ITYPE, ATYPE, XTYPE, YTYPE)                                        \
@@ -846,6 +863,10 @@ INSTANTIATE_MIXED(int32_t, int32_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(int32_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(float, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE_MIXED(float, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, hip_bfloat16, float, float);
 INSTANTIATE_MIXED(
     rocsparse_float_complex, int32_t, float, rocsparse_float_complex, rocsparse_float_complex);
 INSTANTIATE_MIXED(
@@ -615,6 +615,10 @@ INSTANTIATE_MIXED(int32_t, int32_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(int32_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(float, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE_MIXED(float, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, hip_bfloat16, float, float);
 INSTANTIATE_MIXED(
     rocsparse_float_complex, int32_t, float, rocsparse_float_complex, rocsparse_float_complex);
 INSTANTIATE_MIXED(
@@ -0,0 +1,499 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_coomv_batched.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "coomv_device.h"
+
+// Largest number of batches processed by a single launch, bounded by the grid y dimension
+#define COOMV_BATCHED_MAX_GRID_Y 65535
+
+template <unsigned int BLOCKSIZE, typename I, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void coomv_batched_scale(I size, U beta_device_host, Y* __restrict__ data, int64_t batch_stride)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != 1)
+    {
+        coomv_scale_device<BLOCKSIZE>(size, beta, data + batch_stride * hipBlockIdx_y);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int LOOPS,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void coomvn_atomic_loops_batched(int64_t nnz,
+                                 U       alpha_device_host,
+                                 const I* __restrict__ coo_row_ind,
+                                 const I* __restrict__ coo_col_ind,
+                                 int64_t indices_batch_stride,
+                                 const A* __restrict__ coo_val,
+                                 int64_t values_batch_stride,
+                                 const X* __restrict__ x,
+                                 int64_t x_batch_stride,
+                                 Y* __restrict__ y,
+                                 int64_t              y_batch_stride,
+                                 rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        int64_t batch = hipBlockIdx_y;
+
+        coomvn_atomic_loops_device<BLOCKSIZE, LOOPS>(nnz,
+                                                     alpha,
+                                                     coo_row_ind + indices_batch_stride * batch,
+                                                     coo_col_ind + indices_batch_stride * batch,
+                                                     coo_val + values_batch_stride * batch,
+                                                     x + x_batch_stride * batch,
+                                                     y + y_batch_stride * batch,
+                                                     idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename A, typename X, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void coomvt_batched_kernel(rocsparse_operation trans,
+                           int64_t             nnz,
+                           U                   alpha_device_host,
+                           const I* __restrict__ coo_row_ind,
+                           const I* __restrict__ coo_col_ind,
+                           int64_t indices_batch_stride,
+                           const A* __restrict__ coo_val,
+                           int64_t values_batch_stride,
+                           const X* __restrict__ x,
+                           int64_t x_batch_stride,
+                           Y* __restrict__ y,
+                           int64_t              y_batch_stride,
+                           rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        int64_t batch = hipBlockIdx_y;
+
+        coomvt_device(trans,
+                      nnz,
+                      alpha,
+                      coo_row_ind + indices_batch_stride * batch,
+                      coo_col_ind + indices_batch_stride * batch,
+                      coo_val + values_batch_stride * batch,
+                      x + x_batch_stride * batch,
+                      y + y_batch_stride * batch,
+                      idx_base);
+    }
+}
+
+template <typename T, typename I, typename A, typename X, typename Y, typename U>
+rocsparse_status rocsparse_coomv_batched_dispatch(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  I                         m,
+                                                  I                         n,
+                                                  int64_t                   nnz,
+                                                  int64_t                   batch_count,
+                                                  U                         alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  coo_val,
+                                                  int64_t                   values_batch_stride,
+                                                  const I*                  coo_row_ind,
+                                                  const I*                  coo_col_ind,
+                                                  int64_t                   indices_batch_stride,
+                                                  const X*                  x,
+                                                  int64_t                   x_batch_stride,
+                                                  U                         beta_device_host,
+                                                  Y*                        y,
+                                                  int64_t                   y_batch_stride)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    I ysize = (trans == rocsparse_operation_none) ? m : n;
+
+    // Scale y with beta
+    hipLaunchKernelGGL((coomv_batched_scale<1024>),
+                       dim3((ysize - 1) / 1024 + 1, batch_count),
+                       dim3(1024),
+                       0,
+                       stream,
+                       ysize,
+                       beta_device_host,
+                       y,
+                       y_batch_stride);
+
+    // Run different coomv kernels
+    switch(trans)
+    {
+    case rocsparse_operation_none:
+    {
+        hipLaunchKernelGGL((coomvn_atomic_loops_batched<256, 1>),
+                           dim3((nnz - 1) / 256 + 1, batch_count),
+                           dim3(256),
+                           0,
+                           stream,
+                           nnz,
+                           alpha_device_host,
+                           coo_row_ind,
+                           coo_col_ind,
+                           indices_batch_stride,
+                           coo_val,
+                           values_batch_stride,
+                           x,
+                           x_batch_stride,
+                           y,
+                           y_batch_stride,
+                           descr->base);
+        break;
+    }
+    case rocsparse_operation_transpose:
+    case rocsparse_operation_conjugate_transpose:
+    {
+        hipLaunchKernelGGL((coomvt_batched_kernel<1024>),
+                           dim3((nnz - 1) / 1024 + 1, batch_count),
+                           dim3(1024),
+                           0,
+                           stream,
+                           trans,
+                           nnz,
+                           alpha_device_host,
+                           coo_row_ind,
+                           coo_col_ind,
+                           indices_batch_stride,
+                           coo_val,
+                           values_batch_stride,
+                           x,
+                           x_batch_stride,
+                           y,
+                           y_batch_stride,
+                           descr->base);
+        break;
+    }
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_coomv_batched_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  I                         m,
+                                                  I                         n,
+                                                  int64_t                   nnz,
+                                                  int64_t                   batch_count,
+                                                  const T*                  alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  coo_val,
+                                                  int64_t                   values_batch_stride,
+                                                  const I*                  coo_row_ind,
+                                                  const I*                  coo_col_ind,
+                                                  int64_t                   indices_batch_stride,
+                                                  const X*                  x,
+                                                  int64_t                   x_batch_stride,
+                                                  const T*                  beta_device_host,
+                                                  Y*                        y,
+                                                  int64_t                   y_batch_stride)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcoomv_batched"),
+              trans,
+              m,
+              n,
+              nnz,
+              batch_count,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)coo_val,
+              values_batch_stride,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              indices_batch_stride,
+              (const void*&)x,
+              x_batch_stride,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y,
+              y_batch_stride);
+
+    // Check transpose
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check batch strides
+    if(values_batch_stride < 0 || indices_batch_stride < 0 || x_batch_stride < 0
+       || y_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    I ysize = (trans == rocsparse_operation_none) ? m : n;
+
+    // Batches of y must not overlap
+    if(batch_count > 1 && y_batch_stride < ysize)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Another quick return.
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // matrix never accessed however still need to update the y vectors
+        if(ysize > 0)
+        {
+            if(y == nullptr || beta_device_host == nullptr)
+            {
+                return rocsparse_status_invalid_pointer;
+            }
+
+            for(int64_t b = 0; b < batch_count; b += COOMV_BATCHED_MAX_GRID_Y)
+            {
+                int64_t nbatch = std::min<int64_t>(batch_count - b, COOMV_BATCHED_MAX_GRID_Y);
+
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    hipLaunchKernelGGL((coomv_batched_scale<256>),
+                                       dim3((ysize - 1) / 256 + 1, nbatch),
+                                       dim3(256),
+                                       0,
+                                       handle->stream,
+                                       ysize,
+                                       beta_device_host,
+                                       y + y_batch_stride * b,
+                                       y_batch_stride);
+                }
+                else
+                {
+                    hipLaunchKernelGGL((coomv_batched_scale<256>),
+                                       dim3((ysize - 1) / 256 + 1, nbatch),
+                                       dim3(256),
+                                       0,
+                                       handle->stream,
+                                       ysize,
+                                       *beta_device_host,
+                                       y + y_batch_stride * b,
+                                       y_batch_stride);
+                }
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return.
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(coo_val == nullptr || coo_row_ind == nullptr || coo_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Batches are spread over the grid y dimension, one launch per
+    // COOMV_BATCHED_MAX_GRID_Y batches
+    for(int64_t b = 0; b < batch_count; b += COOMV_BATCHED_MAX_GRID_Y)
+    {
+        int64_t nbatch = std::min<int64_t>(batch_count - b, COOMV_BATCHED_MAX_GRID_Y);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_coomv_batched_dispatch<T>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    nbatch,
+                                                    alpha_device_host,
+                                                    descr,
+                                                    coo_val + values_batch_stride * b,
+                                                    values_batch_stride,
+                                                    coo_row_ind + indices_batch_stride * b,
+                                                    coo_col_ind + indices_batch_stride * b,
+                                                    indices_batch_stride,
+                                                    x + x_batch_stride * b,
+                                                    x_batch_stride,
+                                                    beta_device_host,
+                                                    y + y_batch_stride * b,
+                                                    y_batch_stride));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_coomv_batched_dispatch<T>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    nbatch,
+                                                    *alpha_device_host,
+                                                    descr,
+                                                    coo_val + values_batch_stride * b,
+                                                    values_batch_stride,
+                                                    coo_row_ind + indices_batch_stride * b,
+                                                    coo_col_ind + indices_batch_stride * b,
+                                                    indices_batch_stride,
+                                                    x + x_batch_stride * b,
+                                                    x_batch_stride,
+                                                    *beta_device_host,
+                                                    y + y_batch_stride * b,
+                                                    y_batch_stride));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, ATYPE, XTYPE, YTYPE)          \
+    template rocsparse_status rocsparse_coomv_batched_template( \
+        rocsparse_handle          handle,                       \
+        rocsparse_operation       trans,                        \
+        ITYPE                     m,                            \
+        ITYPE                     n,                            \
+        int64_t                   nnz,                          \
+        int64_t                   batch_count,                  \
+        const TTYPE*              alpha_device_host,            \
+        const rocsparse_mat_descr descr,                        \
+        const ATYPE*              coo_val,                      \
+        int64_t                   values_batch_stride,          \
+        const ITYPE*              coo_row_ind,                  \
+        const ITYPE*              coo_col_ind,                  \
+        int64_t                   indices_batch_stride,         \
+        const XTYPE*              x,                            \
+        int64_t                   x_batch_stride,               \
+        const TTYPE*              beta_device_host,             \
+        YTYPE*                    y,                            \
+        int64_t                   y_batch_stride);
+
+INSTANTIATE(float, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(double, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, float, double, double);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
@@ -210,6 +210,10 @@ rocsparse_status rocsparse_coosv_analysis_template(rocsparse_handle          han
               analysis,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcoosv_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -405,6 +409,10 @@ rocsparse_status rocsparse_coosv_solve_template(rocsparse_handle          handle
               "--alpha",
               LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcoosv"), rocsparse_get_datatype<T>(), m, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -481,6 +489,7 @@ rocsparse_status rocsparse_coosv_solve_template(rocsparse_handle          handle
                                               x,
                                               y,
                                               policy,
+                                              rocsparse_spsv_alg_default,
                                               ptr);
     }
     else
@@ -504,6 +513,7 @@ rocsparse_status rocsparse_coosv_solve_template(rocsparse_handle          handle
                                               x,
                                               y,
                                               policy,
+                                              rocsparse_spsv_alg_default,
                                               ptr);
     }
 }
@@ -521,6 +521,10 @@ rocsparse_status rocsparse_csritsv_analysis_impl(rocsparse_handle          handl
               solve,
               analysis,
               (const void*&)temp_buffer);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsritsv_analysis"), rocsparse_get_datatype<T>(), m, nnz);
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
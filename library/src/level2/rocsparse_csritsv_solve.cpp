@@ -677,6 +677,10 @@ rocsparse_status rocsparse_csritsv_solve_impl(rocsparse_handle          handle,
               policy,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsritsv_solve"), rocsparse_get_datatype<T>(), m, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
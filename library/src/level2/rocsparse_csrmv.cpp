@@ -29,11 +29,17 @@
 
 #include "csrmv_device.h"
 #include "csrmv_symm_device.h"
+#include "rocsparse_csrmv_rowblocks.hpp"
 
-#define BLOCK_SIZE 1024
-#define BLOCK_MULTIPLIER 3
-#define ROWS_FOR_VECTOR 1
-#define WG_SIZE 256
+#include "../util/rocsparse_analysis_cache.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+// CSR-Adaptive kernel configuration, the analysis thresholds are part of handle->tuning
+#define BLOCK_SIZE rocsparse_csrmv_adaptive_config::block_size
+#define BLOCK_MULTIPLIER rocsparse_csrmv_adaptive_config::block_multiplier
+#define ROWS_FOR_VECTOR rocsparse_csrmv_adaptive_config::rows_for_vector
+#define WG_SIZE rocsparse_csrmv_adaptive_config::wg_size
 
 #define LAUNCH_CSRMVN_GENERAL(wfsize)                                     \
     csrmvn_general_kernel<CSRMVN_DIM, wfsize>                             \
@@ -89,272 +95,333 @@
                                                        y,                 \
                                                        descr->base)
 
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_adaptive_analysis_count_kernel(
+    J m, const I* csr_row_ptr, int32_t long_row, int32_t row_window, I* num_wgs)
 {
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
+    csrmvn_adaptive_analysis_count_device<BLOCKSIZE, BLOCK_SIZE, BLOCK_MULTIPLIER>(
+        m, csr_row_ptr, long_row, row_window, num_wgs);
 }
 
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_adaptive_analysis_init_kernel(
+    J m, size_t size, I* row_blocks, unsigned int* wg_flags, J* wg_ids)
 {
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
+    csrmvn_adaptive_analysis_init_device<BLOCKSIZE>(m, size, row_blocks, wg_flags, wg_ids);
 }
 
-template <typename I>
-static inline I maxRowsInABlock(const I* rowBlocks, size_t rowBlockSize)
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_adaptive_analysis_fill_kernel(
+    J m, const I* wg_offset, I* row_blocks, J* wg_ids)
 {
-    I max = 0;
-    for(size_t i = 1; i < rowBlockSize; i++)
-    {
-        I current_row = rowBlocks[i];
-        I prev_row    = rowBlocks[i - 1];
+    csrmvn_adaptive_analysis_fill_device<BLOCKSIZE>(m, wg_offset, row_blocks, wg_ids);
+}
 
-        if(max < current_row - prev_row)
-            max = current_row - prev_row;
-    }
-    return max;
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_adaptive_analysis_reduction_kernel(const I* total, const I* row_blocks, J* wg_ids)
+{
+    csrmvn_adaptive_analysis_reduction_device<BLOCKSIZE, ROWS_FOR_VECTOR, WG_SIZE>(
+        total, row_blocks, wg_ids);
 }
 
+// Upper bound of the row blocks array size generated by the device analysis.
+// Every row block starts at row 0, at a multiple of the row window, at a row longer
+// than BLOCK_SIZE / 2 or right after it, at a transition between short and long
+// rows, or when the row begins in another window of BLOCK_SIZE / 2 non-zeros.
+// Additionally, long rows might require multiple workgroups.
 template <typename I, typename J>
-static inline void ComputeRowBlocks(I*       rowBlocks,
-                                    J*       wgIds,
-                                    size_t&  rowBlockSize,
-                                    const I* rowDelimiters,
-                                    I        nRows,
-                                    bool     allocate_row_blocks = true)
+static size_t csrmvn_adaptive_analysis_max_size(J m, I nnz, const rocsparse_tuning_params& tuning)
 {
-    I* rowBlocksBase;
+    size_t m_         = static_cast<size_t>(m);
+    size_t nnz_       = static_cast<size_t>(nnz);
+    size_t long_row   = static_cast<size_t>(tuning.csrmv_long_row);
+    size_t row_window = static_cast<size_t>(tuning.csrmv_row_window);
 
-    // Start at one because of rowBlock[0]
-    I total_row_blocks = 1;
+    size_t long_row_wgs = nnz_ / (BLOCK_MULTIPLIER * BLOCK_SIZE);
 
-    if(allocate_row_blocks)
-    {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        *wgIds        = 0;
-        ++rowBlocks;
-        ++wgIds;
-    }
+    size_t max_starts = 1 + (m_ - 1) / row_window + 2 * (nnz_ / (BLOCK_SIZE / 2 + 1))
+                        + 2 * (nnz_ / (long_row + 1)) + nnz_ / (BLOCK_SIZE / 2) + 1;
 
-    I sum = 0;
-    I i;
-    I last_i = 0;
+    // Plus one for the terminating entry
+    return std::min(max_starts, m_) + long_row_wgs + 1;
+}
 
-    I consecutive_long_rows = 0;
-    for(i = 1; i <= nRows; ++i)
-    {
-        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
-
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
-        {
-            ++consecutive_long_rows;
-        }
-        else if(consecutive_long_rows > 0)
-        {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
-        }
+// Computes the CSR-Adaptive row blocks on the device. The stream is never
+// synchronized, the exact number of row blocks is copied back asynchronously
+// and picked up by the first csrmv call after the analysis has completed.
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrmv_analysis_device(rocsparse_handle     handle,
+                                                        J                    m,
+                                                        I                    nnz,
+                                                        const I*             csr_row_ptr,
+                                                        rocsparse_csrmv_info info)
+{
+#define CSRMV_ANALYSIS_DIM 256
+    // Stream
+    hipStream_t stream = handle->stream;
 
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i - 1;
-
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
-        }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i - 1;
-                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
+    info->size = csrmvn_adaptive_analysis_max_size(m, nnz, handle->tuning);
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+        (void**)&info->row_blocks, sizeof(I) * info->size, handle->stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+        (void**)&info->wg_flags, sizeof(unsigned int) * info->size, handle->stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+        (void**)&info->wg_ids, sizeof(J) * info->size, handle->stream));
+
+    // Number of workgroups per row, scanned in-place into workgroup offsets
+    I* wg_offset = nullptr;
+    RETURN_IF_HIP_ERROR(
+        rocsparse_hipMallocAsync((void**)&wg_offset, sizeof(I) * (m + 1), handle->stream));
+
+    hipLaunchKernelGGL((csrmvn_adaptive_analysis_count_kernel<CSRMV_ANALYSIS_DIM>),
+                       dim3(m / CSRMV_ANALYSIS_DIM + 1),
+                       dim3(CSRMV_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       handle->tuning.csrmv_long_row,
+                       handle->tuning.csrmv_row_window,
+                       wg_offset);
+
+    size_t rocprim_size;
+    void*  rocprim_buffer = nullptr;
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                wg_offset,
+                                                wg_offset,
+                                                static_cast<I>(0),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&rocprim_buffer, rocprim_size, handle->stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                wg_offset,
+                                                wg_offset,
+                                                static_cast<I>(0),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(rocprim_buffer, handle->stream));
+
+    // Unused row blocks point to row m
+    hipLaunchKernelGGL((csrmvn_adaptive_analysis_init_kernel<CSRMV_ANALYSIS_DIM>),
+                       dim3((info->size - 1) / CSRMV_ANALYSIS_DIM + 1),
+                       dim3(CSRMV_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       m,
+                       info->size,
+                       static_cast<I*>(info->row_blocks),
+                       info->wg_flags,
+                       static_cast<J*>(info->wg_ids));
+
+    hipLaunchKernelGGL((csrmvn_adaptive_analysis_fill_kernel<CSRMV_ANALYSIS_DIM>),
+                       dim3((m - 1) / CSRMV_ANALYSIS_DIM + 1),
+                       dim3(CSRMV_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       m,
+                       wg_offset,
+                       static_cast<I*>(info->row_blocks),
+                       static_cast<J*>(info->wg_ids));
+
+    // Number of threads for the CSR-Stream reduction
+    hipLaunchKernelGGL((csrmvn_adaptive_analysis_reduction_kernel<CSRMV_ANALYSIS_DIM>),
+                       dim3((info->size - 1) / CSRMV_ANALYSIS_DIM + 1),
+                       dim3(CSRMV_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       wg_offset + m,
+                       static_cast<const I*>(info->row_blocks),
+                       static_cast<J*>(info->wg_ids));
+
+    // Copy the exact number of row blocks to the host, asynchronously
+    RETURN_IF_HIP_ERROR(rocsparse_hipHostMalloc(&info->size_host, sizeof(I)));
+    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&info->size_event, hipEventDisableTiming));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->size_host, wg_offset + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipEventRecord(info->size_event, stream));
+    info->size_pending = true;
 
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(wg_offset, handle->stream));
+#undef CSRMV_ANALYSIS_DIM
 
-        // Now, what's up with this row? What did it do?
+    return rocsparse_status_success;
+}
 
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case;
-        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            I numWGReq = static_cast<I>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+// Cross-checks the row blocks generated by the device analysis against the
+// host analysis. Blocks the stream, for debugging purposes only.
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrmv_analysis_check(rocsparse_handle     handle,
+                                                       J                    m,
+                                                       const I*             csr_row_ptr,
+                                                       rocsparse_csrmv_info info)
+{
+    hipStream_t stream = handle->stream;
 
-            // Check to ensure #workgroups can fit in 32 bits, if not
-            // then the last workgroup will do all the remaining work
-            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
-            static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
-            numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_csrmv_info_size(info, true));
 
-            if(allocate_row_blocks)
-            {
-                for(I w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = (i - 1);
-                    *wgIds |= static_cast<J>(w);
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                *rowBlocks = i;
-                ++rowBlocks;
-                ++wgIds;
-            }
+    std::vector<I> hptr(m + 1);
+    std::vector<I> row_blocks(info->size);
+    std::vector<J> wg_ids(info->size);
 
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_blocks.data(),
+                                       info->row_blocks,
+                                       sizeof(I) * info->size,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        wg_ids.data(), info->wg_ids, sizeof(J) * info->size, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
+    // Serial host analysis as reference
+    int64_t long_row  = handle->tuning.csrmv_long_row;
+    int64_t short_row = handle->tuning.csrmv_short_row;
+    size_t  host_size = 0;
+    ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE, I, J>(
+        (I*)NULL, (J*)NULL, host_size, hptr.data(), m, long_row, short_row, false);
+    std::vector<I> host_row_blocks(host_size, 0);
+    std::vector<J> host_wg_ids(host_size, 0);
+    ComputeRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(host_row_blocks.data(),
+                                                                             host_wg_ids.data(),
+                                                                             host_size,
+                                                                             hptr.data(),
+                                                                             m,
+                                                                             long_row,
+                                                                             short_row,
+                                                                             true);
+
+    if(!ValidateRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+           host_row_blocks.data(), host_wg_ids.data(), host_size, hptr.data(), m))
+    {
+        ROCSPARSE_DEBUG_VERBOSE("csrmv host analysis generated invalid row blocks");
+        return rocsparse_status_internal_error;
+    }
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if(sum == static_cast<I>(BLOCK_SIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
+    // Multithreaded host analysis
+    std::vector<I> par_row_blocks;
+    std::vector<J> par_wg_ids;
+    ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+        par_row_blocks, par_wg_ids, hptr.data(), m, long_row, short_row);
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
+    if(!ValidateRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+           par_row_blocks.data(), par_wg_ids.data(), par_row_blocks.size(), hptr.data(), m))
+    {
+        ROCSPARSE_DEBUG_VERBOSE("csrmv parallel host analysis generated invalid row blocks");
+        return rocsparse_status_internal_error;
     }
 
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
+    if(!ValidateRowBlocks<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+           row_blocks.data(), wg_ids.data(), info->size, hptr.data(), m))
     {
-        *rowBlocks = nRows;
-        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        ROCSPARSE_DEBUG_VERBOSE("csrmv device analysis generated invalid row blocks");
+        return rocsparse_status_internal_error;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrmv_analysis_rowblocks(rocsparse_handle          handle,
+                                                           J                         m,
+                                                           I                         nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const I*                  csr_row_ptr,
+                                                           rocsparse_csrmv_info      info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The symmetric kernels require the maximum number of rows per block on the host
+    if(descr->type != rocsparse_matrix_type_symmetric
+       && !ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::CSRMV_HOST_ANALYSIS))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis_device(handle, m, nnz, csr_row_ptr, info));
+
+        if(ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::CSRMV_CHECK_ANALYSIS))
         {
-            *(wgIds - 1) |= numThreadsForReduction(i - last_i);
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_check(handle, m, csr_row_ptr, info));
         }
 
-        ++rowBlocks;
+        return rocsparse_status_success;
     }
 
-    ++total_row_blocks;
+    // row blocks size
+    info->size = 0;
 
-    if(allocate_row_blocks)
-    {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
+    // Temporary arrays to hold device data
+    std::vector<I> hptr(m + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Create row blocks and workgroup data structures in a single, multithreaded pass
+    std::vector<I> row_blocks;
+    std::vector<J> wg_ids;
+
+    ComputeRowBlocksParallel<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+        row_blocks,
+        wg_ids,
+        hptr.data(),
+        m,
+        handle->tuning.csrmv_long_row,
+        handle->tuning.csrmv_short_row);
+
+    info->size = row_blocks.size();
+
+    // Workgroup flags
+    std::vector<unsigned int> wg_flags(info->size, 0);
 
-        assert((dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        rowBlockSize = dist;
+    if(descr->type == rocsparse_matrix_type_symmetric)
+    {
+        info->max_rows = maxRowsInABlock(row_blocks.data(), info->size);
     }
-    else
+
+    // Allocate memory on device to hold csrmv info, if required
+    if(info->size > 0)
     {
-        rowBlockSize = total_row_blocks;
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync((void**)&info->row_blocks, sizeof(I) * info->size, stream));
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+            (void**)&info->wg_flags, sizeof(unsigned int) * info->size, stream));
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync((void**)&info->wg_ids, sizeof(J) * info->size, stream));
+
+        // Copy row blocks information to device
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->row_blocks,
+                                           row_blocks.data(),
+                                           sizeof(I) * info->size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->wg_flags,
+                                           wg_flags.data(),
+                                           sizeof(unsigned int) * info->size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->wg_ids,
+                                           wg_ids.data(),
+                                           sizeof(J) * info->size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
     }
+
+    return rocsparse_status_success;
 }
 
 template <typename I, typename J, typename A>
@@ -396,6 +463,10 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
               (const void*&)csr_col_ind,
               (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csrmv_analysis", rocsparse_get_datatype<A>(), m, n, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -464,74 +535,40 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
-    // row blocks size
-    info->csrmv_info->size = 0;
-
-    // Temporary arrays to hold device data
-    std::vector<I> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Determine row blocks array size
-    ComputeRowBlocks<I, J>((I*)NULL, (J*)NULL, info->csrmv_info->size, hptr.data(), m, false);
+    // Reuse the analysis of a matrix with the same sparsity pattern, if cached
+    const bool use_cache = rocsparse_analysis_cache_enabled(handle->analysis_cache);
 
-    // Create row blocks, workgroup flag, and workgroup data structures
-    std::vector<I>            row_blocks(info->csrmv_info->size, 0);
-    std::vector<unsigned int> wg_flags(info->csrmv_info->size, 0);
-    std::vector<J>            wg_ids(info->csrmv_info->size, 0);
+    rocsparse_analysis_cache_key key;
 
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->size, hptr.data(), m, true);
-
-    if(descr->type == rocsparse_matrix_type_symmetric)
+    if(use_cache)
     {
-        info->csrmv_info->max_rows = maxRowsInABlock(row_blocks.data(), info->csrmv_info->size);
-    }
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_analysis_cache_key_template(handle,
+                                                  rocsparse_analysis_cache_kind_csrmv,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  descr->base,
+                                                  &key));
 
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
-    {
-        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&info->csrmv_info->row_blocks,
-                                                     sizeof(I) * info->csrmv_info->size,
-                                                     handle->stream));
-        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&info->csrmv_info->wg_flags,
-                                                     sizeof(unsigned int) * info->csrmv_info->size,
-                                                     handle->stream));
-        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
-            (void**)&info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size, handle->stream));
+        key.options[0] = trans;
+        key.options[1] = descr->type;
 
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(I) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_flags,
-                                           wg_flags.data(),
-                                           sizeof(unsigned int) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_ids,
-                                           wg_ids.data(),
-                                           sizeof(J) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
+        bool found;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_find_csrmv(
+            handle->analysis_cache, key, info->csrmv_info, &found));
 
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-    }
+        if(found)
+        {
+            info->csrmv_info->descr       = descr;
+            info->csrmv_info->csr_row_ptr = csr_row_ptr;
+            info->csrmv_info->csr_col_ind = csr_col_ind;
 
-    // Store some pointers to verify correct execution
-    info->csrmv_info->trans       = trans;
-    info->csrmv_info->m           = m;
-    info->csrmv_info->n           = n;
-    info->csrmv_info->nnz         = nnz;
-    info->csrmv_info->descr       = descr;
-    info->csrmv_info->csr_row_ptr = csr_row_ptr;
-    info->csrmv_info->csr_col_ind = csr_col_ind;
+            return rocsparse_status_success;
+        }
+    }
 
     info->csrmv_info->index_type_I
         = (sizeof(I) == sizeof(uint16_t))
@@ -544,6 +581,25 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
               : ((sizeof(J) == sizeof(int32_t)) ? rocsparse_indextype_i32
                                                 : rocsparse_indextype_i64);
 
+    // Store some pointers to verify correct execution
+    info->csrmv_info->trans       = trans;
+    info->csrmv_info->m           = m;
+    info->csrmv_info->n           = n;
+    info->csrmv_info->nnz         = nnz;
+    info->csrmv_info->descr       = descr;
+    info->csrmv_info->csr_row_ptr = csr_row_ptr;
+    info->csrmv_info->csr_col_ind = csr_col_ind;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrmv_analysis_rowblocks(handle, m, nnz, descr, csr_row_ptr, info->csrmv_info));
+
+    // Keep a copy for the next matrices with this sparsity pattern
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_insert_csrmv(
+            handle->analysis_cache, key, info->csrmv_info, stream));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -708,6 +764,7 @@ void csrmvt_symm_general_kernel(bool     conj,
 template <typename I, typename J, typename A, typename X, typename Y, typename U>
 ROCSPARSE_KERNEL(WG_SIZE)
 void csrmvn_adaptive_kernel(bool conj,
+                            J    m,
                             I    nnz,
                             const I* __restrict__ row_blocks,
                             unsigned int* __restrict__ wg_flags,
@@ -721,6 +778,12 @@ void csrmvn_adaptive_kernel(bool conj,
                             Y* __restrict__ y,
                             rocsparse_index_base idx_base)
 {
+    // Skip unused row blocks of a pending device analysis
+    if(row_blocks[hipBlockIdx_x] >= m)
+    {
+        return;
+    }
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
     if(alpha != 0 || beta != 1)
@@ -994,6 +1057,14 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Pick up the exact number of row blocks, if the device analysis has completed.
+    // The analysis event is not queried while the stream is captured or when sizes
+    // are kept on the device, the upper bound is used instead.
+    if(!rocsparse_sizes_on_device(handle))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_csrmv_info_size(info, false));
+    }
+
     if(descr->type == rocsparse_matrix_type_general
        || descr->type == rocsparse_matrix_type_triangular)
     {
@@ -1006,6 +1077,7 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
                            0,
                            stream,
                            conj,
+                           m,
                            nnz,
                            static_cast<I*>(info->row_blocks),
                            info->wg_flags,
@@ -1222,6 +1294,10 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
               "--beta",
               LOG_BENCH_SCALAR_VALUE(handle, beta_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrmv"), rocsparse_get_datatype<T>(), m, n, nnz);
+
     // Check transpose
     if(rocsparse_enum_utils::is_invalid(trans))
     {
@@ -1326,6 +1402,12 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz,
+                sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz) + sizeof(X) * n
+                    + sizeof(Y) * 2.0 * m);
+
     if(info == nullptr || info->csrmv_info == nullptr || trans != rocsparse_operation_none)
     {
         // If csrmv info is not available, call csrmv general
@@ -1474,6 +1556,12 @@ INSTANTIATE(rocsparse_double_complex, int64_t, int64_t);
 INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, int8_t);
 INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, int8_t);
 INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, int8_t);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, _Float16);
+INSTANTIATE_MIXED_ANALYSIS(int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_MIXED_ANALYSIS
 
 #define INSTANTIATE_MIXED(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)                                 \
@@ -1500,6 +1588,12 @@ INSTANTIATE_MIXED(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(float, int32_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE_MIXED(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, int64_t, hip_bfloat16, float, float);
 INSTANTIATE_MIXED(rocsparse_float_complex,
                   int32_t,
                   int32_t,
@@ -89,3 +89,74 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           const T*                  beta,
                                           Y*                        y,
                                           bool                      force_conj);
+
+// Number of row length bins of the binned csrmv. The host bin sizes array holds the number
+// of rows of each bin, followed by the longest row of the last bin.
+#define CSRMV_BINNED_NBINS 6
+
+// Returns true if the bins cover the product, that is for the non-transposed product of
+// general and triangular matrices
+bool rocsparse_csrmv_binned_supported(rocsparse_operation trans, const rocsparse_mat_descr descr);
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrmv_binned_buffer_size_template(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             J                         m,
+                                                             J                         n,
+                                                             I                         nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const I*                  csr_row_ptr,
+                                                             size_t*                   buffer_size);
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrmv_binned_analysis_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          J                         m,
+                                                          J                         n,
+                                                          I                         nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const I*                  csr_row_ptr,
+                                                          int64_t*                  bin_size,
+                                                          void*                     temp_buffer);
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_binned_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 J                         m,
+                                                 J                         n,
+                                                 I                         nnz,
+                                                 const T*                  alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const A*                  csr_val,
+                                                 const I*                  csr_row_ptr,
+                                                 const J*                  csr_col_ind,
+                                                 const int64_t*            bin_size,
+                                                 const X*                  x,
+                                                 const T*                  beta,
+                                                 Y*                        y,
+                                                 void*                     temp_buffer);
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csrmv_merge_buffer_size_template(rocsparse_handle          handle,
+                                                            rocsparse_operation       trans,
+                                                            J                         m,
+                                                            J                         n,
+                                                            I                         nnz,
+                                                            const rocsparse_mat_descr descr,
+                                                            size_t*                   buffer_size);
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                const X*                  x,
+                                                const T*                  beta,
+                                                Y*                        y,
+                                                void*                     temp_buffer);
@@ -0,0 +1,631 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrmv_batched.hpp"
+#include "common.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrmv_device.h"
+
+// Largest number of batches processed by a single launch, bounded by the grid y dimension
+#define CSRMV_BATCHED_MAX_GRID_Y 65535
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_general_batched_kernel(bool     conj,
+                                   J        m,
+                                   U        alpha_device_host,
+                                   const I* csr_row_ptr,
+                                   int64_t  offsets_batch_stride,
+                                   const J* __restrict__ csr_col_ind,
+                                   int64_t columns_batch_stride,
+                                   const A* __restrict__ csr_val,
+                                   int64_t values_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   U       beta_device_host,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        int64_t  batch   = hipBlockIdx_y;
+        const I* row_ptr = csr_row_ptr + offsets_batch_stride * batch;
+
+        csrmvn_general_device<BLOCKSIZE, WF_SIZE>(conj,
+                                                  m,
+                                                  alpha,
+                                                  row_ptr,
+                                                  row_ptr + 1,
+                                                  csr_col_ind + columns_batch_stride * batch,
+                                                  csr_val + values_batch_stride * batch,
+                                                  x + x_batch_stride * batch,
+                                                  beta,
+                                                  y + y_batch_stride * batch,
+                                                  idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmv_batched_scale_kernel(J size, U scalar_device_host, Y* __restrict__ data, int64_t stride)
+{
+    auto scalar = load_scalar_device_host(scalar_device_host);
+    if(scalar != 1)
+    {
+        csrmvt_scale_device(size, scalar, data + stride * hipBlockIdx_y);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvt_general_batched_kernel(bool     conj,
+                                   J        m,
+                                   U        alpha_device_host,
+                                   const I* csr_row_ptr,
+                                   int64_t  offsets_batch_stride,
+                                   const J* __restrict__ csr_col_ind,
+                                   int64_t columns_batch_stride,
+                                   const A* __restrict__ csr_val,
+                                   int64_t values_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        int64_t  batch   = hipBlockIdx_y;
+        const I* row_ptr = csr_row_ptr + offsets_batch_stride * batch;
+
+        csrmvt_general_device<BLOCKSIZE, WF_SIZE>(conj,
+                                                  m,
+                                                  alpha,
+                                                  row_ptr,
+                                                  row_ptr + 1,
+                                                  csr_col_ind + columns_batch_stride * batch,
+                                                  csr_val + values_batch_stride * batch,
+                                                  x + x_batch_stride * batch,
+                                                  y + y_batch_stride * batch,
+                                                  idx_base);
+    }
+}
+
+#define LAUNCH_CSRMVN_GENERAL_BATCHED(wfsize)                                \
+    csrmvn_general_batched_kernel<CSRMVN_DIM, wfsize>                        \
+        <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(conj,                 \
+                                                       m,                    \
+                                                       alpha_device_host,    \
+                                                       csr_row_ptr,          \
+                                                       offsets_batch_stride, \
+                                                       csr_col_ind,          \
+                                                       columns_batch_stride, \
+                                                       csr_val,              \
+                                                       values_batch_stride,  \
+                                                       x,                    \
+                                                       x_batch_stride,       \
+                                                       beta_device_host,     \
+                                                       y,                    \
+                                                       y_batch_stride,       \
+                                                       descr->base)
+
+#define LAUNCH_CSRMVT_GENERAL_BATCHED(wfsize)                                \
+    csrmvt_general_batched_kernel<CSRMVT_DIM, wfsize>                        \
+        <<<csrmvt_blocks, csrmvt_threads, 0, stream>>>(conj,                 \
+                                                       m,                    \
+                                                       alpha_device_host,    \
+                                                       csr_row_ptr,          \
+                                                       offsets_batch_stride, \
+                                                       csr_col_ind,          \
+                                                       columns_batch_stride, \
+                                                       csr_val,              \
+                                                       values_batch_stride,  \
+                                                       x,                    \
+                                                       x_batch_stride,       \
+                                                       y,                    \
+                                                       y_batch_stride,       \
+                                                       descr->base)
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+rocsparse_status rocsparse_csrmv_batched_dispatch(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  J                         m,
+                                                  J                         n,
+                                                  I                         nnz,
+                                                  int64_t                   batch_count,
+                                                  U                         alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  csr_val,
+                                                  int64_t                   values_batch_stride,
+                                                  const I*                  csr_row_ptr,
+                                                  int64_t                   offsets_batch_stride,
+                                                  const J*                  csr_col_ind,
+                                                  int64_t                   columns_batch_stride,
+                                                  const X*                  x,
+                                                  int64_t                   x_batch_stride,
+                                                  U                         beta_device_host,
+                                                  Y*                        y,
+                                                  int64_t                   y_batch_stride)
+{
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Average nnz per row, all batches share the same number of rows and non-zeros
+    J nnz_per_row = nnz / m;
+
+    if(trans == rocsparse_operation_none)
+    {
+#define CSRMVN_DIM 512
+        dim3 csrmvn_blocks((m - 1) / CSRMVN_DIM + 1, batch_count);
+        dim3 csrmvn_threads(CSRMVN_DIM);
+
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(16);
+        }
+        else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(32);
+        }
+        else
+        {
+            LAUNCH_CSRMVN_GENERAL_BATCHED(64);
+        }
+#undef CSRMVN_DIM
+    }
+    else
+    {
+#define CSRMVT_DIM 256
+        // Scale y with beta
+        csrmv_batched_scale_kernel<CSRMVT_DIM>
+            <<<dim3((n - 1) / CSRMVT_DIM + 1, batch_count), CSRMVT_DIM, 0, stream>>>(
+                n, beta_device_host, y, y_batch_stride);
+
+        J max_blocks = 1024;
+        J min_blocks = (m - 1) / CSRMVT_DIM + 1;
+
+        dim3 csrmvt_blocks(std::min(min_blocks, max_blocks), batch_count);
+        dim3 csrmvt_threads(CSRMVT_DIM);
+
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_CSRMVT_GENERAL_BATCHED(4);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_CSRMVT_GENERAL_BATCHED(8);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_CSRMVT_GENERAL_BATCHED(16);
+        }
+        else if(nnz_per_row < 32 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMVT_GENERAL_BATCHED(32);
+        }
+        else
+        {
+            LAUNCH_CSRMVT_GENERAL_BATCHED(64);
+        }
+#undef CSRMVT_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_batched_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  J                         m,
+                                                  J                         n,
+                                                  I                         nnz,
+                                                  int64_t                   batch_count,
+                                                  const T*                  alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  csr_val,
+                                                  int64_t                   values_batch_stride,
+                                                  const I*                  csr_row_ptr,
+                                                  int64_t                   offsets_batch_stride,
+                                                  const J*                  csr_col_ind,
+                                                  int64_t                   columns_batch_stride,
+                                                  const X*                  x,
+                                                  int64_t                   x_batch_stride,
+                                                  const T*                  beta_device_host,
+                                                  Y*                        y,
+                                                  int64_t                   y_batch_stride)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmv_batched"),
+              trans,
+              m,
+              n,
+              nnz,
+              batch_count,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csr_val,
+              values_batch_stride,
+              (const void*&)csr_row_ptr,
+              offsets_batch_stride,
+              (const void*&)csr_col_ind,
+              columns_batch_stride,
+              (const void*&)x,
+              x_batch_stride,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y,
+              y_batch_stride);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrmv_batched"), rocsparse_get_datatype<T>(), m, n, nnz);
+
+    // Check transpose
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // The symmetric kernels are not batched
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_triangular)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr->type == rocsparse_matrix_type_triangular && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check batch strides
+    if(values_batch_stride < 0 || offsets_batch_stride < 0 || columns_batch_stride < 0
+       || x_batch_stride < 0 || y_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    J ysize = (trans == rocsparse_operation_none) ? m : n;
+
+    // Batches of y must not overlap
+    if(batch_count > 1 && y_batch_stride < ysize)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Another quick return.
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // matrix never accessed however still need to update the y vectors
+        if(ysize > 0)
+        {
+            if(y == nullptr || beta_device_host == nullptr)
+            {
+                return rocsparse_status_invalid_pointer;
+            }
+
+            for(int64_t b = 0; b < batch_count; b += CSRMV_BATCHED_MAX_GRID_Y)
+            {
+                int64_t nbatch = std::min<int64_t>(batch_count - b, CSRMV_BATCHED_MAX_GRID_Y);
+
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    csrmv_batched_scale_kernel<256>
+                        <<<dim3((ysize - 1) / 256 + 1, nbatch), 256, 0, handle->stream>>>(
+                            ysize, beta_device_host, y + y_batch_stride * b, y_batch_stride);
+                }
+                else
+                {
+                    csrmv_batched_scale_kernel<256>
+                        <<<dim3((ysize - 1) / 256 + 1, nbatch), 256, 0, handle->stream>>>(
+                            ysize, *beta_device_host, y + y_batch_stride * b, y_batch_stride);
+                }
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return.
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz * batch_count,
+                (sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz)
+                 + sizeof(X) * ((trans == rocsparse_operation_none) ? n : m)
+                 + sizeof(Y) * 2.0 * ysize)
+                    * batch_count);
+
+    // Batches are spread over the grid y dimension, one launch per
+    // CSRMV_BATCHED_MAX_GRID_Y batches
+    for(int64_t b = 0; b < batch_count; b += CSRMV_BATCHED_MAX_GRID_Y)
+    {
+        int64_t nbatch = std::min<int64_t>(batch_count - b, CSRMV_BATCHED_MAX_GRID_Y);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrmv_batched_dispatch<T>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    nbatch,
+                                                    alpha_device_host,
+                                                    descr,
+                                                    csr_val + values_batch_stride * b,
+                                                    values_batch_stride,
+                                                    csr_row_ptr + offsets_batch_stride * b,
+                                                    offsets_batch_stride,
+                                                    csr_col_ind + columns_batch_stride * b,
+                                                    columns_batch_stride,
+                                                    x + x_batch_stride * b,
+                                                    x_batch_stride,
+                                                    beta_device_host,
+                                                    y + y_batch_stride * b,
+                                                    y_batch_stride));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrmv_batched_dispatch<T>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    nbatch,
+                                                    *alpha_device_host,
+                                                    descr,
+                                                    csr_val + values_batch_stride * b,
+                                                    values_batch_stride,
+                                                    csr_row_ptr + offsets_batch_stride * b,
+                                                    offsets_batch_stride,
+                                                    csr_col_ind + columns_batch_stride * b,
+                                                    columns_batch_stride,
+                                                    x + x_batch_stride * b,
+                                                    x_batch_stride,
+                                                    *beta_device_host,
+                                                    y + y_batch_stride * b,
+                                                    y_batch_stride));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)   \
+    template rocsparse_status rocsparse_csrmv_batched_template( \
+        rocsparse_handle          handle,                       \
+        rocsparse_operation       trans,                        \
+        JTYPE                     m,                            \
+        JTYPE                     n,                            \
+        ITYPE                     nnz,                          \
+        int64_t                   batch_count,                  \
+        const TTYPE*              alpha_device_host,            \
+        const rocsparse_mat_descr descr,                        \
+        const ATYPE*              csr_val,                      \
+        int64_t                   values_batch_stride,          \
+        const ITYPE*              csr_row_ptr,                  \
+        int64_t                   offsets_batch_stride,         \
+        const JTYPE*              csr_col_ind,                  \
+        int64_t                   columns_batch_stride,         \
+        const XTYPE*              x,                            \
+        int64_t                   x_batch_stride,               \
+        const TTYPE*              beta_device_host,             \
+        YTYPE*                    y,                            \
+        int64_t                   y_batch_stride);
+
+INSTANTIATE(float, int32_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(double, int32_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int64_t, float, double, double);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
@@ -0,0 +1,48 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_batched_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  J                         m,
+                                                  J                         n,
+                                                  I                         nnz,
+                                                  int64_t                   batch_count,
+                                                  const T*                  alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  csr_val,
+                                                  int64_t                   values_batch_stride,
+                                                  const I*                  csr_row_ptr,
+                                                  int64_t                   offsets_batch_stride,
+                                                  const J*                  csr_col_ind,
+                                                  int64_t                   columns_batch_stride,
+                                                  const X*                  x,
+                                                  int64_t                   x_batch_stride,
+                                                  const T*                  beta_device_host,
+                                                  Y*                        y,
+                                                  int64_t                   y_batch_stride);
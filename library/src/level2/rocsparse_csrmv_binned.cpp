@@ -0,0 +1,735 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "common.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrmv_device.h"
+#include "rocsparse_csrmv.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+// Rows with up to CSRMV_BINNED_MAX_BLOCK_ROW_NNZ entries are processed by a single block,
+// longer rows by (max_row_nnz - 1) / CSRMV_BINNED_MAX_BLOCK_ROW_NNZ + 1 blocks
+#define CSRMV_BINNED_DIM 256
+#define CSRMV_BINNED_MAX_BLOCK_ROW_NNZ 2048
+
+template <unsigned int BLOCKSIZE,
+          unsigned int NBINS,
+          unsigned int MAX_BLOCK_ROW_NNZ,
+          typename I,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_binned_analysis_count_kernel(J        m,
+                                         const I* csr_row_ptr,
+                                         int* __restrict__ bin_key,
+                                         J* __restrict__ bin_row,
+                                         J* __restrict__ bin_size,
+                                         I* __restrict__ max_row_nnz)
+{
+    csrmvn_binned_analysis_count_device<BLOCKSIZE, NBINS, MAX_BLOCK_ROW_NNZ>(
+        m, csr_row_ptr, bin_key, bin_row, bin_size, max_row_nnz);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_binned_wf_kernel(bool conj,
+                             J    nrows,
+                             const J* __restrict__ bin_row,
+                             U        alpha_device_host,
+                             const I* csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const A* __restrict__ csr_val,
+                             const X* __restrict__ x,
+                             U beta_device_host,
+                             Y* __restrict__ y,
+                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        csrmvn_binned_wf_device<BLOCKSIZE, WF_SIZE>(conj,
+                                                    nrows,
+                                                    bin_row,
+                                                    alpha,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csr_val,
+                                                    x,
+                                                    beta,
+                                                    y,
+                                                    idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_binned_block_kernel(bool conj,
+                                const J* __restrict__ bin_row,
+                                U        alpha_device_host,
+                                const I* csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ x,
+                                U beta_device_host,
+                                Y* __restrict__ y,
+                                rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        csrmvn_binned_block_device<BLOCKSIZE>(
+            conj, bin_row, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_binned_scale_kernel(J nrows,
+                                const J* __restrict__ bin_row,
+                                U beta_device_host,
+                                Y* __restrict__ y)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != 1)
+    {
+        csrmvn_binned_scale_device(nrows, bin_row, beta, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_binned_multiblock_kernel(bool conj,
+                                     J    blocks_per_row,
+                                     const J* __restrict__ bin_row,
+                                     U        alpha_device_host,
+                                     const I* csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const X* __restrict__ x,
+                                     Y* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        csrmvn_binned_multiblock_device<BLOCKSIZE>(conj,
+                                                   blocks_per_row,
+                                                   bin_row,
+                                                   alpha,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   x,
+                                                   y,
+                                                   idx_base);
+    }
+}
+
+// The bins only cover the non-transposed product of general and triangular matrices,
+// everything else runs the general csrmv kernels
+bool rocsparse_csrmv_binned_supported(rocsparse_operation trans, const rocsparse_mat_descr descr)
+{
+    return trans == rocsparse_operation_none
+           && (descr->type == rocsparse_matrix_type_general
+               || descr->type == rocsparse_matrix_type_triangular);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrmv_binned_buffer_size_template(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             J                         m,
+                                                             J                         n,
+                                                             I                         nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const I*                  csr_row_ptr,
+                                                             size_t*                   buffer_size)
+{
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m <= 0 || !rocsparse_csrmv_binned_supported(trans, descr))
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // Rows sorted by bin, kept for the compute stage
+    *buffer_size = ((sizeof(J) * m - 1) / 256 + 1) * 256;
+
+    // Bin sizes and longest row of the last bin
+    *buffer_size += ((sizeof(J) * CSRMV_BINNED_NBINS - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(I) - 1) / 256 + 1) * 256;
+
+    // Unsorted bin keys, sorted bin keys and unsorted rows
+    *buffer_size += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(nullptr,
+                                                  rocprim_size,
+                                                  (int*)nullptr,
+                                                  (int*)nullptr,
+                                                  (J*)nullptr,
+                                                  (J*)nullptr,
+                                                  m,
+                                                  0,
+                                                  rocsparse_clz(CSRMV_BINNED_NBINS),
+                                                  handle->stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrmv_binned_analysis_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          J                         m,
+                                                          J                         n,
+                                                          I                         nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const I*                  csr_row_ptr,
+                                                          int64_t*                  bin_size,
+                                                          void*                     temp_buffer)
+{
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr || bin_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    for(int i = 0; i <= CSRMV_BINNED_NBINS; ++i)
+    {
+        bin_size[i] = 0;
+    }
+
+    if(m <= 0 || !rocsparse_csrmv_binned_supported(trans, descr))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    char* ptr     = reinterpret_cast<char*>(temp_buffer);
+    J*    bin_row = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+    J* d_bin_size = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * CSRMV_BINNED_NBINS - 1) / 256 + 1) * 256;
+    I* d_max_row_nnz = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) - 1) / 256 + 1) * 256;
+    int* bin_key = reinterpret_cast<int*>(ptr);
+    ptr += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    int* bin_key_sorted = reinterpret_cast<int*>(ptr);
+    ptr += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    J* bin_row_unsorted = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_bin_size, 0, sizeof(J) * CSRMV_BINNED_NBINS, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_max_row_nnz, 0, sizeof(I), stream));
+
+    // Determine the bin of each row
+    hipLaunchKernelGGL((csrmvn_binned_analysis_count_kernel<CSRMV_BINNED_DIM,
+                                                            CSRMV_BINNED_NBINS,
+                                                            CSRMV_BINNED_MAX_BLOCK_ROW_NNZ>),
+                       dim3((m - 1) / CSRMV_BINNED_DIM + 1),
+                       dim3(CSRMV_BINNED_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       bin_key,
+                       bin_row_unsorted,
+                       d_bin_size,
+                       d_max_row_nnz);
+
+    // Group the rows by bin, the sort is stable and keeps the rows of a bin in order
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(nullptr,
+                                                  rocprim_size,
+                                                  bin_key,
+                                                  bin_key_sorted,
+                                                  bin_row_unsorted,
+                                                  bin_row,
+                                                  m,
+                                                  0,
+                                                  rocsparse_clz(CSRMV_BINNED_NBINS),
+                                                  stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(rocprim_buffer,
+                                                  rocprim_size,
+                                                  bin_key,
+                                                  bin_key_sorted,
+                                                  bin_row_unsorted,
+                                                  bin_row,
+                                                  m,
+                                                  0,
+                                                  rocsparse_clz(CSRMV_BINNED_NBINS),
+                                                  stream));
+
+    // The compute stage launches one kernel per bin and requires the bin sizes on the host
+    J h_bin_size[CSRMV_BINNED_NBINS];
+    I h_max_row_nnz;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_bin_size,
+                                       d_bin_size,
+                                       sizeof(J) * CSRMV_BINNED_NBINS,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&h_max_row_nnz, d_max_row_nnz, sizeof(I), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int i = 0; i < CSRMV_BINNED_NBINS; ++i)
+    {
+        bin_size[i] = h_bin_size[i];
+    }
+
+    bin_size[CSRMV_BINNED_NBINS] = h_max_row_nnz;
+
+    return rocsparse_status_success;
+}
+
+#define LAUNCH_CSRMVN_BINNED_WF(bin, wfsize)                                              \
+    if(bin_size[bin] > 0)                                                                 \
+    {                                                                                     \
+        dim3 csrmvn_blocks((bin_size[bin] * wfsize - 1) / CSRMV_BINNED_DIM + 1);          \
+        dim3 csrmvn_threads(CSRMV_BINNED_DIM);                                            \
+        csrmvn_binned_wf_kernel<CSRMV_BINNED_DIM, wfsize>                                 \
+            <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(conj,                          \
+                                                           static_cast<J>(bin_size[bin]), \
+                                                           bin_row + offset,              \
+                                                           alpha_device_host,             \
+                                                           csr_row_ptr,                   \
+                                                           csr_col_ind,                   \
+                                                           csr_val,                       \
+                                                           x,                             \
+                                                           beta_device_host,              \
+                                                           y,                             \
+                                                           descr->base);                  \
+    }                                                                                     \
+    offset += bin_size[bin]
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_csrmv_binned_dispatch(rocsparse_handle          handle,
+                                                        U                         alpha_device_host,
+                                                        const rocsparse_mat_descr descr,
+                                                        const A*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        const int64_t*            bin_size,
+                                                        const X*                  x,
+                                                        U                         beta_device_host,
+                                                        Y*                        y,
+                                                        void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Only the non-transposed product is binned
+    const bool conj = false;
+
+    const J* bin_row = reinterpret_cast<const J*>(temp_buffer);
+    int64_t  offset  = 0;
+
+    // Thread per row, subwavefront per row and wavefront per row
+    LAUNCH_CSRMVN_BINNED_WF(0, 1);
+    LAUNCH_CSRMVN_BINNED_WF(1, 4);
+    LAUNCH_CSRMVN_BINNED_WF(2, 16);
+
+    if(handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_BINNED_WF(3, 32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_BINNED_WF(3, 64);
+    }
+
+    // Block per row
+    if(bin_size[4] > 0)
+    {
+        dim3 csrmvn_blocks(bin_size[4]);
+        dim3 csrmvn_threads(CSRMV_BINNED_DIM);
+        csrmvn_binned_block_kernel<CSRMV_BINNED_DIM>
+            <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(conj,
+                                                           bin_row + offset,
+                                                           alpha_device_host,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           csr_val,
+                                                           x,
+                                                           beta_device_host,
+                                                           y,
+                                                           descr->base);
+    }
+
+    offset += bin_size[4];
+
+    // Multiple blocks per row, the rows are scaled by beta before the blocks accumulate
+    if(bin_size[5] > 0)
+    {
+        J nrows          = static_cast<J>(bin_size[5]);
+        J blocks_per_row = static_cast<J>(
+            (bin_size[CSRMV_BINNED_NBINS] - 1) / CSRMV_BINNED_MAX_BLOCK_ROW_NNZ + 1);
+
+        dim3 csrmvn_blocks(static_cast<int64_t>(nrows) * blocks_per_row);
+        dim3 csrmvn_threads(CSRMV_BINNED_DIM);
+
+        csrmvn_binned_scale_kernel<CSRMV_BINNED_DIM>
+            <<<(nrows - 1) / CSRMV_BINNED_DIM + 1, CSRMV_BINNED_DIM, 0, stream>>>(
+                nrows, bin_row + offset, beta_device_host, y);
+
+        csrmvn_binned_multiblock_kernel<CSRMV_BINNED_DIM>
+            <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(conj,
+                                                           blocks_per_row,
+                                                           bin_row + offset,
+                                                           alpha_device_host,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           csr_val,
+                                                           x,
+                                                           y,
+                                                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_binned_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 J                         m,
+                                                 J                         n,
+                                                 I                         nnz,
+                                                 const T*                  alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const A*                  csr_val,
+                                                 const I*                  csr_row_ptr,
+                                                 const J*                  csr_col_ind,
+                                                 const int64_t*            bin_size,
+                                                 const X*                  x,
+                                                 const T*                  beta_device_host,
+                                                 Y*                        y,
+                                                 void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Everything the bins do not cover, including the quick returns, is handled by csrmv
+    if(m <= 0 || n <= 0 || nnz <= 0 || !rocsparse_csrmv_binned_supported(trans, descr))
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        (csr_row_ptr != nullptr) ? csr_row_ptr + 1 : nullptr,
+                                        csr_col_ind,
+                                        nullptr,
+                                        x,
+                                        beta_device_host,
+                                        y,
+                                        false);
+    }
+
+    if(descr->type == rocsparse_matrix_type_triangular && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr || x == nullptr
+       || y == nullptr || bin_size == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz,
+                sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz) + sizeof(X) * n
+                    + sizeof(Y) * 2.0 * m + sizeof(J) * double(m));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_binned_dispatch<T>(handle,
+                                                  alpha_device_host,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  bin_size,
+                                                  x,
+                                                  beta_device_host,
+                                                  y,
+                                                  temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrmv_binned_dispatch<T>(handle,
+                                                  *alpha_device_host,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  bin_size,
+                                                  x,
+                                                  *beta_device_host,
+                                                  y,
+                                                  temp_buffer);
+    }
+}
+
+#define INSTANTIATE_ANALYSIS(ITYPE, JTYPE)                                 \
+    template rocsparse_status rocsparse_csrmv_binned_buffer_size_template( \
+        rocsparse_handle          handle,                                  \
+        rocsparse_operation       trans,                                   \
+        JTYPE                     m,                                       \
+        JTYPE                     n,                                       \
+        ITYPE                     nnz,                                     \
+        const rocsparse_mat_descr descr,                                   \
+        const ITYPE*              csr_row_ptr,                             \
+        size_t*                   buffer_size);                            \
+    template rocsparse_status rocsparse_csrmv_binned_analysis_template(    \
+        rocsparse_handle          handle,                                  \
+        rocsparse_operation       trans,                                   \
+        JTYPE                     m,                                       \
+        JTYPE                     n,                                       \
+        ITYPE                     nnz,                                     \
+        const rocsparse_mat_descr descr,                                   \
+        const ITYPE*              csr_row_ptr,                             \
+        int64_t*                  bin_size,                                \
+        void*                     temp_buffer)
+
+INSTANTIATE_ANALYSIS(int32_t, int32_t);
+INSTANTIATE_ANALYSIS(int64_t, int32_t);
+INSTANTIATE_ANALYSIS(int64_t, int64_t);
+#undef INSTANTIATE_ANALYSIS
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)                                    \
+    template rocsparse_status rocsparse_csrmv_binned_template(rocsparse_handle          handle,  \
+                                                              rocsparse_operation       trans,   \
+                                                              JTYPE                     m,       \
+                                                              JTYPE                     n,       \
+                                                              ITYPE                     nnz,     \
+                                                              const TTYPE*              alpha,   \
+                                                              const rocsparse_mat_descr descr,   \
+                                                              const ATYPE*              csr_val, \
+                                                              const ITYPE*   csr_row_ptr,        \
+                                                              const JTYPE*   csr_col_ind,        \
+                                                              const int64_t* bin_size,           \
+                                                              const XTYPE*   x,                  \
+                                                              const TTYPE*   beta,               \
+                                                              YTYPE*         y,                  \
+                                                              void*          temp_buffer)
+
+// Uniform precisions
+INSTANTIATE(float, int32_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+// Mixed precisions
+INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(double, int32_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int64_t, float, double, double);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
@@ -0,0 +1,520 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrmv_device_merge.h"
+#include "rocsparse_csrmv.hpp"
+
+// Each block walks CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD items of the merge path
+#define CSRMV_MERGE_DIM 256
+#define CSRMV_MERGE_ITEMS_PER_THREAD 4
+
+template <unsigned int BLOCKSIZE, unsigned int ITEMS_PER_BLOCK, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_merge_path_partition_kernel(J m,
+                                        I nnz,
+                                        I nblocks,
+                                        const I* __restrict__ csr_row_ptr,
+                                        J* __restrict__ row_limits,
+                                        rocsparse_index_base idx_base)
+{
+    csrmvn_merge_path_partition_device<BLOCKSIZE, ITEMS_PER_BLOCK>(
+        m, nnz, nblocks, csr_row_ptr, row_limits, idx_base);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int ITEMS_PER_THREAD,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_merge_path_kernel(bool conj,
+                              J    m,
+                              I    nnz,
+                              const J* __restrict__ row_limits,
+                              U        alpha_device_host,
+                              const I* __restrict__ csr_row_ptr,
+                              const J* __restrict__ csr_col_ind,
+                              const A* __restrict__ csr_val,
+                              const X* __restrict__ x,
+                              U beta_device_host,
+                              Y* __restrict__ y,
+                              J* __restrict__ carry_row,
+                              T* __restrict__ carry_val,
+                              rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        csrmvn_merge_path_device<BLOCKSIZE, ITEMS_PER_THREAD>(conj,
+                                                              m,
+                                                              nnz,
+                                                              row_limits,
+                                                              alpha,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              csr_val,
+                                                              x,
+                                                              beta,
+                                                              y,
+                                                              carry_row,
+                                                              carry_val,
+                                                              idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename J, typename Y, typename T, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_merge_path_fixup_kernel(J m,
+                                    I nblocks,
+                                    U alpha_device_host,
+                                    const J* __restrict__ carry_row,
+                                    const T* __restrict__ carry_val,
+                                    Y* __restrict__ y)
+{
+    // Carries are only written for non-zero alpha
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        csrmvn_merge_path_fixup_device<BLOCKSIZE>(m, nblocks, carry_row, carry_val, y);
+    }
+}
+
+// The merge path only covers the non-transposed product of general and triangular matrices,
+// everything else runs the general csrmv kernels
+static bool rocsparse_csrmv_merge_supported(rocsparse_operation       trans,
+                                            const rocsparse_mat_descr descr)
+{
+    return trans == rocsparse_operation_none
+           && (descr->type == rocsparse_matrix_type_general
+               || descr->type == rocsparse_matrix_type_triangular);
+}
+
+template <typename I, typename J>
+static I rocsparse_csrmv_merge_nblocks(J m, I nnz)
+{
+    return static_cast<I>((static_cast<int64_t>(m) + nnz - 1)
+                              / (CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD)
+                          + 1);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csrmv_merge_buffer_size_template(rocsparse_handle          handle,
+                                                            rocsparse_operation       trans,
+                                                            J                         m,
+                                                            J                         n,
+                                                            I                         nnz,
+                                                            const rocsparse_mat_descr descr,
+                                                            size_t*                   buffer_size)
+{
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m <= 0 || nnz <= 0 || !rocsparse_csrmv_merge_supported(trans, descr))
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    I nblocks = rocsparse_csrmv_merge_nblocks(m, nnz);
+
+    // Start rows of the blocks, carry rows and carry values
+    *buffer_size = ((sizeof(J) * (nblocks + 1) - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(J) * nblocks - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(T) * nblocks - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_csrmv_merge_dispatch(rocsparse_handle          handle,
+                                                       J                         m,
+                                                       I                         nnz,
+                                                       U                         alpha_device_host,
+                                                       const rocsparse_mat_descr descr,
+                                                       const A*                  csr_val,
+                                                       const I*                  csr_row_ptr,
+                                                       const J*                  csr_col_ind,
+                                                       const X*                  x,
+                                                       U                         beta_device_host,
+                                                       Y*                        y,
+                                                       void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Only the non-transposed product walks the merge path
+    const bool conj = false;
+
+    I nblocks = rocsparse_csrmv_merge_nblocks(m, nnz);
+
+    char* ptr        = reinterpret_cast<char*>(temp_buffer);
+    J*    row_limits = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * (nblocks + 1) - 1) / 256 + 1) * 256;
+    J* carry_row = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * nblocks - 1) / 256 + 1) * 256;
+    T* carry_val = reinterpret_cast<T*>(ptr);
+
+    // Partition the merge path, one search per block boundary
+    hipLaunchKernelGGL(
+        (csrmvn_merge_path_partition_kernel<CSRMV_MERGE_DIM,
+                                            CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD>),
+        dim3(nblocks / CSRMV_MERGE_DIM + 1),
+        dim3(CSRMV_MERGE_DIM),
+        0,
+        stream,
+        m,
+        nnz,
+        nblocks,
+        csr_row_ptr,
+        row_limits,
+        descr->base);
+
+    hipLaunchKernelGGL((csrmvn_merge_path_kernel<CSRMV_MERGE_DIM, CSRMV_MERGE_ITEMS_PER_THREAD>),
+                       dim3(nblocks),
+                       dim3(CSRMV_MERGE_DIM),
+                       0,
+                       stream,
+                       conj,
+                       m,
+                       nnz,
+                       row_limits,
+                       alpha_device_host,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       x,
+                       beta_device_host,
+                       y,
+                       carry_row,
+                       carry_val,
+                       descr->base);
+
+    // Add the carries of rows spanning multiple blocks
+    hipLaunchKernelGGL((csrmvn_merge_path_fixup_kernel<CSRMV_MERGE_DIM>),
+                       dim3((nblocks - 1) / CSRMV_MERGE_DIM + 1),
+                       dim3(CSRMV_MERGE_DIM),
+                       0,
+                       stream,
+                       m,
+                       nblocks,
+                       alpha_device_host,
+                       carry_row,
+                       carry_val,
+                       y);
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                const X*                  x,
+                                                const T*                  beta_device_host,
+                                                Y*                        y,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Everything the merge path does not cover, including the quick returns, is handled by
+    // csrmv
+    if(m <= 0 || n <= 0 || nnz <= 0 || !rocsparse_csrmv_merge_supported(trans, descr))
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        (csr_row_ptr != nullptr) ? csr_row_ptr + 1 : nullptr,
+                                        csr_col_ind,
+                                        nullptr,
+                                        x,
+                                        beta_device_host,
+                                        y,
+                                        false);
+    }
+
+    if(descr->type == rocsparse_matrix_type_triangular && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr || x == nullptr
+       || y == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz,
+                sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz) + sizeof(X) * n
+                    + sizeof(Y) * 2.0 * m);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_merge_dispatch<T>(handle,
+                                                 m,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 beta_device_host,
+                                                 y,
+                                                 temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrmv_merge_dispatch<T>(handle,
+                                                 m,
+                                                 nnz,
+                                                 *alpha_device_host,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 *beta_device_host,
+                                                 y,
+                                                 temp_buffer);
+    }
+}
+
+#define INSTANTIATE_BUFFER_SIZE(TTYPE, ITYPE, JTYPE)                      \
+    template rocsparse_status rocsparse_csrmv_merge_buffer_size_template< \
+        TTYPE>(rocsparse_handle          handle,                          \
+               rocsparse_operation       trans,                           \
+               JTYPE                     m,                               \
+               JTYPE                     n,                               \
+               ITYPE                     nnz,                             \
+               const rocsparse_mat_descr descr,                           \
+               size_t*                   buffer_size)
+
+INSTANTIATE_BUFFER_SIZE(int32_t, int32_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(int32_t, int64_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(int32_t, int64_t, int64_t);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t);
+INSTANTIATE_BUFFER_SIZE(double, int32_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(double, int64_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(double, int64_t, int64_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_float_complex, int64_t, int64_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE_BUFFER_SIZE(rocsparse_double_complex, int64_t, int64_t);
+#undef INSTANTIATE_BUFFER_SIZE
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)                                   \
+    template rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,  \
+                                                             rocsparse_operation       trans,   \
+                                                             JTYPE                     m,       \
+                                                             JTYPE                     n,       \
+                                                             ITYPE                     nnz,     \
+                                                             const TTYPE*              alpha,   \
+                                                             const rocsparse_mat_descr descr,   \
+                                                             const ATYPE*              csr_val, \
+                                                             const ITYPE* csr_row_ptr,          \
+                                                             const JTYPE* csr_col_ind,          \
+                                                             const XTYPE* x,                    \
+                                                             const TTYPE* beta,                 \
+                                                             YTYPE*       y,                    \
+                                                             void*        temp_buffer)
+
+// Uniform precisions
+INSTANTIATE(float, int32_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+// Mixed precisions
+INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            float,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(double, int32_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int32_t, float, double, double);
+INSTANTIATE(double, int64_t, int64_t, float, double, double);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            double,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
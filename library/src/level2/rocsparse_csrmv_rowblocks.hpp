@@ -0,0 +1,669 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2018-2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+// Host side CSR-Adaptive row block analysis. This header does not depend on
+// HIP, such that the clients can test and benchmark the partitioning directly.
+
+#include "rocsparse-types.h"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+__attribute__((unused)) static inline unsigned int flp2(unsigned int x)
+{
+    x |= (x >> 1);
+    x |= (x >> 2);
+    x |= (x >> 4);
+    x |= (x >> 8);
+    x |= (x >> 16);
+    return x - (x >> 1);
+}
+
+// Short rows in CSR-Adaptive are batched together into a single row block.
+// If there are a relatively small number of these, then we choose to do
+// a horizontal reduction (groups of threads all reduce the same row).
+// If there are many threads (e.g. more threads than the maximum size
+// of our workgroup) then we choose to have each thread serially reduce
+// the row.
+// This function calculates the number of threads that could team up
+// to reduce these groups of rows. For instance, if you have a
+// workgroup size of 256 and 4 rows, you could have 64 threads
+// working on each row. If you have 5 rows, only 32 threads could
+// reliably work on each row because our reduction assumes power-of-2.
+template <rocsparse_int WG_SIZE>
+static inline unsigned long long numThreadsForReduction(unsigned long long num_rows)
+{
+#if defined(__INTEL_COMPILER)
+    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
+#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
+    || !defined(__clang) && defined(__GNUG__)             \
+           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
+    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+    unsigned long long bit_returned;
+    _BitScanReverse(&bit_returned, (num_rows - 1));
+    return WG_SIZE >> (bit_returned + 1);
+#else
+    return flp2(WG_SIZE / num_rows);
+#endif
+}
+
+template <typename I>
+static inline I maxRowsInABlock(const I* rowBlocks, size_t rowBlockSize)
+{
+    I max = 0;
+    for(size_t i = 1; i < rowBlockSize; i++)
+    {
+        I current_row = rowBlocks[i];
+        I prev_row    = rowBlocks[i - 1];
+
+        if(max < current_row - prev_row)
+            max = current_row - prev_row;
+    }
+    return max;
+}
+
+// Rows of more than longRow entries are never batched with shorter rows. A series
+// of long rows ends at the first row of less than shortRow entries.
+template <rocsparse_int BLOCK_SIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_SIZE,
+          typename I,
+          typename J>
+static inline void ComputeRowBlocks(I*       rowBlocks,
+                                    J*       wgIds,
+                                    size_t&  rowBlockSize,
+                                    const I* rowDelimiters,
+                                    I        nRows,
+                                    int64_t  longRow,
+                                    int64_t  shortRow,
+                                    bool     allocate_row_blocks = true)
+{
+    I* rowBlocksBase;
+
+    // Start at one because of rowBlock[0]
+    I total_row_blocks = 1;
+
+    if(allocate_row_blocks)
+    {
+        rowBlocksBase = rowBlocks;
+        *rowBlocks    = 0;
+        *wgIds        = 0;
+        ++rowBlocks;
+        ++wgIds;
+    }
+
+    I sum = 0;
+    I i;
+    I last_i = 0;
+
+    I consecutive_long_rows = 0;
+    for(i = 1; i <= nRows; ++i)
+    {
+        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+        sum += row_length;
+
+        // The following section of code calculates whether you're moving between
+        // a series of "short" rows and a series of "long" rows.
+        // This is because the reduction in CSR-Adaptive likes things to be
+        // roughly the same length. Long rows can be reduced horizontally.
+        // Short rows can be reduced one-thread-per-row. Try not to mix them.
+        if(row_length > longRow)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            // If it turns out we WERE in a long-row region, cut if off now.
+            if(row_length < shortRow) // Now we're in a short-row region
+            {
+                consecutive_long_rows = -1;
+            }
+            else
+            {
+                consecutive_long_rows++;
+            }
+        }
+
+        // If you just entered into a "long" row from a series of short rows,
+        // then we need to make sure we cut off those short rows. Put them in
+        // their own workgroup.
+        if(consecutive_long_rows == 1)
+        {
+            // Assuming there *was* a previous workgroup. If not, nothing to do here.
+            if(i - last_i > 1)
+            {
+                if(allocate_row_blocks)
+                {
+                    *rowBlocks = i - 1;
+
+                    // If this row fits into CSR-Stream, calculate how many rows
+                    // can be used to do a parallel reduction.
+                    // Fill in the low-order bits with the numThreadsForRed
+                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                    {
+                        *(wgIds - 1) |= numThreadsForReduction<WG_SIZE>((i - 1) - last_i);
+                    }
+
+                    ++rowBlocks;
+                    ++wgIds;
+                }
+
+                ++total_row_blocks;
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        else if(consecutive_long_rows == -1)
+        {
+            // We see the first short row after some long ones that
+            // didn't previously fill up a row block.
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i - 1;
+                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction<WG_SIZE>((i - 1) - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        // Now, what's up with this row? What did it do?
+
+        // exactly one row results in non-zero elements to be greater than blockSize
+        // This is csr-vector case;
+        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            I numWGReq = static_cast<I>(
+                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+
+            // Check to ensure #workgroups can fit in 32 bits, if not
+            // then the last workgroup will do all the remaining work
+            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
+            static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
+            numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
+
+            if(allocate_row_blocks)
+            {
+                for(I w = 1; w < numWGReq; ++w)
+                {
+                    *rowBlocks = (i - 1);
+                    *wgIds |= static_cast<J>(w);
+
+                    ++rowBlocks;
+                    ++wgIds;
+                }
+
+                *rowBlocks = i;
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            total_row_blocks += numWGReq;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // more than one row results in non-zero elements to be greater than blockSize
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            // This row won't fit, so back off one.
+            --i;
+
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i;
+                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction<WG_SIZE>(i - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if(sum == static_cast<I>(BLOCK_SIZE))
+        {
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i;
+                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction<WG_SIZE>(i - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    // If we didn't fill a row block with the last row, make sure we don't lose it.
+    if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
+    {
+        *rowBlocks = nRows;
+        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            *(wgIds - 1) |= numThreadsForReduction<WG_SIZE>(nRows - last_i);
+        }
+
+        ++rowBlocks;
+    }
+
+    ++total_row_blocks;
+
+    if(allocate_row_blocks)
+    {
+        size_t dist = std::distance(rowBlocksBase, rowBlocks);
+
+        assert((dist) <= rowBlockSize);
+        // Update the size of rowBlocks to reflect the actual amount of memory used
+        rowBlockSize = dist;
+    }
+    else
+    {
+        rowBlockSize = total_row_blocks;
+    }
+}
+
+template <rocsparse_int BLOCK_SIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_SIZE,
+          typename I,
+          typename J>
+static inline void ComputeRowBlocksChunk(std::vector<I>& rowBlocks,
+                                         std::vector<J>& wgIds,
+                                         const I*        rowDelimiters,
+                                         I               first,
+                                         I               last,
+                                         int64_t         longRow,
+                                         int64_t         shortRow)
+{
+    // Same partitioning as ComputeRowBlocks(), restricted to the rows [first, last).
+    // The chunk always starts and ends with a row block boundary.
+    rowBlocks.clear();
+    wgIds.clear();
+
+    rowBlocks.push_back(first);
+    wgIds.push_back(0);
+
+    I sum    = 0;
+    I i      = first + 1;
+    I last_i = first;
+
+    I consecutive_long_rows = 0;
+    for(; i <= last; ++i)
+    {
+        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+        sum += row_length;
+
+        if(row_length > longRow)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            if(row_length < shortRow)
+            {
+                consecutive_long_rows = -1;
+            }
+            else
+            {
+                consecutive_long_rows++;
+            }
+        }
+
+        if(consecutive_long_rows == 1)
+        {
+            if(i - last_i > 1)
+            {
+                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    wgIds.back() |= numThreadsForReduction<WG_SIZE>((i - 1) - last_i);
+                }
+
+                rowBlocks.push_back(i - 1);
+                wgIds.push_back(0);
+
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        else if(consecutive_long_rows == -1)
+        {
+            if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+            {
+                wgIds.back() |= numThreadsForReduction<WG_SIZE>((i - 1) - last_i);
+            }
+
+            rowBlocks.push_back(i - 1);
+            wgIds.push_back(0);
+
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            I numWGReq = static_cast<I>(
+                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+
+            static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
+            numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
+
+            for(I w = 1; w < numWGReq; ++w)
+            {
+                rowBlocks.push_back(i - 1);
+                wgIds.push_back(static_cast<J>(w));
+            }
+
+            rowBlocks.push_back(i);
+            wgIds.push_back(0);
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            --i;
+
+            if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+            {
+                wgIds.back() |= numThreadsForReduction<WG_SIZE>(i - last_i);
+            }
+
+            rowBlocks.push_back(i);
+            wgIds.push_back(0);
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if(sum == static_cast<I>(BLOCK_SIZE))
+        {
+            if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+            {
+                wgIds.back() |= numThreadsForReduction<WG_SIZE>(i - last_i);
+            }
+
+            rowBlocks.push_back(i);
+            wgIds.push_back(0);
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    if(rowBlocks.back() != last)
+    {
+        if((last - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            wgIds.back() |= numThreadsForReduction<WG_SIZE>(last - last_i);
+        }
+
+        rowBlocks.push_back(last);
+        wgIds.push_back(0);
+    }
+}
+
+// Default number of threads used by ComputeRowBlocksParallel()
+template <typename I>
+static inline unsigned int ComputeRowBlocksNumThreads(I nRows)
+{
+    // Each thread should at least process this number of rows
+    static constexpr I min_rows_per_thread = 65536;
+
+    unsigned int num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    I            max_threads = std::max(nRows / min_rows_per_thread, static_cast<I>(1));
+
+    return (static_cast<I>(num_threads) < max_threads) ? num_threads
+                                                         : static_cast<unsigned int>(max_threads);
+}
+
+// Multithreaded version of ComputeRowBlocks(). The rows are split into one
+// chunk per thread, each thread partitions its chunk in a single pass into
+// its own buffer. The chunks are stitched together at their boundaries,
+// which always start a new row block. Thus, the partitioning is identical to
+// ComputeRowBlocks() when running on a single thread, and has at most
+// numThreads - 1 additional cuts otherwise.
+template <rocsparse_int BLOCK_SIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_SIZE,
+          typename I,
+          typename J>
+static inline void ComputeRowBlocksParallel(std::vector<I>& rowBlocks,
+                                            std::vector<J>& wgIds,
+                                            const I*        rowDelimiters,
+                                            I               nRows,
+                                            int64_t         longRow,
+                                            int64_t         shortRow,
+                                            unsigned int    numThreads = 0)
+{
+    if(nRows <= 0)
+    {
+        rowBlocks.assign(1, 0);
+        wgIds.assign(1, 0);
+        return;
+    }
+
+    if(numThreads == 0)
+    {
+        numThreads = ComputeRowBlocksNumThreads(nRows);
+    }
+
+    if(static_cast<I>(numThreads) > nRows)
+    {
+        numThreads = static_cast<unsigned int>(nRows);
+    }
+
+    std::vector<std::vector<I>> chunkRowBlocks(numThreads);
+    std::vector<std::vector<J>> chunkWgIds(numThreads);
+
+    auto chunk = [&](unsigned int t) {
+        I first = static_cast<I>((static_cast<double>(nRows) * t) / numThreads);
+        I last  = static_cast<I>((static_cast<double>(nRows) * (t + 1)) / numThreads);
+
+        if(t + 1 == numThreads)
+        {
+            last = nRows;
+        }
+
+        ComputeRowBlocksChunk<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            chunkRowBlocks[t], chunkWgIds[t], rowDelimiters, first, last, longRow, shortRow);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+
+    for(unsigned int t = 1; t < numThreads; ++t)
+    {
+        threads.emplace_back(chunk, t);
+    }
+
+    chunk(0);
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Stitch the chunks together. The terminating entry of each chunk
+    // equals the first entry of its successor, which holds the valid
+    // reduction information.
+    size_t size = 1;
+    for(unsigned int t = 0; t < numThreads; ++t)
+    {
+        size += chunkRowBlocks[t].size() - 1;
+    }
+
+    rowBlocks.resize(size);
+    wgIds.resize(size);
+
+    size_t offset = 0;
+    for(unsigned int t = 0; t < numThreads; ++t)
+    {
+        size_t chunk_size = chunkRowBlocks[t].size() - ((t + 1 == numThreads) ? 0 : 1);
+
+        std::copy(chunkRowBlocks[t].begin(),
+                  chunkRowBlocks[t].begin() + chunk_size,
+                  rowBlocks.begin() + offset);
+        std::copy(
+            chunkWgIds[t].begin(), chunkWgIds[t].begin() + chunk_size, wgIds.begin() + offset);
+
+        offset += chunk_size;
+    }
+
+    assert(offset == size);
+}
+
+// Checks that a row block partitioning is consumable by csrmvn_adaptive_kernel:
+// all rows are covered in order, CSR-Stream blocks fit into local memory and
+// use a valid number of reduction threads, and long rows are split into the
+// expected number of workgroups.
+template <rocsparse_int BLOCK_SIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_SIZE,
+          typename I,
+          typename J>
+static inline bool ValidateRowBlocks(const I* rowBlocks,
+                                     const J* wgIds,
+                                     size_t   rowBlockSize,
+                                     const I* rowDelimiters,
+                                     I        nRows)
+{
+    if(rowBlockSize < 2 || rowBlocks[0] != 0 || rowBlocks[rowBlockSize - 1] != nRows)
+    {
+        return false;
+    }
+
+    size_t i = 0;
+    while(i < rowBlockSize - 1)
+    {
+        I row      = rowBlocks[i];
+        I stop_row = rowBlocks[i + 1];
+
+        if(stop_row < row)
+        {
+            return false;
+        }
+
+        I num_rows = stop_row - row;
+        J wg       = wgIds[i];
+
+        if(num_rows > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            // CSR-Stream
+            if(rowDelimiters[stop_row] - rowDelimiters[row] > static_cast<I>(BLOCK_SIZE))
+            {
+                return false;
+            }
+
+            if(wg != 0 && ((wg & (wg - 1)) != 0 || static_cast<I>(wg) * num_rows > WG_SIZE))
+            {
+                return false;
+            }
+
+            ++i;
+        }
+        else if(num_rows == 1 && wg == 0)
+        {
+            // CSR-Vector
+            if(rowDelimiters[stop_row] - rowDelimiters[row]
+               > static_cast<I>(BLOCK_MULTIPLIER * BLOCK_SIZE))
+            {
+                return false;
+            }
+
+            ++i;
+        }
+        else
+        {
+            // CSR-LongRows, all workgroups of this row must be consecutive
+            if(wg != 0)
+            {
+                return false;
+            }
+
+            I numWGs = 1;
+            while(rowBlocks[i + numWGs] == row)
+            {
+                if(i + numWGs >= rowBlockSize - 1 || wgIds[i + numWGs] != static_cast<J>(numWGs))
+                {
+                    return false;
+                }
+
+                ++numWGs;
+            }
+
+            I row_length = rowDelimiters[row + 1] - rowDelimiters[row];
+            I numWGReq   = static_cast<I>(
+                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+            numWGReq = std::min(numWGReq, static_cast<I>(INT_MAX));
+
+            if(numWGs != numWGReq || rowBlocks[i + numWGs] != row + 1)
+            {
+                return false;
+            }
+
+            i += numWGs;
+        }
+    }
+
+    return true;
+}
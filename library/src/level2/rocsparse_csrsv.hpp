@@ -38,6 +38,7 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
                                                       rocsparse_mat_info        info,
                                                       size_t*                   buffer_size);
 
+// The level pointers of the level set solve are only gathered if level_set is true
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         rocsparse_operation       trans,
@@ -49,7 +50,8 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const J*                  csr_col_ind,
                                         rocsparse_trm_info        info,
                                         J**                       zero_pivot,
-                                        void*                     temp_buffer);
+                                        void*                     temp_buffer,
+                                        bool                      level_set = false);
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
@@ -63,7 +65,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                    rocsparse_mat_info        info,
                                                    rocsparse_analysis_policy analysis,
                                                    rocsparse_solve_policy    solve,
-                                                   void*                     temp_buffer);
+                                                   void*                     temp_buffer,
+                                                   bool                      level_set = false);
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle,
@@ -79,4 +82,5 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                                 const T*                  x,
                                                 T*                        y,
                                                 rocsparse_solve_policy    policy,
+                                                rocsparse_spsv_alg        alg,
                                                 void*                     temp_buffer);
@@ -27,6 +27,7 @@
 #include "../conversion/rocsparse_csr2coo.hpp"
 #include "../conversion/rocsparse_identity.hpp"
 #include "../level1/rocsparse_gthr.hpp"
+#include "../util/rocsparse_analysis_cache.hpp"
 #include "csrsv_device.h"
 #include "definitions.h"
 #include "utility.h"
@@ -43,11 +44,52 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const J*                  csr_col_ind,
                                         rocsparse_trm_info        info,
                                         J**                       zero_pivot,
-                                        void*                     temp_buffer)
+                                        void*                     temp_buffer,
+                                        bool                      level_set)
 {
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Reuse the analysis of a matrix with the same sparsity pattern, if cached
+    const bool use_cache = rocsparse_analysis_cache_enabled(handle->analysis_cache);
+
+    rocsparse_analysis_cache_key key;
+
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_analysis_cache_key_template(handle,
+                                                  rocsparse_analysis_cache_kind_trm,
+                                                  m,
+                                                  m,
+                                                  nnz,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  descr->base,
+                                                  &key));
+
+        // Transposed and conjugate transposed analyses are identical
+        key.options[0] = (trans == rocsparse_operation_none) ? 0 : 1;
+        key.options[1] = descr->fill_mode;
+        key.options[2] = descr->diag_type;
+        key.options[3] = level_set ? 1 : 0;
+
+        bool found;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_find_trm(
+            handle->analysis_cache, key, info, (void**)zero_pivot, stream, &found));
+
+        if(found)
+        {
+            info->descr = descr;
+            info->trm_row_ptr
+                = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
+            info->trm_col_ind
+                = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
+
+            return rocsparse_status_success;
+        }
+    }
+
     // If analyzing transposed, allocate some info memory to hold the transposed matrix
     if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
     {
@@ -450,12 +492,6 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
 #undef CSRSV_DIM
 
     // Post processing
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&info->max_nnz, d_max_nnz, sizeof(I), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation_template(handle, m, workspace));
 
     size_t rocprim_size;
@@ -478,6 +514,55 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             info->row_map, vals.current(), sizeof(J) * m, hipMemcpyDeviceToDevice, stream));
     }
 
+    // The deepest row determines the number of levels
+    int nlevels;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nlevels, keys.current() + m - 1, sizeof(int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&info->max_nnz, d_max_nnz, sizeof(I), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    info->nlevels        = nlevels;
+    info->max_level_size = 0;
+
+    // Only the level set solve needs the level pointers, they are gathered on request
+    if(level_set)
+    {
+        // The rows of each level are contiguous in the row map, mark where the levels start
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync((void**)&info->level_ptr, sizeof(J) * (nlevels + 1), stream));
+
+        hipLaunchKernelGGL((csrsv_analysis_level_ptr_kernel<256>),
+                           dim3((m - 1) / 256 + 1),
+                           dim3(256),
+                           0,
+                           stream,
+                           m,
+                           keys.current(),
+                           (J*)info->level_ptr);
+
+        // The level set solve is scheduled on the host
+        std::vector<J> host_level_ptr(nlevels + 1);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(host_level_ptr.data(),
+                                           info->level_ptr,
+                                           sizeof(J) * (nlevels + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        info->host_level_ptr.assign(host_level_ptr.begin(), host_level_ptr.end());
+
+        for(int l = 0; l < nlevels; ++l)
+        {
+            int64_t level_size = host_level_ptr[l + 1] - host_level_ptr[l];
+
+            info->max_level_size = std::max(info->max_level_size, level_size);
+        }
+    }
+
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
@@ -494,6 +579,13 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                              : ((sizeof(J) == sizeof(int32_t)) ? rocsparse_indextype_i32
                                                                : rocsparse_indextype_i64);
 
+    // Keep a copy for the next matrices with this sparsity pattern
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_insert_trm(
+            handle->analysis_cache, key, info, *zero_pivot, stream));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -509,7 +601,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                    rocsparse_mat_info        info,
                                                    rocsparse_analysis_policy analysis,
                                                    rocsparse_solve_policy    solve,
-                                                   void*                     temp_buffer)
+                                                   void*                     temp_buffer,
+                                                   bool                      level_set)
 {
     // Check for valid handle and matrix descriptor
     if(handle == nullptr)
@@ -540,6 +633,10 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
               analysis,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrsv_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -670,7 +767,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             csr_col_ind,
             (trans == rocsparse_operation_none) ? info->csrsv_upper_info : info->csrsvt_upper_info,
             (J**)&info->zero_pivot,
-            temp_buffer));
+            temp_buffer,
+            level_set));
     }
     else
     {
@@ -756,7 +854,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             csr_col_ind,
             (trans == rocsparse_operation_none) ? info->csrsv_lower_info : info->csrsvt_lower_info,
             (J**)&info->zero_pivot,
-            temp_buffer));
+            temp_buffer,
+            level_set));
     }
 
     return rocsparse_status_success;
@@ -773,7 +872,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                      const JTYPE*              csr_col_ind, \
                                                      rocsparse_trm_info        info,        \
                                                      JTYPE**                   zero_pivot,  \
-                                                     void*                     temp_buffer);
+                                                     void*                     temp_buffer, \
+                                                     bool                      level_set);
 
 INSTANTIATE(int32_t, int32_t, float);
 INSTANTIATE(int32_t, int32_t, double);
@@ -802,7 +902,8 @@ INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
         rocsparse_mat_info        info,                          \
         rocsparse_analysis_policy analysis,                      \
         rocsparse_solve_policy    solve,                         \
-        void*                     temp_buffer);
+        void*                     temp_buffer,                   \
+        bool                      level_set);
 
 INSTANTIATE(int32_t, int32_t, float);
 INSTANTIATE(int32_t, int32_t, double);
@@ -70,6 +70,171 @@ void csrsv_kernel(J m,
                                             diag_type);
 }
 
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsv_level_kernel(J level_begin,
+                        J level_end,
+                        U alpha_device_host,
+                        const I* __restrict__ csr_row_ptr,
+                        const J* __restrict__ csr_col_ind,
+                        const T* __restrict__ csr_val,
+                        const T* __restrict__ x,
+                        T* __restrict__ y,
+                        const J* __restrict__ map,
+                        J* __restrict__ zero_pivot,
+                        rocsparse_index_base idx_base,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_level_device<BLOCKSIZE, WF_SIZE>(level_begin,
+                                           level_end,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           x,
+                                           y,
+                                           map,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsv_level_fused_kernel(int64_t level_first,
+                              int64_t level_last,
+                              const J* __restrict__ level_ptr,
+                              U alpha_device_host,
+                              const I* __restrict__ csr_row_ptr,
+                              const J* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              const T* __restrict__ x,
+                              T* __restrict__ y,
+                              const J* __restrict__ map,
+                              J* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_level_fused_device<BLOCKSIZE, WF_SIZE>(level_first,
+                                                 level_last,
+                                                 level_ptr,
+                                                 alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 x,
+                                                 y,
+                                                 map,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
+}
+
+template <unsigned int WF_SIZE, typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_csrsv_solve_level_set(rocsparse_handle     handle,
+                                                 U                    alpha_device_host,
+                                                 const I*             csr_row_ptr,
+                                                 const J*             csr_col_ind,
+                                                 const T*             csr_val,
+                                                 rocsparse_trm_info   csrsv,
+                                                 const T*             x,
+                                                 T*                   y,
+                                                 J*                   zero_pivot,
+                                                 rocsparse_index_base idx_base,
+                                                 rocsparse_fill_mode  fill_mode,
+                                                 rocsparse_diag_type  diag_type)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRSV_LEVEL_DIM 256
+    // Levels with at most this many rows are solved by a single block
+    static constexpr int64_t max_fused_level_size = CSRSV_LEVEL_DIM / WF_SIZE;
+
+    const std::vector<int64_t>& level_ptr = csrsv->host_level_ptr;
+
+    int64_t level = 0;
+    while(level < csrsv->nlevels)
+    {
+        int64_t level_size = level_ptr[level + 1] - level_ptr[level];
+
+        if(level_size <= max_fused_level_size)
+        {
+            // Gather all consecutive small levels into a single launch
+            int64_t level_last = level + 1;
+            while(level_last < csrsv->nlevels
+                  && level_ptr[level_last + 1] - level_ptr[level_last] <= max_fused_level_size)
+            {
+                ++level_last;
+            }
+
+            hipLaunchKernelGGL((csrsv_level_fused_kernel<CSRSV_LEVEL_DIM, WF_SIZE>),
+                               dim3(1),
+                               dim3(CSRSV_LEVEL_DIM),
+                               0,
+                               stream,
+                               level,
+                               level_last,
+                               (const J*)csrsv->level_ptr,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               (const J*)csrsv->row_map,
+                               zero_pivot,
+                               idx_base,
+                               fill_mode,
+                               diag_type);
+
+            level = level_last;
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrsv_level_kernel<CSRSV_LEVEL_DIM, WF_SIZE>),
+                               dim3((level_size - 1) / max_fused_level_size + 1),
+                               dim3(CSRSV_LEVEL_DIM),
+                               0,
+                               stream,
+                               static_cast<J>(level_ptr[level]),
+                               static_cast<J>(level_ptr[level + 1]),
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               (const J*)csrsv->row_map,
+                               zero_pivot,
+                               idx_base,
+                               fill_mode,
+                               diag_type);
+
+            ++level;
+        }
+    }
+#undef CSRSV_LEVEL_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
@@ -84,6 +249,7 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                 const T*                  x,
                                                 T*                        y,
                                                 rocsparse_solve_policy    policy,
+                                                rocsparse_spsv_alg        alg,
                                                 void*                     temp_buffer)
 {
     // Stream
@@ -98,9 +264,6 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     int* done_array = reinterpret_cast<int*>(ptr);
     ptr += ((sizeof(int) * m - 1) / 256 + 1) * 256;
 
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
-
     rocsparse_trm_info csrsv
         = (descr->fill_mode == rocsparse_fill_mode_upper)
               ? ((trans == rocsparse_operation_none) ? info->csrsv_upper_info
@@ -113,6 +276,22 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // The level set solve requires the level data, which is only gathered by the
+    // preprocess stage of the level set algorithm
+    bool level_set = (alg == rocsparse_spsv_alg_level_set);
+
+    if(level_set && csrsv->level_ptr == nullptr)
+    {
+        log_debug(handle, "The analysis has not gathered the levels of the level set SpSV.");
+        return rocsparse_status_invalid_value;
+    }
+
+    // Initialize buffers
+    if(!level_set)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+    }
+
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
@@ -157,6 +336,43 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                              : rocsparse_fill_mode_lower;
     }
 
+    if(level_set)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            return rocsparse_csrsv_solve_level_set<32>(handle,
+                                                       alpha_device_host,
+                                                       local_csr_row_ptr,
+                                                       local_csr_col_ind,
+                                                       local_csr_val,
+                                                       csrsv,
+                                                       x,
+                                                       y,
+                                                       (J*)info->zero_pivot,
+                                                       descr->base,
+                                                       fill_mode,
+                                                       descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            return rocsparse_csrsv_solve_level_set<64>(handle,
+                                                       alpha_device_host,
+                                                       local_csr_row_ptr,
+                                                       local_csr_col_ind,
+                                                       local_csr_val,
+                                                       csrsv,
+                                                       x,
+                                                       y,
+                                                       (J*)info->zero_pivot,
+                                                       descr->base,
+                                                       fill_mode,
+                                                       descr->diag_type);
+        }
+    }
+
     // Determine gcnArch
     int gcnArch = handle->properties.gcnArch;
     int asicRev = handle->asic_rev;
@@ -260,6 +476,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                                 const T*                  x,
                                                 T*                        y,
                                                 rocsparse_solve_policy    policy,
+                                                rocsparse_spsv_alg        alg,
                                                 void*                     temp_buffer)
 {
     // Check for valid handle and matrix descriptor
@@ -300,6 +517,10 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
               "--alpha",
               LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrsv_solve"), rocsparse_get_datatype<T>(), m, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -353,6 +574,11 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * nnz,
+                sizeof(I) * (m + 1.0) + sizeof(J) * double(nnz) + sizeof(T) * (2.0 * m + nnz));
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         return rocsparse_csrsv_solve_dispatch(handle,
@@ -368,6 +594,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                               x,
                                               y,
                                               policy,
+                                              alg,
                                               temp_buffer);
     }
     else
@@ -385,6 +612,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                               x,
                                               y,
                                               policy,
+                                              alg,
                                               temp_buffer);
     }
 }
@@ -404,6 +632,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         const TTYPE*              x,                                               \
         TTYPE*                    y,                                               \
         rocsparse_solve_policy    policy,                                          \
+        rocsparse_spsv_alg        alg,                                             \
         void*                     temp_buffer);
 
 INSTANTIATE(int32_t, int32_t, float);
@@ -456,6 +685,7 @@ INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
                                               x,                            \
                                               y,                            \
                                               policy,                       \
+                                              rocsparse_spsv_alg_default,   \
                                               temp_buffer);                 \
     }                                                                       \
     catch(...)                                                              \
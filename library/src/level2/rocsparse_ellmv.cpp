@@ -180,6 +180,10 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
               "--beta",
               LOG_BENCH_SCALAR_VALUE(handle, beta_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xellmv"), rocsparse_get_datatype<T>(), m, n, ell_width);
+
     if(rocsparse_enum_utils::is_invalid(trans))
     {
         return rocsparse_status_invalid_value;
@@ -233,6 +237,12 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Estimated work, for the profiling layer
+    log_profile(handle,
+                2.0 * m * ell_width,
+                (sizeof(I) + sizeof(A)) * double(m) * ell_width + sizeof(X) * double(n)
+                    + sizeof(Y) * 2.0 * m);
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         return rocsparse_ellmv_dispatch(handle,
@@ -308,6 +318,10 @@ INSTANTIATE_MIXED(int32_t, int32_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(int32_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(float, int32_t, int8_t, int8_t, float);
 INSTANTIATE_MIXED(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE_MIXED(float, int32_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int64_t, _Float16, float, float);
+INSTANTIATE_MIXED(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE_MIXED(float, int64_t, hip_bfloat16, float, float);
 INSTANTIATE_MIXED(
     rocsparse_float_complex, int32_t, float, rocsparse_float_complex, rocsparse_float_complex);
 INSTANTIATE_MIXED(
@@ -245,6 +245,8 @@ rocsparse_status rocsparse_spitsv_dynamic_dispatch(rocsparse_indextype itype,
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -27,22 +27,51 @@
 #include "utility.h"
 
 #include "rocsparse_bsrmv.hpp"
+#include "rocsparse_bellmv.hpp"
 #include "rocsparse_coomv.hpp"
 #include "rocsparse_coomv_aos.hpp"
+#include "rocsparse_coomv_batched.hpp"
 #include "rocsparse_cscmv.hpp"
 #include "rocsparse_csrmv.hpp"
+#include "rocsparse_csrmv_batched.hpp"
 #include "rocsparse_ellmv.hpp"
 
+#include "spmv_device.h"
+
 static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocsparse_spmv_alg alg)
 {
     switch(format)
     {
     case rocsparse_format_csr:
+    {
+        switch(alg)
+        {
+        case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
+        case rocsparse_spmv_alg_csr_stream:
+        case rocsparse_spmv_alg_csr_adaptive:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
+        {
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_alg_coo:
+        case rocsparse_spmv_alg_ell:
+        case rocsparse_spmv_alg_bsr:
+        case rocsparse_spmv_alg_coo_atomic:
+        {
+            return rocsparse_status_invalid_value;
+        }
+        }
+
+        return rocsparse_status_invalid_value;
+    }
     case rocsparse_format_csc:
     {
         switch(alg)
         {
         case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
         case rocsparse_spmv_alg_csr_stream:
         case rocsparse_spmv_alg_csr_adaptive:
         {
@@ -52,6 +81,8 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         case rocsparse_spmv_alg_ell:
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_coo_atomic:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
         {
             return rocsparse_status_invalid_value;
         }
@@ -65,6 +96,7 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         switch(alg)
         {
         case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
         case rocsparse_spmv_alg_coo:
         case rocsparse_spmv_alg_coo_atomic:
         {
@@ -72,6 +104,8 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         }
         case rocsparse_spmv_alg_csr_stream:
         case rocsparse_spmv_alg_csr_adaptive:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_ell:
         {
@@ -86,12 +120,15 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         switch(alg)
         {
         case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
         case rocsparse_spmv_alg_ell:
         {
             return rocsparse_status_success;
         }
         case rocsparse_spmv_alg_csr_stream:
         case rocsparse_spmv_alg_csr_adaptive:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_coo:
         case rocsparse_spmv_alg_coo_atomic:
@@ -107,10 +144,16 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         switch(alg)
         {
         case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
+        case rocsparse_spmv_alg_ell:
+        {
+            return rocsparse_status_success;
+        }
         case rocsparse_spmv_alg_coo:
         case rocsparse_spmv_alg_csr_stream:
         case rocsparse_spmv_alg_csr_adaptive:
-        case rocsparse_spmv_alg_ell:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_coo_atomic:
         {
@@ -126,6 +169,7 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         switch(alg)
         {
         case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_auto:
         case rocsparse_spmv_alg_bsr:
         {
             return rocsparse_status_success;
@@ -133,6 +177,8 @@ static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocspa
         case rocsparse_spmv_alg_ell:
         case rocsparse_spmv_alg_csr_stream:
         case rocsparse_spmv_alg_csr_adaptive:
+        case rocsparse_spmv_alg_csr_binned:
+        case rocsparse_spmv_alg_csr_merge:
         case rocsparse_spmv_alg_coo:
         case rocsparse_spmv_alg_coo_atomic:
         {
@@ -174,6 +220,9 @@ static rocsparse_status rocsparse_spmv_alg2coomv_alg(rocsparse_spmv_alg   spmv_a
     case rocsparse_spmv_alg_csr_stream:
     case rocsparse_spmv_alg_bsr:
     case rocsparse_spmv_alg_ell:
+    case rocsparse_spmv_alg_auto:
+    case rocsparse_spmv_alg_csr_binned:
+    case rocsparse_spmv_alg_csr_merge:
     {
         return rocsparse_status_invalid_value;
     }
@@ -208,6 +257,9 @@ static rocsparse_status rocsparse_spmv_alg2coomv_aos_alg(rocsparse_spmv_alg
     case rocsparse_spmv_alg_csr_stream:
     case rocsparse_spmv_alg_bsr:
     case rocsparse_spmv_alg_ell:
+    case rocsparse_spmv_alg_auto:
+    case rocsparse_spmv_alg_csr_binned:
+    case rocsparse_spmv_alg_csr_merge:
     {
         return rocsparse_status_invalid_value;
     }
@@ -338,6 +390,558 @@ rocsparse_status rocsparse_spmv_template_auto(rocsparse_handle            handle
     }
 }
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_spmv_batched_template(rocsparse_handle            handle,
+                                                 rocsparse_operation         trans,
+                                                 const void*                 alpha,
+                                                 rocsparse_const_spmat_descr mat,
+                                                 rocsparse_const_dnvec_descr x,
+                                                 const void*                 beta,
+                                                 const rocsparse_dnvec_descr y,
+                                                 rocsparse_spmv_alg          alg,
+                                                 rocsparse_spmv_stage        stage,
+                                                 size_t*                     buffer_size,
+                                                 void*                       temp_buffer)
+{
+    // The batch count is given by y, the matrix and x are either broadcast
+    // over all batches or strided with the same batch count
+    const int64_t batch_count = y->batch_count;
+
+    if((mat->batch_count != 1 && mat->batch_count != batch_count)
+       || (x->batch_count != 1 && x->batch_count != batch_count))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const bool    broadcast_A         = (mat->batch_count == 1);
+    const int64_t x_batch_stride      = (x->batch_count == 1) ? 0 : x->batch_stride;
+    const int64_t values_batch_stride = broadcast_A ? 0 : mat->values_batch_stride;
+
+    switch(mat->format)
+    {
+    case rocsparse_format_coo:
+    {
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_stage_preprocess:
+        {
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_stage_compute:
+        {
+            return rocsparse_coomv_batched_template(handle,
+                                                    trans,
+                                                    (I)mat->rows,
+                                                    (I)mat->cols,
+                                                    mat->nnz,
+                                                    batch_count,
+                                                    (const T*)alpha,
+                                                    mat->descr,
+                                                    (const A*)mat->const_val_data,
+                                                    values_batch_stride,
+                                                    (const I*)mat->const_row_data,
+                                                    (const I*)mat->const_col_data,
+                                                    broadcast_A ? 0 : mat->batch_stride,
+                                                    (const X*)x->const_values,
+                                                    x_batch_stride,
+                                                    (const T*)beta,
+                                                    (Y*)y->values,
+                                                    y->batch_stride);
+        }
+        case rocsparse_spmv_stage_auto:
+        {
+            return rocsparse_spmv_template_auto<T, I, J, A, X, Y>(
+                handle, trans, alpha, mat, x, beta, y, alg, buffer_size, temp_buffer);
+        }
+        }
+    }
+
+    case rocsparse_format_csr:
+    {
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_stage_preprocess:
+        {
+            // The batched kernels do not use the csrmv analysis meta data
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_stage_compute:
+        {
+            return rocsparse_csrmv_batched_template(
+                handle,
+                trans,
+                (J)mat->rows,
+                (J)mat->cols,
+                (I)mat->nnz,
+                batch_count,
+                (const T*)alpha,
+                mat->descr,
+                (const A*)mat->const_val_data,
+                values_batch_stride,
+                (const I*)mat->const_row_data,
+                broadcast_A ? 0 : mat->offsets_batch_stride,
+                (const J*)mat->const_col_data,
+                broadcast_A ? 0 : mat->columns_values_batch_stride,
+                (const X*)x->const_values,
+                x_batch_stride,
+                (const T*)beta,
+                (Y*)y->values,
+                y->batch_stride);
+        }
+        case rocsparse_spmv_stage_auto:
+        {
+            return rocsparse_spmv_template_auto<T, I, J, A, X, Y>(
+                handle, trans, alpha, mat, x, beta, y, alg, buffer_size, temp_buffer);
+        }
+        }
+    }
+
+    case rocsparse_format_coo_aos:
+    case rocsparse_format_csc:
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    case rocsparse_format_bsr:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+// Candidate algorithms of the automatic SpMV algorithm selection
+static int rocsparse_spmv_alg_auto_candidates(rocsparse_format    format,
+                                              rocsparse_spmv_alg* candidates)
+{
+    switch(format)
+    {
+    case rocsparse_format_csr:
+    case rocsparse_format_csc:
+    {
+        candidates[0] = rocsparse_spmv_alg_csr_adaptive;
+        candidates[1] = rocsparse_spmv_alg_csr_stream;
+        return 2;
+    }
+    case rocsparse_format_coo:
+    case rocsparse_format_coo_aos:
+    {
+        candidates[0] = rocsparse_spmv_alg_coo;
+        candidates[1] = rocsparse_spmv_alg_coo_atomic;
+        return 2;
+    }
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    {
+        candidates[0] = rocsparse_spmv_alg_ell;
+        return 1;
+    }
+    case rocsparse_format_bsr:
+    {
+        candidates[0] = rocsparse_spmv_alg_bsr;
+        return 1;
+    }
+    }
+
+    return 0;
+}
+
+// Size of the y scratch vector used to time the candidate algorithms
+template <typename Y>
+static size_t rocsparse_spmv_alg_auto_scratch_size(rocsparse_const_spmat_descr mat,
+                                                   rocsparse_const_dnvec_descr y)
+{
+    rocsparse_spmv_alg candidates[2];
+
+    if(rocsparse_spmv_alg_auto_candidates(mat->format, candidates) < 2
+       || !ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::SPMV_AUTOTUNE))
+    {
+        return 0;
+    }
+
+    return ((sizeof(Y) * y->size - 1) / 256 + 1) * 256;
+}
+
+// Largest temporary storage buffer of all candidate algorithms, the y scratch
+// vector is placed behind it
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_spmv_alg_auto_candidates_size(rocsparse_handle            handle,
+                                                         rocsparse_operation         trans,
+                                                         const void*                 alpha,
+                                                         rocsparse_const_spmat_descr mat,
+                                                         rocsparse_const_dnvec_descr x,
+                                                         const void*                 beta,
+                                                         const rocsparse_dnvec_descr y,
+                                                         size_t*                     size)
+{
+    rocsparse_spmv_alg candidates[2];
+    const int          ncandidates = rocsparse_spmv_alg_auto_candidates(mat->format, candidates);
+
+    *size = 0;
+    for(int c = 0; c < ncandidates; ++c)
+    {
+        size_t candidate_size = 0;
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse_spmv_template<T, I, J, A, X, Y>(handle,
+                                                       trans,
+                                                       alpha,
+                                                       mat,
+                                                       x,
+                                                       beta,
+                                                       y,
+                                                       candidates[c],
+                                                       rocsparse_spmv_stage_buffer_size,
+                                                       &candidate_size,
+                                                       nullptr)));
+
+        if(candidate_size > 0)
+        {
+            *size = std::max(*size, ((candidate_size - 1) / 256 + 1) * 256);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+// Select the SpMV algorithm from the row length statistics of the matrix. If
+// ROCSPARSE_SPMV_AUTOTUNE is set, the candidate algorithms are timed on the
+// device instead, using a scratch copy of y that is placed behind the
+// candidates' temporary storage.
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_spmv_alg_auto_select(rocsparse_handle            handle,
+                                                rocsparse_operation         trans,
+                                                const void*                 alpha,
+                                                rocsparse_const_spmat_descr mat,
+                                                rocsparse_const_dnvec_descr x,
+                                                const void*                 beta,
+                                                const rocsparse_dnvec_descr y,
+                                                size_t*                     buffer_size,
+                                                void*                       temp_buffer)
+{
+    rocsparse_spmv_alg candidates[2];
+    const int          ncandidates = rocsparse_spmv_alg_auto_candidates(mat->format, candidates);
+
+    if(ncandidates == 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_spmv_alg alg = candidates[0];
+
+    // Row length statistics
+    int64_t m       = 0;
+    int64_t max_nnz = 0;
+    int64_t sum_sq  = 0;
+
+    switch(mat->format)
+    {
+    case rocsparse_format_csr:
+    case rocsparse_format_csc:
+    {
+        // The adaptive row blocks are only used when the compressed dimension
+        // is processed without transposition
+        const bool gather
+            = (mat->format == rocsparse_format_csr) == (trans == rocsparse_operation_none);
+
+        if(gather == false)
+        {
+            alg = rocsparse_spmv_alg_csr_stream;
+            break;
+        }
+
+        m            = (mat->format == rocsparse_format_csr) ? mat->rows : mat->cols;
+        const I* ptr = (const I*)((mat->format == rocsparse_format_csr) ? mat->const_row_data
+                                                                        : mat->const_col_data);
+
+        if(m == 0 || mat->nnz == 0)
+        {
+            alg = rocsparse_spmv_alg_csr_stream;
+            break;
+        }
+
+#define SPMV_STATS_DIM 256
+        const int nblocks = std::min((m - 1) / SPMV_STATS_DIM + 1, static_cast<int64_t>(256));
+
+        int64_t* workspace = nullptr;
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+            (void**)&workspace, sizeof(int64_t) * 2 * nblocks, handle->stream));
+
+        hipLaunchKernelGGL((spmv_row_length_stats_part1<SPMV_STATS_DIM>),
+                           dim3(nblocks),
+                           dim3(SPMV_STATS_DIM),
+                           0,
+                           handle->stream,
+                           (J)m,
+                           ptr,
+                           workspace);
+
+        hipLaunchKernelGGL((spmv_row_length_stats_part2<SPMV_STATS_DIM>),
+                           dim3(1),
+                           dim3(SPMV_STATS_DIM),
+                           0,
+                           handle->stream,
+                           nblocks,
+                           workspace);
+#undef SPMV_STATS_DIM
+
+        int64_t stats[2];
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            stats, workspace, sizeof(int64_t) * 2, hipMemcpyDeviceToHost, handle->stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(workspace, handle->stream));
+
+        max_nnz = stats[0];
+        sum_sq  = stats[1];
+
+        // CSR stream assigns a fixed number of threads per row, derived from the
+        // mean row length, and performs best when the rows have similar lengths
+        const double mean   = static_cast<double>(mat->nnz) / m;
+        const double stddev
+            = std::sqrt(std::max(static_cast<double>(sum_sq) / m - mean * mean, 0.0));
+
+        alg = (max_nnz <= 4 * mean + 1 && stddev <= 0.5 * mean) ? rocsparse_spmv_alg_csr_stream
+                                                                : rocsparse_spmv_alg_csr_adaptive;
+        break;
+    }
+    case rocsparse_format_coo:
+    case rocsparse_format_coo_aos:
+    {
+        // The atomic algorithm reduces the rows within a block and adds the partial
+        // sums atomically, the segmented algorithm carries the partial sums across
+        // blocks and is preferred when rows span many blocks
+        m = (trans == rocsparse_operation_none) ? mat->rows : mat->cols;
+
+        alg = (m > 0 && mat->nnz / m > 256) ? rocsparse_spmv_alg_coo
+                                            : rocsparse_spmv_alg_coo_atomic;
+        break;
+    }
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    case rocsparse_format_bsr:
+    {
+        break;
+    }
+    }
+
+    // Time the candidates on the device
+    const size_t scratch_size = rocsparse_spmv_alg_auto_scratch_size<Y>(mat, y);
+
+    if(scratch_size > 0 && temp_buffer != nullptr)
+    {
+        size_t scratch_offset;
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_alg_auto_candidates_size<T, I, J, A, X, Y>(
+            handle, trans, alpha, mat, x, beta, y, &scratch_offset)));
+
+        _rocsparse_dnvec_descr y_scratch = *y;
+
+        y_scratch.values       = reinterpret_cast<char*>(temp_buffer) + scratch_offset;
+        y_scratch.const_values = y_scratch.values;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(y_scratch.values, 0, sizeof(Y) * y->size, handle->stream));
+
+        hipEvent_t start;
+        hipEvent_t stop;
+        RETURN_IF_HIP_ERROR(hipEventCreate(&start));
+        RETURN_IF_HIP_ERROR(hipEventCreate(&stop));
+
+        rocsparse_status status    = rocsparse_status_success;
+        float            best_time = std::numeric_limits<float>::max();
+
+        for(int c = 0; c < ncandidates && status == rocsparse_status_success; ++c)
+        {
+            static constexpr int iters = 5;
+
+            // Preprocess and warm up
+            status = rocsparse_spmv_template<T, I, J, A, X, Y>(handle,
+                                                               trans,
+                                                               alpha,
+                                                               mat,
+                                                               x,
+                                                               beta,
+                                                               &y_scratch,
+                                                               candidates[c],
+                                                               rocsparse_spmv_stage_preprocess,
+                                                               buffer_size,
+                                                               temp_buffer);
+
+            for(int iter = 0; iter <= iters && status == rocsparse_status_success; ++iter)
+            {
+                if(iter == 1 && hipEventRecord(start, handle->stream) != hipSuccess)
+                {
+                    status = rocsparse_status_internal_error;
+                    break;
+                }
+
+                status = rocsparse_spmv_template<T, I, J, A, X, Y>(handle,
+                                                                   trans,
+                                                                   alpha,
+                                                                   mat,
+                                                                   x,
+                                                                   beta,
+                                                                   &y_scratch,
+                                                                   candidates[c],
+                                                                   rocsparse_spmv_stage_compute,
+                                                                   buffer_size,
+                                                                   temp_buffer);
+            }
+
+            float time = 0.0f;
+            if(status == rocsparse_status_success
+               && (hipEventRecord(stop, handle->stream) != hipSuccess
+                   || hipEventSynchronize(stop) != hipSuccess
+                   || hipEventElapsedTime(&time, start, stop) != hipSuccess))
+            {
+                status = rocsparse_status_internal_error;
+            }
+
+            if(status == rocsparse_status_success && time < best_time)
+            {
+                best_time = time;
+                alg       = candidates[c];
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventDestroy(start));
+        RETURN_IF_HIP_ERROR(hipEventDestroy(stop));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    mat->spmv_alg       = alg;
+    mat->spmv_alg_trans = trans;
+
+    log_debug(handle,
+              "rocsparse_spmv_alg_auto selected rocsparse_spmv_alg "
+                  + std::to_string(static_cast<int>(alg)) + " (rows " + std::to_string(m)
+                  + ", nnz " + std::to_string(mat->nnz) + ", max row nnz "
+                  + std::to_string(max_nnz) + ")");
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_spmv_alg_auto_template(rocsparse_handle            handle,
+                                                  rocsparse_operation         trans,
+                                                  const void*                 alpha,
+                                                  rocsparse_const_spmat_descr mat,
+                                                  rocsparse_const_dnvec_descr x,
+                                                  const void*                 beta,
+                                                  const rocsparse_dnvec_descr y,
+                                                  rocsparse_spmv_stage        stage,
+                                                  size_t*                     buffer_size,
+                                                  void*                       temp_buffer)
+{
+    switch(stage)
+    {
+    case rocsparse_spmv_stage_buffer_size:
+    {
+        // The buffer allows to time the candidates, even if the algorithm has been selected before
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_alg_auto_candidates_size<T, I, J, A, X, Y>(
+            handle, trans, alpha, mat, x, beta, y, buffer_size)));
+
+        *buffer_size += rocsparse_spmv_alg_auto_scratch_size<Y>(mat, y);
+        return rocsparse_status_success;
+    }
+
+    case rocsparse_spmv_stage_preprocess:
+    case rocsparse_spmv_stage_compute:
+    {
+        // Select the algorithm once per operation, a compute stage without preceding
+        // preprocess stage for the same operation selects and preprocesses it on the fly
+        if(mat->spmv_alg == rocsparse_spmv_alg_default || mat->spmv_alg_trans != trans)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_alg_auto_select<T, I, J, A, X, Y>(
+                handle, trans, alpha, mat, x, beta, y, buffer_size, temp_buffer)));
+
+            if(stage == rocsparse_spmv_stage_compute)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_spmv_template<T, I, J, A, X, Y>(handle,
+                                                               trans,
+                                                               alpha,
+                                                               mat,
+                                                               x,
+                                                               beta,
+                                                               y,
+                                                               mat->spmv_alg,
+                                                               rocsparse_spmv_stage_preprocess,
+                                                               buffer_size,
+                                                               temp_buffer)));
+            }
+        }
+
+        return rocsparse_spmv_template<T, I, J, A, X, Y>(handle,
+                                                         trans,
+                                                         alpha,
+                                                         mat,
+                                                         x,
+                                                         beta,
+                                                         y,
+                                                         mat->spmv_alg,
+                                                         stage,
+                                                         buffer_size,
+                                                         temp_buffer);
+    }
+
+    case rocsparse_spmv_stage_auto:
+    {
+        return rocsparse_spmv_template_auto<T, I, J, A, X, Y>(handle,
+                                                              trans,
+                                                              alpha,
+                                                              mat,
+                                                              x,
+                                                              beta,
+                                                              y,
+                                                              rocsparse_spmv_alg_auto,
+                                                              buffer_size,
+                                                              temp_buffer);
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+template <typename I, typename J>
+static rocsparse_status rocsparse_spmv_csr_binned_analysis(rocsparse_handle            handle,
+                                                           rocsparse_operation         trans,
+                                                           rocsparse_const_spmat_descr mat,
+                                                           void*                       temp_buffer)
+{
+    // Bins are only kept for the products they cover. Otherwise, e.g. after a transposed
+    // preprocess stage, a non-transposed compute stage would launch from empty bins.
+    if(!rocsparse_csrmv_binned_supported(trans, mat->descr))
+    {
+        mat->spmv_bin_size.clear();
+        return rocsparse_status_success;
+    }
+
+    int64_t bin_size[CSRMV_BINNED_NBINS + 1];
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrmv_binned_analysis_template(handle,
+                                                 trans,
+                                                 (J)mat->rows,
+                                                 (J)mat->cols,
+                                                 (I)mat->nnz,
+                                                 mat->descr,
+                                                 (const I*)mat->const_row_data,
+                                                 bin_size,
+                                                 temp_buffer));
+
+    mat->spmv_bin_size.assign(bin_size, bin_size + CSRMV_BINNED_NBINS + 1);
+
+    return rocsparse_status_success;
+}
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
                                          rocsparse_operation         trans,
@@ -353,6 +957,20 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 {
     RETURN_IF_ROCSPARSE_ERROR((rocsparse_check_spmv_alg(mat->format, alg)));
 
+    // Batched SpMV
+    if(mat->batch_count > 1 || x->batch_count > 1 || y->batch_count > 1)
+    {
+        return rocsparse_spmv_batched_template<T, I, J, A, X, Y>(
+            handle, trans, alpha, mat, x, beta, y, alg, stage, buffer_size, temp_buffer);
+    }
+
+    // Automatic algorithm selection
+    if(alg == rocsparse_spmv_alg_auto)
+    {
+        return rocsparse_spmv_alg_auto_template<T, I, J, A, X, Y>(
+            handle, trans, alpha, mat, x, beta, y, stage, buffer_size, temp_buffer);
+    }
+
     switch(mat->format)
     {
     case rocsparse_format_coo:
@@ -529,12 +1147,40 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
         {
         case rocsparse_spmv_stage_buffer_size:
         {
+            if(alg == rocsparse_spmv_alg_csr_binned)
+            {
+                return rocsparse_csrmv_binned_buffer_size_template(handle,
+                                                                   trans,
+                                                                   (J)mat->rows,
+                                                                   (J)mat->cols,
+                                                                   (I)mat->nnz,
+                                                                   mat->descr,
+                                                                   (const I*)mat->const_row_data,
+                                                                   buffer_size);
+            }
+
+            if(alg == rocsparse_spmv_alg_csr_merge)
+            {
+                return rocsparse_csrmv_merge_buffer_size_template<T>(handle,
+                                                                     trans,
+                                                                     (J)mat->rows,
+                                                                     (J)mat->cols,
+                                                                     (I)mat->nnz,
+                                                                     mat->descr,
+                                                                     buffer_size);
+            }
+
             *buffer_size = 0;
             return rocsparse_status_success;
         }
 
         case rocsparse_spmv_stage_preprocess:
         {
+            if(alg == rocsparse_spmv_alg_csr_binned)
+            {
+                return rocsparse_spmv_csr_binned_analysis<I, J>(handle, trans, mat, temp_buffer);
+            }
+
             rocsparse_status status = rocsparse_status_success;
             //
             // If algorithm 1 or default is selected and analysis step is required
@@ -565,6 +1211,51 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
         case rocsparse_spmv_stage_compute:
         {
+            if(alg == rocsparse_spmv_alg_csr_binned)
+            {
+                // A compute stage without preceding preprocess stage bins the rows on the fly
+                if(mat->spmv_bin_size.empty())
+                {
+                    RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_csr_binned_analysis<I, J>(
+                        handle, trans, mat, temp_buffer)));
+                }
+
+                return rocsparse_csrmv_binned_template(handle,
+                                                       trans,
+                                                       (J)mat->rows,
+                                                       (J)mat->cols,
+                                                       (I)mat->nnz,
+                                                       (const T*)alpha,
+                                                       mat->descr,
+                                                       (const A*)mat->const_val_data,
+                                                       (const I*)mat->const_row_data,
+                                                       (const J*)mat->const_col_data,
+                                                       mat->spmv_bin_size.data(),
+                                                       (const X*)x->const_values,
+                                                       (const T*)beta,
+                                                       (Y*)y->values,
+                                                       temp_buffer);
+            }
+
+            if(alg == rocsparse_spmv_alg_csr_merge)
+            {
+                // The merge path is partitioned on the fly, no preprocessing is required
+                return rocsparse_csrmv_merge_template(handle,
+                                                      trans,
+                                                      (J)mat->rows,
+                                                      (J)mat->cols,
+                                                      (I)mat->nnz,
+                                                      (const T*)alpha,
+                                                      mat->descr,
+                                                      (const A*)mat->const_val_data,
+                                                      (const I*)mat->const_row_data,
+                                                      (const J*)mat->const_col_data,
+                                                      (const X*)x->const_values,
+                                                      (const T*)beta,
+                                                      (Y*)y->values,
+                                                      temp_buffer);
+            }
+
             return rocsparse_csrmv_template(handle,
                                             trans,
                                             (J)mat->rows,
@@ -700,9 +1391,43 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
     case rocsparse_format_bell:
     {
-        // LCOV_EXCL_START
-        return rocsparse_status_not_implemented;
-        // LCOV_EXCL_STOP
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_preprocess:
+        {
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_compute:
+        {
+            return rocsparse_bellmv_template(handle,
+                                             trans,
+                                             mat->block_dir,
+                                             (I)(mat->rows / mat->block_dim),
+                                             (I)(mat->cols / mat->block_dim),
+                                             (I)mat->ell_cols,
+                                             (I)mat->block_dim,
+                                             (const T*)alpha,
+                                             mat->descr,
+                                             (const I*)mat->const_col_data,
+                                             (const A*)mat->const_val_data,
+                                             (const X*)x->const_values,
+                                             (const T*)beta,
+                                             (Y*)y->values);
+        }
+
+        case rocsparse_spmv_stage_auto:
+        {
+            return rocsparse_spmv_template_auto<T, I, J, A, X, Y>(
+                handle, trans, alpha, mat, x, beta, y, alg, buffer_size, temp_buffer);
+        }
+        }
     }
     }
 
@@ -729,19 +1454,29 @@ rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
         return rocsparse_status_not_implemented;                                             \
     }
 
-#define DISPATCH_COMPUTE_TYPE_F32R(ITYPE, JTYPE, CTYPE, atype, xtype, ytype)               \
-    if(atype == rocsparse_datatype_f32_r && atype == xtype && atype == ytype)              \
-    {                                                                                      \
-        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, float, float, float>(ts...);   \
-    }                                                                                      \
-    else if(atype == rocsparse_datatype_i8_r && xtype == rocsparse_datatype_i8_r           \
-            && ytype == rocsparse_datatype_f32_r)                                          \
-    {                                                                                      \
-        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, int8_t, int8_t, float>(ts...); \
-    }                                                                                      \
-    else                                                                                   \
-    {                                                                                      \
-        return rocsparse_status_not_implemented;                                           \
+#define DISPATCH_COMPUTE_TYPE_F32R(ITYPE, JTYPE, CTYPE, atype, xtype, ytype)                    \
+    if(atype == rocsparse_datatype_f32_r && atype == xtype && atype == ytype)                   \
+    {                                                                                           \
+        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, float, float, float>(ts...);        \
+    }                                                                                           \
+    else if(atype == rocsparse_datatype_i8_r && xtype == rocsparse_datatype_i8_r                \
+            && ytype == rocsparse_datatype_f32_r)                                               \
+    {                                                                                           \
+        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, int8_t, int8_t, float>(ts...);      \
+    }                                                                                           \
+    else if(atype == rocsparse_datatype_f16_r && xtype == rocsparse_datatype_f32_r              \
+            && ytype == rocsparse_datatype_f32_r)                                               \
+    {                                                                                           \
+        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, _Float16, float, float>(ts...);     \
+    }                                                                                           \
+    else if(atype == rocsparse_datatype_bf16_r && xtype == rocsparse_datatype_f32_r             \
+            && ytype == rocsparse_datatype_f32_r)                                               \
+    {                                                                                           \
+        return rocsparse_spmv_template<CTYPE, ITYPE, JTYPE, hip_bfloat16, float, float>(ts...); \
+    }                                                                                           \
+    else                                                                                        \
+    {                                                                                           \
+        return rocsparse_status_not_implemented;                                                \
     }
 
 #define DISPATCH_COMPUTE_TYPE_F64R(ITYPE, JTYPE, CTYPE, atype, xtype, ytype)                \
@@ -845,6 +1580,8 @@ rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
     case rocsparse_datatype_i8_r:                                                               \
     case rocsparse_datatype_u8_r:                                                               \
     case rocsparse_datatype_u32_r:                                                              \
+    case rocsparse_datatype_f16_r:                                                              \
+    case rocsparse_datatype_bf16_r:                                                             \
     {                                                                                           \
         return rocsparse_status_not_implemented;                                                \
     }                                                                                           \
@@ -932,6 +1669,13 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling, the size of the temporary buffer is known once it is provided
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_spmv", compute_type);
+    if(buffer_size != nullptr && temp_buffer != nullptr)
+    {
+        log_profile_buffer(handle, *buffer_size);
+    }
+
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(mat);
     RETURN_IF_NULLPTR(x);
@@ -26,6 +26,7 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "rocsparse_bsrsv.hpp"
 #include "rocsparse_coosv.hpp"
 #include "rocsparse_csrsv.hpp"
 
@@ -41,6 +42,13 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                          size_t*                     buffer_size,
                                          void*                       temp_buffer)
 {
+    // BSR triangular solve only supports rocsparse_int indices
+    if(mat->format == rocsparse_format_bsr
+       && (!std::is_same<I, rocsparse_int>() || !std::is_same<J, rocsparse_int>()))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // STAGE 1 - compute required buffer size of temp_buffer
     if(stage == rocsparse_spsv_stage_buffer_size
        || (stage == rocsparse_spsv_stage_auto && temp_buffer == nullptr))
@@ -79,6 +87,25 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
+        else if(mat->format == rocsparse_format_bsr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_bsrsv_buffer_size_template(handle,
+                                                     mat->block_dir,
+                                                     trans,
+                                                     (rocsparse_int)mat->rows,
+                                                     (rocsparse_int)mat->nnz,
+                                                     mat->descr,
+                                                     (const T*)mat->const_val_data,
+                                                     (const rocsparse_int*)mat->const_row_data,
+                                                     (const rocsparse_int*)mat->const_col_data,
+                                                     (rocsparse_int)mat->block_dim,
+                                                     mat->info,
+                                                     buffer_size));
+
+            *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
+            return rocsparse_status_success;
+        }
         else
         {
             return rocsparse_status_not_implemented;
@@ -105,7 +132,23 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                        mat->info,
                                                        rocsparse_analysis_policy_force,
                                                        rocsparse_solve_policy_auto,
-                                                       temp_buffer)));
+                                                       temp_buffer,
+                                                       alg == rocsparse_spsv_alg_level_set)));
+
+                // Level statistics of the triangular matrix
+                rocsparse_fill_mode fill_mode = mat->descr->fill_mode;
+                rocsparse_trm_info  trm
+                    = (fill_mode == rocsparse_fill_mode_upper)
+                          ? ((trans == rocsparse_operation_none) ? mat->info->csrsv_upper_info
+                                                                 : mat->info->csrsvt_upper_info)
+                          : ((trans == rocsparse_operation_none) ? mat->info->csrsv_lower_info
+                                                                 : mat->info->csrsvt_lower_info);
+
+                if(trm != nullptr)
+                {
+                    mat->spsv_nlevels        = trm->nlevels;
+                    mat->spsv_max_level_size = trm->max_level_size;
+                }
             }
             else if(mat->format == rocsparse_format_coo)
             {
@@ -123,6 +166,24 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                        rocsparse_solve_policy_auto,
                                                        temp_buffer)));
             }
+            else if(mat->format == rocsparse_format_bsr)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_bsrsv_analysis_template(handle,
+                                                       mat->block_dir,
+                                                       trans,
+                                                       (rocsparse_int)mat->rows,
+                                                       (rocsparse_int)mat->nnz,
+                                                       mat->descr,
+                                                       (const T*)mat->const_val_data,
+                                                       (const rocsparse_int*)mat->const_row_data,
+                                                       (const rocsparse_int*)mat->const_col_data,
+                                                       (rocsparse_int)mat->block_dim,
+                                                       mat->info,
+                                                       rocsparse_analysis_policy_force,
+                                                       rocsparse_solve_policy_auto,
+                                                       temp_buffer)));
+            }
             else
             {
                 return rocsparse_status_not_implemented;
@@ -152,6 +213,7 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                   (const T*)x->const_values,
                                                   (T*)y->values,
                                                   rocsparse_solve_policy_auto,
+                                                  alg,
                                                   temp_buffer);
         }
         else if(mat->format == rocsparse_format_coo)
@@ -171,6 +233,25 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                   rocsparse_solve_policy_auto,
                                                   temp_buffer);
         }
+        else if(mat->format == rocsparse_format_bsr)
+        {
+            return rocsparse_bsrsv_solve_template(handle,
+                                                  mat->block_dir,
+                                                  trans,
+                                                  (rocsparse_int)mat->rows,
+                                                  (rocsparse_int)mat->nnz,
+                                                  (const T*)alpha,
+                                                  mat->descr,
+                                                  (const T*)mat->const_val_data,
+                                                  (const rocsparse_int*)mat->const_row_data,
+                                                  (const rocsparse_int*)mat->const_col_data,
+                                                  (rocsparse_int)mat->block_dim,
+                                                  mat->info,
+                                                  (const T*)x->const_values,
+                                                  (T*)y->values,
+                                                  rocsparse_solve_policy_auto,
+                                                  temp_buffer);
+        }
         else
         {
             return rocsparse_status_not_implemented;
@@ -247,6 +328,8 @@ rocsparse_status rocsparse_spsv_dynamic_dispatch(rocsparse_indextype itype,
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -294,6 +377,9 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_spsv", compute_type);
+
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(mat);
     RETURN_IF_NULLPTR(x);
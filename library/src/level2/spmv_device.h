@@ -0,0 +1,97 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "common.h"
+
+// Per block maximum and sum of squares of the row lengths of a compressed
+// sparse matrix, used by the automatic SpMV algorithm selection
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void spmv_row_length_stats_part1(J m, const I* __restrict__ ptr, int64_t* __restrict__ workspace)
+{
+    int tid = hipThreadIdx_x;
+    J   gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ int64_t smax[BLOCKSIZE];
+    __shared__ int64_t ssum[BLOCKSIZE];
+
+    int64_t row_max = 0;
+    int64_t row_sum = 0;
+
+    for(J row = gid; row < m; row += hipGridDim_x * BLOCKSIZE)
+    {
+        int64_t row_nnz = ptr[row + 1] - ptr[row];
+
+        row_max = max(row_max, row_nnz);
+        row_sum += row_nnz * row_nnz;
+    }
+
+    smax[tid] = row_max;
+    ssum[tid] = row_sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<BLOCKSIZE>(tid, smax);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, ssum);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x]                = smax[0];
+        workspace[hipGridDim_x + hipBlockIdx_x] = ssum[0];
+    }
+}
+
+// Final reduction of the per block row length statistics
+template <unsigned int BLOCKSIZE>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void spmv_row_length_stats_part2(int nblocks, int64_t* __restrict__ workspace)
+{
+    int tid = hipThreadIdx_x;
+
+    __shared__ int64_t smax[BLOCKSIZE];
+    __shared__ int64_t ssum[BLOCKSIZE];
+
+    smax[tid] = 0;
+    ssum[tid] = 0;
+
+    for(int i = tid; i < nblocks; i += BLOCKSIZE)
+    {
+        smax[tid] = max(smax[tid], workspace[i]);
+        ssum[tid] += workspace[nblocks + i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<BLOCKSIZE>(tid, smax);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, ssum);
+
+    if(tid == 0)
+    {
+        workspace[0] = smax[0];
+        workspace[1] = ssum[0];
+    }
+}
@@ -0,0 +1,189 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+// ELL SpMM for non-transposed matrices. Each thread computes one entry of C.
+// If the columns of op(B) are contiguous in memory (TRANSB), consecutive
+// threads compute consecutive columns of the same row of C, such that the
+// loads from B are coalesced. Otherwise consecutive threads compute consecutive
+// rows of the same column of C, such that the loads from the column-major ELL
+// arrays are coalesced.
+template <unsigned int BLOCKSIZE,
+          bool         TRANSB,
+          typename T,
+          typename I,
+          typename A,
+          typename B,
+          typename C>
+ROCSPARSE_DEVICE_ILF void ellmmnn_device(bool    conj_A,
+                                         bool    conj_B,
+                                         I       m,
+                                         I       n,
+                                         I       k,
+                                         I       ell_width,
+                                         T       alpha,
+                                         const I* __restrict__ ell_col_ind,
+                                         const A* __restrict__ ell_val,
+                                         const B* __restrict__ dense_B,
+                                         I ldb,
+                                         T beta,
+                                         C* __restrict__ dense_C,
+                                         I                    ldc,
+                                         rocsparse_order      order_C,
+                                         rocsparse_index_base idx_base)
+{
+    int64_t gid = static_cast<int64_t>(BLOCKSIZE) * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid >= static_cast<int64_t>(m) * n)
+    {
+        return;
+    }
+
+    I row = TRANSB ? gid / n : gid % m;
+    I col = TRANSB ? gid % n : gid / m;
+
+    T sum = static_cast<T>(0);
+    for(I p = 0; p < ell_width; ++p)
+    {
+        int64_t idx = ELL_IND(row, (int64_t)p, m, ell_width);
+        I       c   = rocsparse_ldg(ell_col_ind + idx) - idx_base;
+
+        if(c >= 0 && c < k)
+        {
+            B b = TRANSB ? rocsparse_ldg(dense_B + static_cast<int64_t>(ldb) * c + col)
+                         : rocsparse_ldg(dense_B + static_cast<int64_t>(ldb) * col + c);
+
+            sum = rocsparse_fma<T>(
+                conj_val(rocsparse_ldg(ell_val + idx), conj_A), conj_val(b, conj_B), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int64_t idx_C = (order_C == rocsparse_order_column) ? static_cast<int64_t>(ldc) * col + row
+                                                        : static_cast<int64_t>(ldc) * row + col;
+
+    if(beta == static_cast<T>(0))
+    {
+        dense_C[idx_C] = alpha * sum;
+    }
+    else
+    {
+        dense_C[idx_C] = rocsparse_fma<T>(beta, dense_C[idx_C], alpha * sum);
+    }
+}
+
+// Scale the m x n matrix C by beta, before the atomic updates of the transposed kernel
+template <unsigned int BLOCKSIZE, typename I, typename C, typename T>
+ROCSPARSE_DEVICE_ILF void
+    ellmm_scale_device(I m, I n, T beta, C* __restrict__ dense_C, I ldc, rocsparse_order order_C)
+{
+    int64_t gid = static_cast<int64_t>(BLOCKSIZE) * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid >= static_cast<int64_t>(m) * n)
+    {
+        return;
+    }
+
+    I wid = (order_C == rocsparse_order_column) ? gid / m : gid / n;
+    I lid = (order_C == rocsparse_order_column) ? gid % m : gid % n;
+
+    int64_t idx_C = static_cast<int64_t>(ldc) * wid + lid;
+
+    if(beta == static_cast<T>(0))
+    {
+        dense_C[idx_C] = static_cast<C>(0);
+    }
+    else
+    {
+        dense_C[idx_C] = beta * dense_C[idx_C];
+    }
+}
+
+// ELL SpMM for (conjugate) transposed matrices. Each thread multiplies one
+// entry of B with a row of A and adds the products to C with atomics. The
+// mapping of the threads is the same as in the non-transposed kernel.
+template <unsigned int BLOCKSIZE,
+          bool         TRANSB,
+          typename T,
+          typename I,
+          typename A,
+          typename B,
+          typename C>
+ROCSPARSE_DEVICE_ILF void ellmmtn_device(bool    conj_A,
+                                         bool    conj_B,
+                                         I       m,
+                                         I       n,
+                                         I       k,
+                                         I       ell_width,
+                                         T       alpha,
+                                         const I* __restrict__ ell_col_ind,
+                                         const A* __restrict__ ell_val,
+                                         const B* __restrict__ dense_B,
+                                         I ldb,
+                                         C* __restrict__ dense_C,
+                                         I                    ldc,
+                                         rocsparse_order      order_C,
+                                         rocsparse_index_base idx_base)
+{
+    int64_t gid = static_cast<int64_t>(BLOCKSIZE) * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid >= static_cast<int64_t>(m) * n)
+    {
+        return;
+    }
+
+    I row = TRANSB ? gid / n : gid % m;
+    I col = TRANSB ? gid % n : gid / m;
+
+    B b = TRANSB ? rocsparse_ldg(dense_B + static_cast<int64_t>(ldb) * row + col)
+                 : rocsparse_ldg(dense_B + static_cast<int64_t>(ldb) * col + row);
+
+    T val_B = alpha * conj_val(b, conj_B);
+
+    for(I p = 0; p < ell_width; ++p)
+    {
+        int64_t idx = ELL_IND(row, (int64_t)p, m, ell_width);
+        I       c   = rocsparse_ldg(ell_col_ind + idx) - idx_base;
+
+        if(c >= 0 && c < k)
+        {
+            int64_t idx_C = (order_C == rocsparse_order_column)
+                                ? static_cast<int64_t>(ldc) * col + c
+                                : static_cast<int64_t>(ldc) * c + col;
+
+            atomicAdd(&dense_C[idx_C],
+                      static_cast<T>(conj_val(rocsparse_ldg(ell_val + idx), conj_A)) * val_B);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
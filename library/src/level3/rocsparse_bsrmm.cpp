@@ -94,6 +94,36 @@ rocsparse_status rocsparse_bsrmm_template_general(rocsparse_handle          hand
                                                   T*                        C,
                                                   rocsparse_int             ldc);
 
+rocsparse_bsrmm_alg rocsparse_bsrmm_select_alg(rocsparse_operation trans_B,
+                                               rocsparse_int       n,
+                                               rocsparse_int       block_dim)
+{
+    // If n is only 1 and B are non-transposed, then call bsrmv
+    if(n == 1 && trans_B == rocsparse_operation_none)
+    {
+        return rocsparse_bsrmm_alg_bsrmv;
+    }
+
+    // If block dimension is one we can simply call csrmm
+    if(block_dim == 1)
+    {
+        return rocsparse_bsrmm_alg_csrmm;
+    }
+
+    if(block_dim == 2)
+    {
+        return rocsparse_bsrmm_alg_small;
+    }
+    else if(block_dim <= 32)
+    {
+        return rocsparse_bsrmm_alg_large_ext;
+    }
+    else
+    {
+        return rocsparse_bsrmm_alg_general;
+    }
+}
+
 template <typename T, typename U>
 rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_direction       dir,
@@ -115,32 +145,28 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                    T*                        C,
                                                    rocsparse_int             ldc)
 {
-
-    // If n is only 1 and B are non-transposed, then call bsrmv
-    if(n == 1)
+    switch(rocsparse_bsrmm_select_alg(trans_B, n, block_dim))
     {
-        if(trans_B == rocsparse_operation_none)
-        {
-            return rocsparse_bsrmv_template_dispatch<T>(handle,
-                                                        dir,
-                                                        trans_A,
-                                                        mb,
-                                                        kb,
-                                                        nnzb,
-                                                        alpha,
-                                                        descr,
-                                                        bsr_val,
-                                                        bsr_row_ptr,
-                                                        bsr_col_ind,
-                                                        block_dim,
-                                                        B,
-                                                        beta,
-                                                        C);
-        }
+    case rocsparse_bsrmm_alg_bsrmv:
+    {
+        return rocsparse_bsrmv_template_dispatch<T>(handle,
+                                                    dir,
+                                                    trans_A,
+                                                    mb,
+                                                    kb,
+                                                    nnzb,
+                                                    alpha,
+                                                    descr,
+                                                    bsr_val,
+                                                    bsr_row_ptr,
+                                                    bsr_col_ind,
+                                                    block_dim,
+                                                    B,
+                                                    beta,
+                                                    C);
     }
 
-    // If block dimension is one we can simply call csrmm
-    if(block_dim == 1)
+    case rocsparse_bsrmm_alg_csrmm:
     {
         rocsparse_int nnz = nnzb * block_dim;
         rocsparse_int m   = mb * block_dim;
@@ -176,7 +202,7 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                     false);
     }
 
-    if(block_dim == 2)
+    case rocsparse_bsrmm_alg_small:
     {
         return rocsparse_bsrmm_template_small(handle,
                                               dir,
@@ -198,7 +224,8 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                               C,
                                               ldc);
     }
-    else if(block_dim <= 32)
+
+    case rocsparse_bsrmm_alg_large_ext:
     {
         return rocsparse_bsrmm_template_large_ext(handle,
                                                   dir,
@@ -220,7 +247,8 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                   C,
                                                   ldc);
     }
-    else
+
+    case rocsparse_bsrmm_alg_general:
     {
         return rocsparse_bsrmm_template_general(handle,
                                                 dir,
@@ -235,7 +263,6 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                 bsr_val,
                                                 bsr_row_ptr,
                                                 bsr_col_ind,
-
                                                 block_dim,
                                                 B,
                                                 ldb,
@@ -243,6 +270,140 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                 C,
                                                 ldc);
     }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmm_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             kb,
+                                                   rocsparse_int             nnzb,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   rocsparse_bsrmm_alg*      alg)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrmm_analysis"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              n,
+              kb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)alg);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrmm_analysis"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                n,
+                                                kb,
+                                                nnzb,
+                                                block_dim);
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(trans_A != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || n < 0 || kb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(alg == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The kernel only depends on the sizes and the operation on B
+    *alg = rocsparse_bsrmm_select_alg(trans_B, n, block_dim);
+
+    // Quick return if possible
+    if(mb == 0 || n == 0 || kb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((bsr_val == nullptr && bsr_col_ind != nullptr)
+       || (bsr_val != nullptr && bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnzb != 0 && (bsr_val == nullptr && bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_status_success;
 }
 
 template <typename T>
@@ -479,6 +640,48 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
     }
 }
 
+#define INSTANTIATE(TTYPE)                                                                    \
+    template rocsparse_status rocsparse_bsrmm_analysis_template(                              \
+        rocsparse_handle          handle,                                                     \
+        rocsparse_direction       dir,                                                        \
+        rocsparse_operation       trans_A,                                                    \
+        rocsparse_operation       trans_B,                                                    \
+        rocsparse_int             mb,                                                         \
+        rocsparse_int             n,                                                          \
+        rocsparse_int             kb,                                                         \
+        rocsparse_int             nnzb,                                                       \
+        const rocsparse_mat_descr descr,                                                      \
+        const TTYPE*              bsr_val,                                                    \
+        const rocsparse_int*      bsr_row_ptr,                                                \
+        const rocsparse_int*      bsr_col_ind,                                                \
+        rocsparse_int             block_dim,                                                  \
+        rocsparse_bsrmm_alg*      alg);                                                       \
+    template rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,      \
+                                                       rocsparse_direction       dir,         \
+                                                       rocsparse_operation       trans_A,     \
+                                                       rocsparse_operation       trans_B,     \
+                                                       rocsparse_int             mb,          \
+                                                       rocsparse_int             n,           \
+                                                       rocsparse_int             kb,          \
+                                                       rocsparse_int             nnzb,        \
+                                                       const TTYPE*              alpha,       \
+                                                       const rocsparse_mat_descr descr,       \
+                                                       const TTYPE*              bsr_val,     \
+                                                       const rocsparse_int*      bsr_row_ptr, \
+                                                       const rocsparse_int*      bsr_col_ind, \
+                                                       rocsparse_int             block_dim,   \
+                                                       const TTYPE*              B,           \
+                                                       rocsparse_int             ldb,         \
+                                                       const TTYPE*              beta,        \
+                                                       TTYPE*                    C,           \
+                                                       rocsparse_int             ldc);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -26,6 +26,35 @@
 
 #include "handle.h"
 
+typedef enum rocsparse_bsrmm_alg_
+{
+    rocsparse_bsrmm_alg_bsrmv = 0,
+    rocsparse_bsrmm_alg_csrmm,
+    rocsparse_bsrmm_alg_small,
+    rocsparse_bsrmm_alg_large_ext,
+    rocsparse_bsrmm_alg_general
+} rocsparse_bsrmm_alg;
+
+rocsparse_bsrmm_alg rocsparse_bsrmm_select_alg(rocsparse_operation trans_B,
+                                               rocsparse_int       n,
+                                               rocsparse_int       block_dim);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmm_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             kb,
+                                                   rocsparse_int             nnzb,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   rocsparse_bsrmm_alg*      alg);
+
 template <typename T, typename U>
 rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_direction       dir,
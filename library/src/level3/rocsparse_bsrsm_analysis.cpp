@@ -74,6 +74,14 @@ rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          han
               solve,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrsm_analysis"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     if(rocsparse_enum_utils::is_invalid(dir) || rocsparse_enum_utils::is_invalid(trans_A)
        || rocsparse_enum_utils::is_invalid(trans_X) || rocsparse_enum_utils::is_invalid(analysis)
        || rocsparse_enum_utils::is_invalid(solve))
@@ -268,6 +276,31 @@ rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                       \
+    template rocsparse_status rocsparse_bsrsm_analysis_template( \
+        rocsparse_handle          handle,                        \
+        rocsparse_direction       dir,                           \
+        rocsparse_operation       trans_A,                       \
+        rocsparse_operation       trans_X,                       \
+        rocsparse_int             mb,                            \
+        rocsparse_int             nrhs,                          \
+        rocsparse_int             nnzb,                          \
+        const rocsparse_mat_descr descr,                         \
+        const TTYPE*              bsr_val,                       \
+        const rocsparse_int*      bsr_row_ptr,                   \
+        const rocsparse_int*      bsr_col_ind,                   \
+        rocsparse_int             block_dim,                     \
+        rocsparse_mat_info        info,                          \
+        rocsparse_analysis_policy analysis,                      \
+        rocsparse_solve_policy    solve,                         \
+        void*                     temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
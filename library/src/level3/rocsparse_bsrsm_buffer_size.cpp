@@ -183,6 +183,29 @@ rocsparse_status rocsparse_bsrsm_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                          \
+    template rocsparse_status rocsparse_bsrsm_buffer_size_template( \
+        rocsparse_handle          handle,                           \
+        rocsparse_direction       dir,                              \
+        rocsparse_operation       trans_A,                          \
+        rocsparse_operation       trans_X,                          \
+        rocsparse_int             mb,                               \
+        rocsparse_int             nrhs,                             \
+        rocsparse_int             nnzb,                             \
+        const rocsparse_mat_descr descr,                            \
+        const TTYPE*              bsr_val,                          \
+        const rocsparse_int*      bsr_row_ptr,                      \
+        const rocsparse_int*      bsr_col_ind,                      \
+        rocsparse_int             block_dim,                        \
+        rocsparse_mat_info        info,                             \
+        size_t*                   buffer_size);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -144,6 +144,14 @@ rocsparse_status rocsparse_bsrsm_solve_template(rocsparse_handle          handle
               policy,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrsm_solve"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     if(rocsparse_enum_utils::is_invalid(dir) || rocsparse_enum_utils::is_invalid(trans_A)
        || rocsparse_enum_utils::is_invalid(trans_X) || rocsparse_enum_utils::is_invalid(policy))
     {
@@ -257,6 +265,35 @@ rocsparse_status rocsparse_bsrsm_solve_template(rocsparse_handle          handle
     }
 }
 
+#define INSTANTIATE(TTYPE)                                    \
+    template rocsparse_status rocsparse_bsrsm_solve_template( \
+        rocsparse_handle          handle,                     \
+        rocsparse_direction       dir,                        \
+        rocsparse_operation       trans_A,                    \
+        rocsparse_operation       trans_X,                    \
+        rocsparse_int             mb,                         \
+        rocsparse_int             nrhs,                       \
+        rocsparse_int             nnzb,                       \
+        const TTYPE*              alpha_device_host,          \
+        const rocsparse_mat_descr descr,                      \
+        const TTYPE*              bsr_val,                    \
+        const rocsparse_int*      bsr_row_ptr,                \
+        const rocsparse_int*      bsr_col_ind,                \
+        rocsparse_int             block_dim,                  \
+        rocsparse_mat_info        info,                       \
+        const TTYPE*              B,                          \
+        rocsparse_int             ldb,                        \
+        TTYPE*                    X,                          \
+        rocsparse_int             ldx,                        \
+        rocsparse_solve_policy    policy,                     \
+        void*                     temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
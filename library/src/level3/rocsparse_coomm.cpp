@@ -258,6 +258,10 @@ rocsparse_status rocsparse_coomm_analysis_template(rocsparse_handle          han
               (const void*&)coo_col_ind,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_coomm_analysis", rocsparse_get_datatype<A>(), m, n, k, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
         return rocsparse_status_invalid_value;
@@ -955,6 +959,10 @@ INSTANTIATE_BUFFER_SIZE(int32_t, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(int32_t, int64_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int64_t, int8_t);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, hip_bfloat16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, hip_bfloat16);
 #undef INSTANTIATE_BUFFER_SIZE
 
 #define INSTANTIATE_ANALYSIS(TTYPE, ITYPE, ATYPE)                                     \
@@ -987,6 +995,10 @@ INSTANTIATE_ANALYSIS(int32_t, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(int32_t, int64_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int64_t, int8_t);
+INSTANTIATE_ANALYSIS(float, int32_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int64_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int32_t, hip_bfloat16);
+INSTANTIATE_ANALYSIS(float, int64_t, hip_bfloat16);
 #undef INSTANTIATE_ANALYSIS
 
 #define INSTANTIATE(TTYPE, ITYPE, ATYPE, BTYPE, CTYPE)                                              \
@@ -1049,4 +1061,8 @@ INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t);
 INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE(float, int32_t, int8_t, int8_t, float);
 INSTANTIATE(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float);
 #undef INSTANTIATE
@@ -948,9 +948,17 @@ INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE(float, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE(float, int64_t, int8_t, int8_t, float, float);
+INSTANTIATE(float, int32_t, _Float16, float, float, float);
+INSTANTIATE(float, int64_t, _Float16, float, float, float);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float, float);
 
 INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(float, int32_t, int8_t, int8_t, float, const float*);
 INSTANTIATE(float, int64_t, int8_t, int8_t, float, const float*);
+INSTANTIATE(float, int32_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int64_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float, const float*);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float, const float*);
 #undef INSTANTIATE
@@ -274,6 +274,10 @@ rocsparse_status rocsparse_coosm_analysis_template(rocsparse_handle          han
               solve,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcoosm_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check operation type
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -466,6 +470,10 @@ rocsparse_status rocsparse_coosm_solve_template(rocsparse_handle          handle
               "--alpha",
               LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcoosm_solve"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check operation type
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -300,6 +300,12 @@ INSTANTIATE_BUFFER_SIZE(int32_t, int64_t, int64_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, int8_t);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_BUFFER_SIZE
 
 #define INSTANTIATE_ANALYSIS(TTYPE, ITYPE, JTYPE, ATYPE)                \
@@ -338,6 +344,12 @@ INSTANTIATE_ANALYSIS(int32_t, int64_t, int64_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int32_t, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int64_t, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int64_t, int64_t, int8_t);
+INSTANTIATE_ANALYSIS(float, int32_t, int32_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int64_t, int32_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int64_t, int64_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_ANALYSIS(float, int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_ANALYSIS(float, int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_ANALYSIS
 
 #define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, BTYPE, CTYPE)                                      \
@@ -421,6 +433,12 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float);
 #undef INSTANTIATE
 
 // #define INSTANTIATE_MIXED_BUFFERSIZE(ITYPE, JTYPE, ATYPE)                      \
@@ -229,6 +229,10 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
               (const void*&)csr_col_ind,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csrmm_analysis", rocsparse_get_datatype<A>(), m, n, k, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
         return rocsparse_status_invalid_value;
@@ -632,6 +636,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
               batch_count_C,
               batch_stride_C);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrmm"), rocsparse_get_datatype<T>(), m, n, k, nnz);
+
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
         return rocsparse_status_invalid_value;
@@ -794,6 +802,17 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_value;
     }
 
+    // Estimated work, for the profiling layer
+    {
+        const double m_B = (trans_A == rocsparse_operation_none) ? k : m;
+        const double m_C = (trans_A == rocsparse_operation_none) ? m : k;
+        log_profile(handle,
+                    2.0 * nnz * n * batch_count_C,
+                    (sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz)) * batch_count_A
+                        + sizeof(B) * m_B * n * batch_count_B
+                        + sizeof(C) * 2.0 * m_C * n * batch_count_C);
+    }
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         return rocsparse_csrmm_template_dispatch<T>(handle,
@@ -894,6 +913,12 @@ INSTANTIATE_BUFFER_SIZE(int32_t, int64_t, int64_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, int8_t);
 INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, int8_t);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, _Float16);
+INSTANTIATE_BUFFER_SIZE(float, int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_BUFFER_SIZE(float, int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_BUFFER_SIZE
 
 #define INSTANTIATE_ANALYSIS(TTYPE, ITYPE, JTYPE, ATYPE)                \
@@ -932,6 +957,12 @@ INSTANTIATE_ANALYSIS(int32_t, int64_t, int64_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int32_t, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int64_t, int32_t, int8_t);
 INSTANTIATE_ANALYSIS(float, int64_t, int64_t, int8_t);
+INSTANTIATE_ANALYSIS(float, int32_t, int32_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int64_t, int32_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int64_t, int64_t, _Float16);
+INSTANTIATE_ANALYSIS(float, int32_t, int32_t, hip_bfloat16);
+INSTANTIATE_ANALYSIS(float, int64_t, int32_t, hip_bfloat16);
+INSTANTIATE_ANALYSIS(float, int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE_ANALYSIS
 
 #define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, BTYPE, CTYPE)                                      \
@@ -1016,6 +1047,12 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float);
 #undef INSTANTIATE
 
 /*
@@ -508,8 +508,8 @@ rocsparse_status rocsparse_csrmmnt_template_general(rocsparse_handle handle,
     J main      = 0;
     J remainder = 0;
 
-    // Launch appropriate kernel depending on row nnz of A
-    if(avg_row_nnz < 16)
+    // Launch appropriate kernel depending on row nnz of A, see rocsparse_tuning_params
+    if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[0])
     {
         if(n >= 128)
         {
@@ -551,7 +551,7 @@ rocsparse_status rocsparse_csrmmnt_template_general(rocsparse_handle handle,
             remainder = n;
         }
     }
-    else if(avg_row_nnz < 32)
+    else if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[1])
     {
         if(n >= 256)
         {
@@ -593,7 +593,8 @@ rocsparse_status rocsparse_csrmmnt_template_general(rocsparse_handle handle,
             remainder = n;
         }
     }
-    else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
+    else if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[2]
+            || handle->wavefront_size == 32)
     {
         if(n >= 512)
         {
@@ -1143,6 +1144,12 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float, float);
 
 INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
@@ -1150,4 +1157,10 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, const float*);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, const float*);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, const float*);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float, const float*);
 #undef INSTANTIATE
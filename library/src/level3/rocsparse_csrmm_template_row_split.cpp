@@ -372,8 +372,8 @@ rocsparse_status rocsparse_csrmmnt_template_row_split(rocsparse_handle
     J main      = 0;
     J remainder = 0;
 
-    // Launch appropriate kernel depending on row nnz of A
-    if(avg_row_nnz < 16)
+    // Launch appropriate kernel depending on row nnz of A, see rocsparse_tuning_params
+    if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[0])
     {
         if(n >= 128)
         {
@@ -415,7 +415,7 @@ rocsparse_status rocsparse_csrmmnt_template_row_split(rocsparse_handle
             remainder = n;
         }
     }
-    else if(avg_row_nnz < 32)
+    else if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[1])
     {
         if(n >= 256)
         {
@@ -457,7 +457,8 @@ rocsparse_status rocsparse_csrmmnt_template_row_split(rocsparse_handle
             remainder = n;
         }
     }
-    else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
+    else if(avg_row_nnz < handle->tuning.csrmm_nnz_per_row[2]
+            || handle->wavefront_size == 32)
     {
         if(n >= 512)
         {
@@ -760,6 +761,12 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, int32_t);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, float);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, float);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float, float);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float, float);
 
 INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
@@ -767,6 +774,12 @@ INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, const int32_t*);
 INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, const float*);
 INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, const float*);
 INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, const float*);
+INSTANTIATE(float, int32_t, int32_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, _Float16, float, float, const float*);
+INSTANTIATE(float, int32_t, int32_t, hip_bfloat16, float, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, hip_bfloat16, float, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, hip_bfloat16, float, float, const float*);
 #undef INSTANTIATE
 
 // #define INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE)                  \
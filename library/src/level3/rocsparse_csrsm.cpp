@@ -283,6 +283,10 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
               solve,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrsm_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check operation type
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -1080,6 +1084,10 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
               "--alpha",
               LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host));
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrsm_solve"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check operation type
     if(rocsparse_enum_utils::is_invalid(trans_A))
     {
@@ -0,0 +1,594 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_ellmm.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "ellmm_device.h"
+
+template <unsigned int BLOCKSIZE,
+          bool         TRANSB,
+          typename T,
+          typename I,
+          typename A,
+          typename B,
+          typename C,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void ellmmnn_kernel(bool conj_A,
+                    bool conj_B,
+                    I    m,
+                    I    n,
+                    I    k,
+                    I    ell_width,
+                    I    batch_stride_A,
+                    U    alpha_device_host,
+                    const I* __restrict__ ell_col_ind,
+                    const A* __restrict__ ell_val,
+                    const B* __restrict__ dense_B,
+                    I ldb,
+                    I batch_stride_B,
+                    U beta_device_host,
+                    C* __restrict__ dense_C,
+                    I                    ldc,
+                    I                    batch_stride_C,
+                    rocsparse_order      order_C,
+                    rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    ellmmnn_device<BLOCKSIZE, TRANSB>(conj_A,
+                                      conj_B,
+                                      m,
+                                      n,
+                                      k,
+                                      ell_width,
+                                      alpha,
+                                      load_pointer(ell_col_ind, hipBlockIdx_y, batch_stride_A),
+                                      load_pointer(ell_val, hipBlockIdx_y, batch_stride_A),
+                                      load_pointer(dense_B, hipBlockIdx_y, batch_stride_B),
+                                      ldb,
+                                      beta,
+                                      load_pointer(dense_C, hipBlockIdx_y, batch_stride_C),
+                                      ldc,
+                                      order_C,
+                                      idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename I, typename C, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void ellmm_scale_kernel(I m,
+                        I n,
+                        U beta_device_host,
+                        C* __restrict__ dense_C,
+                        I               ldc,
+                        I               batch_stride_C,
+                        rocsparse_order order_C)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != static_cast<T>(1))
+    {
+        ellmm_scale_device<BLOCKSIZE>(
+            m, n, beta, load_pointer(dense_C, hipBlockIdx_y, batch_stride_C), ldc, order_C);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          bool         TRANSB,
+          typename T,
+          typename I,
+          typename A,
+          typename B,
+          typename C,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void ellmmtn_kernel(bool conj_A,
+                    bool conj_B,
+                    I    m,
+                    I    n,
+                    I    k,
+                    I    ell_width,
+                    I    batch_stride_A,
+                    U    alpha_device_host,
+                    const I* __restrict__ ell_col_ind,
+                    const A* __restrict__ ell_val,
+                    const B* __restrict__ dense_B,
+                    I ldb,
+                    I batch_stride_B,
+                    C* __restrict__ dense_C,
+                    I                    ldc,
+                    I                    batch_stride_C,
+                    rocsparse_order      order_C,
+                    rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        ellmmtn_device<BLOCKSIZE, TRANSB>(conj_A,
+                                          conj_B,
+                                          m,
+                                          n,
+                                          k,
+                                          ell_width,
+                                          alpha,
+                                          load_pointer(ell_col_ind, hipBlockIdx_y, batch_stride_A),
+                                          load_pointer(ell_val, hipBlockIdx_y, batch_stride_A),
+                                          load_pointer(dense_B, hipBlockIdx_y, batch_stride_B),
+                                          ldb,
+                                          load_pointer(dense_C, hipBlockIdx_y, batch_stride_C),
+                                          ldc,
+                                          order_C,
+                                          idx_base);
+    }
+}
+
+#define ELLMMNN_DIM 256
+#define LAUNCH_ELLMMNN_KERNEL(TRANSB)                                                            \
+    hipLaunchKernelGGL((ellmmnn_kernel<ELLMMNN_DIM, TRANSB, T>),                                 \
+                       dim3((static_cast<int64_t>(m) * n - 1) / ELLMMNN_DIM + 1, batch_count_C), \
+                       dim3(ELLMMNN_DIM),                                                        \
+                       0,                                                                        \
+                       handle->stream,                                                           \
+                       conj_A,                                                                   \
+                       conj_B,                                                                   \
+                       m,                                                                        \
+                       n,                                                                        \
+                       k,                                                                        \
+                       ell_width,                                                                \
+                       batch_stride_A,                                                           \
+                       alpha_device_host,                                                        \
+                       ell_col_ind,                                                              \
+                       ell_val,                                                                  \
+                       dense_B,                                                                  \
+                       ldb,                                                                      \
+                       batch_stride_B,                                                           \
+                       beta_device_host,                                                         \
+                       dense_C,                                                                  \
+                       ldc,                                                                      \
+                       batch_stride_C,                                                           \
+                       order,                                                                    \
+                       descr->base)
+
+#define ELLMMTN_DIM 256
+#define LAUNCH_ELLMMTN_KERNEL(TRANSB)                                                            \
+    hipLaunchKernelGGL((ellmmtn_kernel<ELLMMTN_DIM, TRANSB, T>),                                 \
+                       dim3((static_cast<int64_t>(m) * n - 1) / ELLMMTN_DIM + 1, batch_count_C), \
+                       dim3(ELLMMTN_DIM),                                                        \
+                       0,                                                                        \
+                       handle->stream,                                                           \
+                       conj_A,                                                                   \
+                       conj_B,                                                                   \
+                       m,                                                                        \
+                       n,                                                                        \
+                       k,                                                                        \
+                       ell_width,                                                                \
+                       batch_stride_A,                                                           \
+                       alpha_device_host,                                                        \
+                       ell_col_ind,                                                              \
+                       ell_val,                                                                  \
+                       dense_B,                                                                  \
+                       ldb,                                                                      \
+                       batch_stride_B,                                                           \
+                       dense_C,                                                                  \
+                       ldc,                                                                      \
+                       batch_stride_C,                                                           \
+                       order,                                                                    \
+                       descr->base)
+
+template <typename T, typename I, typename A, typename B, typename C, typename U>
+rocsparse_status rocsparse_ellmm_template_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_order           order,
+                                                   I                         m,
+                                                   I                         n,
+                                                   I                         k,
+                                                   I                         ell_width,
+                                                   I                         batch_count_A,
+                                                   I                         batch_stride_A,
+                                                   U                         alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const A*                  ell_val,
+                                                   const I*                  ell_col_ind,
+                                                   const B*                  dense_B,
+                                                   I                         ldb,
+                                                   I                         batch_count_B,
+                                                   I                         batch_stride_B,
+                                                   U                         beta_device_host,
+                                                   C*                        dense_C,
+                                                   I                         ldc,
+                                                   I                         batch_count_C,
+                                                   I                         batch_stride_C)
+{
+    const bool conj_A = (trans_A == rocsparse_operation_conjugate_transpose);
+    const bool conj_B = (trans_B == rocsparse_operation_conjugate_transpose);
+
+    // The columns of op(B) are contiguous in memory, if B is stored in row
+    // order and not transposed, or in column order and transposed
+    const bool transB = (order == rocsparse_order_row) == (trans_B == rocsparse_operation_none);
+
+    // A matrix that is shared by all batches has a zero stride
+    if(batch_count_A == 1)
+    {
+        batch_stride_A = 0;
+    }
+
+    if(batch_count_B == 1)
+    {
+        batch_stride_B = 0;
+    }
+
+    if(trans_A == rocsparse_operation_none)
+    {
+        if(transB)
+        {
+            LAUNCH_ELLMMNN_KERNEL(true);
+        }
+        else
+        {
+            LAUNCH_ELLMMNN_KERNEL(false);
+        }
+    }
+    else
+    {
+        // C is k x n, scale it with beta before accumulating alpha * op(A) * op(B)
+        hipLaunchKernelGGL((ellmm_scale_kernel<256, T>),
+                           dim3((static_cast<int64_t>(k) * n - 1) / 256 + 1, batch_count_C),
+                           dim3(256),
+                           0,
+                           handle->stream,
+                           k,
+                           n,
+                           beta_device_host,
+                           dense_C,
+                           ldc,
+                           batch_stride_C,
+                           order);
+
+        if(transB)
+        {
+            LAUNCH_ELLMMTN_KERNEL(true);
+        }
+        else
+        {
+            LAUNCH_ELLMMTN_KERNEL(false);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_ELLMMTN_KERNEL
+#undef ELLMMTN_DIM
+#undef LAUNCH_ELLMMNN_KERNEL
+#undef ELLMMNN_DIM
+
+template <typename T, typename I, typename A, typename B, typename C>
+rocsparse_status rocsparse_ellmm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_order           order_B,
+                                          rocsparse_order           order_C,
+                                          I                         m,
+                                          I                         n,
+                                          I                         k,
+                                          I                         ell_width,
+                                          I                         batch_count_A,
+                                          I                         batch_stride_A,
+                                          const T*                  alpha_device_host,
+                                          const rocsparse_mat_descr descr,
+                                          const A*                  ell_val,
+                                          const I*                  ell_col_ind,
+                                          const B*                  dense_B,
+                                          I                         ldb,
+                                          I                         batch_count_B,
+                                          I                         batch_stride_B,
+                                          const T*                  beta_device_host,
+                                          C*                        dense_C,
+                                          I                         ldc,
+                                          I                         batch_count_C,
+                                          I                         batch_stride_C)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xellmm"),
+              trans_A,
+              trans_B,
+              order_B,
+              order_C,
+              m,
+              n,
+              k,
+              ell_width,
+              batch_count_A,
+              batch_stride_A,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)ell_val,
+              (const void*&)ell_col_ind,
+              (const void*&)dense_B,
+              ldb,
+              batch_count_B,
+              batch_stride_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)dense_C,
+              ldc,
+              batch_count_C,
+              batch_stride_C);
+
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(order_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(order_C))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(order_B != order_C)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || k < 0 || ell_width < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(dense_B == nullptr || dense_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All must be null (zero matrix) or none null
+    if(!(ell_val == nullptr && ell_col_ind == nullptr)
+       && !(ell_val != nullptr && ell_col_ind != nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(ell_width != 0 && (ell_val == nullptr && ell_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimension of matrices
+    static constexpr I s_one = static_cast<I>(1);
+
+    // Number of rows of op(B) and C
+    const I nrow_B = (trans_A == rocsparse_operation_none) ? k : m;
+    const I nrow_C = (trans_A == rocsparse_operation_none) ? m : k;
+
+    if(ldc < std::max(s_one, ((order_C == rocsparse_order_column) ? nrow_C : n)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    switch(trans_B)
+    {
+    case rocsparse_operation_none:
+    {
+        if(ldb < std::max(s_one, ((order_B == rocsparse_order_column) ? nrow_B : n)))
+        {
+            return rocsparse_status_invalid_size;
+        }
+        break;
+    }
+    case rocsparse_operation_transpose:
+    case rocsparse_operation_conjugate_transpose:
+    {
+        if(ldb < std::max(s_one, ((order_B == rocsparse_order_column) ? n : nrow_B)))
+        {
+            return rocsparse_status_invalid_size;
+        }
+        break;
+    }
+    }
+
+    // Check batch parameters of matrices
+    bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
+    bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
+    bool Ci_Ai_Bi = (batch_count_A == batch_count_C && batch_count_A == batch_count_B);
+
+    if(!Ci_A_Bi && !Ci_Ai_B && !Ci_Ai_Bi)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_ellmm_template_dispatch<T>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    order_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    ell_width,
+                                                    batch_count_A,
+                                                    batch_stride_A,
+                                                    alpha_device_host,
+                                                    descr,
+                                                    ell_val,
+                                                    ell_col_ind,
+                                                    dense_B,
+                                                    ldb,
+                                                    batch_count_B,
+                                                    batch_stride_B,
+                                                    beta_device_host,
+                                                    dense_C,
+                                                    ldc,
+                                                    batch_count_C,
+                                                    batch_stride_C);
+    }
+    else
+    {
+        return rocsparse_ellmm_template_dispatch<T>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    order_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    ell_width,
+                                                    batch_count_A,
+                                                    batch_stride_A,
+                                                    *alpha_device_host,
+                                                    descr,
+                                                    ell_val,
+                                                    ell_col_ind,
+                                                    dense_B,
+                                                    ldb,
+                                                    batch_count_B,
+                                                    batch_stride_B,
+                                                    *beta_device_host,
+                                                    dense_C,
+                                                    ldc,
+                                                    batch_count_C,
+                                                    batch_stride_C);
+    }
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, ATYPE, BTYPE, CTYPE)                                              \
+    template rocsparse_status rocsparse_ellmm_template(rocsparse_handle          handle,            \
+                                                       rocsparse_operation       trans_A,           \
+                                                       rocsparse_operation       trans_B,           \
+                                                       rocsparse_order           order_B,           \
+                                                       rocsparse_order           order_C,           \
+                                                       ITYPE                     m,                 \
+                                                       ITYPE                     n,                 \
+                                                       ITYPE                     k,                 \
+                                                       ITYPE                     ell_width,         \
+                                                       ITYPE                     batch_count_A,     \
+                                                       ITYPE                     batch_stride_A,    \
+                                                       const TTYPE*              alpha_device_host, \
+                                                       const rocsparse_mat_descr descr,             \
+                                                       const ATYPE*              ell_val,           \
+                                                       const ITYPE*              ell_col_ind,       \
+                                                       const BTYPE*              B,                 \
+                                                       ITYPE                     ldb,               \
+                                                       ITYPE                     batch_count_B,     \
+                                                       ITYPE                     batch_stride_B,    \
+                                                       const TTYPE*              beta_device_host,  \
+                                                       CTYPE*                    C,                 \
+                                                       ITYPE                     ldc,               \
+                                                       ITYPE                     batch_count_C,     \
+                                                       ITYPE                     batch_stride_C);
+
+// Uniform precisions
+INSTANTIATE(float, int32_t, float, float, float);
+INSTANTIATE(float, int64_t, float, float, float);
+INSTANTIATE(double, int32_t, double, double, double);
+INSTANTIATE(double, int64_t, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+// Mixed precisions
+INSTANTIATE(int32_t, int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int32_t, int8_t, int8_t, float);
+INSTANTIATE(float, int64_t, int8_t, int8_t, float);
+INSTANTIATE(float, int32_t, _Float16, float, float);
+INSTANTIATE(float, int64_t, _Float16, float, float);
+INSTANTIATE(float, int32_t, hip_bfloat16, float, float);
+INSTANTIATE(float, int64_t, hip_bfloat16, float, float);
+#undef INSTANTIATE
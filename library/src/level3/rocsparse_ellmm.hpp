@@ -0,0 +1,53 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+template <typename T, typename I, typename A, typename B, typename C>
+rocsparse_status rocsparse_ellmm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_order           order_B,
+                                          rocsparse_order           order_C,
+                                          I                         m,
+                                          I                         n,
+                                          I                         k,
+                                          I                         ell_width,
+                                          I                         batch_count_A,
+                                          I                         batch_stride_A,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const A*                  ell_val,
+                                          const I*                  ell_col_ind,
+                                          const B*                  dense_B,
+                                          I                         ldb,
+                                          I                         batch_count_B,
+                                          I                         batch_stride_B,
+                                          const T*                  beta,
+                                          C*                        dense_C,
+                                          I                         ldc,
+                                          I                         batch_count_C,
+                                          I                         batch_stride_C);
@@ -160,6 +160,8 @@ rocsparse_status rocsparse_sddmm_buffer_size_dispatch(rocsparse_format    format
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -395,6 +397,8 @@ rocsparse_status rocsparse_sddmm_preprocess_dispatch(rocsparse_format    format,
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -633,6 +637,8 @@ rocsparse_status rocsparse_sddmm_dispatch(rocsparse_format    format,
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
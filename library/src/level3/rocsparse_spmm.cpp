@@ -27,9 +27,11 @@
 #include "utility.h"
 
 #include "rocsparse_bellmm.hpp"
+#include "rocsparse_bsrmm.hpp"
 #include "rocsparse_coomm.hpp"
 #include "rocsparse_cscmm.hpp"
 #include "rocsparse_csrmm.hpp"
+#include "rocsparse_ellmm.hpp"
 
 rocsparse_status rocsparse_spmm_alg2bellmm_alg(rocsparse_spmm_alg    spmm_alg,
                                                rocsparse_bellmm_alg& bellmm_alg)
@@ -437,6 +439,12 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
 
     case rocsparse_format_bell:
     {
+        // Blocked ELL only supports uniform precision
+        if(!std::is_same<A, T>())
+        {
+            return rocsparse_status_not_implemented;
+        }
+
         rocsparse_bellmm_alg bellmm_alg;
         RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmm_alg2bellmm_alg(alg, bellmm_alg)));
 
@@ -564,9 +572,209 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
         break;
     }
 
-    case rocsparse_format_coo_aos:
     case rocsparse_format_ell:
+    {
+        if(alg != rocsparse_spmm_alg_default)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        const I m = (I)mat_A->rows;
+        const I n = (I)mat_C->cols;
+        const I k = (I)mat_A->cols;
+
+        switch(stage)
+        {
+        case rocsparse_spmm_stage_buffer_size:
+        {
+            RETURN_IF_NULLPTR(buffer_size);
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmm_stage_preprocess:
+        {
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmm_stage_compute:
+        {
+            return rocsparse_ellmm_template(handle,
+                                            trans_A,
+                                            trans_B,
+                                            mat_B->order,
+                                            mat_C->order,
+                                            m,
+                                            n,
+                                            k,
+                                            (I)mat_A->ell_width,
+                                            (I)mat_A->batch_count,
+                                            (I)mat_A->batch_stride,
+                                            (const T*)alpha,
+                                            mat_A->descr,
+                                            (const A*)mat_A->const_val_data,
+                                            (const I*)mat_A->const_col_data,
+                                            (const B*)mat_B->const_values,
+                                            (I)mat_B->ld,
+                                            (I)mat_B->batch_count,
+                                            (I)mat_B->batch_stride,
+                                            (const T*)beta,
+                                            (C*)mat_C->values,
+                                            (I)mat_C->ld,
+                                            (I)mat_C->batch_count,
+                                            (I)mat_C->batch_stride);
+        }
+
+        case rocsparse_spmm_stage_auto:
+        {
+            return rocsparse_spmm_template_auto<T, I, J, A, B, C>(handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  alpha,
+                                                                  mat_A,
+                                                                  mat_B,
+                                                                  beta,
+                                                                  mat_C,
+                                                                  alg,
+                                                                  buffer_size,
+                                                                  temp_buffer);
+        }
+        }
+    }
+
     case rocsparse_format_bsr:
+    {
+        // BSR only supports uniform precision and rocsparse_int indices
+        if(!std::is_same<A, T>() || !std::is_same<I, rocsparse_int>()
+           || !std::is_same<J, rocsparse_int>())
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        if(alg != rocsparse_spmm_alg_default && alg != rocsparse_spmm_alg_bsr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        // bsrmm only operates on a single sparse matrix and column ordered C
+        if(mat_A->batch_count > 1 || mat_C->order != rocsparse_order_column)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // B in row order is the transpose of B in column order
+        rocsparse_operation trans_B_col = trans_B;
+        if(mat_B->order == rocsparse_order_row)
+        {
+            switch(trans_B)
+            {
+            case rocsparse_operation_none:
+            {
+                trans_B_col = rocsparse_operation_transpose;
+                break;
+            }
+            case rocsparse_operation_transpose:
+            {
+                trans_B_col = rocsparse_operation_none;
+                break;
+            }
+            case rocsparse_operation_conjugate_transpose:
+            {
+                return rocsparse_status_not_implemented;
+            }
+            }
+        }
+
+        const rocsparse_int mb        = (rocsparse_int)mat_A->rows;
+        const rocsparse_int n         = (rocsparse_int)mat_C->cols;
+        const rocsparse_int kb        = (rocsparse_int)mat_A->cols;
+        const rocsparse_int nnzb      = (rocsparse_int)mat_A->nnz;
+        const rocsparse_int block_dim = (rocsparse_int)mat_A->block_dim;
+
+        switch(stage)
+        {
+        case rocsparse_spmm_stage_buffer_size:
+        {
+            RETURN_IF_NULLPTR(buffer_size);
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmm_stage_preprocess:
+        {
+            rocsparse_bsrmm_alg bsrmm_alg;
+            return rocsparse_bsrmm_analysis_template(handle,
+                                                     mat_A->block_dir,
+                                                     trans_A,
+                                                     trans_B_col,
+                                                     mb,
+                                                     n,
+                                                     kb,
+                                                     nnzb,
+                                                     mat_A->descr,
+                                                     (const T*)mat_A->const_val_data,
+                                                     (const rocsparse_int*)mat_A->const_row_data,
+                                                     (const rocsparse_int*)mat_A->const_col_data,
+                                                     block_dim,
+                                                     &bsrmm_alg);
+        }
+
+        case rocsparse_spmm_stage_compute:
+        {
+            // Batches of B and C share the sparse matrix
+            const rocsparse_int batch_count_C = (rocsparse_int)mat_C->batch_count;
+            if(mat_B->batch_count != mat_C->batch_count && mat_B->batch_count != 1)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            const int64_t batch_stride_B = (mat_B->batch_count == 1) ? 0 : mat_B->batch_stride;
+
+            for(rocsparse_int batch = 0; batch < batch_count_C; ++batch)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_bsrmm_template(
+                    handle,
+                    mat_A->block_dir,
+                    trans_A,
+                    trans_B_col,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    (const T*)alpha,
+                    mat_A->descr,
+                    (const T*)mat_A->const_val_data,
+                    (const rocsparse_int*)mat_A->const_row_data,
+                    (const rocsparse_int*)mat_A->const_col_data,
+                    block_dim,
+                    (const T*)mat_B->const_values + batch_stride_B * batch,
+                    (rocsparse_int)mat_B->ld,
+                    (const T*)beta,
+                    (T*)mat_C->values + mat_C->batch_stride * batch,
+                    (rocsparse_int)mat_C->ld));
+            }
+
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmm_stage_auto:
+        {
+            return rocsparse_spmm_template_auto<T, I, J, A, B, C>(handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  alpha,
+                                                                  mat_A,
+                                                                  mat_B,
+                                                                  beta,
+                                                                  mat_C,
+                                                                  alg,
+                                                                  buffer_size,
+                                                                  temp_buffer);
+        }
+        }
+    }
+
+    case rocsparse_format_coo_aos:
     {
         return rocsparse_status_not_implemented;
     }
@@ -642,6 +850,54 @@ rocsparse_status rocsparse_spmm_template_auto(rocsparse_handle            handle
     }
 }
 
+template <typename A, typename... Ts>
+static inline rocsparse_status rocsparse_spmm_mixed_dispatch(rocsparse_indextype itype,
+                                                             rocsparse_indextype jtype,
+                                                             Ts&&... ts)
+{
+    switch(itype)
+    {
+    case rocsparse_indextype_u16:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    case rocsparse_indextype_i32:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_spmm_template<float, int32_t, int32_t, A, float, float>(ts...);
+        }
+        }
+    }
+    case rocsparse_indextype_i64:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_spmm_template<float, int64_t, int32_t, A, float, float>(ts...);
+        }
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_spmm_template<float, int64_t, int64_t, A, float, float>(ts...);
+        }
+        }
+    }
+    }
+    return rocsparse_status_not_implemented;
+}
+
 template <typename... Ts>
 static inline rocsparse_status rocsparse_spmm_dynamic_dispatch(rocsparse_indextype itype,
                                                                rocsparse_indextype jtype,
@@ -651,7 +907,6 @@ static inline rocsparse_status rocsparse_spmm_dynamic_dispatch(rocsparse_indexty
                                                                rocsparse_datatype  compute_type,
                                                                Ts&&... ts)
 {
-    assert(compute_type == atype);
     assert(compute_type == btype);
     assert(compute_type == ctype);
 
@@ -659,6 +914,24 @@ static inline rocsparse_status rocsparse_spmm_dynamic_dispatch(rocsparse_indexty
     {
     case rocsparse_datatype_f32_r:
     {
+        // Half precision sparse matrix, single precision dense matrices and computation
+        switch(atype)
+        {
+        case rocsparse_datatype_f16_r:
+        {
+            return rocsparse_spmm_mixed_dispatch<_Float16>(itype, jtype, ts...);
+        }
+        case rocsparse_datatype_bf16_r:
+        {
+            return rocsparse_spmm_mixed_dispatch<hip_bfloat16>(itype, jtype, ts...);
+        }
+        default:
+        {
+            assert(compute_type == atype);
+            break;
+        }
+        }
+
         switch(itype)
         {
         case rocsparse_indextype_u16:
@@ -866,6 +1139,8 @@ static inline rocsparse_status rocsparse_spmm_dynamic_dispatch(rocsparse_indexty
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -952,6 +1227,13 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling, the size of the temporary buffer is known once it is provided
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_spmm", compute_type);
+    if(buffer_size != nullptr && temp_buffer != nullptr)
+    {
+        log_profile_buffer(handle, *buffer_size);
+    }
+
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(mat_A);
     RETURN_IF_NULLPTR(mat_B);
@@ -992,13 +1274,32 @@ try
         return rocsparse_status_not_initialized;
     }
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
+    // Check for matching types, the only supported mixed precision computation is
+    // a half precision sparse matrix with single precision dense matrices
+    const bool half_A = (compute_type == rocsparse_datatype_f32_r)
+                        && (mat_A->data_type == rocsparse_datatype_f16_r
+                            || mat_A->data_type == rocsparse_datatype_bf16_r);
+
+    if((compute_type != mat_A->data_type && !half_A) || compute_type != mat_B->data_type
        || compute_type != mat_C->data_type)
     {
         return rocsparse_status_not_implemented;
     }
 
+    // Batched SpMM requires the values of A to share the batch stride of its indices
+    if(mat_A->batch_count > 1)
+    {
+        const int64_t indices_batch_stride
+            = (mat_A->format == rocsparse_format_csr || mat_A->format == rocsparse_format_csc)
+                  ? mat_A->columns_values_batch_stride
+                  : mat_A->batch_stride;
+
+        if(mat_A->values_batch_stride != indices_batch_stride)
+        {
+            return rocsparse_status_not_implemented;
+        }
+    }
+
     return rocsparse_spmm_dynamic_dispatch(determine_I_index_type(mat_A),
                                            determine_J_index_type(mat_A),
                                            mat_A->data_type,
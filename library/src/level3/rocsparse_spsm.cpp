@@ -26,6 +26,7 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "rocsparse_bsrsm.hpp"
 #include "rocsparse_coosm.hpp"
 #include "rocsparse_csrsm.hpp"
 
@@ -42,6 +43,13 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                                          size_t*                     buffer_size,
                                          void*                       temp_buffer)
 {
+    // BSR triangular solve only supports rocsparse_int indices
+    if(matA->format == rocsparse_format_bsr
+       && (!std::is_same<I, rocsparse_int>() || !std::is_same<J, rocsparse_int>()))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // STAGE 1 - compute required buffer size of temp_buffer
     if(stage == rocsparse_spsm_stage_buffer_size
        || (stage == rocsparse_spsm_stage_auto && temp_buffer == nullptr))
@@ -92,6 +100,28 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
+        else if(matA->format == rocsparse_format_bsr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_bsrsm_buffer_size_template(
+                handle,
+                matA->block_dir,
+                trans_A,
+                trans_B,
+                (rocsparse_int)matA->rows,
+                (trans_B == rocsparse_operation_none ? (rocsparse_int)matB->cols
+                                                     : (rocsparse_int)matB->rows),
+                (rocsparse_int)matA->nnz,
+                matA->descr,
+                (const T*)matA->const_val_data,
+                (const rocsparse_int*)matA->const_row_data,
+                (const rocsparse_int*)matA->const_col_data,
+                (rocsparse_int)matA->block_dim,
+                matA->info,
+                buffer_size));
+
+            *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
+            return rocsparse_status_success;
+        }
         else
         {
             return rocsparse_status_not_implemented;
@@ -146,6 +176,27 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                     rocsparse_solve_policy_auto,
                     temp_buffer)));
             }
+            else if(matA->format == rocsparse_format_bsr)
+            {
+                RETURN_IF_ROCSPARSE_ERROR((rocsparse_bsrsm_analysis_template(
+                    handle,
+                    matA->block_dir,
+                    trans_A,
+                    trans_B,
+                    (rocsparse_int)matA->rows,
+                    (trans_B == rocsparse_operation_none ? (rocsparse_int)matB->cols
+                                                         : (rocsparse_int)matB->rows),
+                    (rocsparse_int)matA->nnz,
+                    matA->descr,
+                    (const T*)matA->const_val_data,
+                    (const rocsparse_int*)matA->const_row_data,
+                    (const rocsparse_int*)matA->const_col_data,
+                    (rocsparse_int)matA->block_dim,
+                    matA->info,
+                    rocsparse_analysis_policy_force,
+                    rocsparse_solve_policy_auto,
+                    temp_buffer)));
+            }
             else
             {
                 return rocsparse_status_not_implemented;
@@ -160,6 +211,33 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
     // STAGE 3 - perform SpSM computation
     if(stage == rocsparse_spsm_stage_compute || stage == rocsparse_spsm_stage_auto)
     {
+        // bsrsm reads B and writes the solution to C, no copy required
+        if(matA->format == rocsparse_format_bsr)
+        {
+            return rocsparse_bsrsm_solve_template(
+                handle,
+                matA->block_dir,
+                trans_A,
+                trans_B,
+                (rocsparse_int)matA->rows,
+                (trans_B == rocsparse_operation_none ? (rocsparse_int)matB->cols
+                                                     : (rocsparse_int)matB->rows),
+                (rocsparse_int)matA->nnz,
+                (const T*)alpha,
+                matA->descr,
+                (const T*)matA->const_val_data,
+                (const rocsparse_int*)matA->const_row_data,
+                (const rocsparse_int*)matA->const_col_data,
+                (rocsparse_int)matA->block_dim,
+                matA->info,
+                (const T*)matB->const_values,
+                (rocsparse_int)matB->ld,
+                (T*)matC->values,
+                (rocsparse_int)matC->ld,
+                rocsparse_solve_policy_auto,
+                temp_buffer);
+        }
+
         // copy B to C and perform in-place using C
         if(matB->rows > 0 && matB->cols > 0)
         {
@@ -289,6 +367,8 @@ rocsparse_status rocsparse_spsm_dynamic_dispatch(rocsparse_indextype itype,
     case rocsparse_datatype_u8_r:
     case rocsparse_datatype_i32_r:
     case rocsparse_datatype_u32_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return rocsparse_status_not_implemented;
     }
@@ -338,6 +418,9 @@ try
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_spsm", compute_type);
+
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(matA);
     RETURN_IF_NULLPTR(matB);
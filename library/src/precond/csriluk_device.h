@@ -0,0 +1,610 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "../extra/csrgemm_device.h"
+
+// Hash operation to insert a column together with its level of fill into the hash
+// table. If the column is already present, the minimum of both levels is kept.
+template <unsigned int HASHVAL, unsigned int HASHSIZE, typename J>
+ROCSPARSE_DEVICE_ILF void
+    csriluk_insert_level(J key, J lev, J* __restrict__ table, J* __restrict__ level, J empty)
+{
+    // Compute hash
+    J hash = (key * HASHVAL) & (HASHSIZE - 1);
+
+    // Loop until key has been inserted
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            // Element already present, keep the lower level of fill
+            atomicMin(&level[hash], lev);
+            break;
+        }
+        else if(table[hash] == empty)
+        {
+            // If empty, add element with atomic
+            if(atomicCAS(&table[hash], empty, key) == empty)
+            {
+                atomicMin(&level[hash], lev);
+                break;
+            }
+        }
+        else
+        {
+            // Linear probing, when hash is collided, try next entry
+            hash = (hash + 1) & (HASHSIZE - 1);
+        }
+    }
+}
+
+// Hash operations of the global memory hash tables, with a runtime hash table size
+template <unsigned int HASHVAL, typename J>
+ROCSPARSE_DEVICE_ILF bool csriluk_insert_key_global(J key, J* __restrict__ table, J hashsize)
+{
+    // Compute hash
+    J hash = (key * HASHVAL) & (hashsize - 1);
+
+    // Loop until key has been inserted
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            // Element already present
+            return false;
+        }
+        else if(table[hash] == -1)
+        {
+            // If empty, add element with atomic
+            if(atomicCAS(&table[hash], -1, key) == -1)
+            {
+                return true;
+            }
+        }
+        else
+        {
+            // Linear probing, when hash is collided, try next entry
+            hash = (hash + 1) & (hashsize - 1);
+        }
+    }
+
+    return false;
+}
+
+template <unsigned int HASHVAL, typename J>
+ROCSPARSE_DEVICE_ILF void csriluk_insert_level_global(
+    J key, J lev, J* __restrict__ table, J* __restrict__ level, J empty, J hashsize)
+{
+    // Compute hash
+    J hash = (key * HASHVAL) & (hashsize - 1);
+
+    // Loop until key has been inserted
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            // Element already present, keep the lower level of fill
+            atomicMin(&level[hash], lev);
+            break;
+        }
+        else if(table[hash] == empty)
+        {
+            // If empty, add element with atomic
+            if(atomicCAS(&table[hash], empty, key) == empty)
+            {
+                atomicMin(&level[hash], lev);
+                break;
+            }
+        }
+        else
+        {
+            // Linear probing, when hash is collided, try next entry
+            hash = (hash + 1) & (hashsize - 1);
+        }
+    }
+}
+
+// Compute an upper bound of the row nnz of the next level of fill pass, which is the
+// row nnz of the current pattern plus the nnz of all rows referenced by its lower part
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csriluk_max_row_nnz(J m,
+                         const J* __restrict__ csr_row_ptr,
+                         const J* __restrict__ csr_col_ind,
+                         J* __restrict__ max_nnz,
+                         rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    J   row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ J sdata[BLOCKSIZE];
+
+    J nnz = 0;
+
+    if(row < m)
+    {
+        J row_begin = csr_row_ptr[row] - idx_base;
+        J row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        nnz = row_end - row_begin;
+
+        // Rows are sorted, thus the lower part is stored first
+        for(J j = row_begin; j < row_end; ++j)
+        {
+            J col = csr_col_ind[j] - idx_base;
+
+            if(col >= row)
+            {
+                break;
+            }
+
+            nnz += csr_row_ptr[col + 1] - csr_row_ptr[col];
+        }
+
+        // A row cannot hold more than m entries
+        nnz = min(nnz, m);
+    }
+
+    sdata[tid] = nnz;
+    __syncthreads();
+
+    rocsparse_blockreduce_max<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicMax(max_nnz, sdata[0]);
+    }
+}
+
+// Level of fill pass, where each row is processed by WFSIZE threads. The pattern of row
+// i is merged with the upper parts of all rows k < i referenced by its lower part, where
+// entry (i, j) is kept, if lev(i, j) = lev(i, k) + lev(k, j) + 1 does not exceed level.
+// If FILL is false, only the row nnz are computed and stored in lu_row_ptr[i]. If FILL
+// is true, the sum of all levels of fill is accumulated into lev_sum.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          bool         FILL,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csriluk_symbolic_pass(J m,
+                           J level,
+                           const J* __restrict__ csr_row_ptr,
+                           const J* __restrict__ csr_col_ind,
+                           const J* __restrict__ csr_lev,
+                           J* __restrict__ lu_row_ptr,
+                           J* __restrict__ lu_col_ind,
+                           J* __restrict__ lu_lev,
+                           int64_t* __restrict__ lev_sum,
+                           rocsparse_index_base idx_base)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Group id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each group of WFSIZE threads processes a row
+    J row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Hash table in shared memory, levels of fill are only required when filling
+    __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
+    __shared__ J slev[FILL ? BLOCKSIZE / WFSIZE * HASHSIZE : 1];
+    __shared__ J snnz[BLOCKSIZE / WFSIZE];
+
+    // Local hash table
+    J* table = &stable[wid * HASHSIZE];
+    J* lev   = &slev[FILL ? wid * HASHSIZE : 0];
+
+    // Initialize hash table, insert_key requires -1 to mark empty entries while
+    // filling uses m, such that empty entries are sorted last
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        table[i] = FILL ? m : -1;
+
+        if(FILL)
+        {
+            lev[i] = level;
+        }
+    }
+
+    if(lid == 0)
+    {
+        snnz[wid] = 0;
+    }
+
+    __syncthreads();
+
+    if(row < m)
+    {
+        J row_begin = csr_row_ptr[row] - idx_base;
+        J row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Loop over the entries of the current row
+        for(J j = row_begin + lid; j < row_end; j += WFSIZE)
+        {
+            J col    = csr_col_ind[j] - idx_base;
+            J lev_ik = (csr_lev != nullptr) ? csr_lev[j] : 0;
+
+            if(FILL)
+            {
+                csriluk_insert_level<HASHVAL, HASHSIZE>(col, lev_ik, table, lev, m);
+            }
+            else if(insert_key<HASHVAL, HASHSIZE>(col, table))
+            {
+                atomicAdd(&snnz[wid], 1);
+            }
+
+            // Only the lower part, with a level that can still produce fill-in, is
+            // combined with the upper part of the referenced row
+            if(col >= row || lev_ik >= level)
+            {
+                continue;
+            }
+
+            J row_begin_k = csr_row_ptr[col] - idx_base;
+            J row_end_k   = csr_row_ptr[col + 1] - idx_base;
+
+            for(J k = row_begin_k; k < row_end_k; ++k)
+            {
+                J col_k = csr_col_ind[k] - idx_base;
+
+                if(col_k <= col)
+                {
+                    continue;
+                }
+
+                J lev_ij = lev_ik + ((csr_lev != nullptr) ? csr_lev[k] : 0) + 1;
+
+                if(lev_ij > level)
+                {
+                    continue;
+                }
+
+                if(FILL)
+                {
+                    csriluk_insert_level<HASHVAL, HASHSIZE>(col_k, lev_ij, table, lev, m);
+                }
+                else if(insert_key<HASHVAL, HASHSIZE>(col_k, table))
+                {
+                    atomicAdd(&snnz[wid], 1);
+                }
+            }
+        }
+    }
+
+    __syncthreads();
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(!FILL)
+    {
+        // Write row nnz to global memory
+        if(lid == 0)
+        {
+            lu_row_ptr[row] = snnz[wid];
+        }
+
+        return;
+    }
+
+    // Entry point of current row
+    J row_begin_lu = lu_row_ptr[row] - idx_base;
+
+    // Sum of the levels of fill written by this thread
+    int64_t sum = 0;
+
+    // Loop over hash table
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        J col = table[i];
+
+        // Skip hash table entry if not present
+        if(col >= m)
+        {
+            continue;
+        }
+
+        // The (sorted) position of the column is given by the number of smaller
+        // columns in the hash table
+        J idx = row_begin_lu;
+
+        for(unsigned int h = 0; h < HASHSIZE; ++h)
+        {
+            if(col > table[h])
+            {
+                ++idx;
+            }
+        }
+
+        lu_col_ind[idx] = col + idx_base;
+        lu_lev[idx]     = lev[i];
+
+        sum += lev[i];
+    }
+
+    if(sum > 0)
+    {
+        atomicAdd(lev_sum, sum);
+    }
+}
+
+// Level of fill pass for rows that exceed the shared memory hash tables. Each block
+// processes a row at a time in a hash table of hashsize entries in global memory, and
+// the blocks stride over the rows. The wavefronts of a block process the entries of the
+// row, their lanes the upper part of the referenced row. When filling, the entries are
+// gathered into the row of the factors first and then sorted by their rank, using the
+// hash table as scratch space.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHVAL,
+          bool         FILL,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csriluk_symbolic_pass_global(J m,
+                                  J level,
+                                  J hashsize,
+                                  const J* __restrict__ csr_row_ptr,
+                                  const J* __restrict__ csr_col_ind,
+                                  const J* __restrict__ csr_lev,
+                                  J* __restrict__ lu_row_ptr,
+                                  J* __restrict__ lu_col_ind,
+                                  J* __restrict__ lu_lev,
+                                  J* __restrict__ workspace,
+                                  int64_t* __restrict__ lev_sum,
+                                  rocsparse_index_base idx_base)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Hash table of this block, followed by the levels of fill when filling
+    J* table = &workspace[hipBlockIdx_x * (FILL ? 2 : 1) * hashsize];
+    J* lev   = &table[hashsize];
+
+    __shared__ J snnz;
+
+    // Sum of the levels of fill written by this thread
+    int64_t sum = 0;
+
+    for(J row = hipBlockIdx_x; row < m; row += hipGridDim_x)
+    {
+        // Initialize hash table, see csriluk_symbolic_pass
+        for(J i = hipThreadIdx_x; i < hashsize; i += BLOCKSIZE)
+        {
+            table[i] = FILL ? m : -1;
+
+            if(FILL)
+            {
+                lev[i] = level;
+            }
+        }
+
+        if(hipThreadIdx_x == 0)
+        {
+            snnz = 0;
+        }
+
+        __syncthreads();
+
+        J row_begin = csr_row_ptr[row] - idx_base;
+        J row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Loop over the entries of the current row
+        for(J j = row_begin + wid; j < row_end; j += BLOCKSIZE / WFSIZE)
+        {
+            J col    = csr_col_ind[j] - idx_base;
+            J lev_ik = (csr_lev != nullptr) ? csr_lev[j] : 0;
+
+            if(lid == 0)
+            {
+                if(FILL)
+                {
+                    csriluk_insert_level_global<HASHVAL>(col, lev_ik, table, lev, m, hashsize);
+                }
+                else if(csriluk_insert_key_global<HASHVAL>(col, table, hashsize))
+                {
+                    atomicAdd(&snnz, 1);
+                }
+            }
+
+            if(col >= row || lev_ik >= level)
+            {
+                continue;
+            }
+
+            J row_begin_k = csr_row_ptr[col] - idx_base;
+            J row_end_k   = csr_row_ptr[col + 1] - idx_base;
+
+            for(J k = row_begin_k + lid; k < row_end_k; k += WFSIZE)
+            {
+                J col_k = csr_col_ind[k] - idx_base;
+
+                if(col_k <= col)
+                {
+                    continue;
+                }
+
+                J lev_ij = lev_ik + ((csr_lev != nullptr) ? csr_lev[k] : 0) + 1;
+
+                if(lev_ij > level)
+                {
+                    continue;
+                }
+
+                if(FILL)
+                {
+                    csriluk_insert_level_global<HASHVAL>(col_k, lev_ij, table, lev, m, hashsize);
+                }
+                else if(csriluk_insert_key_global<HASHVAL>(col_k, table, hashsize))
+                {
+                    atomicAdd(&snnz, 1);
+                }
+            }
+        }
+
+        __syncthreads();
+
+        if(!FILL)
+        {
+            // Write row nnz to global memory
+            if(hipThreadIdx_x == 0)
+            {
+                lu_row_ptr[row] = snnz;
+            }
+
+            __syncthreads();
+
+            continue;
+        }
+
+        // Entry point and nnz of current row
+        J row_begin_lu = lu_row_ptr[row] - idx_base;
+        J row_nnz_lu   = lu_row_ptr[row + 1] - lu_row_ptr[row];
+
+        if(hipThreadIdx_x == 0)
+        {
+            snnz = 0;
+        }
+
+        __syncthreads();
+
+        // Gather the entries of the hash table into the row of the factors
+        for(J i = hipThreadIdx_x; i < hashsize; i += BLOCKSIZE)
+        {
+            J col = table[i];
+
+            // Skip hash table entry if not present
+            if(col >= m)
+            {
+                continue;
+            }
+
+            J idx = row_begin_lu + atomicAdd(&snnz, 1);
+
+            lu_col_ind[idx] = col;
+            lu_lev[idx]     = lev[i];
+
+            sum += lev[i];
+        }
+
+        __syncthreads();
+
+        // The (sorted) position of each entry is given by the number of smaller columns
+        for(J j = hipThreadIdx_x; j < row_nnz_lu; j += BLOCKSIZE)
+        {
+            J col = lu_col_ind[row_begin_lu + j];
+            J idx = 0;
+
+            for(J h = 0; h < row_nnz_lu; ++h)
+            {
+                if(col > lu_col_ind[row_begin_lu + h])
+                {
+                    ++idx;
+                }
+            }
+
+            table[idx] = col;
+            lev[idx]   = lu_lev[row_begin_lu + j];
+        }
+
+        __syncthreads();
+
+        for(J j = hipThreadIdx_x; j < row_nnz_lu; j += BLOCKSIZE)
+        {
+            lu_col_ind[row_begin_lu + j] = table[j] + idx_base;
+            lu_lev[row_begin_lu + j]     = lev[j];
+        }
+
+        __syncthreads();
+    }
+
+    if(FILL && sum > 0)
+    {
+        atomicAdd(lev_sum, sum);
+    }
+}
+
+// Scatter the entries of A into the (zero initialized) incomplete LU factors, where
+// each row is processed by WFSIZE threads
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csriluk_scatter(J m,
+                     const J* __restrict__ csr_row_ptr,
+                     const J* __restrict__ csr_col_ind,
+                     const T* __restrict__ csr_val,
+                     const J* __restrict__ lu_row_ptr,
+                     const J* __restrict__ lu_col_ind,
+                     T* __restrict__ lu_val,
+                     rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    J   row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    J row_begin = csr_row_ptr[row] - idx_base;
+    J row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    J row_begin_lu = lu_row_ptr[row] - idx_base;
+    J row_end_lu   = lu_row_ptr[row + 1] - idx_base;
+
+    for(J j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        J col = csr_col_ind[j];
+
+        // Binary search for the column in the sorted row of the factors, which
+        // contains all entries of A
+        J l = row_begin_lu;
+        J r = row_end_lu - 1;
+
+        while(l < r)
+        {
+            J mid = (l + r) >> 1;
+
+            if(lu_col_ind[mid] < col)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        lu_val[l] = csr_val[j];
+    }
+}
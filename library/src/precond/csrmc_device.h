@@ -0,0 +1,361 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_identity(J m, J* __restrict__ identity)
+{
+    const J gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        identity[gid] = gid;
+    }
+}
+
+// Flag colors outside of [0, ncolors), e.g. rows left uncolored by csrcolor
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_check_colors(J m, J ncolors, const J* __restrict__ coloring, J* __restrict__ invalid)
+{
+    const J row = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    const J color = coloring[row];
+
+    if(color < 0 || color >= ncolors)
+    {
+        *invalid = 1;
+    }
+}
+
+// Offsets of the colors into the sorted colors, color_ptr[c] is the position of the
+// first row with color >= c
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_color_ptr(J m, J ncolors, const J* __restrict__ sorted_colors, J* __restrict__ color_ptr)
+{
+    const J c = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(c > ncolors)
+    {
+        return;
+    }
+
+    // Lower bound of c in the sorted colors
+    J l = 0;
+    J r = m;
+
+    while(l < r)
+    {
+        const J mid = l + ((r - l) >> 1);
+
+        if(sorted_colors[mid] < c)
+        {
+            l = mid + 1;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    color_ptr[c] = l;
+}
+
+// Number of entries of each row of the color ordered matrix, shifted by one for the
+// subsequent inclusive scan
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_row_nnz(J m,
+                   const J* __restrict__ csr_row_ptr,
+                   const J* __restrict__ perm,
+                   J* __restrict__ mc_row_ptr,
+                   rocsparse_index_base idx_base)
+{
+    const J row = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(row == 0)
+    {
+        mc_row_ptr[0] = idx_base;
+    }
+
+    const J old_row = perm[row];
+
+    mc_row_ptr[row + 1] = csr_row_ptr[old_row + 1] - csr_row_ptr[old_row];
+}
+
+// Relabel the column indices of each row of the color ordered matrix and record the
+// position of each entry in the original matrix
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_permute_cols(J m,
+                        const J* __restrict__ csr_row_ptr,
+                        const J* __restrict__ csr_col_ind,
+                        const J* __restrict__ perm,
+                        const J* __restrict__ iperm,
+                        const J* __restrict__ mc_row_ptr,
+                        J* __restrict__ mc_col_ind,
+                        J* __restrict__ pos,
+                        rocsparse_index_base idx_base)
+{
+    const J lid = hipThreadIdx_x & (WFSIZE - 1);
+    const J row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    const J old_row = perm[row];
+    const J shift   = (mc_row_ptr[row] - idx_base) - (csr_row_ptr[old_row] - idx_base);
+    const J row_end = csr_row_ptr[old_row + 1] - idx_base;
+
+    for(J k = csr_row_ptr[old_row] - idx_base + lid; k < row_end; k += WFSIZE)
+    {
+        mc_col_ind[k + shift] = iperm[csr_col_ind[k] - idx_base] + idx_base;
+        pos[k + shift]        = k;
+    }
+}
+
+// Position of the diagonal entry of each row with sorted column indices, -1 if the
+// row has no diagonal entry
+template <unsigned int BLOCKSIZE, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmc_diag_ind(J m,
+                    const J* __restrict__ mc_row_ptr,
+                    const J* __restrict__ mc_col_ind,
+                    J* __restrict__ diag_ind,
+                    rocsparse_index_base idx_base)
+{
+    const J row = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    J l = mc_row_ptr[row] - idx_base;
+    J r = mc_row_ptr[row + 1] - idx_base;
+
+    while(l < r)
+    {
+        const J mid = l + ((r - l) >> 1);
+
+        if(mc_col_ind[mid] - idx_base < row)
+        {
+            l = mid + 1;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    const J row_end = mc_row_ptr[row + 1] - idx_base;
+
+    diag_ind[row] = (l < row_end && mc_col_ind[l] - idx_base == row) ? l : -1;
+}
+
+// Incomplete LU factorization of the rows [row_begin, row_begin + nrows) of a single
+// color. Rows of the same color do not couple, such that all entries left of the
+// diagonal refer to rows of previously processed colors.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmcilu0_color(J row_begin,
+                     J nrows,
+                     const J* __restrict__ mc_row_ptr,
+                     const J* __restrict__ mc_col_ind,
+                     T* __restrict__ mc_val,
+                     const J* __restrict__ diag_ind,
+                     J* __restrict__ zero_pivot,
+                     rocsparse_index_base idx_base)
+{
+    const J lid = hipThreadIdx_x & (WFSIZE - 1);
+    const J idx = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    const J row = row_begin + idx;
+
+    // Row entry point
+    const J row_start = mc_row_ptr[row] - idx_base;
+    const J row_end   = mc_row_ptr[row + 1] - idx_base;
+
+    // Structural zero pivot
+    if(diag_ind[row] == -1 && lid == 0)
+    {
+        atomicMin(zero_pivot, row + idx_base);
+    }
+
+    // Loop over the entries left of the diagonal
+    for(J j = row_start; j < row_end; ++j)
+    {
+        // Column index currently being processed
+        const J local_col = mc_col_ind[j] - idx_base;
+
+        if(local_col >= row)
+        {
+            break;
+        }
+
+        // Diagonal entry point of row local_col
+        const J local_diag = diag_ind[local_col];
+
+        // Row local_col has a structural zero pivot, which has been reported before
+        if(local_diag == -1)
+        {
+            break;
+        }
+
+        // Load diagonal entry
+        const T diag_val = mc_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        const T local_val = mc_val[j] / diag_val;
+
+        if(lid == 0)
+        {
+            mc_val[j] = local_val;
+        }
+
+        // Loop over the upper part of row local_col, each lane processes one entry
+        const J local_end = mc_row_ptr[local_col + 1] - idx_base;
+
+        J l = j + 1;
+        for(J k = local_diag + 1 + lid; k < local_end; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            J r     = row_end - 1;
+            J m     = (r + l) >> 1;
+            J col_j = mc_col_ind[m];
+
+            const J col_k = mc_col_ind[k];
+
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = mc_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                mc_val[l] = rocsparse_fma(-local_val, mc_val[k], mc_val[l]);
+            }
+        }
+
+        // Make sure updated mc_val is visible to all lanes
+        __threadfence();
+    }
+}
+
+// Gauss-Seidel relaxation of the rows [row_begin, row_begin + nrows) of a single
+// color, with WFSIZE threads per row. Rows of the same color do not couple, such
+// that all of them can be relaxed at once.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmcgs_color(J row_begin,
+                   J nrows,
+                   const J* __restrict__ mc_row_ptr,
+                   const J* __restrict__ mc_col_ind,
+                   const T* __restrict__ mc_val,
+                   const J* __restrict__ diag_ind,
+                   const T* __restrict__ b,
+                   T* __restrict__ x,
+                   rocsparse_index_base idx_base)
+{
+    const J lid = hipThreadIdx_x & (WFSIZE - 1);
+    const J idx = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    const J row  = row_begin + idx;
+    const J diag = diag_ind[row];
+
+    // Rows without diagonal entry are left untouched
+    if(diag == -1)
+    {
+        return;
+    }
+
+    T       sum     = static_cast<T>(0);
+    const J row_end = mc_row_ptr[row + 1] - idx_base;
+
+    for(J k = mc_row_ptr[row] - idx_base + lid; k < row_end; k += WFSIZE)
+    {
+        if(k != diag)
+        {
+            sum = rocsparse_fma(mc_val[k], x[mc_col_ind[k] - idx_base], sum);
+        }
+    }
+
+    sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
+
+    if(lid == WFSIZE - 1)
+    {
+        x[row] = (b[row] - sum) / mc_val[diag];
+    }
+}
@@ -257,6 +257,101 @@ rocsparse_status rocsparse_nrminf_diff(rocsparse_handle          handle_,
     return rocsparse_status_success;
 }
 
+template <typename T, typename J>
+ROCSPARSE_KERNEL(1)
+void kernel_itilu0_check_convergence(J iter_,
+                                     T tol_,
+                                     T stagnation_nrm_,
+                                     const T* __restrict__ nrm_,
+                                     T* __restrict__ nrm_previous_,
+                                     J* __restrict__ stop_,
+                                     J* __restrict__ niter_)
+{
+    if(stop_[0] != 0)
+    {
+        return;
+    }
+
+    const T nrm          = nrm_[0];
+    const T nrm_previous = nrm_previous_[0];
+    nrm_previous_[0]     = nrm;
+    if(std::isinf(nrm))
+    {
+        stop_[0]  = -1;
+        niter_[0] = iter_ + 1;
+        return;
+    }
+
+    //
+    // Same criteria as the host check, including the stagnation test: nrm_previous_
+    // holds the residual of the preceding sweep, whatever the check interval.
+    //
+    static constexpr T tol_increment = (sizeof(T) == sizeof(float)) ? 1.0e-5 : 1.0e-15;
+    if((nrm <= tol_)
+       || ((iter_ > 3) && (std::abs(nrm - nrm_previous) <= tol_increment * nrm)
+           && (nrm <= stagnation_nrm_)))
+    {
+        stop_[0]  = 1;
+        niter_[0] = iter_ + 1;
+    }
+}
+
+template <typename T, typename J>
+rocsparse_status rocsparse_itilu0_check_convergence(rocsparse_handle handle_,
+                                                    J                iter_,
+                                                    T                tol_,
+                                                    T                stagnation_nrm_,
+                                                    const T*         nrm_,
+                                                    T*               nrm_previous_,
+                                                    J*               stop_,
+                                                    J*               niter_)
+{
+    hipLaunchKernelGGL((kernel_itilu0_check_convergence<T, J>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle_->stream,
+                       iter_,
+                       tol_,
+                       stagnation_nrm_,
+                       nrm_,
+                       nrm_previous_,
+                       stop_,
+                       niter_);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename J>
+ROCSPARSE_KERNEL(1)
+void kernel_itilu0_keep_residual(const T* __restrict__ nrm_,
+                                 T* __restrict__ nrm_previous_,
+                                 const J* __restrict__ stop_)
+{
+    if(stop_[0] != 0)
+    {
+        return;
+    }
+
+    nrm_previous_[0] = nrm_[0];
+}
+
+template <typename T, typename J>
+rocsparse_status rocsparse_itilu0_keep_residual(rocsparse_handle handle_,
+                                                const T*         nrm_,
+                                                T*               nrm_previous_,
+                                                const J*         stop_)
+{
+    hipLaunchKernelGGL((kernel_itilu0_keep_residual<T, J>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle_->stream,
+                       nrm_,
+                       nrm_previous_,
+                       stop_);
+    return rocsparse_status_success;
+}
+
 //
 #define INSTANTIATE(BLOCKSIZE, T, I)                                            \
     template void rocsparse_set_identity_array<BLOCKSIZE, T, I>(                \
@@ -315,3 +410,21 @@ INSTANTIATE(256, rocsparse_float_complex);
 INSTANTIATE(256, rocsparse_double_complex);
 
 #undef INSTANTIATE
+
+#define INSTANTIATE(T, J)                                               \
+    template rocsparse_status rocsparse_itilu0_check_convergence<T, J>( \
+        rocsparse_handle handle_,                                       \
+        J                iter_,                                         \
+        T                tol_,                                          \
+        T                stagnation_nrm_,                               \
+        const T*         nrm_,                                          \
+        T*               nrm_previous_,                                 \
+        J*               stop_,                                         \
+        J*               niter_);                                       \
+    template rocsparse_status rocsparse_itilu0_keep_residual<T, J>(     \
+        rocsparse_handle handle_, const T* nrm_, T* nrm_previous_, const J* stop_)
+
+INSTANTIATE(float, int32_t);
+INSTANTIATE(double, int32_t);
+
+#undef INSTANTIATE
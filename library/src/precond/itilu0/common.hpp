@@ -52,6 +52,32 @@ rocsparse_status rocsparse_nrminf_diff(rocsparse_handle          handle_,
                                        const floating_data_t<T>* nrm0_,
                                        bool                      MX);
 
+//
+// Check the stopping criteria on device from the residual nrm_ of the sweep iter_.
+// On convergence stop_ is set to 1, on a numerical breakdown stop_ is set to -1, and
+// niter_ receives the number of sweeps; further checks are then no-ops. The residual
+// is kept in nrm_previous_ for the next check.
+//
+template <typename T, typename J>
+rocsparse_status rocsparse_itilu0_check_convergence(rocsparse_handle handle_,
+                                                    J                iter_,
+                                                    T                tol_,
+                                                    T                stagnation_nrm_,
+                                                    const T*         nrm_,
+                                                    T*               nrm_previous_,
+                                                    J*               stop_,
+                                                    J*               niter_);
+
+//
+// Keep the residual nrm_ of a sweep preceding a check in nrm_previous_, unless the
+// iteration has already stopped and the sweep did not compute a residual.
+//
+template <typename T, typename J>
+rocsparse_status rocsparse_itilu0_keep_residual(rocsparse_handle handle_,
+                                                const T*         nrm_,
+                                                T*               nrm_previous_,
+                                                const J*         stop_);
+
 //
 // Assign nitems of type T in the buffer.
 //
@@ -0,0 +1,376 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "utility.h"
+
+//
+// One Jacobi sweep on the rows of the factors stored in the pattern of A,
+// with WFSIZE threads per row.
+//
+// LOWER:  z = b - L y, with L strictly lower and unit diagonal,
+//         and if w_ is not null, w = inv(D) z.
+// !LOWER: z = inv(D) (b - U y), with U strictly upper and D the diagonal.
+//
+// A null y_ stands for a zero vector.
+//
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          bool         LOWER,
+          typename T,
+          typename I,
+          typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void kernel_itilu0_jacobi_sweep(J m_,
+                                const I* __restrict__ ptr_,
+                                const J* __restrict__ ind_,
+                                const T* __restrict__ ilu0_,
+                                rocsparse_index_base base_,
+                                const T* __restrict__ b_,
+                                const T* __restrict__ y_,
+                                T* __restrict__ z_,
+                                T* __restrict__ w_)
+{
+    const J lid = hipThreadIdx_x & (WFSIZE - 1);
+    const J i   = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+    if(i >= m_)
+    {
+        return;
+    }
+
+    T       sum  = static_cast<T>(0);
+    T       diag = static_cast<T>(0);
+    const I end  = ptr_[i + 1] - base_;
+    for(I k = (ptr_[i] - base_) + lid; k < end; k += WFSIZE)
+    {
+        const J j = ind_[k] - base_;
+        if(j == i)
+        {
+            diag = ilu0_[k];
+        }
+        else if(y_ != nullptr && (LOWER ? (j < i) : (j > i)))
+        {
+            sum = rocsparse_fma(ilu0_[k], y_[j], sum);
+        }
+    }
+
+    sum  = rocsparse_wfreduce_sum<WFSIZE>(sum);
+    diag = rocsparse_wfreduce_sum<WFSIZE>(diag);
+    if(lid == WFSIZE - 1)
+    {
+        if(LOWER)
+        {
+            const T z = b_[i] - sum;
+            z_[i]     = z;
+            if(w_ != nullptr)
+            {
+                w_[i] = z / diag;
+            }
+        }
+        else
+        {
+            z_[i] = (b_[i] - sum) / diag;
+        }
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          bool         LOWER,
+          typename T,
+          typename I,
+          typename J,
+          typename... P>
+static void kernel_itilu0_jacobi_sweep_launch(J m_, hipStream_t stream_, P... p)
+{
+    dim3 blocks((m_ - 1) / (BLOCKSIZE / WFSIZE) + 1);
+    dim3 threads(BLOCKSIZE);
+    hipLaunchKernelGGL((kernel_itilu0_jacobi_sweep<BLOCKSIZE, WFSIZE, LOWER, T, I, J>),
+                       blocks,
+                       threads,
+                       0,
+                       stream_,
+                       m_,
+                       p...);
+}
+
+template <unsigned int BLOCKSIZE, bool LOWER, typename T, typename I, typename J, typename... P>
+static void kernel_itilu0_jacobi_sweep_dispatch(
+    J m_, I mean_nnz_per_row_, int wavefront_size, hipStream_t stream_, P... p)
+{
+    if(mean_nnz_per_row_ <= 2)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 1, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else if(mean_nnz_per_row_ <= 4)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 2, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else if(mean_nnz_per_row_ <= 8)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 4, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else if(mean_nnz_per_row_ <= 16)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 8, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else if(mean_nnz_per_row_ <= 32)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 16, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else if(mean_nnz_per_row_ <= 64 || wavefront_size == 32)
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 32, LOWER, T, I, J>(m_, stream_, p...);
+    }
+    else
+    {
+        kernel_itilu0_jacobi_sweep_launch<BLOCKSIZE, 64, LOWER, T, I, J>(m_, stream_, p...);
+    }
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csritilu0_apply_template(rocsparse_handle handle_,
+                                                    J                nsweeps_,
+                                                    J                m_,
+                                                    I                nnz_,
+                                                    const I* __restrict__ ptr_,
+                                                    const J* __restrict__ ind_,
+                                                    const T* __restrict__ ilu0_,
+                                                    rocsparse_index_base base_,
+                                                    const T* __restrict__ x_,
+                                                    T* __restrict__ y_)
+{
+    // Quick return if possible
+    if(m_ == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    static constexpr unsigned int BLOCKSIZE = 256;
+    hipStream_t                   stream    = handle_->stream;
+    const I                       mean      = std::max(nnz_ / m_, static_cast<I>(1));
+
+    if(nsweeps_ == 0)
+    {
+        //
+        // y = inv(D) x
+        //
+        kernel_itilu0_jacobi_sweep_dispatch<BLOCKSIZE, false, T, I, J>(
+            m_,
+            mean,
+            handle_->wavefront_size,
+            stream,
+            ptr_,
+            ind_,
+            ilu0_,
+            base_,
+            x_,
+            static_cast<const T*>(nullptr),
+            y_,
+            static_cast<T*>(nullptr));
+        return rocsparse_status_success;
+    }
+
+    //
+    // Two vectors of size m for the iterates.
+    //
+    T*         tmp       = nullptr;
+    const bool tmp_alloc = (handle_->buffer_size < sizeof(T) * m_ * 2);
+    if(tmp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&tmp, sizeof(T) * m_ * 2, stream));
+    }
+    else
+    {
+        tmp = (T*)handle_->buffer;
+    }
+
+    //
+    // The L sweeps end in z, the U sweeps end in y_. The initial guess of the
+    // U sweeps, inv(D) z, is computed by the last L sweep into a vector that
+    // is neither read nor written by that sweep, such that every sweep is a
+    // single kernel without copies.
+    //
+    T* z      = tmp;
+    T* w      = tmp + m_;
+    T* lother = ((nsweeps_ % 2) == 0) ? w : y_;
+    T* seed   = ((nsweeps_ % 2) == 0) ? y_ : w;
+
+    //
+    // Jacobi sweeps on L z = x, starting from z = x.
+    //
+    const T* z_prev = x_;
+    for(J sweep = 0; sweep < nsweeps_; ++sweep)
+    {
+        T* z_next = (((nsweeps_ - 1 - sweep) % 2) == 0) ? z : lother;
+        kernel_itilu0_jacobi_sweep_dispatch<BLOCKSIZE, true, T, I, J>(
+            m_,
+            mean,
+            handle_->wavefront_size,
+            stream,
+            ptr_,
+            ind_,
+            ilu0_,
+            base_,
+            x_,
+            z_prev,
+            z_next,
+            (sweep == nsweeps_ - 1) ? seed : static_cast<T*>(nullptr));
+        z_prev = z_next;
+    }
+
+    //
+    // Jacobi sweeps on U y = z, starting from y = inv(D) z.
+    //
+    const T* y_prev = seed;
+    for(J sweep = 0; sweep < nsweeps_; ++sweep)
+    {
+        T* y_next = (((nsweeps_ - 1 - sweep) % 2) == 0) ? y_ : w;
+        kernel_itilu0_jacobi_sweep_dispatch<BLOCKSIZE, false, T, I, J>(
+            m_,
+            mean,
+            handle_->wavefront_size,
+            stream,
+            ptr_,
+            ind_,
+            ilu0_,
+            base_,
+            static_cast<const T*>(z),
+            y_prev,
+            y_next,
+            static_cast<T*>(nullptr));
+        y_prev = y_next;
+    }
+
+    if(tmp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(tmp, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csritilu0_apply_impl(rocsparse_handle handle_,
+                                                J                nsweeps_,
+                                                J                m_,
+                                                I                nnz_,
+                                                const I* __restrict__ ptr_,
+                                                const J* __restrict__ ind_,
+                                                const T* __restrict__ ilu0_,
+                                                rocsparse_index_base base_,
+                                                const T* __restrict__ x_,
+                                                T* __restrict__ y_)
+{
+    // Check for valid handle
+    if(handle_ == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle_,
+              replaceX<T>("rocsparse_Xcsritilu0_apply"),
+              nsweeps_,
+              m_,
+              nnz_,
+              (const void*&)ptr_,
+              (const void*&)ind_,
+              (const void*&)ilu0_,
+              base_,
+              (const void*&)x_,
+              (const void*&)y_);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsritilu0_apply"), rocsparse_get_datatype<T>(), m_, nnz_);
+
+    if(rocsparse_enum_utils::is_invalid(base_))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(nsweeps_ < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(m_ < 0 || nnz_ < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(m_ > 0 && ptr_ == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_ > 0 && (ind_ == nullptr || ilu0_ == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m_ > 0 && (x_ == nullptr || y_ == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Every row holds its diagonal entry
+    if(nnz_ < m_)
+    {
+        return rocsparse_status_zero_pivot;
+    }
+
+    return rocsparse_csritilu0_apply_template(
+        handle_, nsweeps_, m_, nnz_, ptr_, ind_, ilu0_, base_, x_, y_);
+}
+
+#define IMPL(NAME, T, I, J)                                                 \
+    extern "C" rocsparse_status NAME(rocsparse_handle     handle_,          \
+                                     J                    nsweeps_,         \
+                                     J                    m_,               \
+                                     I                    nnz_,             \
+                                     const I*             ptr_,             \
+                                     const J*             ind_,             \
+                                     const T*             ilu0_,            \
+                                     rocsparse_index_base base_,            \
+                                     const T*             x_,               \
+                                     T*                   y_)               \
+    try                                                                     \
+    {                                                                       \
+        return rocsparse_csritilu0_apply_impl<T, I, J>(                     \
+            handle_, nsweeps_, m_, nnz_, ptr_, ind_, ilu0_, base_, x_, y_); \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocsparse_status();                             \
+    }
+
+IMPL(rocsparse_scsritilu0_apply, float, rocsparse_int, rocsparse_int);
+IMPL(rocsparse_dcsritilu0_apply, double, rocsparse_int, rocsparse_int);
+IMPL(rocsparse_ccsritilu0_apply, rocsparse_float_complex, rocsparse_int, rocsparse_int);
+IMPL(rocsparse_zcsritilu0_apply, rocsparse_double_complex, rocsparse_int, rocsparse_int);
+
+#undef IMPL
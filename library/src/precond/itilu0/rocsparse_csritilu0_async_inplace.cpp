@@ -184,8 +184,17 @@ void kernel_calculate(const J m_,
                       const I* __restrict__ uperm_,
                       T* __restrict__ ilu0_,
                       floating_data_t<T>*       nrm_,
-                      const floating_data_t<T>* nrm0_)
+                      const floating_data_t<T>* nrm0_,
+                      const J* __restrict__ stop_)
 {
+    //
+    // Skip the sweep if the convergence has been detected on device.
+    //
+    if(stop_ != nullptr && stop_[0] != 0)
+    {
+        return;
+    }
+
     static constexpr unsigned int nid = BLOCKSIZE / WFSIZE;
     const J                       lid = hipThreadIdx_x & (WFSIZE - 1);
     const J                       wid = hipThreadIdx_x / WFSIZE;
@@ -337,8 +346,17 @@ void kernel_calculate_coo(const J m_,
                           const I* __restrict__ uperm_,
                           T* __restrict__ ilu0_,
                           floating_data_t<T>*       nrm_,
-                          const floating_data_t<T>* nrm0_)
+                          const floating_data_t<T>* nrm0_,
+                          const J* __restrict__ stop_)
 {
+    //
+    // Skip the sweep if the convergence has been detected on device.
+    //
+    if(stop_ != nullptr && stop_[0] != 0)
+    {
+        return;
+    }
+
     static constexpr int num = 64;
 
     const J    lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -476,6 +494,7 @@ struct compute_iter
                                                                      uperm_,
                                                                      ilu0_,
                                                                      nullptr,
+                                                                     nullptr,
                                                                      nullptr);
             }
         }
@@ -504,12 +523,101 @@ struct compute_iter
                                                                          uperm_,
                                                                          ilu0_,
                                                                          nullptr,
+                                                                         nullptr,
                                                                          nullptr);
             }
         }
         return rocsparse_status_success;
     }
 
+    template <bool RESIDUAL>
+    static void sweep(rocsparse_handle handle_,
+                      bool             use_coo_format_,
+                      I                mean_,
+                      J                m_,
+                      I                nnz_,
+                      const I* __restrict__ ptr_begin_,
+                      const I* __restrict__ ptr_end_,
+                      const J* __restrict__ row_ind_,
+                      const J* __restrict__ ind_,
+                      const T* __restrict__ val_,
+                      rocsparse_index_base base_,
+
+                      const I* __restrict__ lptr_begin_,
+                      const I* __restrict__ lptr_end_,
+                      const J* __restrict__ lind_,
+
+                      const I* __restrict__ uptr_begin_,
+                      const I* __restrict__ uptr_end_,
+                      const J* __restrict__ uind_,
+                      const I* __restrict__ uperm_,
+
+                      T* __restrict__ ilu0_,
+                      floating_data_t<T>*       nrm_,
+                      const floating_data_t<T>* nrm0_,
+                      const J* __restrict__ stop_)
+    {
+        if(use_coo_format_)
+        {
+            //
+            // Compute an iteration of the factorization.
+            //
+            kernel_calculate_coo_dispatch<BLOCKSIZE, RESIDUAL, T, I, J>(nnz_,
+                                                                        handle_->wavefront_size,
+                                                                        handle_->stream,
+
+                                                                        m_,
+                                                                        nnz_,
+                                                                        row_ind_,
+                                                                        ind_,
+                                                                        val_,
+                                                                        base_,
+
+                                                                        lptr_begin_,
+                                                                        lptr_end_,
+                                                                        lind_,
+
+                                                                        uptr_begin_,
+                                                                        uptr_end_,
+                                                                        uind_,
+                                                                        uperm_,
+
+                                                                        ilu0_,
+                                                                        nrm_,
+                                                                        nrm0_,
+                                                                        stop_);
+        }
+        else
+        {
+            kernel_calculate_dispatch<BLOCKSIZE, RESIDUAL, T, I, J>(m_,
+                                                                    mean_,
+                                                                    handle_->wavefront_size,
+                                                                    handle_->stream,
+
+                                                                    m_,
+                                                                    nnz_,
+                                                                    ptr_begin_,
+                                                                    ptr_end_,
+                                                                    ind_,
+                                                                    val_,
+                                                                    base_,
+
+                                                                    lptr_begin_,
+                                                                    lptr_end_,
+                                                                    lind_,
+
+                                                                    uptr_begin_,
+                                                                    uptr_end_,
+                                                                    uind_,
+                                                                    uperm_,
+
+                                                                    ilu0_,
+                                                                    nrm_,
+                                                                    nrm0_,
+                                                                    stop_);
+        }
+    }
+
     static rocsparse_status run(rocsparse_handle handle_,
                                 J                options_,
                                 J* __restrict__ nmaxiter_,
@@ -536,10 +644,14 @@ struct compute_iter
                                 size_t buffer_size_,
                                 void* __restrict__ buffer_)
     {
-        hipStream_t stream            = handle_->stream;
-        const bool  verbose           = (options_ & rocsparse_itilu0_option_verbose) > 0;
-        const bool  stopping_criteria = (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
-        const bool  convergence_history
+        hipStream_t stream  = handle_->stream;
+        const bool  verbose = (options_ & rocsparse_itilu0_option_verbose) > 0;
+        const bool  device_stopping_criteria
+            = (options_ & rocsparse_itilu0_option_device_stopping_criteria) > 0;
+        const bool stopping_criteria
+            = !device_stopping_criteria
+              && (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
+        const bool convergence_history
             = (options_ & rocsparse_itilu0_option_convergence_history) > 0;
         const bool use_coo_format = (options_ & rocsparse_itilu0_option_coo_format) > 0;
 
@@ -555,13 +667,30 @@ struct compute_iter
         rocsparse_itilu0x_convergence_info_t<floating_data_t<T>, J> setup;
         buffer = setup.init(handle_, buffer, nmaxiter, options_);
 
-        floating_data_t<T>* p_nrm_matrix   = setup.info.nrm_matrix;
-        floating_data_t<T>* p_nrm_residual = setup.info.nrm_residual;
-        J*                  p_iter         = setup.info.iter;
-        floating_data_t<T>* log_mxresidual = setup.log_mxresidual;
+        floating_data_t<T>* p_nrm_matrix            = setup.info.nrm_matrix;
+        floating_data_t<T>* p_nrm_residual          = setup.info.nrm_residual;
+        floating_data_t<T>* p_nrm_residual_previous = setup.info.nrm_residual_previous;
+        J*                  p_iter                  = setup.info.iter;
+        J*                  p_stop                  = nullptr;
+        floating_data_t<T>* log_mxresidual          = setup.log_mxresidual;
 
         RETURN_IF_ROCSPARSE_ERROR(
             rocsparse_nrminf<BLOCKSIZE>(handle_, nnz_, val_, p_nrm_matrix, nullptr, false));
+
+        //
+        // The stopping criteria is checked on device every check_interval sweeps,
+        // the sweeps following the convergence return immediately.
+        //
+        const J check_interval = handle_->itilu0_check_interval;
+        if(device_stopping_criteria)
+        {
+            p_stop = setup.info.stop;
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(p_stop, 0, sizeof(J), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                p_nrm_residual_previous, 0, sizeof(floating_data_t<T>), stream));
+            RETURN_IF_HIP_ERROR(on_device(p_iter, nmaxiter_, stream));
+        }
+
         //
         // Loop over.
         //
@@ -569,70 +698,78 @@ struct compute_iter
         bool               converged             = false;
         for(J iter = 0; iter < nmaxiter; ++iter)
         {
+            const bool check
+                = device_stopping_criteria
+                  && (((iter + 1) % check_interval) == 0 || (iter + 1) == nmaxiter);
+
             //
-            // Need to set to zero because of atomics.
-            // (And absolutely need to be aligned).
+            // The stagnation test compares the residuals of two consecutive sweeps,
+            // the residual is also needed for the sweep preceding a check.
             //
-            RETURN_IF_HIP_ERROR(
-                hipMemsetAsync(p_nrm_residual, 0, sizeof(floating_data_t<T>), handle_->stream));
+            const bool precheck
+                = device_stopping_criteria && !check
+                  && (((iter + 2) % check_interval) == 0 || (iter + 2) == nmaxiter);
 
-            if(use_coo_format)
+            if(device_stopping_criteria && !check && !precheck && !convergence_history)
             {
                 //
-                // Compute an iteration of the factorization.
+                // No residual is needed for this sweep.
                 //
-                kernel_calculate_coo_dispatch<BLOCKSIZE, true, T, I, J>(nnz_,
-                                                                        handle_->wavefront_size,
-                                                                        handle_->stream,
-
-                                                                        m_,
-                                                                        nnz_,
-                                                                        row_ind_,
-                                                                        ind_,
-                                                                        val_,
-                                                                        base_,
-
-                                                                        lptr_begin_,
-                                                                        lptr_end_,
-                                                                        lind_,
-
-                                                                        uptr_begin_,
-                                                                        uptr_end_,
-                                                                        uind_,
-                                                                        uperm_,
-
-                                                                        ilu0_,
-                                                                        p_nrm_residual,
-                                                                        p_nrm_matrix);
+                sweep<false>(handle_,
+                             use_coo_format,
+                             mean,
+                             m_,
+                             nnz_,
+                             ptr_begin_,
+                             ptr_end_,
+                             row_ind_,
+                             ind_,
+                             val_,
+                             base_,
+                             lptr_begin_,
+                             lptr_end_,
+                             lind_,
+                             uptr_begin_,
+                             uptr_end_,
+                             uind_,
+                             uperm_,
+                             ilu0_,
+                             nullptr,
+                             nullptr,
+                             p_stop);
+                continue;
             }
-            else
-            {
-                kernel_calculate_dispatch<BLOCKSIZE, true, T, I, J>(m_,
-                                                                    mean,
-                                                                    handle_->wavefront_size,
-                                                                    handle_->stream,
-
-                                                                    m_,
-                                                                    nnz_,
-                                                                    ptr_begin_,
-                                                                    ptr_end_,
-                                                                    ind_,
-                                                                    val_,
-                                                                    base_,
 
-                                                                    lptr_begin_,
-                                                                    lptr_end_,
-                                                                    lind_,
+            //
+            // Need to set to zero because of atomics.
+            // (And absolutely need to be aligned).
+            //
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(p_nrm_residual, 0, sizeof(floating_data_t<T>), handle_->stream));
 
-                                                                    uptr_begin_,
-                                                                    uptr_end_,
-                                                                    uind_,
-                                                                    uperm_,
+            sweep<true>(handle_,
+                        use_coo_format,
+                        mean,
+                        m_,
+                        nnz_,
+                        ptr_begin_,
+                        ptr_end_,
+                        row_ind_,
+                        ind_,
+                        val_,
+                        base_,
+                        lptr_begin_,
+                        lptr_end_,
+                        lind_,
+                        uptr_begin_,
+                        uptr_end_,
+                        uind_,
+                        uperm_,
+                        ilu0_,
+                        p_nrm_residual,
+                        p_nrm_matrix,
+                        p_stop);
 
-                                                                    ilu0_,
-                                                                    p_nrm_residual,
-                                                                    p_nrm_matrix);
-            }
             if(convergence_history)
             {
                 //
@@ -641,6 +778,29 @@ struct compute_iter
                 RETURN_IF_HIP_ERROR(stay_on_device(&log_mxresidual[iter], p_nrm_residual, stream));
             }
 
+            if(check)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_itilu0_check_convergence(
+                    handle_,
+                    iter,
+                    tol_,
+                    static_cast<floating_data_t<T>>(1.0e-5),
+                    p_nrm_residual,
+                    p_nrm_residual_previous,
+                    p_stop,
+                    p_iter));
+            }
+            else if(device_stopping_criteria)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_itilu0_keep_residual(
+                    handle_, p_nrm_residual, p_nrm_residual_previous, p_stop));
+            }
+
+            if(device_stopping_criteria)
+            {
+                continue;
+            }
+
             floating_data_t<T> nrm_residual;
             if(stopping_criteria)
             {
@@ -707,6 +867,32 @@ struct compute_iter
 
             nrm_residual_previous = nrm_residual;
         }
+
+        if(device_stopping_criteria)
+        {
+            //
+            // Single synchronization.
+            //
+            J stop;
+            RETURN_IF_HIP_ERROR(on_host(&stop, p_stop, stream));
+            RETURN_IF_HIP_ERROR(on_host(nmaxiter_, p_iter, stream));
+            RETURN_IF_HIP_ERROR(
+                on_host(&nrm_residual_previous, p_nrm_residual_previous, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            if(verbose)
+            {
+                std::cout << std::setw(16) << "iter";
+                std::cout << std::setw(16) << "residual";
+                std::cout << std::endl;
+                std::cout << std::setw(16) << nmaxiter_[0];
+                std::cout << std::setw(16) << nrm_residual_previous;
+                std::cout << std::endl;
+            }
+
+            return (stop < 0) ? rocsparse_status_zero_pivot : rocsparse_status_success;
+        }
+
         RETURN_IF_HIP_ERROR(on_device(p_iter, (converged) ? nmaxiter_ : (&nmaxiter), stream));
 
         return rocsparse_status_success;
@@ -1245,6 +1431,8 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -127,6 +127,10 @@ rocsparse_status rocsparse_csritilu0_buffer_size_impl(rocsparse_handle     handl
               datatype_,
               (const void*&)buffer_size_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csritilu0_buffer_size", m_, nnz_);
+
     if(rocsparse_enum_utils::is_invalid(base_))
     {
         return rocsparse_status_invalid_value;
@@ -140,6 +140,10 @@ rocsparse_status rocsparse_csritilu0_compute_impl(rocsparse_handle     handle_,
               buffer_size_,
               (const void*&)buffer_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csritilu0_compute", rocsparse_get_datatype<T>(), m_, nnz_);
+
     if(rocsparse_enum_utils::is_invalid(alg_))
     {
         return rocsparse_status_invalid_value;
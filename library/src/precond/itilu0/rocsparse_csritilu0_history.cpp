@@ -89,6 +89,10 @@ rocsparse_status rocsparse_csritilu0_history_impl(rocsparse_handle     handle_,
               (const void*&)nrms_,
               buffer_size_,
               (const void*&)buffer_);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csritilu0_history", rocsparse_get_datatype<T>());
     // Check pointer arguments
     if(rocsparse_enum_utils::is_invalid(alg_))
     {
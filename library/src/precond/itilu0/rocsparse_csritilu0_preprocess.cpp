@@ -130,6 +130,9 @@ rocsparse_status rocsparse_csritilu0_preprocess_impl(rocsparse_handle     handle
               datatype_,
               (const void*&)buffer_size_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csritilu0_preprocess", m_, nnz_);
+
     if(rocsparse_enum_utils::is_invalid(base_))
     {
         return rocsparse_status_invalid_value;
@@ -52,9 +52,18 @@ void kernel_correction(const J m_,
                        const rocsparse_index_base ubase_,
                        T* __restrict__ dval_,
                        floating_data_t<T>*       nrm_,
-                       const floating_data_t<T>* nrm0_)
+                       const floating_data_t<T>* nrm0_,
+                       const J* __restrict__ stop_)
 
 {
+    //
+    // Skip the sweep if the convergence has been detected on device.
+    //
+    if(stop_ != nullptr && stop_[0] != 0)
+    {
+        return;
+    }
+
     floating_data_t<T> nrm = 0;
     __shared__ floating_data_t<T> sdata[BLOCKSIZE / WFSIZE];
 
@@ -321,6 +330,8 @@ public:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -407,8 +418,12 @@ public:
             const bool  verbose = (options_ & rocsparse_itilu0_option_verbose) > 0;
             const bool  compute_nrm_residual
                 = (options_ & rocsparse_itilu0_option_compute_nrm_residual) > 0;
+            const bool device_stopping_criteria
+                = compute_nrm_residual
+                  && (options_ & rocsparse_itilu0_option_device_stopping_criteria) > 0;
             const bool stopping_criteria
-                = (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
+                = !device_stopping_criteria
+                  && (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
             const bool convergence_history
                 = (options_ & rocsparse_itilu0_option_convergence_history) > 0;
 
@@ -429,6 +444,7 @@ public:
             floating_data_t<T>* p_nrm_residual
                 = (compute_nrm_residual) ? setup.info.nrm_residual : nullptr;
             J*                  p_iter = setup.info.iter;
+            J*                  p_stop = nullptr;
             floating_data_t<T>* log_mxresidual
                 = (compute_nrm_residual) ? setup.log_mxresidual : nullptr;
 
@@ -438,6 +454,20 @@ public:
                     rocsparse_nrminf<BLOCKSIZE>(handle_, nnz_, val_, p_nrm_matrix, nullptr, false));
             }
 
+            //
+            // The stopping criteria is checked on device every check_interval sweeps,
+            // the sweeps following the convergence return immediately.
+            //
+            const J check_interval = handle_->itilu0_check_interval;
+            if(device_stopping_criteria)
+            {
+                p_stop = setup.info.stop;
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(p_stop, 0, sizeof(J), stream));
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    setup.info.nrm_residual_previous, 0, sizeof(floating_data_t<T>), stream));
+                RETURN_IF_HIP_ERROR(on_device(p_iter, nmaxiter_, stream));
+            }
+
             //
             // Loop over.
             //
@@ -481,7 +511,8 @@ public:
                                                                ubase_, //
                                                                dval_,
                                                                p_nrm_residual,
-                                                               p_nrm_matrix);
+                                                               p_nrm_matrix,
+                                                               p_stop);
                 if(convergence_history)
                 {
                     //
@@ -491,6 +522,34 @@ public:
                         stay_on_device(&log_mxresidual[iter], p_nrm_residual, stream));
                 }
 
+                if(device_stopping_criteria)
+                {
+                    if(((iter + 1) % check_interval) == 0 || (iter + 1) == nmaxiter)
+                    {
+                        RETURN_IF_ROCSPARSE_ERROR(
+                            rocsparse_itilu0_check_convergence(handle_,
+                                                               iter,
+                                                               tol_,
+                                                               tol_ * 10,
+                                                               p_nrm_residual,
+                                                               setup.info.nrm_residual_previous,
+                                                               p_stop,
+                                                               p_iter));
+                    }
+                    else
+                    {
+                        //
+                        // Keep the residual of the sweep preceding the check.
+                        //
+                        RETURN_IF_ROCSPARSE_ERROR(
+                            rocsparse_itilu0_keep_residual(handle_,
+                                                           p_nrm_residual,
+                                                           setup.info.nrm_residual_previous,
+                                                           p_stop));
+                    }
+                    continue;
+                }
+
                 if(stopping_criteria)
                 {
 
@@ -577,6 +636,31 @@ public:
                 }
             }
 
+            if(device_stopping_criteria)
+            {
+                //
+                // Single synchronization.
+                //
+                J stop;
+                RETURN_IF_HIP_ERROR(on_host(&stop, p_stop, stream));
+                RETURN_IF_HIP_ERROR(on_host(nmaxiter_, p_iter, stream));
+                RETURN_IF_HIP_ERROR(
+                    on_host(&nrm_residual_previous, setup.info.nrm_residual_previous, stream));
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+                if(verbose)
+                {
+                    std::cout << std::setw(16) << "iter";
+                    std::cout << std::setw(16) << "residual";
+                    std::cout << std::endl;
+                    std::cout << std::setw(16) << nmaxiter_[0];
+                    std::cout << std::setw(16) << nrm_residual_previous;
+                    std::cout << std::endl;
+                }
+
+                return (stop < 0) ? rocsparse_status_zero_pivot : rocsparse_status_success;
+            }
+
             RETURN_IF_HIP_ERROR(on_device(p_iter, (converged) ? nmaxiter_ : (&nmaxiter), stream));
 
             return rocsparse_status_success;
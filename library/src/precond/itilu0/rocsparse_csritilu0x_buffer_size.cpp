@@ -145,6 +145,10 @@ rocsparse_status rocsparse_csritilu0x_buffer_size_impl(rocsparse_handle     hand
               datatype_,
               (const void*&)buffer_size_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_csritilu0x_buffer_size", m_, nnz_);
+
     // Check sizes
     if(m_ < 0 || nnz_ < 0)
     {
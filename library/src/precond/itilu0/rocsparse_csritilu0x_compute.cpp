@@ -215,6 +215,10 @@ rocsparse_status rocsparse_csritilu0x_compute_impl(rocsparse_handle     handle_,
               buffer_size_,
               (const void*&)buffer_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsritilu0x"), rocsparse_get_datatype<T>(), m_, nnz_);
+
     // Check sizes
     if(m_ < 0 || nnz_ < 0)
     {
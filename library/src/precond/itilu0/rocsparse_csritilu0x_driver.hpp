@@ -72,10 +72,12 @@ struct rocsparse_itilu0x_info_t
     T*    nrm_matrix{};
     T*    nrm_corr{};
     T*    nrm_residual{};
+    T*    nrm_residual_previous{};
     J*    options;
     J*    nmaxiter;
     J*    local_iter{};
     J*    iter{};
+    J*    stop{};
     void* init(void* buffer_)
     {
         void* buffer = buffer_;
@@ -91,6 +93,9 @@ struct rocsparse_itilu0x_info_t
         nrm_residual = ((T*)buffer);
         buffer       = (void*)&nrm_residual[1];
 
+        nrm_residual_previous = ((T*)buffer);
+        buffer                = (void*)&nrm_residual_previous[1];
+
         options = ((J*)buffer);
         buffer  = (void*)&options[1];
 
@@ -103,12 +108,15 @@ struct rocsparse_itilu0x_info_t
         iter   = ((J*)buffer);
         buffer = (void*)&iter[1];
 
+        stop   = ((J*)buffer);
+        buffer = (void*)&stop[1];
+
         return (void*)(((char*)buffer_) + size());
     };
 
     static size_t size()
     {
-        return (((sizeof(T) * 3 + sizeof(J) * 4) - 1) / sizeof(T) + 1) * sizeof(T);
+        return (((sizeof(T) * 4 + sizeof(J) * 5) - 1) / sizeof(T) + 1) * sizeof(T);
     };
 };
 
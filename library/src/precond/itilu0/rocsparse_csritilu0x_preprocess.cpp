@@ -193,6 +193,10 @@ rocsparse_status rocsparse_csritilu0x_preprocess_impl(rocsparse_handle     handl
               buffer_size_,
               (const void*&)buffer_);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, "rocsparse_Xcsritilu0x_preprocess", m_, nnz_);
+
     // Check sizes
     if(m_ < 0 || nnz_ < 0)
     {
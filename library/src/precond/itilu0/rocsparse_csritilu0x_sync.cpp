@@ -448,6 +448,8 @@ public:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -474,6 +476,8 @@ public:
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -643,8 +647,15 @@ public:
                 = (options_ & rocsparse_itilu0_option_compute_nrm_correction) > 0;
             const bool compute_nrm_residual
                 = (options_ & rocsparse_itilu0_option_compute_nrm_residual) > 0;
+            //
+            // The unknowns are copied by the host every sweep, the device stopping
+            // criteria falls back to the host stopping criteria.
+            //
             const bool stopping_criteria
-                = (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
+                = (options_
+                   & (rocsparse_itilu0_option_stopping_criteria
+                      | rocsparse_itilu0_option_device_stopping_criteria))
+                  > 0;
             const bool convergence_history
                 = (options_ & rocsparse_itilu0_option_convergence_history) > 0;
 
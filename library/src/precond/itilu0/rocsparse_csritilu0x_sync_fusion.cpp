@@ -726,6 +726,8 @@ struct rocsparse_csritilu0x_driver_t<rocsparse_itilu0_alg_sync_split_fusion>
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -752,6 +754,8 @@ struct rocsparse_csritilu0x_driver_t<rocsparse_itilu0_alg_sync_split_fusion>
             case rocsparse_datatype_u8_r:
             case rocsparse_datatype_i32_r:
             case rocsparse_datatype_u32_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             {
                 return rocsparse_status_not_implemented;
             }
@@ -841,8 +845,15 @@ struct rocsparse_csritilu0x_driver_t<rocsparse_itilu0_alg_sync_split_fusion>
         {
             hipStream_t      stream = handle_->stream;
             rocsparse_status status;
-            const bool       stopping_criteria
-                = (options_ & rocsparse_itilu0_option_stopping_criteria) > 0;
+            //
+            // The unknowns are copied by the host every sweep, the device stopping
+            // criteria falls back to the host stopping criteria.
+            //
+            const bool stopping_criteria
+                = (options_
+                   & (rocsparse_itilu0_option_stopping_criteria
+                      | rocsparse_itilu0_option_device_stopping_criteria))
+                  > 0;
             const bool convergence_history
                 = (options_ & rocsparse_itilu0_option_convergence_history) > 0;
             const bool compute_nrm_corr
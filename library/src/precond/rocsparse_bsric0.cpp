@@ -338,6 +338,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_bsric0_clear", (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_bsric0_clear");
+
     // If meta data is not shared, delete it
     if(!rocsparse_check_trm_shared(info, info->bsric0_info))
     {
@@ -499,6 +502,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_bsric0_zero_pivot", (const void*&)info, (const void*&)position);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_bsric0_zero_pivot");
+
     // Check pointer arguments
     if(position == nullptr)
     {
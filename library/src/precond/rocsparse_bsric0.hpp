@@ -163,6 +163,14 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
               solve,
               analysis);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsric0_analysis"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     if(rocsparse_enum_utils::is_invalid(dir))
     {
         return rocsparse_status_invalid_value;
@@ -455,6 +463,10 @@ rocsparse_status rocsparse_bsric0_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f bsric0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xbsric0"), rocsparse_get_datatype<T>(), mb, nnzb, block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
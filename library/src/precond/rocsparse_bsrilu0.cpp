@@ -432,6 +432,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_bsrilu0_clear", (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_bsrilu0_clear");
+
     // If meta data is not shared, delete it
     if(!rocsparse_check_trm_shared(info, info->bsrilu0_info))
     {
@@ -629,6 +632,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_bsrilu0_zero_pivot", (const void*&)info, (const void*&)position);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_bsrilu0_zero_pivot");
+
     // Check pointer arguments
     if(position == nullptr)
     {
@@ -138,6 +138,10 @@ rocsparse_status rocsparse_bsrilu0_numeric_boost_template(rocsparse_handle   han
               (const void*&)boost_tol,
               (const void*&)boost_val);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xbsrilu0_numeric_boost"), rocsparse_get_datatype<T>());
+
     // Reset boost
     info->boost_enable        = 0;
     info->use_double_prec_tol = 0;
@@ -208,6 +212,14 @@ rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          h
               solve,
               analysis);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrilu0_analysis"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
@@ -645,6 +657,14 @@ rocsparse_status rocsparse_bsrilu0_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f bsrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle,
+                                                replaceX<T>("rocsparse_Xbsrilu0"),
+                                                rocsparse_get_datatype<T>(),
+                                                mb,
+                                                nnzb,
+                                                block_dim);
+
     // Check direction
     if(rocsparse_enum_utils::is_invalid(dir))
     {
@@ -274,6 +274,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_csric0_clear", (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csric0_clear");
+
     // If meta data is not shared, delete it
     if(!rocsparse_check_trm_shared(info, info->csric0_info))
     {
@@ -387,6 +390,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_csric0_zero_pivot", (const void*&)info, (const void*&)position);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csric0_zero_pivot");
+
     // Check pointer arguments
     if(position == nullptr)
     {
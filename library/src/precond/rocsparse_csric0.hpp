@@ -69,6 +69,10 @@ rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          ha
               solve,
               analysis);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsric0_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check matrix type
     if(descr->type != rocsparse_matrix_type_general)
     {
@@ -241,6 +245,10 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csric0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsric0"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check solve policy
     if(rocsparse_enum_utils::is_invalid(policy))
     {
@@ -368,6 +368,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_csrilu0_clear", (const void*&)info);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csrilu0_clear");
+
     // If meta data is not shared, delete it
     if(!rocsparse_check_trm_shared(info, info->csrilu0_info))
     {
@@ -497,6 +500,9 @@ try
     // Logging
     log_trace(handle, "rocsparse_csrilu0_zero_pivot", (const void*&)info, (const void*&)position);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csrilu0_zero_pivot");
+
     // Check pointer arguments
     if(position == nullptr)
     {
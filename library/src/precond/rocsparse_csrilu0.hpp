@@ -54,6 +54,10 @@ rocsparse_status rocsparse_csrilu0_numeric_boost_template(rocsparse_handle   han
               (const void*&)boost_tol,
               (const void*&)boost_val);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrilu0_numeric_boost"), rocsparse_get_datatype<T>());
+
     // Reset boost
     info->boost_enable        = 0;
     info->use_double_prec_tol = 0;
@@ -120,6 +124,10 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
               solve,
               analysis);
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrilu0_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check matrix type
     if(descr->type != rocsparse_matrix_type_general)
     {
@@ -340,6 +348,7 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                             const rocsparse_int*      csr_row_ptr,
                                             const rocsparse_int*      csr_col_ind,
                                             rocsparse_mat_info        info,
+                                            rocsparse_trm_info        trm_info,
                                             rocsparse_solve_policy    policy,
                                             void*                     temp_buffer,
                                             U                         boost_tol_device_host,
@@ -360,7 +369,7 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
 
     // Max nnz per row
-    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
+    rocsparse_int max_nnz = trm_info->max_nnz;
 
     // Determine gcnArch and ASIC revision
     int gcnArch = handle->properties.gcnArch;
@@ -381,9 +390,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                            csr_row_ptr,
                            csr_col_ind,
                            csr_val,
-                           (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                           (rocsparse_int*)trm_info->trm_diag_ind,
                            d_done_array,
-                           (rocsparse_int*)info->csrilu0_info->row_map,
+                           (rocsparse_int*)trm_info->row_map,
                            (rocsparse_int*)info->zero_pivot,
                            descr->base,
                            info->boost_enable,
@@ -405,9 +414,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -425,9 +434,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -445,9 +454,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -465,9 +474,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -485,9 +494,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -505,9 +514,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -528,9 +537,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -548,9 +557,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -568,9 +577,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -588,9 +597,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -608,9 +617,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -628,9 +637,9 @@ rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   (rocsparse_int*)info->csrilu0_info->trm_diag_ind,
+                                   (rocsparse_int*)trm_info->trm_diag_ind,
                                    d_done_array,
-                                   (rocsparse_int*)info->csrilu0_info->row_map,
+                                   (rocsparse_int*)trm_info->row_map,
                                    (rocsparse_int*)info->zero_pivot,
                                    descr->base,
                                    info->boost_enable,
@@ -689,6 +698,10 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
 
     log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
 
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrilu0"), rocsparse_get_datatype<T>(), m, nnz);
+
     // Check solve policy
     if(rocsparse_enum_utils::is_invalid(policy))
     {
@@ -753,6 +766,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                           csr_row_ptr,
                                           csr_col_ind,
                                           info,
+                                          info->csrilu0_info,
                                           policy,
                                           temp_buffer,
                                           reinterpret_cast<const U*>(info->boost_tol),
@@ -769,6 +783,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
             csr_row_ptr,
             csr_col_ind,
             info,
+            info->csrilu0_info,
             policy,
             temp_buffer,
             (info->boost_enable != 0) ? *reinterpret_cast<const U*>(info->boost_tol)
@@ -0,0 +1,344 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csriluk.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             nnz,           \
+                                     const rocsparse_mat_descr descr,         \
+                                     const TYPE*               csr_val,       \
+                                     const rocsparse_int*      csr_row_ptr,   \
+                                     const rocsparse_int*      csr_col_ind,   \
+                                     rocsparse_mat_info        info,          \
+                                     size_t*                   buffer_size)   \
+    try                                                                       \
+    {                                                                         \
+        return rocsparse_csrsv_buffer_size_template(handle,                   \
+                                                    rocsparse_operation_none, \
+                                                    m,                        \
+                                                    nnz,                      \
+                                                    descr,                    \
+                                                    csr_val,                  \
+                                                    csr_row_ptr,              \
+                                                    csr_col_ind,              \
+                                                    info,                     \
+                                                    buffer_size);             \
+    }                                                                         \
+    catch(...)                                                                \
+    {                                                                         \
+        return exception_to_rocsparse_status();                               \
+    }
+
+C_IMPL(rocsparse_scsriluk_buffer_size, float);
+C_IMPL(rocsparse_dcsriluk_buffer_size, double);
+C_IMPL(rocsparse_ccsriluk_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsriluk_buffer_size, rocsparse_double_complex);
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             level,       \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_analysis_policy analysis,    \
+                                     rocsparse_solve_policy    solve,       \
+                                     void*                     temp_buffer) \
+    try                                                                     \
+    {                                                                       \
+        return rocsparse_csriluk_analysis_template(handle,                  \
+                                                   level,                   \
+                                                   m,                       \
+                                                   nnz,                     \
+                                                   descr,                   \
+                                                   csr_val,                 \
+                                                   csr_row_ptr,             \
+                                                   csr_col_ind,             \
+                                                   info,                    \
+                                                   analysis,                \
+                                                   solve,                   \
+                                                   temp_buffer);            \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocsparse_status();                             \
+    }
+
+C_IMPL(rocsparse_scsriluk_analysis, float);
+C_IMPL(rocsparse_dcsriluk_analysis, double);
+C_IMPL(rocsparse_ccsriluk_analysis, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsriluk_analysis, rocsparse_double_complex);
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     TYPE*                     lu_val,      \
+                                     rocsparse_int*            lu_row_ptr,  \
+                                     rocsparse_int*            lu_col_ind,  \
+                                     rocsparse_solve_policy    policy,      \
+                                     void*                     temp_buffer) \
+    try                                                                     \
+    {                                                                       \
+        if(info != nullptr && info->use_double_prec_tol)                    \
+        {                                                                   \
+            return rocsparse_csriluk_template<TYPE, double>(handle,         \
+                                                            m,              \
+                                                            nnz,            \
+                                                            descr,          \
+                                                            csr_val,        \
+                                                            csr_row_ptr,    \
+                                                            csr_col_ind,    \
+                                                            info,           \
+                                                            lu_val,         \
+                                                            lu_row_ptr,     \
+                                                            lu_col_ind,     \
+                                                            policy,         \
+                                                            temp_buffer);   \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            return rocsparse_csriluk_template<TYPE, floating_data_t<TYPE>>( \
+                handle,                                                     \
+                m,                                                          \
+                nnz,                                                        \
+                descr,                                                      \
+                csr_val,                                                    \
+                csr_row_ptr,                                                \
+                csr_col_ind,                                                \
+                info,                                                       \
+                lu_val,                                                     \
+                lu_row_ptr,                                                 \
+                lu_col_ind,                                                 \
+                policy,                                                     \
+                temp_buffer);                                               \
+        }                                                                   \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocsparse_status();                             \
+    }
+
+C_IMPL(rocsparse_scsriluk, float);
+C_IMPL(rocsparse_dcsriluk, double);
+C_IMPL(rocsparse_ccsriluk, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsriluk, rocsparse_double_complex);
+#undef C_IMPL
+
+extern "C" rocsparse_status
+    rocsparse_csriluk_nnz(rocsparse_handle handle, rocsparse_mat_info info, rocsparse_int* lu_nnz)
+try
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_nnz", (const void*&)info, (const void*&)lu_nnz);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csriluk_nnz");
+
+    // Check pointer arguments
+    if(lu_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If m == 0 it can happen, that info structure is not created.
+    // In this case, the factors do not have any entries.
+    rocsparse_int nnz
+        = (info->csriluk_info != nullptr) ? static_cast<rocsparse_int>(info->csriluk_info->lu_nnz)
+                                          : 0;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            lu_nnz, &nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    }
+    else
+    {
+        *lu_nnz = nnz;
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+try
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csriluk_zero_pivot");
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csriluk_info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 0xFF, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 0xFF, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+try
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_clear", (const void*&)info);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(handle, "rocsparse_csriluk_clear");
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
@@ -0,0 +1,680 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "../extra/rocsparse_csrgemm.hpp"
+#include "csriluk_device.h"
+#include "rocsparse_csrilu0.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+template <bool FILL>
+rocsparse_status rocsparse_csriluk_symbolic_pass(rocsparse_handle     handle,
+                                                 rocsparse_int        max_nnz,
+                                                 rocsparse_int        level,
+                                                 rocsparse_int        m,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const rocsparse_int* csr_lev,
+                                                 rocsparse_int*       lu_row_ptr,
+                                                 rocsparse_int*       lu_col_ind,
+                                                 rocsparse_int*       lu_lev,
+                                                 int64_t*             lev_sum,
+                                                 rocsparse_index_base base)
+{
+    hipStream_t stream = handle->stream;
+
+#define LAUNCH_CSRILUK_SYMBOLIC_PASS(CSRILUK_DIM, CSRILUK_SUB, CSRILUK_HASHSIZE)            \
+    hipLaunchKernelGGL((csriluk_symbolic_pass<CSRILUK_DIM,                                  \
+                                              CSRILUK_SUB,                                  \
+                                              CSRILUK_HASHSIZE,                             \
+                                              (FILL ? CSRGEMM_FLL_HASH : CSRGEMM_NNZ_HASH), \
+                                              FILL>),                                       \
+                       dim3((m - 1) / (CSRILUK_DIM / CSRILUK_SUB) + 1),                     \
+                       dim3(CSRILUK_DIM),                                                   \
+                       0,                                                                   \
+                       stream,                                                              \
+                       m,                                                                   \
+                       level,                                                               \
+                       csr_row_ptr,                                                         \
+                       csr_col_ind,                                                         \
+                       csr_lev,                                                             \
+                       lu_row_ptr,                                                          \
+                       lu_col_ind,                                                          \
+                       lu_lev,                                                              \
+                       lev_sum,                                                             \
+                       base)
+
+    // The hash table size is chosen by the maximum number of distinct columns per row
+    if(max_nnz < 64)
+    {
+        LAUNCH_CSRILUK_SYMBOLIC_PASS(256, 16, 64);
+    }
+    else if(max_nnz < 256)
+    {
+        LAUNCH_CSRILUK_SYMBOLIC_PASS(256, 64, 256);
+    }
+    else if(max_nnz < 1024)
+    {
+        LAUNCH_CSRILUK_SYMBOLIC_PASS(256, 256, 1024);
+    }
+    else if(max_nnz < 4096)
+    {
+        LAUNCH_CSRILUK_SYMBOLIC_PASS(1024, 1024, 4096);
+    }
+    else
+    {
+        // Larger rows use hash tables in global memory, at most half full, with a table
+        // per block and the blocks striding over the rows
+#define CSRILUK_DIM 1024
+#define CSRILUK_SUB 32
+        int64_t hashsize = 8192;
+        while(hashsize < 2 * static_cast<int64_t>(max_nnz))
+        {
+            hashsize <<= 1;
+        }
+
+        const rocsparse_int nblocks
+            = std::min(m, 2 * static_cast<rocsparse_int>(handle->properties.multiProcessorCount));
+
+        rocsparse_int* workspace = nullptr;
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync((void**)&workspace,
+                                     sizeof(rocsparse_int) * (FILL ? 2 : 1) * nblocks * hashsize,
+                                     stream));
+
+        hipLaunchKernelGGL((csriluk_symbolic_pass_global<CSRILUK_DIM,
+                                                         CSRILUK_SUB,
+                                                         (FILL ? CSRGEMM_FLL_HASH
+                                                               : CSRGEMM_NNZ_HASH),
+                                                         FILL>),
+                           dim3(nblocks),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           level,
+                           static_cast<rocsparse_int>(hashsize),
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_lev,
+                           lu_row_ptr,
+                           lu_col_ind,
+                           lu_lev,
+                           workspace,
+                           lev_sum,
+                           base);
+
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(workspace, stream));
+#undef CSRILUK_SUB
+#undef CSRILUK_DIM
+    }
+#undef LAUNCH_CSRILUK_SYMBOLIC_PASS
+
+    return rocsparse_status_success;
+}
+
+// Compute the sparsity pattern of the incomplete LU factorization with level of fill.
+// Starting from the pattern of A, each pass merges the lower part of every row with
+// the upper parts of the referenced rows using hash tables. After level passes, all
+// entries with a fill path of at most level + 1 edges have been found. Passes stop
+// earlier, once a pass changes neither the pattern nor the levels of fill, since all
+// following passes would then reproduce the same pattern.
+inline rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle       handle,
+                                                   rocsparse_int          level,
+                                                   rocsparse_int          m,
+                                                   const rocsparse_int*   csr_row_ptr,
+                                                   const rocsparse_int*   csr_col_ind,
+                                                   rocsparse_index_base   base,
+                                                   rocsparse_csriluk_info info,
+                                                   void*                  temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Maximum row nnz bound and sum of the levels of fill, stored in the first 256 bytes
+    // of the buffer
+    rocsparse_int* d_max_nnz = reinterpret_cast<rocsparse_int*>(temp_buffer);
+    int64_t*       d_lev_sum
+        = reinterpret_cast<int64_t*>(reinterpret_cast<char*>(temp_buffer) + sizeof(int64_t));
+
+    // Pattern and levels of fill of the previous pass
+    const rocsparse_int* row_ptr = csr_row_ptr;
+    const rocsparse_int* col_ind = csr_col_ind;
+    rocsparse_int*       lev     = nullptr;
+
+    rocsparse_int* lu_row_ptr = nullptr;
+    rocsparse_int* lu_col_ind = nullptr;
+    rocsparse_int* lu_lev     = nullptr;
+    rocsparse_int  lu_nnz     = 0;
+
+    // Nnz and sum of the levels of fill of the two previous passes
+    rocsparse_int prev_lu_nnz  = -1;
+    int64_t       lev_sum      = 0;
+    int64_t       prev_lev_sum = -1;
+
+    // rocprim buffer
+    size_t rocprim_size;
+    void*  rocprim_buffer;
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                lu_row_ptr,
+                                                lu_row_ptr,
+                                                static_cast<rocsparse_int>(base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&rocprim_buffer, rocprim_size, stream));
+
+    // A single pass is required to sort and compress the pattern of A for level 0
+    rocsparse_int npasses = std::max(level, 1);
+
+    for(rocsparse_int pass = 0; pass < npasses; ++pass)
+    {
+        // Upper bound of the row nnz of the current pass
+#define CSRILUK_DIM 256
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_max_nnz, 0, sizeof(rocsparse_int), stream));
+        hipLaunchKernelGGL((csriluk_max_row_nnz<CSRILUK_DIM>),
+                           dim3((m - 1) / CSRILUK_DIM + 1),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           row_ptr,
+                           col_ind,
+                           d_max_nnz,
+                           base);
+#undef CSRILUK_DIM
+
+        rocsparse_int max_nnz;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        if(pass > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &lev_sum, d_lev_sum, sizeof(int64_t), hipMemcpyDeviceToHost, stream));
+        }
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // The levels of fill of a pass never exceed those of the previous pass and its
+        // pattern contains the previous pattern. Equal nnz and level sums thus mean that
+        // the previous pass did not change anything.
+        if(pass > 1 && lu_nnz == prev_lu_nnz && lev_sum == prev_lev_sum)
+        {
+            break;
+        }
+
+        prev_lu_nnz  = lu_nnz;
+        prev_lev_sum = lev_sum;
+
+        // Row nnz of the current pass
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+            (void**)&lu_row_ptr, sizeof(rocsparse_int) * (m + 1), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(lu_row_ptr + m, 0, sizeof(rocsparse_int), stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic_pass<false>(handle,
+                                                                         max_nnz,
+                                                                         level,
+                                                                         m,
+                                                                         row_ptr,
+                                                                         col_ind,
+                                                                         lev,
+                                                                         lu_row_ptr,
+                                                                         nullptr,
+                                                                         nullptr,
+                                                                         nullptr,
+                                                                         base));
+
+        // Exclusive sum to obtain row pointers
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                    rocprim_size,
+                                                    lu_row_ptr,
+                                                    lu_row_ptr,
+                                                    static_cast<rocsparse_int>(base),
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &lu_nnz, lu_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        lu_nnz -= base;
+
+        // Columns and levels of fill of the current pass
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_lev_sum, 0, sizeof(int64_t), stream));
+        if(lu_nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+                (void**)&lu_col_ind, sizeof(rocsparse_int) * lu_nnz, stream));
+            RETURN_IF_HIP_ERROR(
+                rocsparse_hipMallocAsync((void**)&lu_lev, sizeof(rocsparse_int) * lu_nnz, stream));
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic_pass<true>(handle,
+                                                                            max_nnz,
+                                                                            level,
+                                                                            m,
+                                                                            row_ptr,
+                                                                            col_ind,
+                                                                            lev,
+                                                                            lu_row_ptr,
+                                                                            lu_col_ind,
+                                                                            lu_lev,
+                                                                            d_lev_sum,
+                                                                            base));
+        }
+
+        // Free the previous pattern, unless it is the pattern of A
+        if(pass > 0)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync((void*)row_ptr, stream));
+
+            if(col_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync((void*)col_ind, stream));
+                RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(lev, stream));
+            }
+        }
+
+        row_ptr = lu_row_ptr;
+        col_ind = lu_col_ind;
+        lev     = lu_lev;
+
+        lu_row_ptr = nullptr;
+        lu_col_ind = nullptr;
+        lu_lev     = nullptr;
+    }
+
+    if(lev != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(lev, stream));
+    }
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(rocprim_buffer, stream));
+
+    info->level      = level;
+    info->m          = m;
+    info->lu_nnz     = lu_nnz;
+    info->lu_row_ptr = (void*)row_ptr;
+    info->lu_col_ind = (void*)col_ind;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_analysis_template(rocsparse_handle          handle,
+                                                     rocsparse_int             level,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_analysis_policy analysis,
+                                                     rocsparse_solve_policy    solve,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk_analysis"),
+              level,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              solve,
+              analysis);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsriluk_analysis"), rocsparse_get_datatype<T>(), m, nnz);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(rocsparse_enum_utils::is_invalid(analysis))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(solve))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check level of fill
+    if(level < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If the sparsity pattern of the factors is already available for the requested
+    // level of fill, re-use it. It is the user's responsibility that this data is
+    // still valid, since the 'reuse' flag has been passed.
+    if(analysis == rocsparse_analysis_policy_reuse && info->csriluk_info != nullptr
+       && info->csriluk_info->level == level && info->csriluk_info->m == m)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clear csriluk info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    // Create csriluk info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+
+    // Symbolic level of fill phase
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+        handle, level, m, csr_row_ptr, csr_col_ind, descr->base, info->csriluk_info, temp_buffer));
+
+    // Perform analysis of the sparsity pattern of the factors
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->csriluk_info->lu_info));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_trm_analysis(handle,
+                               rocsparse_operation_none,
+                               m,
+                               static_cast<rocsparse_int>(info->csriluk_info->lu_nnz),
+                               descr,
+                               csr_val,
+                               (const rocsparse_int*)info->csriluk_info->lu_row_ptr,
+                               (const rocsparse_int*)info->csriluk_info->lu_col_ind,
+                               info->csriluk_info->lu_info,
+                               (rocsparse_int**)&info->zero_pivot,
+                               temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            T*                        lu_val,
+                                            rocsparse_int*            lu_row_ptr,
+                                            rocsparse_int*            lu_col_ind,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)lu_val,
+              (const void*&)lu_row_ptr,
+              (const void*&)lu_col_ind,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csriluk -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sizek",
+              (info->csriluk_info != nullptr) ? info->csriluk_info->level : 0);
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsriluk"), rocsparse_get_datatype<T>(), m, nnz);
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || lu_row_ptr == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csriluk_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csriluk_info csriluk_info = info->csriluk_info;
+
+    // Analysis must have been performed on a matrix of the same size
+    if(csriluk_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_int lu_nnz = static_cast<rocsparse_int>(csriluk_info->lu_nnz);
+
+    if(lu_nnz != 0 && (lu_val == nullptr || lu_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Sparsity pattern of the factors
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(lu_row_ptr,
+                                       csriluk_info->lu_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    if(lu_nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(lu_col_ind,
+                                           csriluk_info->lu_col_ind,
+                                           sizeof(rocsparse_int) * lu_nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(lu_val, 0, sizeof(T) * lu_nnz, stream));
+    }
+
+    // Scatter the entries of A into the factors, fill-in entries remain zero
+    if(nnz > 0)
+    {
+#define CSRILUK_DIM 256
+#define CSRILUK_SUB 8
+        hipLaunchKernelGGL((csriluk_scatter<CSRILUK_DIM, CSRILUK_SUB>),
+                           dim3((m - 1) / (CSRILUK_DIM / CSRILUK_SUB) + 1),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           lu_row_ptr,
+                           lu_col_ind,
+                           lu_val,
+                           descr->base);
+#undef CSRILUK_SUB
+#undef CSRILUK_DIM
+    }
+
+    // Numeric phase, the sync-free ILU0 factorization on the sparsity pattern of the
+    // factors
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrilu0_dispatch(handle,
+                                          m,
+                                          lu_nnz,
+                                          descr,
+                                          lu_val,
+                                          lu_row_ptr,
+                                          lu_col_ind,
+                                          info,
+                                          csriluk_info->lu_info,
+                                          policy,
+                                          temp_buffer,
+                                          reinterpret_cast<const U*>(info->boost_tol),
+                                          reinterpret_cast<const T*>(info->boost_val));
+    }
+    else
+    {
+        return rocsparse_csrilu0_dispatch(
+            handle,
+            m,
+            lu_nnz,
+            descr,
+            lu_val,
+            lu_row_ptr,
+            lu_col_ind,
+            info,
+            csriluk_info->lu_info,
+            policy,
+            temp_buffer,
+            (info->boost_enable != 0) ? *reinterpret_cast<const U*>(info->boost_tol)
+                                      : static_cast<U>(0),
+            (info->boost_enable != 0) ? *reinterpret_cast<const T*>(info->boost_val)
+                                      : static_cast<T>(0));
+    }
+}
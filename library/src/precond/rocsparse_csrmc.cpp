@@ -0,0 +1,359 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csrmc.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrmc_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size)
+try
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrmc_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Sorted colors, identity and inverse permutation
+    *buffer_size = ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256 * 3;
+
+    // Entry positions
+    *buffer_size += ((sizeof(rocsparse_int) * nnz) / 256 + 1) * 256;
+
+    // Scratch space shared by rocprim and csrsort
+    size_t work_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrmc_work_size(handle, m, nnz, csr_row_ptr, csr_col_ind, &work_size));
+
+    *buffer_size += work_size;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             ncolors,     \
+                                     const rocsparse_int*      coloring,    \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_int*            perm,        \
+                                     TYPE*                     mc_val,      \
+                                     rocsparse_int*            mc_row_ptr,  \
+                                     rocsparse_int*            mc_col_ind,  \
+                                     void*                     temp_buffer) \
+    try                                                                     \
+    {                                                                       \
+        return rocsparse_csrmc_reorder_template(handle,                     \
+                                                m,                          \
+                                                nnz,                        \
+                                                descr,                      \
+                                                csr_val,                    \
+                                                csr_row_ptr,                \
+                                                csr_col_ind,                \
+                                                ncolors,                    \
+                                                coloring,                   \
+                                                info,                       \
+                                                perm,                       \
+                                                mc_val,                     \
+                                                mc_row_ptr,                 \
+                                                mc_col_ind,                 \
+                                                temp_buffer);               \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocsparse_status();                             \
+    }
+
+C_IMPL(rocsparse_scsrmc_reorder, float);
+C_IMPL(rocsparse_dcsrmc_reorder, double);
+C_IMPL(rocsparse_ccsrmc_reorder, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmc_reorder, rocsparse_double_complex);
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                 \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,     \
+                                     rocsparse_int             m,          \
+                                     rocsparse_int             nnz,        \
+                                     const rocsparse_mat_descr descr,      \
+                                     TYPE*                     mc_val,     \
+                                     const rocsparse_int*      mc_row_ptr, \
+                                     const rocsparse_int*      mc_col_ind, \
+                                     rocsparse_mat_info        info)       \
+    try                                                                    \
+    {                                                                      \
+        return rocsparse_csrmcilu0_template(handle,                        \
+                                            m,                             \
+                                            nnz,                           \
+                                            descr,                         \
+                                            mc_val,                        \
+                                            mc_row_ptr,                    \
+                                            mc_col_ind,                    \
+                                            info);                         \
+    }                                                                      \
+    catch(...)                                                             \
+    {                                                                      \
+        return exception_to_rocsparse_status();                            \
+    }
+
+C_IMPL(rocsparse_scsrmcilu0, float);
+C_IMPL(rocsparse_dcsrmcilu0, double);
+C_IMPL(rocsparse_ccsrmcilu0, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmcilu0, rocsparse_double_complex);
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                 \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,     \
+                                     rocsparse_int             m,          \
+                                     rocsparse_int             nnz,        \
+                                     const rocsparse_mat_descr descr,      \
+                                     const TYPE*               mc_val,     \
+                                     const rocsparse_int*      mc_row_ptr, \
+                                     const rocsparse_int*      mc_col_ind, \
+                                     rocsparse_mat_info        info,       \
+                                     rocsparse_int             nsweeps,    \
+                                     int                       symmetric,  \
+                                     const TYPE*               b,          \
+                                     TYPE*                     x)          \
+    try                                                                    \
+    {                                                                      \
+        return rocsparse_csrmcgs_template(handle,                          \
+                                          m,                               \
+                                          nnz,                             \
+                                          descr,                           \
+                                          mc_val,                          \
+                                          mc_row_ptr,                      \
+                                          mc_col_ind,                      \
+                                          info,                            \
+                                          nsweeps,                         \
+                                          symmetric,                       \
+                                          b,                               \
+                                          x);                              \
+    }                                                                      \
+    catch(...)                                                             \
+    {                                                                      \
+        return exception_to_rocsparse_status();                            \
+    }
+
+C_IMPL(rocsparse_scsrmcgs, float);
+C_IMPL(rocsparse_dcsrmcgs, double);
+C_IMPL(rocsparse_ccsrmcgs, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmcgs, rocsparse_double_complex);
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrmc_zero_pivot(rocsparse_handle   handle,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_int*     position)
+try
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmc_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csrmc_info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 0xFF, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 0xFF, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_csrmc_clear(rocsparse_handle handle, rocsparse_mat_info info)
+try
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmc_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmc_info(info->csrmc_info));
+    info->csrmc_info = nullptr;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
@@ -0,0 +1,709 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../level1/rocsparse_gthr.hpp"
+#include "csrmc_device.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+// Size of the rocprim and csrsort scratch space shared by the steps of csrmc_reorder
+inline rocsparse_status rocsparse_csrmc_work_size(rocsparse_handle     handle,
+                                                  rocsparse_int        m,
+                                                  rocsparse_int        nnz,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  size_t*              work_size)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* ptr = nullptr;
+
+    // rocprim radix sort of the colors
+    size_t sort_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, sort_size, ptr, ptr, ptr, ptr, m, 0, sizeof(rocsparse_int) * 8, stream));
+
+    // rocprim inclusive scan of the row pointers
+    size_t scan_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    // Sorting the relabeled column indices
+    size_t csrsort_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrsort_buffer_size(handle, m, m, nnz, csr_row_ptr, csr_col_ind, &csrsort_size));
+
+    *work_size = std::max(std::max(sort_size, scan_size), csrsort_size);
+    *work_size = ((*work_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmc_reorder_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             ncolors,
+                                                  const rocsparse_int*      coloring,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int*            perm,
+                                                  T*                        mc_val,
+                                                  rocsparse_int*            mc_row_ptr,
+                                                  rocsparse_int*            mc_col_ind,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmc_reorder"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              ncolors,
+              (const void*&)coloring,
+              (const void*&)info,
+              (const void*&)perm,
+              (const void*&)mc_val,
+              (const void*&)mc_row_ptr,
+              (const void*&)mc_col_ind,
+              (const void*&)temp_buffer);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || ncolors < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || coloring == nullptr || perm == nullptr || mc_row_ptr == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (mc_val == nullptr || mc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Sorted colors
+    rocsparse_int* sorted_colors = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Identity
+    rocsparse_int* identity = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Inverse permutation, mapping rows of A to rows of the color ordered matrix
+    rocsparse_int* iperm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Position of each entry of the color ordered matrix in A
+    rocsparse_int* pos = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnz) / 256 + 1) * 256;
+
+    // Scratch space shared by rocprim and csrsort
+    void* work = reinterpret_cast<void*>(ptr);
+
+    size_t work_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrmc_work_size(handle, m, nnz, csr_row_ptr, csr_col_ind, &work_size));
+
+#define CSRMC_DIM 256
+    // The sort only considers the bits of [0, ncolors), colors out of range, like the
+    // negative colors of rows left uncolored by csrcolor, are rejected. The sorted colors
+    // are not written yet and hold the flag.
+    rocsparse_int invalid;
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(sorted_colors, 0, sizeof(rocsparse_int), stream));
+    hipLaunchKernelGGL((csrmc_check_colors<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       ncolors,
+                       coloring,
+                       sorted_colors);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &invalid, sorted_colors, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(invalid != 0)
+    {
+        log_debug(handle, "The colors must be in [0, ncolors).");
+        return rocsparse_status_invalid_value;
+    }
+
+    // Create csrmc info, if not yet available
+    if(info->csrmc_info == nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmc_info(&info->csrmc_info));
+    }
+
+    rocsparse_csrmc_info csrmc_info = info->csrmc_info;
+
+    // Allocate diagonal entry points, if the size has changed
+    if(csrmc_info->diag_ind != nullptr && csrmc_info->m != m)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(csrmc_info->diag_ind));
+        csrmc_info->diag_ind = nullptr;
+    }
+
+    if(csrmc_info->diag_ind == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMalloc((void**)&csrmc_info->diag_ind, sizeof(rocsparse_int) * m));
+    }
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync((void**)&info->zero_pivot, sizeof(rocsparse_int), stream));
+    }
+
+    // Initialize zero pivot
+    RETURN_IF_HIP_ERROR(rocsparse_assign_async(static_cast<rocsparse_int*>(info->zero_pivot),
+                                               std::numeric_limits<rocsparse_int>::max(),
+                                               stream));
+
+    // Sort the rows by color, the stable sort keeps the original order within a color
+    hipLaunchKernelGGL((csrmc_identity<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       identity);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(work,
+                                                  work_size,
+                                                  coloring,
+                                                  sorted_colors,
+                                                  identity,
+                                                  perm,
+                                                  m,
+                                                  0,
+                                                  std::max(rocsparse_clz(ncolors), 1),
+                                                  stream));
+
+    // Color offsets into the rows of the color ordered matrix, colors might be unused
+    // such that ncolors is not bounded by m
+    rocsparse_int* color_ptr = nullptr;
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+        (void**)&color_ptr, sizeof(rocsparse_int) * (ncolors + 1), stream));
+
+    hipLaunchKernelGGL((csrmc_color_ptr<CSRMC_DIM>),
+                       dim3(ncolors / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       ncolors,
+                       sorted_colors,
+                       color_ptr);
+
+    csrmc_info->m       = m;
+    csrmc_info->ncolors = ncolors;
+    csrmc_info->color_ptr.resize(ncolors + 1);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrmc_info->color_ptr.data(),
+                                       color_ptr,
+                                       sizeof(rocsparse_int) * (ncolors + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(color_ptr, stream));
+
+    // Inverse permutation
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_inverse_permutation(handle, m, perm, iperm, rocsparse_index_base_zero));
+
+    // Row pointers of the color ordered matrix
+    hipLaunchKernelGGL((csrmc_row_nnz<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       perm,
+                       mc_row_ptr,
+                       descr->base);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(work,
+                                                work_size,
+                                                mc_row_ptr,
+                                                mc_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(nnz > 0)
+    {
+        // Relabel the column indices, rows of the color ordered matrix are unsorted
+#define CSRMC_SUB 8
+        hipLaunchKernelGGL((csrmc_permute_cols<CSRMC_DIM, CSRMC_SUB>),
+                           dim3((m - 1) / (CSRMC_DIM / CSRMC_SUB) + 1),
+                           dim3(CSRMC_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           iperm,
+                           mc_row_ptr,
+                           mc_col_ind,
+                           pos,
+                           descr->base);
+#undef CSRMC_SUB
+
+        // Sort the rows of the color ordered matrix and gather its values
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrsort(handle, m, m, nnz, descr, mc_row_ptr, mc_col_ind, pos, work));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
+            handle, nnz, csr_val, mc_val, (const rocsparse_int*)pos, rocsparse_index_base_zero));
+    }
+
+    // Diagonal entry points of the color ordered matrix
+    hipLaunchKernelGGL((csrmc_diag_ind<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       (const rocsparse_int*)mc_row_ptr,
+                       (const rocsparse_int*)mc_col_ind,
+                       (rocsparse_int*)csrmc_info->diag_ind,
+                       descr->base);
+#undef CSRMC_DIM
+
+    // Wait for the color offsets to arrive on the host
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcilu0_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              T*                        mc_val,
+                                              const rocsparse_int*      mc_row_ptr,
+                                              const rocsparse_int*      mc_col_ind,
+                                              rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmcilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)mc_val,
+              (const void*&)mc_row_ptr,
+              (const void*&)mc_col_ind,
+              (const void*&)info);
+
+    log_bench(handle, "./rocsparse-bench -f csrmc -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Profiling
+    const rocsparse_profile_guard profile_guard(
+        handle, replaceX<T>("rocsparse_Xcsrmcilu0"), rocsparse_get_datatype<T>(), m, nnz);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(mc_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((mc_val == nullptr && mc_col_ind != nullptr) || (mc_val != nullptr && mc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (mc_val == nullptr && mc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for reordering call
+    if(info->csrmc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrmc_info csrmc_info = info->csrmc_info;
+
+    // Reordering must have been performed on a matrix of the same size
+    if(csrmc_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Initialize zero pivot
+    RETURN_IF_HIP_ERROR(rocsparse_assign_async(static_cast<rocsparse_int*>(info->zero_pivot),
+                                               std::numeric_limits<rocsparse_int>::max(),
+                                               stream));
+
+    // Number of threads per row, chosen by the average number of entries per row
+    const rocsparse_int mean = std::max(nnz / m, 1);
+
+#define CSRMCILU0_DIM 256
+#define LAUNCH_CSRMCILU0_COLOR(CSRMCILU0_SUB)                                   \
+    hipLaunchKernelGGL((csrmcilu0_color<CSRMCILU0_DIM, CSRMCILU0_SUB>),         \
+                       dim3((nrows - 1) / (CSRMCILU0_DIM / CSRMCILU0_SUB) + 1), \
+                       dim3(CSRMCILU0_DIM),                                     \
+                       0,                                                       \
+                       stream,                                                  \
+                       row_begin,                                               \
+                       nrows,                                                   \
+                       mc_row_ptr,                                              \
+                       mc_col_ind,                                              \
+                       mc_val,                                                  \
+                       (const rocsparse_int*)csrmc_info->diag_ind,              \
+                       (rocsparse_int*)info->zero_pivot,                        \
+                       descr->base)
+
+    // Process one color at a time, all rows of a color are independent
+    for(rocsparse_int c = 0; c < csrmc_info->ncolors; ++c)
+    {
+        const rocsparse_int row_begin = csrmc_info->color_ptr[c];
+        const rocsparse_int nrows     = csrmc_info->color_ptr[c + 1] - row_begin;
+
+        if(nrows == 0)
+        {
+            continue;
+        }
+
+        if(mean <= 8)
+        {
+            LAUNCH_CSRMCILU0_COLOR(4);
+        }
+        else if(mean <= 16)
+        {
+            LAUNCH_CSRMCILU0_COLOR(8);
+        }
+        else if(mean <= 32)
+        {
+            LAUNCH_CSRMCILU0_COLOR(16);
+        }
+        else if(mean <= 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMCILU0_COLOR(32);
+        }
+        else
+        {
+            LAUNCH_CSRMCILU0_COLOR(64);
+        }
+    }
+#undef LAUNCH_CSRMCILU0_COLOR
+#undef CSRMCILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcgs_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  mc_val,
+                                            const rocsparse_int*      mc_row_ptr,
+                                            const rocsparse_int*      mc_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             nsweeps,
+                                            int                       symmetric,
+                                            const T*                  b,
+                                            T*                        x)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmcgs"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)mc_val,
+              (const void*&)mc_row_ptr,
+              (const void*&)mc_col_ind,
+              (const void*&)info,
+              nsweeps,
+              symmetric,
+              (const void*&)b,
+              (const void*&)x);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrmc -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sizek",
+              nsweeps);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || nsweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nsweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(mc_row_ptr == nullptr || b == nullptr || x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((mc_val == nullptr && mc_col_ind != nullptr) || (mc_val != nullptr && mc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (mc_val == nullptr && mc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for reordering call
+    if(info->csrmc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrmc_info csrmc_info = info->csrmc_info;
+
+    // Reordering must have been performed on a matrix of the same size
+    if(csrmc_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of threads per row, chosen by the average number of entries per row
+    const rocsparse_int mean = std::max(nnz / m, 1);
+
+#define CSRMCGS_DIM 256
+#define LAUNCH_CSRMCGS_COLOR(CSRMCGS_SUB)                                   \
+    hipLaunchKernelGGL((csrmcgs_color<CSRMCGS_DIM, CSRMCGS_SUB>),           \
+                       dim3((nrows - 1) / (CSRMCGS_DIM / CSRMCGS_SUB) + 1), \
+                       dim3(CSRMCGS_DIM),                                   \
+                       0,                                                   \
+                       stream,                                              \
+                       row_begin,                                           \
+                       nrows,                                               \
+                       mc_row_ptr,                                          \
+                       mc_col_ind,                                          \
+                       mc_val,                                              \
+                       (const rocsparse_int*)csrmc_info->diag_ind,          \
+                       b,                                                   \
+                       x,                                                   \
+                       descr->base)
+
+    const rocsparse_int ncolors = static_cast<rocsparse_int>(csrmc_info->ncolors);
+
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        // Forward sweep over the colors, followed by a backward sweep if symmetric. The
+        // backward sweep starts at the second to last color, relaxing the last color
+        // again would not change x, since its rows are not coupled.
+        for(rocsparse_int s = 0; s < (symmetric ? 2 * ncolors - 1 : ncolors); ++s)
+        {
+            const rocsparse_int c         = (s < ncolors) ? s : 2 * ncolors - 2 - s;
+            const rocsparse_int row_begin = csrmc_info->color_ptr[c];
+            const rocsparse_int nrows     = csrmc_info->color_ptr[c + 1] - row_begin;
+
+            if(nrows == 0)
+            {
+                continue;
+            }
+
+            if(mean <= 2)
+            {
+                LAUNCH_CSRMCGS_COLOR(1);
+            }
+            else if(mean <= 4)
+            {
+                LAUNCH_CSRMCGS_COLOR(2);
+            }
+            else if(mean <= 8)
+            {
+                LAUNCH_CSRMCGS_COLOR(4);
+            }
+            else if(mean <= 16)
+            {
+                LAUNCH_CSRMCGS_COLOR(8);
+            }
+            else if(mean <= 32)
+            {
+                LAUNCH_CSRMCGS_COLOR(16);
+            }
+            else if(mean <= 64 || handle->wavefront_size == 32)
+            {
+                LAUNCH_CSRMCGS_COLOR(32);
+            }
+            else
+            {
+                LAUNCH_CSRMCGS_COLOR(64);
+            }
+        }
+    }
+#undef LAUNCH_CSRMCGS_COLOR
+#undef CSRMCGS_DIM
+
+    return rocsparse_status_success;
+}
@@ -72,6 +72,72 @@ module rocsparse
             type(c_ptr) :: stream
         end function rocsparse_get_stream
 
+!       rocsparse_memory_pool
+        function rocsparse_set_memory_pool_limit(handle, max_cached_bytes) &
+                bind(c, name = 'rocsparse_set_memory_pool_limit')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_memory_pool_limit
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: max_cached_bytes
+        end function rocsparse_set_memory_pool_limit
+
+        function rocsparse_trim_memory_pool(handle) &
+                bind(c, name = 'rocsparse_trim_memory_pool')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_trim_memory_pool
+            type(c_ptr), value :: handle
+        end function rocsparse_trim_memory_pool
+
+        function rocsparse_get_memory_pool_info(handle, bytes_in_use, bytes_cached, &
+                high_water_mark) &
+                bind(c, name = 'rocsparse_get_memory_pool_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_memory_pool_info
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: bytes_in_use
+            type(c_ptr), value :: bytes_cached
+            type(c_ptr), value :: high_water_mark
+        end function rocsparse_get_memory_pool_info
+
+!       rocsparse_analysis_cache
+        function rocsparse_set_analysis_cache_size(handle, max_entries) &
+                bind(c, name = 'rocsparse_set_analysis_cache_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_analysis_cache_size
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: max_entries
+        end function rocsparse_set_analysis_cache_size
+
+        function rocsparse_clear_analysis_cache(handle) &
+                bind(c, name = 'rocsparse_clear_analysis_cache')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_clear_analysis_cache
+            type(c_ptr), value :: handle
+        end function rocsparse_clear_analysis_cache
+
+        function rocsparse_get_analysis_cache_info(handle, num_entries, num_hits, &
+                num_misses) &
+                bind(c, name = 'rocsparse_get_analysis_cache_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_analysis_cache_info
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: num_entries
+            type(c_ptr), value :: num_hits
+            type(c_ptr), value :: num_misses
+        end function rocsparse_get_analysis_cache_info
+
 !       rocsparse_pointer_mode
         function rocsparse_set_pointer_mode(handle, pointer_mode) &
                 bind(c, name = 'rocsparse_set_pointer_mode')
@@ -93,6 +159,48 @@ module rocsparse
             integer(c_int) :: pointer_mode
         end function rocsparse_get_pointer_mode
 
+!       rocsparse_sizes_mode
+        function rocsparse_set_sizes_mode(handle, sizes_mode) &
+                bind(c, name = 'rocsparse_set_sizes_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_sizes_mode
+            type(c_ptr), value :: handle
+            integer(c_int), value :: sizes_mode
+        end function rocsparse_set_sizes_mode
+
+        function rocsparse_get_sizes_mode(handle, sizes_mode) &
+                bind(c, name = 'rocsparse_get_sizes_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_sizes_mode
+            type(c_ptr), value :: handle
+            integer(c_int) :: sizes_mode
+        end function rocsparse_get_sizes_mode
+
+!       rocsparse_itilu0_check_interval
+        function rocsparse_set_itilu0_check_interval(handle, check_interval) &
+                bind(c, name = 'rocsparse_set_itilu0_check_interval')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_itilu0_check_interval
+            type(c_ptr), value :: handle
+            integer(c_int), value :: check_interval
+        end function rocsparse_set_itilu0_check_interval
+
+        function rocsparse_get_itilu0_check_interval(handle, check_interval) &
+                bind(c, name = 'rocsparse_get_itilu0_check_interval')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_itilu0_check_interval
+            type(c_ptr), value :: handle
+            integer(c_int) :: check_interval
+        end function rocsparse_get_itilu0_check_interval
+
 !       rocsparse_version
         function rocsparse_get_version(handle, version) &
                 bind(c, name = 'rocsparse_get_version')
@@ -261,6 +369,55 @@ module rocsparse
             type(c_ptr), value :: info
         end function rocsparse_destroy_mat_info
 
+        function rocsparse_export_mat_info_buffer_size(handle, info, buffer_size) &
+                bind(c, name = 'rocsparse_export_mat_info_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_export_mat_info_buffer_size
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_export_mat_info_buffer_size
+
+        function rocsparse_csr_export_mat_info(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, buffer_size, buffer) &
+                bind(c, name = 'rocsparse_csr_export_mat_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr_export_mat_info
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: info
+            integer(c_size_t), value :: buffer_size
+            type(c_ptr), value :: buffer
+        end function rocsparse_csr_export_mat_info
+
+        function rocsparse_csr_import_mat_info(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, buffer_size, buffer) &
+                bind(c, name = 'rocsparse_csr_import_mat_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr_import_mat_info
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_size_t), value :: buffer_size
+            type(c_ptr), intent(in), value :: buffer
+        end function rocsparse_csr_import_mat_info
+
 ! ===========================================================================
 !   level 1 SPARSE
 ! ===========================================================================
@@ -4053,6 +4210,591 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsrilu0
 
+!       rocsparse_csriluk_zero_pivot
+        function rocsparse_csriluk_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csriluk_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csriluk_zero_pivot
+
+!       rocsparse_csriluk_nnz
+        function rocsparse_csriluk_nnz(handle, info, lu_nnz) &
+                bind(c, name = 'rocsparse_csriluk_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_nnz
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: lu_nnz
+        end function rocsparse_csriluk_nnz
+
+!       rocsparse_csriluk_buffer_size
+        function rocsparse_scsriluk_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsriluk_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsriluk_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsriluk_buffer_size
+
+        function rocsparse_dcsriluk_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsriluk_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsriluk_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsriluk_buffer_size
+
+        function rocsparse_ccsriluk_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsriluk_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsriluk_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsriluk_buffer_size
+
+        function rocsparse_zcsriluk_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsriluk_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsriluk_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsriluk_buffer_size
+
+!       rocsparse_csriluk_analysis
+        function rocsparse_scsriluk_analysis(handle, level, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, analysis, solve, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_scsriluk_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsriluk_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: level
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsriluk_analysis
+
+        function rocsparse_dcsriluk_analysis(handle, level, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, analysis, solve, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dcsriluk_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsriluk_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: level
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsriluk_analysis
+
+        function rocsparse_ccsriluk_analysis(handle, level, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, analysis, solve, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_ccsriluk_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsriluk_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: level
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsriluk_analysis
+
+        function rocsparse_zcsriluk_analysis(handle, level, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, analysis, solve, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zcsriluk_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsriluk_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: level
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsriluk_analysis
+
+!       rocsparse_csriluk_clear
+        function rocsparse_csriluk_clear(handle, info) &
+                bind(c, name = 'rocsparse_csriluk_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csriluk_clear
+
+!       rocsparse_csriluk
+        function rocsparse_scsriluk(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, lu_val, lu_row_ptr, &
+                lu_col_ind, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: lu_val
+            type(c_ptr), value :: lu_row_ptr
+            type(c_ptr), value :: lu_col_ind
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsriluk
+
+        function rocsparse_dcsriluk(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, lu_val, lu_row_ptr, &
+                lu_col_ind, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: lu_val
+            type(c_ptr), value :: lu_row_ptr
+            type(c_ptr), value :: lu_col_ind
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsriluk
+
+        function rocsparse_ccsriluk(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, lu_val, lu_row_ptr, &
+                lu_col_ind, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: lu_val
+            type(c_ptr), value :: lu_row_ptr
+            type(c_ptr), value :: lu_col_ind
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsriluk
+
+        function rocsparse_zcsriluk(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, lu_val, lu_row_ptr, &
+                lu_col_ind, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: lu_val
+            type(c_ptr), value :: lu_row_ptr
+            type(c_ptr), value :: lu_col_ind
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsriluk
+
+!       rocsparse_csrmc_zero_pivot
+        function rocsparse_csrmc_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrmc_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrmc_zero_pivot
+
+!       rocsparse_csrmc_buffer_size
+        function rocsparse_csrmc_buffer_size(handle, m, nnz, descr, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_csrmc_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csrmc_buffer_size
+
+!       rocsparse_csrmc_reorder
+        function rocsparse_scsrmc_reorder(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, &
+                info, perm, mc_val, mc_row_ptr, mc_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrmc_reorder')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmc_reorder
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: ncolors
+            type(c_ptr), intent(in), value :: coloring
+            type(c_ptr), value :: info
+            type(c_ptr), value :: perm
+            type(c_ptr), value :: mc_val
+            type(c_ptr), value :: mc_row_ptr
+            type(c_ptr), value :: mc_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrmc_reorder
+
+        function rocsparse_dcsrmc_reorder(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, &
+                info, perm, mc_val, mc_row_ptr, mc_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrmc_reorder')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmc_reorder
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: ncolors
+            type(c_ptr), intent(in), value :: coloring
+            type(c_ptr), value :: info
+            type(c_ptr), value :: perm
+            type(c_ptr), value :: mc_val
+            type(c_ptr), value :: mc_row_ptr
+            type(c_ptr), value :: mc_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrmc_reorder
+
+        function rocsparse_ccsrmc_reorder(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, &
+                info, perm, mc_val, mc_row_ptr, mc_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrmc_reorder')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmc_reorder
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: ncolors
+            type(c_ptr), intent(in), value :: coloring
+            type(c_ptr), value :: info
+            type(c_ptr), value :: perm
+            type(c_ptr), value :: mc_val
+            type(c_ptr), value :: mc_row_ptr
+            type(c_ptr), value :: mc_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrmc_reorder
+
+        function rocsparse_zcsrmc_reorder(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, &
+                info, perm, mc_val, mc_row_ptr, mc_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrmc_reorder')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmc_reorder
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: ncolors
+            type(c_ptr), intent(in), value :: coloring
+            type(c_ptr), value :: info
+            type(c_ptr), value :: perm
+            type(c_ptr), value :: mc_val
+            type(c_ptr), value :: mc_row_ptr
+            type(c_ptr), value :: mc_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrmc_reorder
+
+!       rocsparse_csrmc_clear
+        function rocsparse_csrmc_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrmc_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrmc_clear
+
+!       rocsparse_csrmcilu0
+        function rocsparse_scsrmcilu0(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info) &
+                bind(c, name = 'rocsparse_scsrmcilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmcilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_scsrmcilu0
+
+        function rocsparse_dcsrmcilu0(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info) &
+                bind(c, name = 'rocsparse_dcsrmcilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmcilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_dcsrmcilu0
+
+        function rocsparse_ccsrmcilu0(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info) &
+                bind(c, name = 'rocsparse_ccsrmcilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmcilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_ccsrmcilu0
+
+        function rocsparse_zcsrmcilu0(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info) &
+                bind(c, name = 'rocsparse_zcsrmcilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmcilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_zcsrmcilu0
+
+!       rocsparse_csrmcgs
+        function rocsparse_scsrmcgs(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info, nsweeps, symmetric, b, x) &
+                bind(c, name = 'rocsparse_scsrmcgs')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmcgs
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            integer(c_int), value :: symmetric
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_scsrmcgs
+
+        function rocsparse_dcsrmcgs(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info, nsweeps, symmetric, b, x) &
+                bind(c, name = 'rocsparse_dcsrmcgs')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmcgs
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            integer(c_int), value :: symmetric
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_dcsrmcgs
+
+        function rocsparse_ccsrmcgs(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info, nsweeps, symmetric, b, x) &
+                bind(c, name = 'rocsparse_ccsrmcgs')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmcgs
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            integer(c_int), value :: symmetric
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_ccsrmcgs
+
+        function rocsparse_zcsrmcgs(handle, m, nnz, descr, mc_val, &
+                mc_row_ptr, mc_col_ind, info, nsweeps, symmetric, b, x) &
+                bind(c, name = 'rocsparse_zcsrmcgs')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmcgs
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: mc_val
+            type(c_ptr), intent(in), value :: mc_row_ptr
+            type(c_ptr), intent(in), value :: mc_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            integer(c_int), value :: symmetric
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_zcsrmcgs
+
 !       rocsparse_gtsv_buffer_size
         function rocsparse_sgtsv_buffer_size(handle, m, n, dl, d, du, &
                 B, ldb, buffer_size) &
@@ -0,0 +1,393 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "analysis_cache.h"
+#include "definitions.h"
+#include "envariables.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <list>
+
+// Number of entries when the cache is enabled through ROCSPARSE_ANALYSIS_CACHE
+static constexpr size_t default_capacity = 16;
+
+struct rocsparse_analysis_cache_entry
+{
+    rocsparse_analysis_cache_key key;
+
+    // trm
+    rocsparse_trm_info trm{};
+    void*              zero_pivot{};
+
+    // csrmv
+    rocsparse_csrmv_info csrmv{};
+
+    // csrgemm_nnz
+    void*   csr_row_ptr_C{};
+    int64_t nnz_C{};
+};
+
+struct _rocsparse_analysis_cache
+{
+    size_t capacity{};
+    size_t num_hits{};
+    size_t num_misses{};
+
+    // Most recently used entry first
+    std::list<rocsparse_analysis_cache_entry> entries;
+};
+
+static size_t analysis_cache_index_size(rocsparse_indextype type)
+{
+    switch(type)
+    {
+    case rocsparse_indextype_u16:
+    {
+        return sizeof(uint16_t);
+    }
+    case rocsparse_indextype_i32:
+    {
+        return sizeof(int32_t);
+    }
+    case rocsparse_indextype_i64:
+    {
+        return sizeof(int64_t);
+    }
+    }
+    return 0;
+}
+
+static rocsparse_status analysis_cache_release(rocsparse_analysis_cache_entry& entry)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(entry.trm));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(entry.csrmv));
+
+    if(entry.zero_pivot != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(entry.zero_pivot));
+    }
+
+    if(entry.csr_row_ptr_C != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(entry.csr_row_ptr_C));
+    }
+
+    entry = rocsparse_analysis_cache_entry();
+    return rocsparse_status_success;
+}
+
+// Evict the least recently used entries until at most max_entries are left
+static rocsparse_status analysis_cache_evict(rocsparse_analysis_cache cache, size_t max_entries)
+{
+    while(cache->entries.size() > max_entries)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(analysis_cache_release(cache->entries.back()));
+        cache->entries.pop_back();
+    }
+    return rocsparse_status_success;
+}
+
+// Find the entry of key and move it to the front, or return nullptr
+static rocsparse_analysis_cache_entry*
+    analysis_cache_lookup(rocsparse_analysis_cache cache, const rocsparse_analysis_cache_key& key)
+{
+    for(auto it = cache->entries.begin(); it != cache->entries.end(); ++it)
+    {
+        if(it->key == key)
+        {
+            cache->entries.splice(cache->entries.begin(), cache->entries, it);
+            ++cache->num_hits;
+            return &cache->entries.front();
+        }
+    }
+
+    ++cache->num_misses;
+    return nullptr;
+}
+
+// Add a filled entry at the front, replacing the entry of the same key. If filling
+// the entry failed, its data is released instead.
+static rocsparse_status analysis_cache_push(rocsparse_analysis_cache        cache,
+                                            rocsparse_analysis_cache_entry& entry,
+                                            rocsparse_status                fill_status)
+{
+    if(fill_status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(analysis_cache_release(entry));
+        return fill_status;
+    }
+
+    for(auto it = cache->entries.begin(); it != cache->entries.end(); ++it)
+    {
+        if(it->key == entry.key)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(analysis_cache_release(*it));
+            cache->entries.erase(it);
+            break;
+        }
+    }
+
+    cache->entries.push_front(entry);
+    return analysis_cache_evict(cache, cache->capacity);
+}
+
+static rocsparse_status analysis_cache_fill_trm(rocsparse_analysis_cache_entry& entry,
+                                                const _rocsparse_trm_info*      trm,
+                                                const void*                     zero_pivot)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&entry.trm));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_copy_trm_info(entry.trm, const_cast<rocsparse_trm_info>(trm)));
+
+    // The cached data outlives the matrix arrays it has been computed from
+    entry.trm->descr       = nullptr;
+    entry.trm->trm_row_ptr = nullptr;
+    entry.trm->trm_col_ind = nullptr;
+
+    size_t pivot_size = analysis_cache_index_size(entry.key.index_type_J);
+    RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&entry.zero_pivot, pivot_size));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(entry.zero_pivot, zero_pivot, pivot_size, hipMemcpyDeviceToDevice));
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status analysis_cache_fill_csrmv(rocsparse_analysis_cache_entry& entry,
+                                                  const _rocsparse_csrmv_info*    csrmv)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&entry.csrmv));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_copy_csrmv_info(entry.csrmv, const_cast<rocsparse_csrmv_info>(csrmv)));
+
+    // The cached data outlives the matrix arrays it has been computed from
+    entry.csrmv->descr       = nullptr;
+    entry.csrmv->csr_row_ptr = nullptr;
+    entry.csrmv->csr_col_ind = nullptr;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status analysis_cache_fill_csrgemm_nnz(rocsparse_analysis_cache_entry& entry,
+                                                        const void* csr_row_ptr_C,
+                                                        int64_t     nnz_C)
+{
+    size_t row_ptr_size
+        = analysis_cache_index_size(entry.key.index_type_I) * (entry.key.sizes[0] + 1);
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&entry.csr_row_ptr_C, row_ptr_size));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(entry.csr_row_ptr_C, csr_row_ptr_C, row_ptr_size, hipMemcpyDeviceToDevice));
+
+    entry.nnz_C = nnz_C;
+    return rocsparse_status_success;
+}
+
+bool rocsparse_analysis_cache_key::operator==(const rocsparse_analysis_cache_key& that) const
+{
+    return this->kind == that.kind && this->hash == that.hash && this->sizes[0] == that.sizes[0]
+           && this->sizes[1] == that.sizes[1] && this->sizes[2] == that.sizes[2]
+           && this->index_type_I == that.index_type_I && this->index_type_J == that.index_type_J
+           && this->options[0] == that.options[0] && this->options[1] == that.options[1]
+           && this->options[2] == that.options[2] && this->options[3] == that.options[3];
+}
+
+rocsparse_analysis_cache rocsparse_analysis_cache_create()
+{
+    rocsparse_analysis_cache cache = new _rocsparse_analysis_cache;
+
+    cache->capacity = ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::ANALYSIS_CACHE)
+                          ? default_capacity
+                          : 0;
+    return cache;
+}
+
+void rocsparse_analysis_cache_destroy(rocsparse_analysis_cache cache)
+{
+    if(cache == nullptr)
+    {
+        return;
+    }
+
+    // Errors cannot be reported from the destructor of the handle
+    analysis_cache_evict(cache, 0);
+    delete cache;
+}
+
+bool rocsparse_analysis_cache_enabled(const _rocsparse_analysis_cache* cache)
+{
+    return cache != nullptr && cache->capacity > 0;
+}
+
+rocsparse_status rocsparse_analysis_cache_set_capacity(rocsparse_analysis_cache cache,
+                                                       size_t                   max_entries)
+{
+    RETURN_IF_ROCSPARSE_ERROR(analysis_cache_evict(cache, max_entries));
+    cache->capacity = max_entries;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_analysis_cache_clear(rocsparse_analysis_cache cache)
+{
+    RETURN_IF_ROCSPARSE_ERROR(analysis_cache_evict(cache, 0));
+    cache->num_hits   = 0;
+    cache->num_misses = 0;
+    return rocsparse_status_success;
+}
+
+void rocsparse_analysis_cache_get_info(const _rocsparse_analysis_cache* cache,
+                                       size_t*                          num_entries,
+                                       size_t*                          num_hits,
+                                       size_t*                          num_misses)
+{
+    *num_entries = cache->entries.size();
+    *num_hits    = cache->num_hits;
+    *num_misses  = cache->num_misses;
+}
+
+rocsparse_status rocsparse_analysis_cache_find_trm(rocsparse_analysis_cache            cache,
+                                                   const rocsparse_analysis_cache_key& key,
+                                                   _rocsparse_trm_info*                trm,
+                                                   void**                              zero_pivot,
+                                                   hipStream_t                         stream,
+                                                   bool*                               found)
+{
+    rocsparse_analysis_cache_entry* entry = analysis_cache_lookup(cache, key);
+
+    *found = (entry != nullptr);
+    if(entry == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_copy_trm_info(trm, entry->trm));
+
+    size_t pivot_size = analysis_cache_index_size(key.index_type_J);
+    if(*zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(zero_pivot, pivot_size, stream));
+    }
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        *zero_pivot, entry->zero_pivot, pivot_size, hipMemcpyDeviceToDevice, stream));
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_analysis_cache_insert_trm(rocsparse_analysis_cache            cache,
+                                                     const rocsparse_analysis_cache_key& key,
+                                                     const _rocsparse_trm_info*          trm,
+                                                     const void*                         zero_pivot,
+                                                     hipStream_t                         stream)
+{
+    if(cache->capacity == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The copies are not ordered with the analysis on the stream
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    rocsparse_analysis_cache_entry entry;
+    entry.key = key;
+    return analysis_cache_push(cache, entry, analysis_cache_fill_trm(entry, trm, zero_pivot));
+}
+
+rocsparse_status rocsparse_analysis_cache_find_csrmv(rocsparse_analysis_cache            cache,
+                                                     const rocsparse_analysis_cache_key& key,
+                                                     _rocsparse_csrmv_info*              csrmv,
+                                                     bool*                               found)
+{
+    rocsparse_analysis_cache_entry* entry = analysis_cache_lookup(cache, key);
+
+    *found = (entry != nullptr);
+    if(entry == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_copy_csrmv_info(csrmv, entry->csrmv));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_analysis_cache_insert_csrmv(rocsparse_analysis_cache            cache,
+                                                       const rocsparse_analysis_cache_key& key,
+                                                       const _rocsparse_csrmv_info*        csrmv,
+                                                       hipStream_t                         stream)
+{
+    if(cache->capacity == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The copies are not ordered with the analysis on the stream
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    rocsparse_analysis_cache_entry entry;
+    entry.key = key;
+    return analysis_cache_push(cache, entry, analysis_cache_fill_csrmv(entry, csrmv));
+}
+
+rocsparse_status rocsparse_analysis_cache_find_csrgemm_nnz(rocsparse_analysis_cache cache,
+                                                           const rocsparse_analysis_cache_key& key,
+                                                           void*       csr_row_ptr_C,
+                                                           int64_t*    nnz_C,
+                                                           hipStream_t stream,
+                                                           bool*       found)
+{
+    rocsparse_analysis_cache_entry* entry = analysis_cache_lookup(cache, key);
+
+    *found = (entry != nullptr);
+    if(entry == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    size_t row_ptr_size = analysis_cache_index_size(key.index_type_I) * (key.sizes[0] + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csr_row_ptr_C, entry->csr_row_ptr_C, row_ptr_size, hipMemcpyDeviceToDevice, stream));
+
+    *nnz_C = entry->nnz_C;
+    return rocsparse_status_success;
+}
+
+rocsparse_status
+    rocsparse_analysis_cache_insert_csrgemm_nnz(rocsparse_analysis_cache            cache,
+                                                const rocsparse_analysis_cache_key& key,
+                                                const void*                         csr_row_ptr_C,
+                                                int64_t                             nnz_C,
+                                                hipStream_t                         stream)
+{
+    if(cache->capacity == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The copy is not ordered with the computation on the stream
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    rocsparse_analysis_cache_entry entry;
+    entry.key = key;
+    return analysis_cache_push(
+        cache, entry, analysis_cache_fill_csrgemm_nnz(entry, csr_row_ptr_C, nnz_C));
+}
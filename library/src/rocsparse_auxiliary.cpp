@@ -137,6 +137,115 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief Indicates whether sizes computed on the device may be copied to the host.
+ * Set sizes mode, can be host or device
+ *******************************************************************************/
+rocsparse_status rocsparse_set_sizes_mode(rocsparse_handle handle, rocsparse_sizes_mode mode)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(mode))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    handle->sizes_mode = mode;
+    log_trace(handle, "rocsparse_set_sizes_mode", mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get sizes mode, can be host or device.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_sizes_mode(rocsparse_handle handle, rocsparse_sizes_mode* mode)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *mode = handle->sizes_mode;
+    log_trace(handle, "rocsparse_get_sizes_mode", *mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Set the number of iterative ILU0 sweeps between two convergence checks
+ * on the device.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_itilu0_check_interval(rocsparse_handle handle,
+                                                     rocsparse_int    check_interval)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(check_interval <= 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    handle->itilu0_check_interval = check_interval;
+    log_trace(handle, "rocsparse_set_itilu0_check_interval", check_interval);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the number of iterative ILU0 sweeps between two convergence checks
+ * on the device.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_itilu0_check_interval(rocsparse_handle handle,
+                                                     rocsparse_int*   check_interval)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(check_interval == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *check_interval = handle->itilu0_check_interval;
+    log_trace(handle, "rocsparse_get_itilu0_check_interval", *check_interval);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -176,6 +285,154 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief Limit the memory cached by the memory pool of the handle stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_memory_pool_limit(rocsparse_handle handle, size_t max_cached_bytes)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle, "rocsparse_set_memory_pool_limit", max_cached_bytes);
+    RETURN_IF_HIP_ERROR(rocsparse_memory_pool_set_limit(handle->memory_pool, max_cached_bytes));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Release the memory cached by the memory pool of the handle stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_trim_memory_pool(rocsparse_handle handle)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle, "rocsparse_trim_memory_pool");
+    RETURN_IF_HIP_ERROR(rocsparse_memory_pool_trim(handle->memory_pool));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the statistics of the memory pool of the handle stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_memory_pool_info(rocsparse_handle handle,
+                                                size_t*          bytes_in_use,
+                                                size_t*          bytes_cached,
+                                                size_t*          high_water_mark)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle,
+              "rocsparse_get_memory_pool_info",
+              (const void*&)bytes_in_use,
+              (const void*&)bytes_cached,
+              (const void*&)high_water_mark);
+
+    if(bytes_in_use == nullptr || bytes_cached == nullptr || high_water_mark == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_memory_pool_get_info(
+        handle->memory_pool, bytes_in_use, bytes_cached, high_water_mark);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Set the maximum number of entries of the analysis data cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t max_entries)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle, "rocsparse_set_analysis_cache_size", max_entries);
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_analysis_cache_set_capacity(handle->analysis_cache, max_entries));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Release the entries of the analysis data cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_clear_analysis_cache(rocsparse_handle handle)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle, "rocsparse_clear_analysis_cache");
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_clear(handle->analysis_cache));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the statistics of the analysis data cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_analysis_cache_info(rocsparse_handle handle,
+                                                   size_t*          num_entries,
+                                                   size_t*          num_hits,
+                                                   size_t*          num_misses)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    log_trace(handle,
+              "rocsparse_get_analysis_cache_info",
+              (const void*&)num_entries,
+              (const void*&)num_hits,
+              (const void*&)num_misses);
+
+    if(num_entries == nullptr || num_hits == nullptr || num_misses == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_analysis_cache_get_info(handle->analysis_cache, num_entries, num_hits, num_misses);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief Get rocSPARSE version
  * version % 100        = patch level
@@ -607,6 +864,16 @@ try
         T_size = sizeof(uint32_t);
         break;
     }
+    case rocsparse_datatype_f16_r:
+    {
+        T_size = sizeof(_Float16);
+        break;
+    }
+    case rocsparse_datatype_bf16_r:
+    {
+        T_size = sizeof(hip_bfloat16);
+        break;
+    }
     }
 
     if(src->ell_col_ind != nullptr)
@@ -676,6 +943,7 @@ try
     dest->ell_width   = src->ell_width;
     dest->ell_nnz     = src->ell_nnz;
     dest->coo_nnz     = src->coo_nnz;
+    dest->hybmv_bytes = src->hybmv_bytes;
     dest->data_type_T = src->data_type_T;
 
     return rocsparse_status_success;
@@ -685,6 +953,37 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief rocsparse_get_hyb_mat_partition returns the HYB matrix partitioning.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_hyb_mat_partition(const rocsparse_hyb_mat hyb,
+                                                 rocsparse_int*          ell_width,
+                                                 rocsparse_int*          coo_nnz,
+                                                 int64_t*                hybmv_bytes)
+try
+{
+    // Check for valid pointers
+    if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(ell_width == nullptr || coo_nnz == nullptr || hybmv_bytes == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *ell_width   = hyb->ell_width;
+    *coo_nnz     = hyb->coo_nnz;
+    *hybmv_bytes = hyb->hybmv_bytes;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief Destroy HYB matrix.
  *******************************************************************************/
@@ -1033,6 +1332,30 @@ try
             rocsparse_copy_csritsv_info(dest->csritsv_info, src->csritsv_info));
     }
 
+    if(src->csriluk_info != nullptr)
+    {
+        if(src->csriluk_info->lu_info != nullptr)
+        {
+            index_type_J = src->csriluk_info->lu_info->index_type_J;
+        }
+
+        if(dest->csriluk_info == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&dest->csriluk_info));
+        }
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_copy_csriluk_info(dest->csriluk_info, src->csriluk_info));
+    }
+
+    if(src->csrmc_info != nullptr)
+    {
+        if(dest->csrmc_info == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmc_info(&dest->csrmc_info));
+        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_copy_csrmc_info(dest->csrmc_info, src->csrmc_info));
+    }
+
     if(src->zero_pivot != nullptr)
     {
         // zero pivot for csrsv, csrsm, csrilu0, csric0
@@ -1300,6 +1623,18 @@ try
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csritsv_info(info->csritsv_info));
     }
 
+    // Clear csriluk info struct
+    if(info->csriluk_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
+    // Clear csrmc info struct
+    if(info->csrmc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmc_info(info->csrmc_info));
+    }
+
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
@@ -1915,6 +2250,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2011,6 +2347,7 @@ try
         new_descr->batch_stride                = 0;
         new_descr->offsets_batch_stride        = 0;
         new_descr->columns_values_batch_stride = 0;
+        new_descr->values_batch_stride         = 0;
 
         *descr = new_descr;
     }
@@ -2112,6 +2449,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2224,6 +2562,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2330,6 +2669,7 @@ try
         new_descr->batch_stride                = 0;
         new_descr->offsets_batch_stride        = 0;
         new_descr->columns_values_batch_stride = 0;
+        new_descr->values_batch_stride         = 0;
 
         *descr = new_descr;
     }
@@ -2444,6 +2784,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2550,6 +2891,7 @@ try
         new_descr->batch_stride                = 0;
         new_descr->offsets_batch_stride        = 0;
         new_descr->columns_values_batch_stride = 0;
+        new_descr->values_batch_stride         = 0;
 
         *descr = new_descr;
     }
@@ -2656,6 +2998,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2765,6 +3108,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -2867,6 +3211,7 @@ try
         new_descr->batch_stride                = 0;
         new_descr->offsets_batch_stride        = 0;
         new_descr->columns_values_batch_stride = 0;
+        new_descr->values_batch_stride         = 0;
 
         *descr = new_descr;
     }
@@ -2986,6 +3331,7 @@ try
         (*descr)->batch_stride                = 0;
         (*descr)->offsets_batch_stride        = 0;
         (*descr)->columns_values_batch_stride = 0;
+        (*descr)->values_batch_stride         = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -3649,6 +3995,9 @@ try
         return rocsparse_status_not_initialized;
     }
 
+    // Sparsity structure might have changed, the SpMV algorithm is selected again
+    descr->spmv_alg = rocsparse_spmv_alg_default;
+
     descr->row_data = coo_row_ind;
     descr->col_data = coo_col_ind;
     descr->val_data = coo_val;
@@ -3689,6 +4038,9 @@ try
         return rocsparse_status_not_initialized;
     }
 
+    // Sparsity structure might have changed, the SpMV algorithm is selected again
+    descr->spmv_alg = rocsparse_spmv_alg_default;
+
     descr->ind_data = coo_ind;
     descr->val_data = coo_val;
 
@@ -3731,6 +4083,11 @@ try
 
     // Sparsity structure might have changed, analysis is required before calling SpMV
     descr->analysed = false;
+    descr->spmv_alg = rocsparse_spmv_alg_default;
+    descr->spmv_bin_size.clear();
+
+    descr->spsv_nlevels        = 0;
+    descr->spsv_max_level_size = 0;
 
     descr->row_data = csr_row_ptr;
     descr->col_data = csr_col_ind;
@@ -3776,6 +4133,7 @@ try
 
     // Sparsity structure might have changed, analysis is required before calling SpMV
     descr->analysed = false;
+    descr->spmv_alg = rocsparse_spmv_alg_default;
 
     descr->row_data = csc_row_ind;
     descr->col_data = csc_col_ptr;
@@ -3817,6 +4175,9 @@ try
         return rocsparse_status_not_initialized;
     }
 
+    // Sparsity structure might have changed, the SpMV algorithm is selected again
+    descr->spmv_alg = rocsparse_spmv_alg_default;
+
     descr->col_data = ell_col_ind;
     descr->val_data = ell_val;
 
@@ -3859,6 +4220,7 @@ try
 
     // Sparsity structure might have changed, analysis is required before calling SpMV
     descr->analysed = false;
+    descr->spmv_alg = rocsparse_spmv_alg_default;
 
     descr->row_data = bsr_row_ptr;
     descr->col_data = bsr_col_ind;
@@ -4135,8 +4497,9 @@ try
         return rocsparse_status_invalid_value;
     }
 
-    descr->batch_count  = batch_count;
-    descr->batch_stride = batch_stride;
+    descr->batch_count         = batch_count;
+    descr->batch_stride        = batch_stride;
+    descr->values_batch_stride = batch_stride;
 
     return rocsparse_status_success;
 }
@@ -4175,6 +4538,7 @@ try
     descr->batch_count                 = batch_count;
     descr->offsets_batch_stride        = offsets_batch_stride;
     descr->columns_values_batch_stride = columns_values_batch_stride;
+    descr->values_batch_stride         = columns_values_batch_stride;
 
     return rocsparse_status_success;
 }
@@ -4201,6 +4565,77 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief rocsparse_ell_set_strided_batch sets the ELL sparse matrix batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_ell_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->batch_count         = batch_count;
+    descr->batch_stride        = batch_stride;
+    descr->values_batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief rocsparse_spmat_set_values_batch_stride sets the batch stride of the
+ * sparse matrix values array, independently of the index arrays.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_set_values_batch_stride(rocsparse_spmat_descr descr,
+                                                         int64_t               values_batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    if(values_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->values_batch_stride = values_batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief rocsparse_spmat_get_attribute gets the sparse matrix attribute.
  *******************************************************************************/
@@ -4257,6 +4692,36 @@ try
         *storage                        = rocsparse_get_mat_storage_mode(descr->descr);
         return rocsparse_status_success;
     }
+    case rocsparse_spmat_spmv_alg:
+    {
+        if(data_size != sizeof(rocsparse_spmv_alg))
+        {
+            return rocsparse_status_invalid_size;
+        }
+        rocsparse_spmv_alg* alg = reinterpret_cast<rocsparse_spmv_alg*>(data);
+        *alg                    = descr->spmv_alg;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_spsv_nlevels:
+    {
+        if(data_size != sizeof(int64_t))
+        {
+            return rocsparse_status_invalid_size;
+        }
+        int64_t* nlevels = reinterpret_cast<int64_t*>(data);
+        *nlevels         = descr->spsv_nlevels;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_spsv_max_level_size:
+    {
+        if(data_size != sizeof(int64_t))
+        {
+            return rocsparse_status_invalid_size;
+        }
+        int64_t* max_level_size = reinterpret_cast<int64_t*>(data);
+        *max_level_size         = descr->spsv_max_level_size;
+        return rocsparse_status_success;
+    }
     }
 
     return rocsparse_status_invalid_value;
@@ -4319,6 +4784,17 @@ try
         rocsparse_storage_mode storage = *reinterpret_cast<const rocsparse_storage_mode*>(data);
         return rocsparse_set_mat_storage_mode(descr->descr, storage);
     }
+    case rocsparse_spmat_spmv_alg:
+    {
+        // Set by the SpMV preprocess stage only
+        return rocsparse_status_invalid_value;
+    }
+    case rocsparse_spmat_spsv_nlevels:
+    case rocsparse_spmat_spsv_max_level_size:
+    {
+        // Set by the SpSV preprocess stage only
+        return rocsparse_status_invalid_value;
+    }
     }
 
     return rocsparse_status_invalid_value;
@@ -4376,6 +4852,9 @@ try
         (*descr)->values       = values;
         (*descr)->const_values = values;
         (*descr)->data_type    = data_type;
+
+        (*descr)->batch_count  = 1;
+        (*descr)->batch_stride = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -4431,6 +4910,9 @@ try
         new_descr->const_values = values;
         new_descr->data_type    = data_type;
 
+        new_descr->batch_count  = 1;
+        new_descr->batch_stride = 0;
+
         *descr = new_descr;
     }
     catch(const rocsparse_status& status)
@@ -4614,6 +5096,78 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnvec_get_strided_batch gets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = descr->batch_count;
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnvec_set_strided_batch sets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(batch_count > 1 && batch_stride < descr->size)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnmat_descr creates a descriptor holding the dense
  * matrix data, size and properties. It must be called prior to all subsequent
@@ -84,6 +84,7 @@ module rocsparse_enums
         enumerator :: rocsparse_hyb_partition_auto = 0
         enumerator :: rocsparse_hyb_partition_user = 1
         enumerator :: rocsparse_hyb_partition_max = 2
+        enumerator :: rocsparse_hyb_partition_cost = 3
     end enum
 
 !   rocsparse_analysis_policy
@@ -103,12 +104,19 @@ module rocsparse_enums
         enumerator :: rocsparse_pointer_mode_device = 1
     end enum
 
+!   rocsparse_sizes_mode
+    enum, bind(c)
+        enumerator :: rocsparse_sizes_mode_host = 0
+        enumerator :: rocsparse_sizes_mode_device = 1
+    end enum
+
 !   rocsparse_layer_mode
     enum, bind(c)
         enumerator :: rocsparse_layer_mode_none = 0
         enumerator :: rocsparse_layer_mode_log_trace = 1
         enumerator :: rocsparse_layer_mode_log_bench = 2
         enumerator :: rocsparse_layer_mode_log_debug = 4
+        enumerator :: rocsparse_layer_mode_log_profile = 8
     end enum
 
 !   rocsparse_status
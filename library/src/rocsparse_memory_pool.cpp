@@ -0,0 +1,658 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "memory_pool.h"
+#include "envariables.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//
+// Size classes. Requests of at most 2^min_bin bytes use the first class, larger requests
+// are rounded up to a multiple of a quarter of the power of two below them, such that a
+// block is at most 25% larger than the request. The largest class holds 2^max_bin bytes.
+//
+static constexpr int min_bin       = 9;
+static constexpr int max_bin       = 31;
+static constexpr int sub_bin_shift = 2;
+static constexpr int num_sub_bin   = 1 << sub_bin_shift;
+static constexpr int num_bin       = 1 + (max_bin - min_bin) * num_sub_bin;
+
+static inline int memory_pool_bin(size_t nbytes)
+{
+    if(nbytes <= (size_t(1) << min_bin))
+    {
+        return 0;
+    }
+
+    // 2^p < nbytes <= 2^(p + 1)
+    int p = min_bin;
+    while(p < max_bin && (size_t(2) << p) < nbytes)
+    {
+        ++p;
+    }
+
+    if((size_t(2) << p) < nbytes)
+    {
+        return num_bin;
+    }
+
+    const size_t step = size_t(1) << (p - sub_bin_shift);
+    const size_t sub  = (nbytes - (size_t(1) << p) + step - 1) / step;
+
+    return 1 + (p - min_bin) * num_sub_bin + static_cast<int>(sub) - 1;
+}
+
+static inline size_t memory_pool_bin_size(int bin)
+{
+    if(bin == 0)
+    {
+        return size_t(1) << min_bin;
+    }
+
+    const int    p   = min_bin + (bin - 1) / num_sub_bin;
+    const size_t sub = (bin - 1) % num_sub_bin + 1;
+
+    return (size_t(1) << p) + sub * (size_t(1) << (p - sub_bin_shift));
+}
+
+static inline bool memory_pool_is_capturing(hipStream_t stream)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+    {
+        return true;
+    }
+    return capture_status != hipStreamCaptureStatusNone;
+}
+
+static inline hipError_t memory_pool_hip_malloc_async(void** mem, size_t nbytes, hipStream_t stream)
+{
+#if HIP_VERSION >= 50300000
+    return hipMallocAsync(mem, nbytes, stream);
+#else
+    return hipMalloc(mem, nbytes);
+#endif
+}
+
+static inline hipError_t memory_pool_hip_free_async(void* mem, hipStream_t stream)
+{
+#if HIP_VERSION >= 50300000
+    return hipFreeAsync(mem, stream);
+#else
+    return hipFree(mem);
+#endif
+}
+
+static hipError_t memory_pool_device_synchronize(int device)
+{
+    int        current;
+    hipError_t err = hipGetDevice(&current);
+    if(err != hipSuccess || current == device)
+    {
+        return (err != hipSuccess) ? err : hipDeviceSynchronize();
+    }
+
+    err = hipSetDevice(device);
+    if(err == hipSuccess)
+    {
+        err = hipDeviceSynchronize();
+    }
+    hipError_t err_restore = hipSetDevice(current);
+    return (err != hipSuccess) ? err : err_restore;
+}
+
+struct _rocsparse_memory_pool
+{
+    struct block
+    {
+        void* ptr;
+        // Recorded on the stream the block has been freed on, when it is not the
+        // stream of the pool. The next user waits for it before reusing the block.
+        hipEvent_t event;
+    };
+
+    int         device;
+    hipStream_t stream;
+
+    // Number of handles using the pool
+    int64_t users = 0;
+
+    // bytes_in_use includes the blocks being allocated or returned while the registry
+    // lock is not held, the pool is not deleted before it drops to zero.
+    size_t max_cached_bytes = std::numeric_limits<size_t>::max();
+    size_t bytes_in_use     = 0;
+    size_t bytes_cached     = 0;
+    size_t high_water_mark  = 0;
+
+    std::vector<block>      bins[num_bin];
+    std::vector<hipEvent_t> events;
+
+    _rocsparse_memory_pool(int device_, hipStream_t stream_)
+        : device(device_)
+        , stream(stream_)
+    {
+    }
+
+    // Cached blocks are given back before the pool is deleted
+    ~_rocsparse_memory_pool()
+    {
+        for(auto event : this->events)
+        {
+            (void)hipEventDestroy(event);
+        }
+    }
+
+    hipEvent_t pop_event()
+    {
+        if(this->events.empty())
+        {
+            return nullptr;
+        }
+        hipEvent_t event = this->events.back();
+        this->events.pop_back();
+        return event;
+    }
+
+    // Remove cached blocks, largest first, until at most max_bytes remain cached.
+    // The blocks are freed by memory_pool_free_blocks once the lock is released.
+    void take_cached(size_t max_bytes, std::vector<block>& blocks)
+    {
+        for(int bin = num_bin - 1; bin >= 0 && this->bytes_cached > max_bytes; --bin)
+        {
+            auto& list = this->bins[bin];
+            while(!list.empty() && this->bytes_cached > max_bytes)
+            {
+                blocks.push_back(list.back());
+                list.pop_back();
+                this->bytes_cached -= memory_pool_bin_size(bin);
+            }
+        }
+    }
+
+    bool is_orphan() const
+    {
+        return this->users == 0 && this->bytes_in_use == 0;
+    }
+
+    void update_high_water_mark()
+    {
+        this->high_water_mark
+            = std::max(this->high_water_mark, this->bytes_in_use + this->bytes_cached);
+    }
+};
+
+//
+// Free blocks taken from a pool on the stream of the pool, after the streams they have
+// been returned on reach the point of the return.
+//
+static hipError_t memory_pool_free_blocks(const std::vector<_rocsparse_memory_pool::block>& blocks,
+                                          hipStream_t                                      stream)
+{
+    hipError_t status = hipSuccess;
+    for(const auto& b : blocks)
+    {
+        if(b.event != nullptr)
+        {
+            hipError_t err = hipStreamWaitEvent(stream, b.event, 0);
+            if(err != hipSuccess)
+            {
+                status = err;
+            }
+            (void)hipEventDestroy(b.event);
+        }
+
+        hipError_t err = memory_pool_hip_free_async(b.ptr, stream);
+        if(err != hipSuccess)
+        {
+            status = err;
+        }
+    }
+    return status;
+}
+
+namespace
+{
+    //
+    // Pools indexed by (device, stream), and pool blocks currently in use.
+    //
+    // The registry lock only guards the bookkeeping, it is never held across HIP calls
+    // such that handles on different streams do not serialize on the runtime.
+    //
+    struct memory_pool_registry
+    {
+        struct live_block
+        {
+            rocsparse_memory_pool pool;
+            int                   bin;
+        };
+
+        std::mutex                                                   mutex;
+        std::map<std::pair<int, hipStream_t>, rocsparse_memory_pool> pools;
+        std::unordered_map<void*, live_block>                        blocks;
+    };
+
+    // Never destroyed, pools may still be referenced during static destruction
+    memory_pool_registry& get_registry()
+    {
+        static memory_pool_registry* registry = new memory_pool_registry;
+        return *registry;
+    }
+}
+
+rocsparse_memory_pool rocsparse_memory_pool_acquire(int device, hipStream_t stream)
+{
+    if(rocsparse_envariables::Instance().get(rocsparse_envariables::NO_MEMORY_POOL))
+    {
+        return nullptr;
+    }
+
+    auto&                       registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto& pool = registry.pools[std::make_pair(device, stream)];
+    if(pool == nullptr)
+    {
+        pool = new _rocsparse_memory_pool(device, stream);
+    }
+
+    ++pool->users;
+    return pool;
+}
+
+void rocsparse_memory_pool_release(rocsparse_memory_pool pool)
+{
+    if(pool == nullptr)
+    {
+        return;
+    }
+
+    std::vector<_rocsparse_memory_pool::block> blocks;
+    const hipStream_t                          stream = pool->stream;
+    bool                                       orphan;
+    {
+        auto&                       registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        if(--pool->users > 0)
+        {
+            return;
+        }
+
+        // Last user, blocks returned from now on are freed
+        registry.pools.erase(std::make_pair(pool->device, stream));
+        pool->take_cached(0, blocks);
+        orphan = pool->is_orphan();
+    }
+
+    (void)memory_pool_free_blocks(blocks, stream);
+    if(orphan)
+    {
+        delete pool;
+    }
+}
+
+hipError_t rocsparse_memory_pool_set_limit(rocsparse_memory_pool pool, size_t max_cached_bytes)
+{
+    if(pool == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<_rocsparse_memory_pool::block> blocks;
+    {
+        auto&                       registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        pool->max_cached_bytes = max_cached_bytes;
+        pool->take_cached(max_cached_bytes, blocks);
+    }
+
+    return memory_pool_free_blocks(blocks, pool->stream);
+}
+
+hipError_t rocsparse_memory_pool_trim(rocsparse_memory_pool pool)
+{
+    if(pool == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<_rocsparse_memory_pool::block> blocks;
+    {
+        auto&                       registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        pool->take_cached(0, blocks);
+        pool->high_water_mark = pool->bytes_in_use + pool->bytes_cached;
+    }
+
+    return memory_pool_free_blocks(blocks, pool->stream);
+}
+
+void rocsparse_memory_pool_get_info(rocsparse_memory_pool pool,
+                                    size_t*               bytes_in_use,
+                                    size_t*               bytes_cached,
+                                    size_t*               high_water_mark)
+{
+    size_t in_use = 0;
+    size_t cached = 0;
+    size_t hwm    = 0;
+
+    if(pool != nullptr)
+    {
+        auto&                       registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        in_use = pool->bytes_in_use;
+        cached = pool->bytes_cached;
+        hwm    = pool->high_water_mark;
+    }
+
+    if(bytes_in_use != nullptr)
+    {
+        *bytes_in_use = in_use;
+    }
+    if(bytes_cached != nullptr)
+    {
+        *bytes_cached = cached;
+    }
+    if(high_water_mark != nullptr)
+    {
+        *high_water_mark = hwm;
+    }
+}
+
+// Bytes requested by the calling thread, used by the profiling layer
+static thread_local size_t s_thread_allocated_bytes = 0;
+
+size_t rocsparse_memory_pool_thread_allocated_bytes()
+{
+    return s_thread_allocated_bytes;
+}
+
+static hipError_t memory_pool_malloc_async(void** mem, size_t nbytes, hipStream_t stream)
+{
+    if(mem == nullptr || nbytes == 0)
+    {
+        return memory_pool_hip_malloc_async(mem, nbytes, stream);
+    }
+
+    const int bin = memory_pool_bin(nbytes);
+    if(bin >= num_bin || memory_pool_is_capturing(stream))
+    {
+        return memory_pool_hip_malloc_async(mem, nbytes, stream);
+    }
+
+    int        device;
+    hipError_t err = hipGetDevice(&device);
+    if(err != hipSuccess)
+    {
+        return err;
+    }
+
+    auto&                        registry = get_registry();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+
+    auto it = registry.pools.find(std::make_pair(device, stream));
+    if(it == registry.pools.end())
+    {
+        lock.unlock();
+        return memory_pool_hip_malloc_async(mem, nbytes, stream);
+    }
+
+    rocsparse_memory_pool pool  = it->second;
+    const size_t          bytes = memory_pool_bin_size(bin);
+    auto&                 list  = pool->bins[bin];
+
+    // Reserve the block, the pool stays alive while the lock is released
+    pool->bytes_in_use += bytes;
+
+    _rocsparse_memory_pool::block b = {nullptr, nullptr};
+    if(!list.empty())
+    {
+        // Reuse the most recently freed block of this size class
+        b = list.back();
+        list.pop_back();
+        pool->bytes_cached -= bytes;
+    }
+
+    lock.unlock();
+
+    if(b.ptr != nullptr)
+    {
+        err = (b.event != nullptr) ? hipStreamWaitEvent(stream, b.event, 0) : hipSuccess;
+    }
+    else
+    {
+        err = memory_pool_hip_malloc_async(&b.ptr, bytes, stream);
+        if(err == hipErrorOutOfMemory)
+        {
+            // Give the cached blocks back to the runtime and try again
+            (void)hipGetLastError();
+
+            std::vector<_rocsparse_memory_pool::block> blocks;
+            lock.lock();
+            pool->take_cached(0, blocks);
+            lock.unlock();
+
+            if(!blocks.empty())
+            {
+                err = memory_pool_free_blocks(blocks, pool->stream);
+                if(err == hipSuccess)
+                {
+                    err = memory_pool_hip_malloc_async(&b.ptr, bytes, stream);
+                }
+            }
+        }
+    }
+
+    lock.lock();
+
+    if(err != hipSuccess)
+    {
+        pool->bytes_in_use -= bytes;
+        if(b.ptr != nullptr && pool->users > 0)
+        {
+            pool->bins[bin].push_back(b);
+            pool->bytes_cached += bytes;
+            return err;
+        }
+
+        const bool orphan = pool->is_orphan();
+        lock.unlock();
+
+        if(b.ptr != nullptr)
+        {
+            (void)memory_pool_free_blocks({b}, stream);
+        }
+        if(orphan)
+        {
+            delete pool;
+        }
+        return err;
+    }
+
+    if(b.event != nullptr)
+    {
+        pool->events.push_back(b.event);
+    }
+
+    pool->update_high_water_mark();
+    registry.blocks[b.ptr] = {pool, bin};
+    *mem                   = b.ptr;
+
+    return hipSuccess;
+}
+
+hipError_t rocsparse_memory_pool_malloc_async(void** mem, size_t nbytes, hipStream_t stream)
+{
+    hipError_t err = memory_pool_malloc_async(mem, nbytes, stream);
+    if(err == hipSuccess)
+    {
+        s_thread_allocated_bytes += nbytes;
+    }
+    return err;
+}
+
+hipError_t rocsparse_memory_pool_free_async(void* mem, hipStream_t stream)
+{
+    if(mem == nullptr)
+    {
+        return memory_pool_hip_free_async(mem, stream);
+    }
+
+    const bool capturing = memory_pool_is_capturing(stream);
+
+    auto&                        registry = get_registry();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+
+    auto it = registry.blocks.find(mem);
+    if(it == registry.blocks.end())
+    {
+        lock.unlock();
+        return memory_pool_hip_free_async(mem, stream);
+    }
+
+    rocsparse_memory_pool pool  = it->second.pool;
+    const int             bin   = it->second.bin;
+    const size_t          bytes = memory_pool_bin_size(bin);
+    registry.blocks.erase(it);
+
+    if(pool->users == 0 || pool->bytes_cached + bytes > pool->max_cached_bytes || capturing)
+    {
+        pool->bytes_in_use -= bytes;
+        const bool orphan = pool->is_orphan();
+        lock.unlock();
+
+        hipError_t err = memory_pool_hip_free_async(mem, stream);
+        if(orphan)
+        {
+            delete pool;
+        }
+        return err;
+    }
+
+    if(stream == pool->stream)
+    {
+        pool->bytes_in_use -= bytes;
+        pool->bins[bin].push_back({mem, nullptr});
+        pool->bytes_cached += bytes;
+        return hipSuccess;
+    }
+
+    // Blocks freed on another stream are only reused once this stream reaches the free
+    hipEvent_t event = pool->pop_event();
+    lock.unlock();
+
+    hipError_t err = (event == nullptr) ? hipEventCreateWithFlags(&event, hipEventDisableTiming)
+                                        : hipSuccess;
+    if(err == hipSuccess)
+    {
+        err = hipEventRecord(event, stream);
+    }
+
+    lock.lock();
+    pool->bytes_in_use -= bytes;
+
+    if(err == hipSuccess && pool->users > 0)
+    {
+        pool->bins[bin].push_back({mem, event});
+        pool->bytes_cached += bytes;
+        return hipSuccess;
+    }
+
+    const bool orphan = pool->is_orphan();
+    lock.unlock();
+
+    if(event != nullptr)
+    {
+        (void)hipEventDestroy(event);
+    }
+
+    hipError_t err_free = memory_pool_hip_free_async(mem, stream);
+    if(orphan)
+    {
+        delete pool;
+    }
+    return (err != hipSuccess) ? err : err_free;
+}
+
+hipError_t rocsparse_memory_pool_free(void* mem)
+{
+    if(mem == nullptr)
+    {
+        return hipFree(mem);
+    }
+
+    auto&                        registry = get_registry();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+
+    auto it = registry.blocks.find(mem);
+    if(it == registry.blocks.end())
+    {
+        lock.unlock();
+        return hipFree(mem);
+    }
+
+    rocsparse_memory_pool pool   = it->second.pool;
+    const int             bin    = it->second.bin;
+    const size_t          bytes  = memory_pool_bin_size(bin);
+    const int             device = pool->device;
+    registry.blocks.erase(it);
+
+    const bool cache = pool->users > 0 && pool->bytes_cached + bytes <= pool->max_cached_bytes;
+    lock.unlock();
+
+    // Like hipFree, wait for all pending work on the device before the block is released
+    hipError_t err = memory_pool_device_synchronize(device);
+
+    lock.lock();
+    pool->bytes_in_use -= bytes;
+
+    if(cache && err == hipSuccess && pool->users > 0)
+    {
+        pool->bins[bin].push_back({mem, nullptr});
+        pool->bytes_cached += bytes;
+        return hipSuccess;
+    }
+
+    // Blocks come from hipMallocAsync and are freed in stream order. The stream of a pool
+    // without user may be destroyed already, the device is idle and the null stream is used.
+    const hipStream_t stream = (pool->users > 0) ? pool->stream : nullptr;
+    const bool        orphan = pool->is_orphan();
+    lock.unlock();
+
+    hipError_t err_free = memory_pool_hip_free_async(mem, stream);
+    if(orphan)
+    {
+        delete pool;
+    }
+    return (err != hipSuccess) ? err : err_free;
+}
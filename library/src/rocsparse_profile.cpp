@@ -0,0 +1,380 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profile.h"
+#include "memory_pool.h"
+
+#include <iomanip>
+
+thread_local rocsparse_profile_guard* rocsparse_profile_guard::s_current = nullptr;
+
+rocsparse_profiler::rocsparse_profiler() {}
+
+rocsparse_profiler::~rocsparse_profiler()
+{
+    this->resolve(true);
+    for(auto event : this->events)
+    {
+        (void)hipEventDestroy(event);
+    }
+}
+
+hipError_t rocsparse_profiler::get_event(hipEvent_t* event)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if(!this->events.empty())
+        {
+            *event = this->events.back();
+            this->events.pop_back();
+            return hipSuccess;
+        }
+    }
+    return hipEventCreate(event);
+}
+
+void rocsparse_profiler::record(const std::string& name,
+                                const std::string& type,
+                                int64_t            size,
+                                double             wall_time_us,
+                                hipEvent_t         start,
+                                hipEvent_t         stop,
+                                double             flops,
+                                double             bytes,
+                                size_t             device_bytes,
+                                size_t             buffer_bytes)
+{
+    // Size bucket, -1 if the routine has no size argument
+    int bucket = -1;
+    if(size > 0)
+    {
+        bucket = 0;
+        while((size >> (bucket + 1)) > 0)
+        {
+            ++bucket;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    entry& e = this->entries[std::make_tuple(name, type, bucket)];
+    ++e.calls;
+    e.wall_time_us += wall_time_us;
+    e.flops += flops;
+    e.bytes += bytes;
+    e.device_bytes += device_bytes;
+    e.buffer_bytes = std::max(e.buffer_bytes, buffer_bytes);
+
+    if(start != nullptr && stop != nullptr)
+    {
+        this->pending_events.push_back({&e, start, stop});
+    }
+
+    this->resolve(false);
+}
+
+void rocsparse_profiler::resolve(bool wait)
+{
+    // Calls complete in stream order, stop at the first one still running
+    size_t i = 0;
+    for(; i < this->pending_events.size(); ++i)
+    {
+        pending& p = this->pending_events[i];
+
+        if(wait)
+        {
+            if(hipEventSynchronize(p.stop) != hipSuccess)
+            {
+                (void)hipGetLastError();
+            }
+        }
+        else if(hipEventQuery(p.stop) == hipErrorNotReady)
+        {
+            break;
+        }
+
+        float ms;
+        if(hipEventElapsedTime(&ms, p.start, p.stop) == hipSuccess)
+        {
+            ++p.e->gpu_calls;
+            p.e->gpu_time_us += 1e3 * ms;
+        }
+        else
+        {
+            (void)hipGetLastError();
+        }
+
+        this->events.push_back(p.start);
+        this->events.push_back(p.stop);
+    }
+
+    this->pending_events.erase(this->pending_events.begin(), this->pending_events.begin() + i);
+}
+
+void rocsparse_profiler::write(std::ostream& os, bool json)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->resolve(true);
+
+    // Sort by decreasing wall time, so that the most expensive routines come first
+    std::vector<std::pair<const std::tuple<std::string, std::string, int>*, const entry*>> rows;
+    for(const auto& it : this->entries)
+    {
+        rows.push_back(std::make_pair(&it.first, &it.second));
+    }
+    std::stable_sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.second->wall_time_us > b.second->wall_time_us;
+    });
+
+    static const char* columns[] = {"routine",
+                                    "type",
+                                    "size_bucket",
+                                    "calls",
+                                    "wall_time_us",
+                                    "wall_time_us_per_call",
+                                    "gpu_time_us",
+                                    "gpu_time_us_per_call",
+                                    "gflop",
+                                    "gbyte",
+                                    "gflop_per_s",
+                                    "gbyte_per_s",
+                                    "device_bytes_allocated",
+                                    "max_buffer_bytes"};
+
+    const auto flags = os.flags();
+    os << std::setprecision(6);
+
+    if(json)
+    {
+        os << "[";
+    }
+    else
+    {
+        for(size_t c = 0; c < sizeof(columns) / sizeof(columns[0]); ++c)
+        {
+            os << (c ? "," : "") << columns[c];
+        }
+        os << std::endl;
+    }
+
+    for(size_t r = 0; r < rows.size(); ++r)
+    {
+        const std::string& name   = std::get<0>(*rows[r].first);
+        const std::string& type   = std::get<1>(*rows[r].first);
+        const int          bucket = std::get<2>(*rows[r].first);
+        const entry&       e      = *rows[r].second;
+
+        // The throughput is measured on the GPU time, or on the wall time without events
+        const double time_us = (e.gpu_calls == e.calls) ? e.gpu_time_us : e.wall_time_us;
+        const double gflop   = e.flops / 1e9;
+        const double gbyte   = e.bytes / 1e9;
+
+        const double values[] = {double(e.calls),
+                                 e.wall_time_us,
+                                 e.wall_time_us / e.calls,
+                                 e.gpu_time_us,
+                                 (e.gpu_calls > 0) ? e.gpu_time_us / e.gpu_calls : 0.0,
+                                 gflop,
+                                 gbyte,
+                                 (time_us > 0.0) ? gflop / (time_us / 1e6) : 0.0,
+                                 (time_us > 0.0) ? gbyte / (time_us / 1e6) : 0.0,
+                                 double(e.device_bytes),
+                                 double(e.buffer_bytes)};
+
+        const int64_t size_bucket = (bucket < 0) ? 0 : (int64_t(1) << bucket);
+
+        if(json)
+        {
+            os << (r ? "," : "") << "\n  {\"" << columns[0] << "\": \"" << name << "\", \""
+               << columns[1] << "\": \"" << type << "\", \"" << columns[2]
+               << "\": " << size_bucket;
+            for(size_t c = 0; c < sizeof(values) / sizeof(values[0]); ++c)
+            {
+                os << ", \"" << columns[c + 3] << "\": " << values[c];
+            }
+            os << "}";
+        }
+        else
+        {
+            os << name << "," << type << "," << size_bucket;
+            for(size_t c = 0; c < sizeof(values) / sizeof(values[0]); ++c)
+            {
+                os << "," << values[c];
+            }
+            os << std::endl;
+        }
+    }
+
+    if(json)
+    {
+        os << "\n]" << std::endl;
+    }
+
+    os.flags(flags);
+}
+
+const char* rocsparse_profile_guard::datatype_name(rocsparse_datatype datatype)
+{
+    switch(datatype)
+    {
+    case rocsparse_datatype_f16_r:
+        return "f16_r";
+    case rocsparse_datatype_bf16_r:
+        return "bf16_r";
+    case rocsparse_datatype_f32_r:
+        return "f32_r";
+    case rocsparse_datatype_f64_r:
+        return "f64_r";
+    case rocsparse_datatype_f32_c:
+        return "f32_c";
+    case rocsparse_datatype_f64_c:
+        return "f64_c";
+    case rocsparse_datatype_i8_r:
+        return "i8_r";
+    case rocsparse_datatype_u8_r:
+        return "u8_r";
+    case rocsparse_datatype_i32_r:
+        return "i32_r";
+    case rocsparse_datatype_u32_r:
+        return "u32_r";
+    }
+    return "";
+}
+
+void rocsparse_profile_guard::begin(rocsparse_handle   handle,
+                                    const std::string& name_,
+                                    const std::string& type_,
+                                    int64_t            size_)
+{
+    this->profiler = handle->profiler;
+    this->name     = name_;
+    this->type     = type_;
+    this->size     = size_;
+
+    // No event is recorded while the stream is captured
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(handle->stream, &capture_status) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        capture_status = hipStreamCaptureStatusActive;
+    }
+
+    if(capture_status == hipStreamCaptureStatusNone)
+    {
+        if(this->profiler->get_event(&this->start) != hipSuccess
+           || this->profiler->get_event(&this->stop) != hipSuccess
+           || hipEventRecord(this->start, handle->stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            if(this->start != nullptr)
+            {
+                (void)hipEventDestroy(this->start);
+            }
+            if(this->stop != nullptr)
+            {
+                (void)hipEventDestroy(this->stop);
+            }
+            this->start = nullptr;
+            this->stop  = nullptr;
+        }
+        this->stream = handle->stream;
+    }
+
+    this->device_bytes_start = rocsparse_memory_pool_thread_allocated_bytes();
+
+    this->parent = s_current;
+    s_current    = this;
+
+    this->wall_start = std::chrono::steady_clock::now();
+}
+
+rocsparse_profile_guard::~rocsparse_profile_guard()
+{
+    if(this->profiler == nullptr)
+    {
+        return;
+    }
+
+    const double wall_time_us = std::chrono::duration<double, std::micro>(
+                                    std::chrono::steady_clock::now() - this->wall_start)
+                                    .count();
+
+    if(this->stop != nullptr && hipEventRecord(this->stop, this->stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        (void)hipEventDestroy(this->start);
+        (void)hipEventDestroy(this->stop);
+        this->start = nullptr;
+        this->stop  = nullptr;
+    }
+
+    const size_t device_bytes
+        = rocsparse_memory_pool_thread_allocated_bytes() - this->device_bytes_start;
+
+    s_current = this->parent;
+
+    // The work and the size of nested routines are accounted to the calling routine
+    if(this->parent != nullptr)
+    {
+        this->parent->flops += this->flops;
+        this->parent->bytes += this->bytes;
+        this->parent->buffer_bytes = std::max(this->parent->buffer_bytes, this->buffer_bytes);
+        if(this->parent->size < 0)
+        {
+            this->parent->size = this->size;
+        }
+        if(this->parent->type.empty())
+        {
+            this->parent->type = this->type;
+        }
+    }
+
+    this->profiler->record(this->name,
+                           this->type,
+                           this->size,
+                           wall_time_us,
+                           this->start,
+                           this->stop,
+                           this->flops,
+                           this->bytes,
+                           device_bytes,
+                           this->buffer_bytes);
+}
+
+void rocsparse_profile_guard::add_work(double flops, double bytes)
+{
+    if(s_current != nullptr)
+    {
+        s_current->flops += flops;
+        s_current->bytes += bytes;
+    }
+}
+
+void rocsparse_profile_guard::add_buffer(size_t buffer_size)
+{
+    if(s_current != nullptr)
+    {
+        s_current->buffer_bytes = std::max(s_current->buffer_bytes, buffer_size);
+    }
+}
@@ -0,0 +1,219 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "tuning.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+//
+// Built-in tuning table. It currently only holds the defaults of each wavefront size, which
+// match the thresholds rocSPARSE has always used. Architecture specific entries, generated
+// by rocsparse-tune --format table from sweeps on that architecture, go ahead of them.
+//
+struct rocsparse_tuning_entry
+{
+    const char*             arch_name;
+    int                     wavefront_size;
+    rocsparse_tuning_params params;
+};
+
+static const rocsparse_tuning_entry tuning_table[] = {
+    // Generic wave64 devices
+    {nullptr, 64, {128, 32, 1024, {16, 32, 64}, 16, 32}},
+    // Generic wave32 devices, sub-wavefronts of 64 threads are not available
+    {nullptr, 32, {128, 32, 1024, {16, 32, INT_MAX}, 16, 32}}};
+
+// Architecture name without target features, e.g. gfx90a for gfx90a:sramecc+:xnack-
+static std::string tuning_arch_base(const char* arch_name)
+{
+    std::string arch = (arch_name != nullptr) ? arch_name : "";
+    return arch.substr(0, arch.find(':'));
+}
+
+static int32_t* tuning_param(rocsparse_tuning_params* params, const std::string& name)
+{
+    if(name == "csrmv_long_row")
+        return &params->csrmv_long_row;
+    if(name == "csrmv_short_row")
+        return &params->csrmv_short_row;
+    if(name == "csrmv_row_window")
+        return &params->csrmv_row_window;
+    if(name == "csrmm_nnz_per_row_0")
+        return &params->csrmm_nnz_per_row[0];
+    if(name == "csrmm_nnz_per_row_1")
+        return &params->csrmm_nnz_per_row[1];
+    if(name == "csrmm_nnz_per_row_2")
+        return &params->csrmm_nnz_per_row[2];
+    if(name == "csrgemm_group_nnz")
+        return &params->csrgemm_group_nnz;
+    if(name == "csrgemm_group_products")
+        return &params->csrgemm_group_products;
+    return nullptr;
+}
+
+static std::string tuning_trim(const std::string& s)
+{
+    size_t first = s.find_first_not_of(" \t\r");
+    if(first == std::string::npos)
+    {
+        return std::string();
+    }
+    size_t last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+// Related thresholds must be ordered, e.g. short rows cannot be longer than long rows. A group
+// that is not is reported and reset to its previous values, whatever line broke the order.
+static void tuning_check_order(rocsparse_tuning_params*       params,
+                               const rocsparse_tuning_params& previous,
+                               const char*                    path)
+{
+    if(params->csrmv_short_row > params->csrmv_long_row)
+    {
+        std::cerr << "rocsparse warning, ignoring csrmv_short_row = " << params->csrmv_short_row
+                  << " and csrmv_long_row = " << params->csrmv_long_row << " of tuning file "
+                  << path << ": csrmv_short_row must not exceed csrmv_long_row" << std::endl;
+
+        params->csrmv_short_row = previous.csrmv_short_row;
+        params->csrmv_long_row  = previous.csrmv_long_row;
+    }
+
+    const int32_t* nnz_per_row = params->csrmm_nnz_per_row;
+    if(nnz_per_row[0] > nnz_per_row[1] || nnz_per_row[1] > nnz_per_row[2])
+    {
+        std::cerr << "rocsparse warning, ignoring csrmm_nnz_per_row_0..2 = " << nnz_per_row[0]
+                  << ", " << nnz_per_row[1] << ", " << nnz_per_row[2] << " of tuning file "
+                  << path << ": csrmm_nnz_per_row_0..2 must be non-decreasing" << std::endl;
+
+        std::copy(std::begin(previous.csrmm_nnz_per_row),
+                  std::end(previous.csrmm_nnz_per_row),
+                  params->csrmm_nnz_per_row);
+    }
+}
+
+// Apply the lines of the tuning file that match the device. Malformed lines are reported
+// and skipped, such that a stale file never prevents the handle from being created.
+static void tuning_read_file(rocsparse_tuning_params* params,
+                             const char*              path,
+                             const std::string&       arch,
+                             int                      wavefront_size)
+{
+    std::ifstream file(path);
+    if(!file.is_open())
+    {
+        std::cerr << "rocsparse warning, cannot open tuning file " << path << std::endl;
+        return;
+    }
+
+    const rocsparse_tuning_params previous = *params;
+
+    std::string wave = "wave" + std::to_string(wavefront_size);
+
+    bool        match = true;
+    std::string line;
+    for(int lineno = 1; std::getline(file, line); ++lineno)
+    {
+        line = tuning_trim(line.substr(0, line.find('#')));
+        if(line.empty())
+        {
+            continue;
+        }
+
+        if(line.front() == '[')
+        {
+            std::string section = tuning_trim(line.substr(1, line.find(']') - 1));
+            match = (line.back() == ']') && (section == "*" || section == arch || section == wave);
+            continue;
+        }
+
+        if(!match)
+        {
+            continue;
+        }
+
+        size_t      eq    = line.find('=');
+        std::string name  = tuning_trim(line.substr(0, eq));
+        std::string value = (eq != std::string::npos) ? tuning_trim(line.substr(eq + 1)) : "";
+
+        int32_t* param = tuning_param(params, name);
+        char*    end   = nullptr;
+        long     v     = std::strtol(value.c_str(), &end, 10);
+
+        if(param == nullptr || value.empty() || *end != '\0' || v < 1 || v > INT_MAX)
+        {
+            std::cerr << "rocsparse warning, ignoring line " << lineno << " of tuning file "
+                      << path << ": " << line << std::endl;
+            continue;
+        }
+
+        *param = static_cast<int32_t>(v);
+    }
+
+    tuning_check_order(params, previous, path);
+}
+
+void rocsparse_tuning_select(rocsparse_tuning_params* params,
+                             const char*              arch_name,
+                             int                      wavefront_size)
+{
+    std::string arch = tuning_arch_base(arch_name);
+
+    const rocsparse_tuning_entry* entry = nullptr;
+    for(const rocsparse_tuning_entry& e : tuning_table)
+    {
+        if(e.arch_name != nullptr && arch == e.arch_name)
+        {
+            entry = &e;
+            break;
+        }
+
+        if(e.arch_name == nullptr && entry == nullptr && e.wavefront_size == wavefront_size)
+        {
+            entry = &e;
+        }
+    }
+
+    *params = (entry != nullptr) ? entry->params : rocsparse_tuning_params{};
+
+    const char* path = getenv("ROCSPARSE_TUNING_FILE");
+    if(path != nullptr && path[0] != '\0')
+    {
+        tuning_read_file(params, path, arch, wavefront_size);
+    }
+
+    // The first SpGEMM group is sized for the default thresholds
+    rocsparse_tuning_params defaults;
+    params->csrgemm_group_nnz = std::min(params->csrgemm_group_nnz, defaults.csrgemm_group_nnz);
+    params->csrgemm_group_products
+        = std::min(params->csrgemm_group_products, defaults.csrgemm_group_products);
+}
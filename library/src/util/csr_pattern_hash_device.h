@@ -0,0 +1,94 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+// 64-bit finalizer of splitmix64
+__host__ __device__ __forceinline__ uint64_t rocsparse_hash_mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Hash of the value stored at a given position of an array
+__host__ __device__ __forceinline__ uint64_t rocsparse_hash_entry(uint64_t array,
+                                                                  uint64_t position,
+                                                                  uint64_t value)
+{
+    return rocsparse_hash_mix(rocsparse_hash_mix(position ^ (array * 0x9e3779b97f4a7c15ULL))
+                              + value);
+}
+
+// Sum of the hashes of all row offsets and column indices. The sum is order
+// independent, such that the entries can be processed by any thread.
+template <unsigned int BLOCKSIZE, typename I, typename J>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csr_pattern_hash_kernel(J m,
+                             I nnz,
+                             const I* __restrict__ csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             rocsparse_index_base idx_base,
+                             uint64_t* __restrict__ hash)
+{
+    int     tid = hipThreadIdx_x;
+    int64_t gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    int64_t inc = static_cast<int64_t>(hipGridDim_x) * BLOCKSIZE;
+
+    // Row offsets, followed by the column indices
+    int64_t size = static_cast<int64_t>(m) + 1 + nnz;
+
+    uint64_t sum = 0;
+
+    for(int64_t i = gid; i < size; i += inc)
+    {
+        if(i <= m)
+        {
+            sum += rocsparse_hash_entry(0, i, static_cast<uint64_t>(csr_row_ptr[i] - idx_base));
+        }
+        else
+        {
+            int64_t j = i - m - 1;
+            sum += rocsparse_hash_entry(1, j, static_cast<uint64_t>(csr_col_ind[j] - idx_base));
+        }
+    }
+
+    __shared__ uint64_t sdata[BLOCKSIZE];
+
+    sdata[tid] = sum;
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicAdd(reinterpret_cast<unsigned long long*>(hash),
+                  static_cast<unsigned long long>(sdata[0]));
+    }
+}
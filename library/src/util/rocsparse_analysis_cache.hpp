@@ -0,0 +1,136 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "analysis_cache.h"
+#include "csr_pattern_hash_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse_csr_pattern_hash.hpp"
+
+template <typename T>
+inline rocsparse_indextype rocsparse_analysis_cache_index_type()
+{
+    return (sizeof(T) == sizeof(uint16_t))
+               ? rocsparse_indextype_u16
+               : ((sizeof(T) == sizeof(int32_t)) ? rocsparse_indextype_i32
+                                                 : rocsparse_indextype_i64);
+}
+
+/********************************************************************************
+ * \brief Build the cache key of an analysis of a CSR sparsity pattern. The
+ * fingerprint of the pattern is computed on the device, the stream is
+ * synchronized. The options of the key are left to the caller.
+ *******************************************************************************/
+template <typename I, typename J>
+inline rocsparse_status
+    rocsparse_analysis_cache_key_template(rocsparse_handle              handle,
+                                          rocsparse_analysis_cache_kind kind,
+                                          J                             m,
+                                          J                             n,
+                                          I                             nnz,
+                                          const I*                      csr_row_ptr,
+                                          const J*                      csr_col_ind,
+                                          rocsparse_index_base          idx_base,
+                                          rocsparse_analysis_cache_key* key)
+{
+    key->kind         = kind;
+    key->sizes[0]     = m;
+    key->sizes[1]     = n;
+    key->sizes[2]     = nnz;
+    key->index_type_I = rocsparse_analysis_cache_index_type<I>();
+    key->index_type_J = rocsparse_analysis_cache_index_type<J>();
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+        handle, m, n, nnz, csr_row_ptr, csr_col_ind, idx_base, &key->hash));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Build the cache key of the structure of C = A * B + D computed by
+ * csrgemm_nnz, from the fingerprints of the sparsity patterns of the matrices
+ * involved.
+ *******************************************************************************/
+template <typename I, typename J>
+inline rocsparse_status
+    rocsparse_analysis_cache_csrgemm_key_template(rocsparse_handle              handle,
+                                                  rocsparse_operation           trans_A,
+                                                  rocsparse_operation           trans_B,
+                                                  J                             m,
+                                                  J                             n,
+                                                  J                             k,
+                                                  bool                          mul,
+                                                  bool                          add,
+                                                  const rocsparse_mat_descr     descr_A,
+                                                  I                             nnz_A,
+                                                  const I*                      csr_row_ptr_A,
+                                                  const J*                      csr_col_ind_A,
+                                                  const rocsparse_mat_descr     descr_B,
+                                                  I                             nnz_B,
+                                                  const I*                      csr_row_ptr_B,
+                                                  const J*                      csr_col_ind_B,
+                                                  const rocsparse_mat_descr     descr_D,
+                                                  I                             nnz_D,
+                                                  const I*                      csr_row_ptr_D,
+                                                  const J*                      csr_col_ind_D,
+                                                  const rocsparse_mat_descr     descr_C,
+                                                  rocsparse_analysis_cache_key* key)
+{
+    key->kind         = rocsparse_analysis_cache_kind_csrgemm_nnz;
+    key->sizes[0]     = m;
+    key->sizes[1]     = n;
+    key->sizes[2]     = k;
+    key->index_type_I = rocsparse_analysis_cache_index_type<I>();
+    key->index_type_J = rocsparse_analysis_cache_index_type<J>();
+    key->options[0]   = trans_A;
+    key->options[1]   = trans_B;
+    key->options[2]   = (mul ? 1 : 0) | (add ? 2 : 0);
+    key->options[3]   = descr_C->base;
+
+    uint64_t hash_A = 0;
+    uint64_t hash_B = 0;
+    uint64_t hash_D = 0;
+
+    if(mul)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+            handle, m, k, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_A->base, &hash_A));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+            handle, k, n, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_B->base, &hash_B));
+    }
+
+    if(add)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+            handle, m, n, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_D->base, &hash_D));
+    }
+
+    key->hash = rocsparse_hash_mix(
+        rocsparse_hash_entry(3, 0, hash_A) ^ rocsparse_hash_entry(3, 1, hash_B)
+        ^ rocsparse_hash_entry(3, 2, hash_D));
+
+    return rocsparse_status_success;
+}
@@ -301,6 +301,8 @@ rocsparse_status rocsparse_check_spmat_dynamic_dispatch(rocsparse_indextype ityp
     case rocsparse_datatype_u8_r:                                                             \
     case rocsparse_datatype_i32_r:                                                            \
     case rocsparse_datatype_u32_r:                                                            \
+    case rocsparse_datatype_f16_r:                                                            \
+    case rocsparse_datatype_bf16_r:                                                           \
     {                                                                                         \
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);                          \
     }                                                                                         \
@@ -0,0 +1,106 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_csr_pattern_hash.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csr_pattern_hash_device.h"
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csr_pattern_hash_template(rocsparse_handle     handle,
+                                                     J                    m,
+                                                     J                    n,
+                                                     I                    nnz,
+                                                     const I*             csr_row_ptr,
+                                                     const J*             csr_col_ind,
+                                                     rocsparse_index_base idx_base,
+                                                     uint64_t*            hash)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    uint64_t sum = 0;
+
+    if(m > 0)
+    {
+        uint64_t* dsum = nullptr;
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&dsum, sizeof(uint64_t), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(dsum, 0, sizeof(uint64_t), stream));
+
+#define HASH_DIM 256
+        int64_t size = static_cast<int64_t>(m) + 1 + nnz;
+        dim3    hash_blocks(std::min((size - 1) / HASH_DIM + 1, static_cast<int64_t>(1024)));
+        dim3    hash_threads(HASH_DIM);
+
+        hipLaunchKernelGGL((csr_pattern_hash_kernel<HASH_DIM>),
+                           hash_blocks,
+                           hash_threads,
+                           0,
+                           stream,
+                           m,
+                           nnz,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           idx_base,
+                           dsum);
+#undef HASH_DIM
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&sum, dsum, sizeof(uint64_t), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(dsum, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    // Combine with the matrix dimensions
+    const uint64_t dims[4] = {static_cast<uint64_t>(m),
+                              static_cast<uint64_t>(n),
+                              static_cast<uint64_t>(nnz),
+                              static_cast<uint64_t>(idx_base)};
+
+    uint64_t h = rocsparse_hash_mix(sum);
+    for(uint64_t i = 0; i < 4; ++i)
+    {
+        h = rocsparse_hash_mix(h ^ rocsparse_hash_entry(2, i, dims[i]));
+    }
+
+    *hash = h;
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                                \
+    template rocsparse_status rocsparse_csr_pattern_hash_template<ITYPE, JTYPE>( \
+        rocsparse_handle     handle,                                             \
+        JTYPE                m,                                                  \
+        JTYPE                n,                                                  \
+        ITYPE                nnz,                                                \
+        const ITYPE*         csr_row_ptr,                                        \
+        const JTYPE*         csr_col_ind,                                        \
+        rocsparse_index_base idx_base,                                           \
+        uint64_t*            hash);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
@@ -0,0 +1,42 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+/********************************************************************************
+ * \brief Compute a 64-bit fingerprint of the sparsity pattern (m, n, nnz,
+ * csr_row_ptr, csr_col_ind and index base) of a CSR matrix on the device. The
+ * fingerprint is written to host memory, the stream is synchronized.
+ *******************************************************************************/
+template <typename I, typename J>
+rocsparse_status rocsparse_csr_pattern_hash_template(rocsparse_handle     handle,
+                                                     J                    m,
+                                                     J                    n,
+                                                     I                    nnz,
+                                                     const I*             csr_row_ptr,
+                                                     const J*             csr_col_ind,
+                                                     rocsparse_index_base idx_base,
+                                                     uint64_t*            hash);
@@ -0,0 +1,1192 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_mat_info_serialize.hpp"
+#include "definitions.h"
+#include "rocsparse_csr_pattern_hash.hpp"
+#include "utility.h"
+
+#include <cstring>
+
+namespace
+{
+    // "RSPINFO" followed by the format version
+    constexpr uint64_t s_magic   = 0x4f464e4950535200ULL;
+    constexpr uint32_t s_version = 2;
+
+    // Header of the exported buffer
+    struct header_t
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t index_type_I;
+        uint32_t index_type_J;
+        uint32_t idx_base;
+        int64_t  m;
+        int64_t  n;
+        int64_t  nnz;
+        uint64_t pattern_hash;
+        uint64_t payload_size;
+        uint64_t payload_checksum;
+    };
+
+    // Records of the payload
+    enum record_t : uint32_t
+    {
+        record_end        = 0,
+        record_csrmv      = 1,
+        record_trm        = 2,
+        record_zero_pivot = 3
+    };
+
+    // Triangular meta data of the matrix info, in serialization order. Slots
+    // sharing their meta data are serialized once.
+    rocsparse_trm_info _rocsparse_mat_info::*const s_trm_slots[] = {
+        &_rocsparse_mat_info::bsrsv_upper_info,  &_rocsparse_mat_info::bsrsv_lower_info,
+        &_rocsparse_mat_info::bsrsvt_upper_info, &_rocsparse_mat_info::bsrsvt_lower_info,
+        &_rocsparse_mat_info::bsric0_info,       &_rocsparse_mat_info::bsrilu0_info,
+        &_rocsparse_mat_info::bsrsm_upper_info,  &_rocsparse_mat_info::bsrsm_lower_info,
+        &_rocsparse_mat_info::bsrsmt_upper_info, &_rocsparse_mat_info::bsrsmt_lower_info,
+        &_rocsparse_mat_info::csric0_info,       &_rocsparse_mat_info::csrilu0_info,
+        &_rocsparse_mat_info::csrsv_upper_info,  &_rocsparse_mat_info::csrsv_lower_info,
+        &_rocsparse_mat_info::csrsvt_upper_info, &_rocsparse_mat_info::csrsvt_lower_info,
+        &_rocsparse_mat_info::csrsm_upper_info,  &_rocsparse_mat_info::csrsm_lower_info,
+        &_rocsparse_mat_info::csrsmt_upper_info, &_rocsparse_mat_info::csrsmt_lower_info};
+
+    constexpr int32_t s_num_trm_slots = sizeof(s_trm_slots) / sizeof(s_trm_slots[0]);
+
+    // First slot holding CSR meta data
+    constexpr int32_t s_first_csr_trm_slot = 10;
+
+    template <typename I>
+    rocsparse_indextype index_type()
+    {
+        return (sizeof(I) == sizeof(uint16_t))
+                   ? rocsparse_indextype_u16
+                   : ((sizeof(I) == sizeof(int32_t)) ? rocsparse_indextype_i32
+                                                     : rocsparse_indextype_i64);
+    }
+
+    size_t index_type_size(rocsparse_indextype type)
+    {
+        switch(type)
+        {
+        case rocsparse_indextype_u16:
+        {
+            return sizeof(uint16_t);
+        }
+        case rocsparse_indextype_i32:
+        {
+            return sizeof(int32_t);
+        }
+        case rocsparse_indextype_i64:
+        {
+            return sizeof(int64_t);
+        }
+        }
+        return 0;
+    }
+
+    // 64-bit FNV-1a checksum of the payload
+    uint64_t checksum(const char* data, size_t size)
+    {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for(size_t i = 0; i < size; ++i)
+        {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    // Serializes scalars and device arrays, or only counts their size if no
+    // destination is given. Device arrays are copied on the stream.
+    class writer_t
+    {
+    public:
+        writer_t(char* data, hipStream_t stream)
+            : data(data)
+            , stream(stream)
+        {
+        }
+
+        size_t size() const
+        {
+            return pos;
+        }
+
+        template <typename T>
+        void scalar(T value)
+        {
+            if(data != nullptr)
+            {
+                std::memcpy(data + pos, &value, sizeof(T));
+            }
+            pos += sizeof(T);
+        }
+
+        rocsparse_status array(const void* ptr, size_t bytes)
+        {
+            scalar<uint8_t>(ptr != nullptr);
+
+            if(ptr == nullptr)
+            {
+                return rocsparse_status_success;
+            }
+
+            scalar<uint64_t>(bytes);
+
+            if(data != nullptr && bytes > 0)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipMemcpyAsync(data + pos, ptr, bytes, hipMemcpyDeviceToHost, stream));
+            }
+            pos += bytes;
+
+            return rocsparse_status_success;
+        }
+
+    private:
+        char*       data{};
+        size_t      pos{};
+        hipStream_t stream{};
+    };
+
+    // Deserializes scalars and device arrays, checking the bounds of the buffer.
+    // Device arrays are allocated and copied on the stream.
+    class reader_t
+    {
+    public:
+        reader_t(const char* data, size_t size, hipStream_t stream)
+            : data(data)
+            , size(size)
+            , stream(stream)
+        {
+        }
+
+        template <typename T>
+        rocsparse_status scalar(T& value)
+        {
+            if(size - pos < sizeof(T))
+            {
+                return rocsparse_status_invalid_value;
+            }
+            std::memcpy(&value, data + pos, sizeof(T));
+            pos += sizeof(T);
+
+            return rocsparse_status_success;
+        }
+
+        rocsparse_status array(void** ptr, size_t bytes)
+        {
+            uint8_t present;
+            RETURN_IF_ROCSPARSE_ERROR(scalar(present));
+
+            if(present == 0)
+            {
+                return rocsparse_status_success;
+            }
+
+            uint64_t stored_bytes;
+            RETURN_IF_ROCSPARSE_ERROR(scalar(stored_bytes));
+
+            if(stored_bytes != bytes || size - pos < bytes)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(ptr, std::max(bytes, size_t(1)), stream));
+
+            if(bytes > 0)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipMemcpyAsync(*ptr, data + pos, bytes, hipMemcpyHostToDevice, stream));
+            }
+            pos += bytes;
+
+            return rocsparse_status_success;
+        }
+
+    private:
+        const char* data{};
+        size_t      size{};
+        size_t      pos{};
+        hipStream_t stream{};
+    };
+
+    rocsparse_status serialize_csrmv_info(writer_t& writer, rocsparse_csrmv_info info)
+    {
+        size_t I_size = index_type_size(info->index_type_I);
+        size_t J_size = index_type_size(info->index_type_J);
+
+        writer.scalar<uint32_t>(record_csrmv);
+        writer.scalar<uint64_t>(info->size);
+        writer.scalar<int32_t>(info->trans);
+        writer.scalar<int64_t>(info->m);
+        writer.scalar<int64_t>(info->n);
+        writer.scalar<int64_t>(info->nnz);
+        writer.scalar<int64_t>(info->max_rows);
+
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->row_blocks, I_size * info->size));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->wg_flags, sizeof(unsigned int) * info->size));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->wg_ids, J_size * info->size));
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status deserialize_csrmv_info(reader_t&            reader,
+                                            rocsparse_indextype  index_type_I,
+                                            rocsparse_indextype  index_type_J,
+                                            rocsparse_csrmv_info info)
+    {
+        size_t I_size = index_type_size(index_type_I);
+        size_t J_size = index_type_size(index_type_J);
+
+        uint64_t size;
+        int32_t  trans;
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(size));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(trans));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->n));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->nnz));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->max_rows));
+
+        if(rocsparse_enum_utils::is_invalid(static_cast<rocsparse_operation>(trans)))
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        info->size         = size;
+        info->trans        = static_cast<rocsparse_operation>(trans);
+        info->index_type_I = index_type_I;
+        info->index_type_J = index_type_J;
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->row_blocks, I_size * size));
+        RETURN_IF_ROCSPARSE_ERROR(
+            reader.array((void**)&info->wg_flags, sizeof(unsigned int) * size));
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->wg_ids, J_size * size));
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status serialize_trm_info(writer_t& writer, rocsparse_trm_info info)
+    {
+        size_t I_size = index_type_size(info->index_type_I);
+        size_t J_size = index_type_size(info->index_type_J);
+
+        writer.scalar<int64_t>(info->max_nnz);
+        writer.scalar<int64_t>(info->m);
+        writer.scalar<int64_t>(info->nnz);
+
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->row_map, J_size * info->m));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->trm_diag_ind, I_size * info->m));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->trmt_perm, I_size * info->nnz));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->trmt_row_ptr, I_size * (info->m + 1)));
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->trmt_col_ind, J_size * info->nnz));
+
+        writer.scalar<int64_t>(info->nlevels);
+        writer.scalar<int64_t>(info->max_level_size);
+
+        RETURN_IF_ROCSPARSE_ERROR(writer.array(info->level_ptr, J_size * (info->nlevels + 1)));
+
+        if(info->level_ptr != nullptr)
+        {
+            for(int64_t l = 0; l <= info->nlevels; ++l)
+            {
+                writer.scalar<int64_t>(info->host_level_ptr[l]);
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status deserialize_trm_info(reader_t&           reader,
+                                          rocsparse_indextype index_type_I,
+                                          rocsparse_indextype index_type_J,
+                                          rocsparse_trm_info  info)
+    {
+        size_t I_size = index_type_size(index_type_I);
+        size_t J_size = index_type_size(index_type_J);
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->max_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->nnz));
+
+        if(info->m < 0 || info->nnz < 0)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        info->index_type_I = index_type_I;
+        info->index_type_J = index_type_J;
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->row_map, J_size * info->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->trm_diag_ind, I_size * info->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->trmt_perm, I_size * info->nnz));
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->trmt_row_ptr, I_size * (info->m + 1)));
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->trmt_col_ind, J_size * info->nnz));
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->nlevels));
+        RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->max_level_size));
+
+        if(info->nlevels < 0 || info->nlevels > info->m)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.array(&info->level_ptr, J_size * (info->nlevels + 1)));
+
+        if(info->level_ptr != nullptr)
+        {
+            info->host_level_ptr.resize(info->nlevels + 1);
+
+            for(int64_t l = 0; l <= info->nlevels; ++l)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(reader.scalar(info->host_level_ptr[l]));
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Serialize all the analysis data of the matrix info
+    rocsparse_status serialize_mat_info(writer_t& writer, rocsparse_mat_info info)
+    {
+        rocsparse_indextype index_type_J = rocsparse_indextype_u16;
+
+        if(info->csrmv_info != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(serialize_csrmv_info(writer, info->csrmv_info));
+        }
+
+        for(int32_t slot = 0; slot < s_num_trm_slots; ++slot)
+        {
+            rocsparse_trm_info trm = info->*s_trm_slots[slot];
+
+            if(trm == nullptr)
+            {
+                continue;
+            }
+
+            index_type_J = trm->index_type_J;
+
+            // Shared meta data refers to the first slot holding it
+            int32_t alias = -1;
+            for(int32_t prev = 0; prev < slot; ++prev)
+            {
+                if(info->*s_trm_slots[prev] == trm)
+                {
+                    alias = prev;
+                    break;
+                }
+            }
+
+            writer.scalar<uint32_t>(record_trm);
+            writer.scalar<int32_t>(slot);
+            writer.scalar<int32_t>(alias);
+
+            if(alias < 0)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(serialize_trm_info(writer, trm));
+            }
+        }
+
+        // zero pivot for csrsv, csrsm, csrilu0, csric0
+        if(info->zero_pivot != nullptr)
+        {
+            writer.scalar<uint32_t>(record_zero_pivot);
+            RETURN_IF_ROCSPARSE_ERROR(
+                writer.array(info->zero_pivot, index_type_size(index_type_J)));
+        }
+
+        writer.scalar<uint32_t>(record_end);
+
+        return rocsparse_status_success;
+    }
+
+    // Deserialize the analysis data into an empty matrix info
+    rocsparse_status deserialize_mat_info(reader_t&           reader,
+                                          rocsparse_indextype index_type_I,
+                                          rocsparse_indextype index_type_J,
+                                          rocsparse_mat_info  info)
+    {
+        while(true)
+        {
+            uint32_t record;
+            RETURN_IF_ROCSPARSE_ERROR(reader.scalar(record));
+
+            switch(record)
+            {
+            case record_end:
+            {
+                return rocsparse_status_success;
+            }
+
+            case record_csrmv:
+            {
+                if(info->csrmv_info != nullptr)
+                {
+                    return rocsparse_status_invalid_value;
+                }
+
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
+                RETURN_IF_ROCSPARSE_ERROR(
+                    deserialize_csrmv_info(reader, index_type_I, index_type_J, info->csrmv_info));
+                break;
+            }
+
+            case record_trm:
+            {
+                int32_t slot;
+                int32_t alias;
+                RETURN_IF_ROCSPARSE_ERROR(reader.scalar(slot));
+                RETURN_IF_ROCSPARSE_ERROR(reader.scalar(alias));
+
+                if(slot < 0 || slot >= s_num_trm_slots || alias >= slot
+                   || info->*s_trm_slots[slot] != nullptr)
+                {
+                    return rocsparse_status_invalid_value;
+                }
+
+                if(alias >= 0)
+                {
+                    if(info->*s_trm_slots[alias] == nullptr)
+                    {
+                        return rocsparse_status_invalid_value;
+                    }
+
+                    info->*s_trm_slots[slot] = info->*s_trm_slots[alias];
+                }
+                else
+                {
+                    rocsparse_trm_info& trm = info->*s_trm_slots[slot];
+
+                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&trm));
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        deserialize_trm_info(reader, index_type_I, index_type_J, trm));
+                }
+                break;
+            }
+
+            case record_zero_pivot:
+            {
+                if(info->zero_pivot != nullptr)
+                {
+                    return rocsparse_status_invalid_value;
+                }
+
+                RETURN_IF_ROCSPARSE_ERROR(
+                    reader.array(&info->zero_pivot, index_type_size(index_type_J)));
+                break;
+            }
+
+            default:
+            {
+                return rocsparse_status_invalid_value;
+            }
+            }
+        }
+    }
+
+    // Check that the analysis data has been computed for the given matrix
+    template <typename I, typename J>
+    rocsparse_status
+        check_mat_info(rocsparse_handle handle, J m, J n, I nnz, const rocsparse_mat_info info)
+    {
+        if(info->csrmv_info != nullptr)
+        {
+            if(info->csrmv_info->index_type_I != index_type<I>()
+               || info->csrmv_info->index_type_J != index_type<J>())
+            {
+                log_debug(handle, "csrmv analysis data has been computed for other index types.");
+                return rocsparse_status_invalid_value;
+            }
+
+            if(info->csrmv_info->m != m || info->csrmv_info->n != n
+               || info->csrmv_info->nnz != nnz)
+            {
+                log_debug(handle, "csrmv analysis data has been computed for another matrix.");
+                return rocsparse_status_invalid_size;
+            }
+        }
+
+        for(int32_t slot = 0; slot < s_num_trm_slots; ++slot)
+        {
+            rocsparse_trm_info trm = info->*s_trm_slots[slot];
+
+            if(trm == nullptr)
+            {
+                continue;
+            }
+
+            if(trm->index_type_I != index_type<I>() || trm->index_type_J != index_type<J>())
+            {
+                log_debug(handle, "Analysis data has been computed for other index types.");
+                return rocsparse_status_invalid_value;
+            }
+
+            if(slot >= s_first_csr_trm_slot && (trm->m != m || trm->nnz != nnz))
+            {
+                log_debug(handle, "Analysis data has been computed for another matrix.");
+                return rocsparse_status_invalid_size;
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+}
+
+rocsparse_status rocsparse_mat_info_export_size(rocsparse_handle         handle,
+                                               const rocsparse_mat_info info,
+                                               size_t*                  buffer_size)
+{
+    // Wait for a pending device analysis
+    if(info->csrmv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_csrmv_info_size(info->csrmv_info, true));
+    }
+
+    writer_t writer(nullptr, handle->stream);
+    RETURN_IF_ROCSPARSE_ERROR(serialize_mat_info(writer, info));
+
+    *buffer_size = sizeof(header_t) + writer.size();
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_mat_info_export_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    const rocsparse_mat_info  info,
+                                                    size_t                    buffer_size,
+                                                    void*                     buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    RETURN_IF_ROCSPARSE_ERROR(check_mat_info(handle, m, n, nnz, info));
+
+    size_t required_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_export_size(handle, info, &required_size));
+
+    if(buffer_size < required_size)
+    {
+        log_debug(handle, "Buffer is too small to hold the analysis data.");
+        return rocsparse_status_invalid_size;
+    }
+
+    header_t header{};
+    header.magic        = s_magic;
+    header.version      = s_version;
+    header.index_type_I = index_type<I>();
+    header.index_type_J = index_type<J>();
+    header.idx_base     = descr->base;
+    header.m            = m;
+    header.n            = n;
+    header.nnz          = nnz;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+        handle, m, n, nnz, csr_row_ptr, csr_col_ind, descr->base, &header.pattern_hash));
+
+    char*    payload = static_cast<char*>(buffer) + sizeof(header_t);
+    writer_t writer(payload, stream);
+    RETURN_IF_ROCSPARSE_ERROR(serialize_mat_info(writer, info));
+
+    // Wait for the device arrays
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    header.payload_size     = writer.size();
+    header.payload_checksum = checksum(payload, writer.size());
+
+    std::memcpy(buffer, &header, sizeof(header_t));
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_mat_info_import_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    size_t                    buffer_size,
+                                                    const void*               buffer,
+                                                    bool*                     imported)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    header_t header;
+
+    if(buffer_size < sizeof(header_t))
+    {
+        log_debug(handle, "Buffer is too small to hold analysis data.");
+        return rocsparse_status_invalid_size;
+    }
+
+    std::memcpy(&header, buffer, sizeof(header_t));
+
+    if(header.magic != s_magic || header.version != s_version)
+    {
+        log_debug(handle, "Buffer does not hold analysis data of this rocSPARSE version.");
+        return rocsparse_status_invalid_value;
+    }
+
+    const char* payload = static_cast<const char*>(buffer) + sizeof(header_t);
+
+    if(header.payload_size > buffer_size - sizeof(header_t)
+       || header.payload_checksum != checksum(payload, header.payload_size))
+    {
+        log_debug(handle, "Analysis data is corrupted.");
+        return rocsparse_status_invalid_value;
+    }
+
+    if(header.index_type_I != index_type<I>() || header.index_type_J != index_type<J>())
+    {
+        log_debug(handle, "Analysis data has been exported for other index types.");
+        return rocsparse_status_invalid_value;
+    }
+
+    if(header.m != m || header.n != n || header.nnz != nnz)
+    {
+        log_debug(handle, "Analysis data has been exported for another matrix size.");
+        return rocsparse_status_invalid_size;
+    }
+
+    if(header.idx_base != static_cast<uint32_t>(descr->base))
+    {
+        log_debug(handle, "Analysis data has been exported for another index base.");
+        return rocsparse_status_invalid_value;
+    }
+
+    // The sparsity pattern must match the one of the exported analysis
+    uint64_t pattern_hash;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash_template(
+        handle, m, n, nnz, csr_row_ptr, csr_col_ind, descr->base, &pattern_hash));
+
+    if(pattern_hash != header.pattern_hash)
+    {
+        log_debug(handle, "Analysis data has been exported for another sparsity pattern.");
+        return rocsparse_status_invalid_value;
+    }
+
+    // Deserialize into a new matrix info, such that info is left unchanged on failure
+    rocsparse_mat_info tmp;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&tmp));
+
+    reader_t         reader(payload, header.payload_size, stream);
+    rocsparse_status status = deserialize_mat_info(reader, index_type<I>(), index_type<J>(), tmp);
+
+    // Wait for the device arrays, the buffer may be released after returning
+    hipError_t hip_status = hipStreamSynchronize(stream);
+
+    if(status == rocsparse_status_success && hip_status != hipSuccess)
+    {
+        status = get_rocsparse_status_for_hip_status(hip_status);
+    }
+
+    if(status != rocsparse_status_success)
+    {
+        log_debug(handle, "Analysis data is invalid.");
+        rocsparse_destroy_mat_info(tmp);
+        return status;
+    }
+
+    // Bind the analysis data to the matrix
+    bool any = false;
+
+    if(tmp->csrmv_info != nullptr)
+    {
+        tmp->csrmv_info->descr       = descr;
+        tmp->csrmv_info->csr_row_ptr = csr_row_ptr;
+        tmp->csrmv_info->csr_col_ind = csr_col_ind;
+
+        any = true;
+    }
+
+    for(int32_t slot = 0; slot < s_num_trm_slots; ++slot)
+    {
+        rocsparse_trm_info trm = tmp->*s_trm_slots[slot];
+
+        if(trm == nullptr)
+        {
+            continue;
+        }
+
+        trm->descr = descr;
+        trm->trm_row_ptr
+            = (trm->trmt_row_ptr != nullptr) ? trm->trmt_row_ptr : (const void*)csr_row_ptr;
+        trm->trm_col_ind
+            = (trm->trmt_col_ind != nullptr) ? trm->trmt_col_ind : (const void*)csr_col_ind;
+
+        any = true;
+    }
+
+    // Exchange the analysis data of info, the previous one is released with tmp
+    std::swap(info->csrmv_info, tmp->csrmv_info);
+    for(int32_t slot = 0; slot < s_num_trm_slots; ++slot)
+    {
+        std::swap(info->*s_trm_slots[slot], tmp->*s_trm_slots[slot]);
+    }
+    std::swap(info->zero_pivot, tmp->zero_pivot);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(tmp));
+
+    if(imported != nullptr)
+    {
+        *imported = any;
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                               \
+    template rocsparse_status rocsparse_mat_info_export_template<ITYPE, JTYPE>( \
+        rocsparse_handle          handle,                                       \
+        JTYPE                     m,                                            \
+        JTYPE                     n,                                            \
+        ITYPE                     nnz,                                          \
+        const rocsparse_mat_descr descr,                                        \
+        const ITYPE*              csr_row_ptr,                                  \
+        const JTYPE*              csr_col_ind,                                  \
+        const rocsparse_mat_info  info,                                         \
+        size_t                    buffer_size,                                  \
+        void*                     buffer);                                      \
+    template rocsparse_status rocsparse_mat_info_import_template<ITYPE, JTYPE>( \
+        rocsparse_handle          handle,                                       \
+        JTYPE                     m,                                            \
+        JTYPE                     n,                                            \
+        ITYPE                     nnz,                                          \
+        const rocsparse_mat_descr descr,                                        \
+        const ITYPE*              csr_row_ptr,                                  \
+        const JTYPE*              csr_col_ind,                                  \
+        rocsparse_mat_info        info,                                         \
+        size_t                    buffer_size,                                  \
+        const void*               buffer,                                       \
+        bool*                     imported);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
+
+template <typename I, typename J>
+static rocsparse_status rocsparse_csr_export_mat_info_impl(rocsparse_handle          handle,
+                                                           J                         m,
+                                                           J                         n,
+                                                           I                         nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const I*                  csr_row_ptr,
+                                                           const J*                  csr_col_ind,
+                                                           const rocsparse_mat_info  info,
+                                                           size_t                    buffer_size,
+                                                           void*                     buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr_export_mat_info",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              buffer_size,
+              (const void*&)buffer);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(descr == nullptr || info == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if((m > 0 && csr_row_ptr == nullptr) || (nnz > 0 && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_mat_info_export_template(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer);
+}
+
+template <typename I, typename J>
+static rocsparse_status rocsparse_csr_import_mat_info_impl(rocsparse_handle          handle,
+                                                           J                         m,
+                                                           J                         n,
+                                                           I                         nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const I*                  csr_row_ptr,
+                                                           const J*                  csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           size_t                    buffer_size,
+                                                           const void*               buffer,
+                                                           bool*                     imported)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr_import_mat_info",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              buffer_size,
+              (const void*&)buffer);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(descr == nullptr || info == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if((m > 0 && csr_row_ptr == nullptr) || (nnz > 0 && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_mat_info_import_template(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer, imported);
+}
+
+template <typename I, typename J>
+static rocsparse_status
+    rocsparse_spmat_export_analysis_template(rocsparse_handle            handle,
+                                             rocsparse_const_spmat_descr mat,
+                                             size_t                      buffer_size,
+                                             void*                       buffer)
+{
+    return rocsparse_mat_info_export_template(handle,
+                                              (J)mat->rows,
+                                              (J)mat->cols,
+                                              (I)mat->nnz,
+                                              mat->descr,
+                                              (const I*)mat->const_row_data,
+                                              (const J*)mat->const_col_data,
+                                              mat->info,
+                                              buffer_size,
+                                              buffer);
+}
+
+template <typename I, typename J>
+static rocsparse_status
+    rocsparse_spmat_import_analysis_template(rocsparse_handle      handle,
+                                             rocsparse_spmat_descr mat,
+                                             size_t                buffer_size,
+                                             const void*           buffer)
+{
+    bool imported = false;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_import_template(handle,
+                                                                 (J)mat->rows,
+                                                                 (J)mat->cols,
+                                                                 (I)mat->nnz,
+                                                                 mat->descr,
+                                                                 (const I*)mat->const_row_data,
+                                                                 (const J*)mat->const_col_data,
+                                                                 mat->info,
+                                                                 buffer_size,
+                                                                 buffer,
+                                                                 &imported));
+
+    // Skip the analysis of the preprocess stages
+    if(imported)
+    {
+        mat->analysed = true;
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_export_mat_info_buffer_size(
+    rocsparse_handle handle, const rocsparse_mat_info info, size_t* buffer_size)
+try
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_export_mat_info_buffer_size",
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check pointer arguments
+    if(info == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_mat_info_export_size(handle, info, buffer_size);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_csr_export_mat_info(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          const rocsparse_mat_info  info,
+                                                          size_t                    buffer_size,
+                                                          void*                     buffer)
+try
+{
+    return rocsparse_csr_export_mat_info_impl(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer_size, buffer);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_csr_import_mat_info(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          size_t                    buffer_size,
+                                                          const void*               buffer)
+try
+{
+    return rocsparse_csr_import_mat_info_impl(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              buffer_size,
+                                              buffer,
+                                              (bool*)nullptr);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_spmat_export_analysis_buffer_size(
+    rocsparse_handle handle, rocsparse_const_spmat_descr mat, size_t* buffer_size)
+try
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmat_export_analysis_buffer_size",
+              (const void*&)mat,
+              (const void*&)buffer_size);
+
+    // Check pointer arguments
+    if(mat == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor is initialized
+    if(mat->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    return rocsparse_mat_info_export_size(handle, mat->info, buffer_size);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_spmat_export_analysis(rocsparse_handle            handle,
+                                                            rocsparse_const_spmat_descr mat,
+                                                            size_t                      buffer_size,
+                                                            void*                       buffer)
+try
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmat_export_analysis",
+              (const void*&)mat,
+              buffer_size,
+              (const void*&)buffer);
+
+    // Check pointer arguments
+    if(mat == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor is initialized
+    if(mat->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Only the analysis data of CSR matrices can be exported
+    if(mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mat->row_type == rocsparse_indextype_i32 && mat->col_type == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmat_export_analysis_template<int32_t, int32_t>(
+            handle, mat, buffer_size, buffer);
+    }
+    if(mat->row_type == rocsparse_indextype_i64 && mat->col_type == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmat_export_analysis_template<int64_t, int32_t>(
+            handle, mat, buffer_size, buffer);
+    }
+    if(mat->row_type == rocsparse_indextype_i64 && mat->col_type == rocsparse_indextype_i64)
+    {
+        return rocsparse_spmat_export_analysis_template<int64_t, int64_t>(
+            handle, mat, buffer_size, buffer);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+extern "C" rocsparse_status rocsparse_spmat_import_analysis(rocsparse_handle      handle,
+                                                            rocsparse_spmat_descr mat,
+                                                            size_t                buffer_size,
+                                                            const void*           buffer)
+try
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmat_import_analysis",
+              (const void*&)mat,
+              buffer_size,
+              (const void*&)buffer);
+
+    // Check pointer arguments
+    if(mat == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor is initialized
+    if(mat->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Only the analysis data of CSR matrices can be imported
+    if(mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mat->row_type == rocsparse_indextype_i32 && mat->col_type == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmat_import_analysis_template<int32_t, int32_t>(
+            handle, mat, buffer_size, buffer);
+    }
+    if(mat->row_type == rocsparse_indextype_i64 && mat->col_type == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmat_import_analysis_template<int64_t, int32_t>(
+            handle, mat, buffer_size, buffer);
+    }
+    if(mat->row_type == rocsparse_indextype_i64 && mat->col_type == rocsparse_indextype_i64)
+    {
+        return rocsparse_spmat_import_analysis_template<int64_t, int64_t>(
+            handle, mat, buffer_size, buffer);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
@@ -0,0 +1,70 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+/********************************************************************************
+ * \brief Number of bytes required to export the analysis data of a matrix info
+ * structure.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_export_size(rocsparse_handle         handle,
+                                               const rocsparse_mat_info info,
+                                               size_t*                  buffer_size);
+
+/********************************************************************************
+ * \brief Export the analysis data of a matrix info structure to host memory,
+ * together with the fingerprint of the sparsity pattern it was computed for.
+ *******************************************************************************/
+template <typename I, typename J>
+rocsparse_status rocsparse_mat_info_export_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    const rocsparse_mat_info  info,
+                                                    size_t                    buffer_size,
+                                                    void*                     buffer);
+
+/********************************************************************************
+ * \brief Import the analysis data of a matrix info structure from host memory,
+ * after checking that it has been exported for the same sparsity pattern. If
+ * imported is not nullptr, it is set to true if some analysis data has been
+ * imported.
+ *******************************************************************************/
+template <typename I, typename J>
+rocsparse_status rocsparse_mat_info_import_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    size_t                    buffer_size,
+                                                    const void*               buffer,
+                                                    bool*                     imported);
@@ -69,7 +69,9 @@ fi
 logname=dcsrmv_$(date +'%Y%m%d%H%M%S').log
 truncate -s 0 $logname
 
-# Run csrmv for all matrices available
+# Run csrmv for all matrices available, with the CSR adaptive, stream, binned and merge algorithms
 for filename in ./matrices/*.csr; do
-    $bench -f csrmv --precision d --device $dev --alpha 1 --beta 0 --iters 1000 --rocalution $filename 2>&1 | tee -a $logname
+    for alg in 2 3 8 9; do
+        $bench -f csrmv --spmv_alg $alg --precision d --device $dev --alpha 1 --beta 0 --iters 1000 --rocalution $filename 2>&1 | tee -a $logname
+    done
 done